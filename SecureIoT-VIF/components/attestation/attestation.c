@@ -0,0 +1,833 @@
+/**
+ * @file attestation.c
+ * @brief Rapports d'attestation signés et mis en cache (Community Edition)
+ *
+ * Une signature ECDSA par fenêtre de fraîcheur, par changement d'état ou
+ * par lot de défis nouveaux: le rapport signé est copié sous section
+ * critique pour chaque demande déjà couverte, la signature est sérialisée
+ * par un verrou dédié.
+ *
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include "esp_log.h"
+#include "esp_err.h"
+#include "esp_timer.h"
+#include "esp_ota_ops.h"
+#include "nvs.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "sdkconfig.h"
+#if CONFIG_ATTESTATION_UDP_RESPONDER
+#include <unistd.h>
+#include "lwip/sockets.h"
+#endif
+
+#include "attestation.h"
+#include "crypto_operations_basic.h"
+#include "integrity_manifest.h"
+#include "incident_manager.h"
+#include "boot_scheduler.h"
+
+static const char *TAG = "ATTESTATION_COMMUNITY";
+
+#define ATTESTATION_NVS_KEY_KEYPAIR     "key"
+#define ATTESTATION_NVS_KEY_BOOTS       "boots"
+
+// Options absentes sans CONFIG_ATTESTATION_ENABLE (aucune init: API inerte)
+#ifndef CONFIG_ATTESTATION_FRESHNESS_WINDOW_MS
+#define CONFIG_ATTESTATION_FRESHNESS_WINDOW_MS      (60000)
+#endif
+#ifndef CONFIG_ATTESTATION_MIN_RESIGN_INTERVAL_MS
+#define CONFIG_ATTESTATION_MIN_RESIGN_INTERVAL_MS   (5000)
+#endif
+#ifndef CONFIG_ATTESTATION_CHALLENGE_SIGNS_PER_MINUTE
+#define CONFIG_ATTESTATION_CHALLENGE_SIGNS_PER_MINUTE (12)
+#endif
+#ifndef CONFIG_ATTESTATION_BATCH_WINDOW_MS
+#define CONFIG_ATTESTATION_BATCH_WINDOW_MS          (100)
+#endif
+
+// Re-signature aux 3/4 de la fenêtre: le rapport en cache reste frais entre
+// deux passages de la maintenance, les demandes ne signent pas
+#define ATTESTATION_RENEW_AGE_MS        (CONFIG_ATTESTATION_FRESHNESS_WINDOW_MS / 4 * 3)
+
+// Seau à jetons des signatures sur défi (milli-jetons, comme incident_manager)
+#define ATTESTATION_TOKEN_MILLI         (1000)
+#define ATTESTATION_BUCKET_CAPACITY_MILLI \
+    (ATTESTATION_CHALLENGE_SIGN_BURST_COMMUNITY * ATTESTATION_TOKEN_MILLI)
+
+/**
+ * @brief Clé d'attestation persistée en NVS
+ */
+typedef struct {
+    uint8_t public_key[CRYPTO_BASIC_ECDSA_PUBLIC_KEY_SIZE];
+    uint8_t private_key[CRYPTO_BASIC_ECDSA_PRIVATE_KEY_SIZE];
+} attestation_key_blob_t;
+
+// ================================
+// Variables globales
+// ================================
+
+static bool attestation_initialized = false;
+static crypto_basic_keypair_t attestation_key;
+static uint32_t attestation_boot_count = 0;
+static uint32_t attestation_boot_reports = 0;   // Rapports signés depuis le démarrage
+
+// Signature sérialisée (tick, refresh et demande sur cache périmé)
+static SemaphoreHandle_t attestation_sign_mutex = NULL;
+static StaticSemaphore_t attestation_sign_mutex_buffer;
+
+// Rapport en cache et statistiques (copiés sous section critique)
+static portMUX_TYPE attestation_lock = portMUX_INITIALIZER_UNLOCKED;
+static attestation_response_t attestation_cached;
+static int64_t attestation_cached_at_us = 0;
+static bool attestation_cache_valid = false;
+static attestation_stats_t attestation_stats;
+static uint32_t attestation_sign_tokens_milli = 0;
+static uint32_t attestation_sign_refill_ms = 0;
+
+#if CONFIG_ATTESTATION_UDP_RESPONDER
+static TaskHandle_t attestation_responder_handle = NULL;
+static int attestation_socket = -1;
+
+/**
+ * @brief Demande UDP en attente du prochain lot
+ */
+typedef struct {
+    uint8_t challenge[ATTESTATION_NONCE_SIZE];
+    struct sockaddr_in source;
+    socklen_t source_len;
+} attestation_pending_t;
+#endif
+
+// ================================
+// Fonctions internes
+// ================================
+
+/**
+ * @brief Charge la clé d'attestation, ou la génère au premier démarrage
+ */
+static esp_err_t attestation_load_key(nvs_handle_t handle) {
+    attestation_key_blob_t blob;
+    size_t blob_size = sizeof(blob);
+
+    esp_err_t ret = nvs_get_blob(handle, ATTESTATION_NVS_KEY_KEYPAIR, &blob, &blob_size);
+    if (ret == ESP_OK && blob_size == sizeof(blob)) {
+        memcpy(attestation_key.public_key, blob.public_key, sizeof(blob.public_key));
+        attestation_key.public_key_len = sizeof(blob.public_key);
+        memcpy(attestation_key.private_key, blob.private_key, sizeof(blob.private_key));
+        attestation_key.private_key_len = sizeof(blob.private_key);
+        CRYPTO_BASIC_SECURE_ZERO(&blob, sizeof(blob));
+        return ESP_OK;
+    }
+    if (ret != ESP_OK && ret != ESP_ERR_NVS_NOT_FOUND) {
+        return ret;
+    }
+
+    // Hors barrière: chaque rapport signé porte ATTESTATION_FLAG_INTEGRITY_VERIFIED
+    ret = crypto_basic_generate_ecdsa_keypair_ungated(&attestation_key);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    memcpy(blob.public_key, attestation_key.public_key, sizeof(blob.public_key));
+    memcpy(blob.private_key, attestation_key.private_key, sizeof(blob.private_key));
+    ret = nvs_set_blob(handle, ATTESTATION_NVS_KEY_KEYPAIR, &blob, sizeof(blob));
+    CRYPTO_BASIC_SECURE_ZERO(&blob, sizeof(blob));
+    if (ret == ESP_OK) {
+        ret = nvs_commit(handle);
+    }
+    if (ret == ESP_OK) {
+        ESP_LOGI(TAG, "🔑 Clé d'attestation générée et enregistrée");
+    }
+    return ret;
+}
+
+/**
+ * @brief Incrémente le compteur persistant de démarrages
+ */
+static esp_err_t attestation_count_boot(nvs_handle_t handle) {
+    uint32_t boots = 0;
+    esp_err_t ret = nvs_get_u32(handle, ATTESTATION_NVS_KEY_BOOTS, &boots);
+    if (ret != ESP_OK && ret != ESP_ERR_NVS_NOT_FOUND) {
+        return ret;
+    }
+
+    boots++;
+    ret = nvs_set_u32(handle, ATTESTATION_NVS_KEY_BOOTS, boots);
+    if (ret == ESP_OK) {
+        ret = nvs_commit(handle);
+    }
+    if (ret == ESP_OK) {
+        attestation_boot_count = boots;
+    }
+    return ret;
+}
+
+/**
+ * @brief Agrège l'état attesté (sans séquence ni signature)
+ */
+static void attestation_collect_state(attestation_report_t *report) {
+    memset(report, 0, sizeof(*report));
+    report->magic = ATTESTATION_REPORT_MAGIC;
+    report->version = ATTESTATION_REPORT_VERSION;
+    report->boot_count = attestation_boot_count;
+
+    if (boot_gate_is_open(BOOT_GATE_INTEGRITY_VERIFIED)) {
+        report->flags |= ATTESTATION_FLAG_INTEGRITY_VERIFIED;
+    }
+
+    if (integrity_manifest_get_state() == INTEGRITY_MANIFEST_READY &&
+        integrity_manifest_get_root(report->manifest_root) == ESP_OK) {
+        report->flags |= ATTESTATION_FLAG_MANIFEST_READY;
+        report->manifest_chunks = (uint16_t)integrity_manifest_get_chunk_count();
+    }
+
+    const esp_app_desc_t *app_desc = esp_ota_get_app_description();
+    if (app_desc != NULL) {
+        memcpy(report->app_elf_sha256, app_desc->app_elf_sha256, sizeof(report->app_elf_sha256));
+    }
+
+    incident_stats_t incidents;
+    if (incident_get_stats(&incidents) == ESP_OK) {
+        report->incidents_total = incidents.total_incidents;
+        report->integrity_failures = incidents.integrity_failures;
+        report->anomalies_handled = incidents.anomalies_handled;
+        report->security_violations = incidents.security_violations;
+    }
+}
+
+/**
+ * @brief Compare l'état attesté de deux rapports (hors séquence, uptime et défis)
+ */
+static bool attestation_state_equal(const attestation_report_t *a, const attestation_report_t *b) {
+    return a->flags == b->flags &&
+           a->manifest_chunks == b->manifest_chunks &&
+           a->incidents_total == b->incidents_total &&
+           a->integrity_failures == b->integrity_failures &&
+           a->anomalies_handled == b->anomalies_handled &&
+           a->security_violations == b->security_violations &&
+           memcmp(a->app_elf_sha256, b->app_elf_sha256, sizeof(a->app_elf_sha256)) == 0 &&
+           memcmp(a->manifest_root, b->manifest_root, sizeof(a->manifest_root)) == 0;
+}
+
+/**
+ * @brief Le défi figure-t-il dans la partie signée du rapport ?
+ */
+static bool attestation_report_has_challenge(const attestation_report_t *report, const uint8_t *challenge) {
+    for (size_t i = 0; i < report->challenge_count; i++) {
+        if (memcmp(report->challenges[i], challenge, ATTESTATION_NONCE_SIZE) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Cache frais (< max_age_ms) et couvrant tous les défis (sous attestation_lock)
+ */
+static bool attestation_cache_covers_locked(int64_t max_age_ms,
+                                            const uint8_t (*challenges)[ATTESTATION_NONCE_SIZE],
+                                            size_t challenge_count) {
+    if (!attestation_cache_valid ||
+        (esp_timer_get_time() - attestation_cached_at_us) / 1000 >= max_age_ms) {
+        return false;
+    }
+    for (size_t i = 0; i < challenge_count; i++) {
+        if (!attestation_report_has_challenge(&attestation_cached.report, challenges[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Consomme un jeton de signature sur défi (sous attestation_lock)
+ *
+ * L'horloge du seau n'avance que du temps converti en milli-jetons.
+ */
+static bool attestation_take_sign_token_locked(void) {
+    uint32_t now_ms = (uint32_t)(esp_timer_get_time() / 1000);
+    uint32_t elapsed_ms = now_ms - attestation_sign_refill_ms;
+    uint64_t refill = (uint64_t)elapsed_ms * CONFIG_ATTESTATION_CHALLENGE_SIGNS_PER_MINUTE *
+                      ATTESTATION_TOKEN_MILLI / 60000;
+    uint64_t tokens = attestation_sign_tokens_milli + refill;
+
+    if (tokens >= ATTESTATION_BUCKET_CAPACITY_MILLI) {
+        attestation_sign_tokens_milli = ATTESTATION_BUCKET_CAPACITY_MILLI;
+        attestation_sign_refill_ms = now_ms;
+    } else {
+        attestation_sign_tokens_milli = (uint32_t)tokens;
+        attestation_sign_refill_ms += (uint32_t)(refill * 60000 /
+            ((uint64_t)CONFIG_ATTESTATION_CHALLENGE_SIGNS_PER_MINUTE * ATTESTATION_TOKEN_MILLI));
+    }
+
+    if (attestation_sign_tokens_milli < ATTESTATION_TOKEN_MILLI) {
+        return false;
+    }
+    attestation_sign_tokens_milli -= ATTESTATION_TOKEN_MILLI;
+    return true;
+}
+
+/**
+ * @brief Âge du rapport en cache (ms), -1 si aucun rapport
+ */
+static int64_t attestation_cache_age_ms(void) {
+    int64_t age_ms = -1;
+    portENTER_CRITICAL(&attestation_lock);
+    if (attestation_cache_valid) {
+        age_ms = (esp_timer_get_time() - attestation_cached_at_us) / 1000;
+    }
+    portEXIT_CRITICAL(&attestation_lock);
+    return age_ms;
+}
+
+/**
+ * @brief Signe un nouveau rapport et remplace le cache
+ *
+ * Les défis fournis sont placés en tête, puis les défis du rapport en
+ * cache complètent les places libres: une re-signature ne retire pas à un
+ * vérificateur le défi de son époque.
+ *
+ * @param max_age_ms Ne signe pas si le cache a moins de max_age_ms et couvre
+ *                   les défis une fois le verrou obtenu (signature concurrente),
+ *                   -1 pour forcer
+ * @param on_change Signature déclenchée par un changement d'état
+ * @param challenges Défis à inclure (ATTESTATION_MAX_CHALLENGES au plus)
+ * @param challenge_count Nombre de défis
+ */
+static esp_err_t attestation_sign(int64_t max_age_ms, bool on_change,
+                                  const uint8_t (*challenges)[ATTESTATION_NONCE_SIZE],
+                                  size_t challenge_count) {
+    xSemaphoreTake(attestation_sign_mutex, portMAX_DELAY);
+
+    static attestation_response_t fresh;
+    static attestation_report_t previous;
+    bool covered;
+    bool had_previous;
+    portENTER_CRITICAL(&attestation_lock);
+    covered = max_age_ms >= 0 && attestation_cache_covers_locked(max_age_ms, challenges, challenge_count);
+    had_previous = attestation_cache_valid;
+    previous = attestation_cached.report;
+    portEXIT_CRITICAL(&attestation_lock);
+    if (covered) {
+        xSemaphoreGive(attestation_sign_mutex);
+        return ESP_OK;
+    }
+
+    attestation_collect_state(&fresh.report);
+    fresh.report.sequence = ((uint64_t)attestation_boot_count << 32) | (attestation_boot_reports + 1);
+
+    size_t new_challenges = 0;
+    for (size_t i = 0; i < challenge_count; i++) {
+        if (!attestation_report_has_challenge(&fresh.report, challenges[i])) {
+            memcpy(fresh.report.challenges[fresh.report.challenge_count++], challenges[i],
+                   ATTESTATION_NONCE_SIZE);
+            if (!had_previous || !attestation_report_has_challenge(&previous, challenges[i])) {
+                new_challenges++;
+            }
+        }
+    }
+    for (size_t i = 0; had_previous && i < previous.challenge_count &&
+                       fresh.report.challenge_count < ATTESTATION_MAX_CHALLENGES; i++) {
+        if (!attestation_report_has_challenge(&fresh.report, previous.challenges[i])) {
+            memcpy(fresh.report.challenges[fresh.report.challenge_count++], previous.challenges[i],
+                   ATTESTATION_NONCE_SIZE);
+        }
+    }
+
+    int64_t start_us = esp_timer_get_time();
+    fresh.report.uptime_s = (uint32_t)(start_us / 1000000);
+
+    uint8_t hash[CRYPTO_BASIC_SHA256_SIZE];
+    esp_err_t ret = crypto_basic_sha256((const uint8_t *)&fresh.report, sizeof(fresh.report), hash);
+    if (ret == ESP_OK) {
+        fresh.signature_len = sizeof(fresh.signature);
+        ret = crypto_basic_ecdsa_sign_ungated(&attestation_key, hash, sizeof(hash),
+                                              fresh.signature, &fresh.signature_len);
+    }
+    int64_t end_us = esp_timer_get_time();
+    uint32_t sign_time_us = (uint32_t)(end_us - start_us);
+
+    portENTER_CRITICAL(&attestation_lock);
+    if (ret == ESP_OK) {
+        attestation_cached = fresh;
+        attestation_cached_at_us = end_us;
+        attestation_cache_valid = true;
+        attestation_stats.reports_signed++;
+        if (on_change) {
+            attestation_stats.resigns_on_change++;
+        }
+        if (new_challenges > 0) {
+            attestation_stats.batches++;
+            attestation_stats.batched_challenges += new_challenges;
+        }
+        attestation_stats.last_sign_time_us = sign_time_us;
+        if (sign_time_us > attestation_stats.max_sign_time_us) {
+            attestation_stats.max_sign_time_us = sign_time_us;
+        }
+    } else {
+        attestation_stats.sign_failures++;
+    }
+    portEXIT_CRITICAL(&attestation_lock);
+
+    if (ret == ESP_OK) {
+        attestation_boot_reports++;
+        ESP_LOGD(TAG, "✍️ Rapport d'attestation #%lu signé en %lu µs (%d défi(s) nouveau(x))%s",
+                 attestation_boot_reports, sign_time_us, (int)new_challenges,
+                 on_change ? " (changement d'état)" : "");
+    } else {
+        ESP_LOGE(TAG, "❌ Échec signature du rapport d'attestation: %s", esp_err_to_name(ret));
+    }
+
+    xSemaphoreGive(attestation_sign_mutex);
+    return ret;
+}
+
+#if CONFIG_ATTESTATION_UDP_RESPONDER
+/**
+ * @brief Envoie une réponse sérialisée à un vérificateur
+ */
+static void attestation_send(const uint8_t *buffer, size_t len,
+                             const struct sockaddr_in *destination, socklen_t destination_len) {
+    if (sendto(attestation_socket, buffer, len, 0,
+               (const struct sockaddr *)destination, destination_len) < 0) {
+        ESP_LOGW(TAG, "⚠️ Envoi réponse d'attestation (errno %d)", errno);
+    }
+}
+
+/**
+ * @brief Tâche du répondeur
+ *
+ * Un défi déjà couvert par le rapport en cache est servi immédiatement. Les
+ * défis nouveaux sont retenus pendant CONFIG_ATTESTATION_BATCH_WINDOW_MS (ou
+ * jusqu'à ATTESTATION_MAX_CHALLENGES) puis couverts par une seule signature,
+ * envoyée à chacun. Budget de signatures épuisé: le lot reste sans réponse
+ * (pas de rapport signé renvoyé à une source non authentifiée).
+ */
+static void attestation_responder_task(void *pvParameters) {
+    static uint8_t response_buffer[ATTESTATION_RESPONSE_MAX_SIZE];
+    static attestation_response_t response;
+    static attestation_pending_t pending[ATTESTATION_MAX_CHALLENGES];
+    static uint8_t pending_challenges[ATTESTATION_MAX_CHALLENGES][ATTESTATION_NONCE_SIZE];
+    size_t pending_count = 0;
+    int64_t batch_deadline_us = 0;
+    uint8_t request[sizeof(uint32_t) + ATTESTATION_NONCE_SIZE];
+
+    while (1) {
+        // Sans lot ouvert, attente bloquante: la radio reste en modem-sleep
+        struct timeval timeout;
+        struct timeval *timeout_ptr = NULL;
+        if (pending_count > 0) {
+            int64_t remaining_us = batch_deadline_us - esp_timer_get_time();
+            if (remaining_us < 0) {
+                remaining_us = 0;
+            }
+            timeout.tv_sec = remaining_us / 1000000;
+            timeout.tv_usec = remaining_us % 1000000;
+            timeout_ptr = &timeout;
+        }
+
+        fd_set readable;
+        FD_ZERO(&readable);
+        FD_SET(attestation_socket, &readable);
+        int ready = select(attestation_socket + 1, &readable, NULL, NULL, timeout_ptr);
+        if (ready < 0) {
+            ESP_LOGW(TAG, "⚠️ Attente demande d'attestation (errno %d)", errno);
+            vTaskDelay(pdMS_TO_TICKS(1000));
+            continue;
+        }
+
+        if (ready > 0) {
+            struct sockaddr_in source;
+            socklen_t source_len = sizeof(source);
+            int len = recvfrom(attestation_socket, request, sizeof(request), 0,
+                               (struct sockaddr *)&source, &source_len);
+
+            uint32_t magic = 0;
+            if (len == (int)sizeof(request)) {
+                memcpy(&magic, request, sizeof(magic));
+            }
+            if (magic != ATTESTATION_REQUEST_MAGIC) {
+                portENTER_CRITICAL(&attestation_lock);
+                attestation_stats.udp_rejected++;
+                portEXIT_CRITICAL(&attestation_lock);
+                continue;
+            }
+
+            const uint8_t *challenge = request + sizeof(magic);
+            bool cached;
+            portENTER_CRITICAL(&attestation_lock);
+            cached = attestation_cache_covers_locked(CONFIG_ATTESTATION_FRESHNESS_WINDOW_MS,
+                                                     (const uint8_t (*)[ATTESTATION_NONCE_SIZE])challenge, 1);
+            portEXIT_CRITICAL(&attestation_lock);
+
+            size_t written = 0;
+            if (cached) {
+                if (attestation_get_response((const uint8_t (*)[ATTESTATION_NONCE_SIZE])challenge, 1,
+                                             &response) == ESP_OK &&
+                    attestation_encode_response(&response, response_buffer, sizeof(response_buffer),
+                                                &written) == ESP_OK) {
+                    attestation_send(response_buffer, written, &source, source_len);
+                }
+                continue;
+            }
+
+            if (pending_count == 0) {
+                batch_deadline_us = esp_timer_get_time() + (int64_t)CONFIG_ATTESTATION_BATCH_WINDOW_MS * 1000;
+            }
+            memcpy(pending[pending_count].challenge, challenge, ATTESTATION_NONCE_SIZE);
+            pending[pending_count].source = source;
+            pending[pending_count].source_len = source_len;
+            pending_count++;
+
+            if (pending_count < ATTESTATION_MAX_CHALLENGES &&
+                esp_timer_get_time() < batch_deadline_us) {
+                continue;
+            }
+        } else if (pending_count == 0) {
+            continue;
+        }
+
+        // Fin du lot: une signature pour tous les défis en attente
+        for (size_t i = 0; i < pending_count; i++) {
+            memcpy(pending_challenges[i], pending[i].challenge, ATTESTATION_NONCE_SIZE);
+        }
+        size_t written = 0;
+        if (attestation_get_response((const uint8_t (*)[ATTESTATION_NONCE_SIZE])pending_challenges,
+                                     pending_count, &response) == ESP_OK &&
+            attestation_encode_response(&response, response_buffer, sizeof(response_buffer),
+                                        &written) == ESP_OK) {
+            for (size_t i = 0; i < pending_count; i++) {
+                attestation_send(response_buffer, written, &pending[i].source, pending[i].source_len);
+            }
+        }
+        pending_count = 0;
+    }
+}
+#endif
+
+// ================================
+// Fonctions publiques
+// ================================
+
+/**
+ * @brief Charge (ou génère) la clé d'attestation et compte le démarrage
+ */
+esp_err_t attestation_init(void) {
+    if (attestation_initialized) {
+        return ESP_OK;
+    }
+
+    if (attestation_sign_mutex == NULL) {
+        attestation_sign_mutex = xSemaphoreCreateMutexStatic(&attestation_sign_mutex_buffer);
+        if (attestation_sign_mutex == NULL) {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+    nvs_handle_t handle;
+    esp_err_t ret = nvs_open(ATTESTATION_NVS_NAMESPACE, NVS_READWRITE, &handle);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ Ouverture NVS attestation: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    ret = attestation_load_key(handle);
+    if (ret == ESP_OK) {
+        ret = attestation_count_boot(handle);
+    }
+    nvs_close(handle);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ Clé ou compteur d'attestation indisponible: %s", esp_err_to_name(ret));
+        CRYPTO_BASIC_SECURE_ZERO(&attestation_key, sizeof(attestation_key));
+        return ret;
+    }
+
+    portENTER_CRITICAL(&attestation_lock);
+    memset(&attestation_stats, 0, sizeof(attestation_stats));
+    attestation_cache_valid = false;
+    attestation_sign_tokens_milli = ATTESTATION_BUCKET_CAPACITY_MILLI;
+    attestation_sign_refill_ms = (uint32_t)(esp_timer_get_time() / 1000);
+    portEXIT_CRITICAL(&attestation_lock);
+    attestation_boot_reports = 0;
+
+    attestation_initialized = true;
+    ESP_LOGI(TAG, "🪪 Attestation prête: démarrage #%lu, fenêtre de fraîcheur %d ms",
+             attestation_boot_count, CONFIG_ATTESTATION_FRESHNESS_WINDOW_MS);
+
+    // Enrôlement: clé à fournir au vérificateur (tools/attestation_verify.py --pubkey)
+    char public_key_hex[CRYPTO_BASIC_ECDSA_PUBLIC_KEY_SIZE * 2 + 1] = {0};
+    for (size_t i = 0; i < attestation_key.public_key_len; i++) {
+        snprintf(&public_key_hex[i * 2], 3, "%02x", attestation_key.public_key[i]);
+    }
+    ESP_LOGI(TAG, "🔑 Clé publique d'attestation: %s", public_key_hex);
+    return ESP_OK;
+}
+
+/**
+ * @brief Arrête le répondeur et efface la clé en RAM
+ */
+esp_err_t attestation_deinit(void) {
+    if (!attestation_initialized) {
+        return ESP_OK;
+    }
+
+#if CONFIG_ATTESTATION_UDP_RESPONDER
+    if (attestation_responder_handle != NULL) {
+        vTaskDelete(attestation_responder_handle);
+        attestation_responder_handle = NULL;
+    }
+    if (attestation_socket >= 0) {
+        close(attestation_socket);
+        attestation_socket = -1;
+    }
+#endif
+
+    xSemaphoreTake(attestation_sign_mutex, portMAX_DELAY);
+    CRYPTO_BASIC_SECURE_ZERO(&attestation_key, sizeof(attestation_key));
+    portENTER_CRITICAL(&attestation_lock);
+    attestation_cache_valid = false;
+    portEXIT_CRITICAL(&attestation_lock);
+    attestation_initialized = false;
+    xSemaphoreGive(attestation_sign_mutex);
+
+    ESP_LOGI(TAG, "Attestation arrêtée");
+    return ESP_OK;
+}
+
+/**
+ * @brief Maintien du rapport en cache (appelé par la maintenance du monitoring)
+ */
+esp_err_t attestation_tick(void) {
+    if (!attestation_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    int64_t age_ms = attestation_cache_age_ms();
+    if (age_ms < 0 || age_ms >= ATTESTATION_RENEW_AGE_MS) {
+        return attestation_sign(ATTESTATION_RENEW_AGE_MS, false, NULL, 0);
+    }
+    if (age_ms < CONFIG_ATTESTATION_MIN_RESIGN_INTERVAL_MS) {
+        return ESP_OK;
+    }
+
+    // Changement d'état (fin de vérification, nouvel incident): ne pas attendre l'échéance
+    attestation_report_t current;
+    attestation_report_t cached;
+    attestation_collect_state(&current);
+    portENTER_CRITICAL(&attestation_lock);
+    cached = attestation_cached.report;
+    portEXIT_CRITICAL(&attestation_lock);
+
+    if (attestation_state_equal(&current, &cached)) {
+        return ESP_OK;
+    }
+    return attestation_sign(CONFIG_ATTESTATION_MIN_RESIGN_INTERVAL_MS, true, NULL, 0);
+}
+
+/**
+ * @brief Force la signature d'un nouveau rapport
+ */
+esp_err_t attestation_refresh(void) {
+    if (!attestation_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    return attestation_sign(-1, false, NULL, 0);
+}
+
+/**
+ * @brief Répond à des défis depuis le rapport en cache
+ */
+esp_err_t attestation_get_response(const uint8_t (*challenges)[ATTESTATION_NONCE_SIZE],
+                                   size_t challenge_count, attestation_response_t *response) {
+    if (response == NULL || challenge_count > ATTESTATION_MAX_CHALLENGES ||
+        (challenges == NULL && challenge_count > 0)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!attestation_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    bool cache_hit = true;
+    for (int attempt = 0; attempt < 2; attempt++) {
+        bool served = false;
+        bool throttled = false;
+
+        portENTER_CRITICAL(&attestation_lock);
+        if (attestation_cache_covers_locked(CONFIG_ATTESTATION_FRESHNESS_WINDOW_MS,
+                                            challenges, challenge_count)) {
+            *response = attestation_cached;
+            response->age_ms = (uint32_t)((esp_timer_get_time() - attestation_cached_at_us) / 1000);
+            attestation_stats.requests += (challenge_count > 0) ? challenge_count : 1;
+            if (cache_hit) {
+                attestation_stats.cache_hits += (challenge_count > 0) ? challenge_count : 1;
+            }
+            served = true;
+        } else if (cache_hit && challenge_count > 0 && !attestation_take_sign_token_locked()) {
+            // Défis nouveaux hors budget: pas de signature
+            attestation_stats.challenges_throttled += challenge_count;
+            throttled = true;
+        }
+        portEXIT_CRITICAL(&attestation_lock);
+
+        if (served) {
+            return ESP_OK;
+        }
+        if (throttled) {
+            return ESP_ERR_TIMEOUT;
+        }
+
+        // Défis nouveaux ou cache périmé: une signature, partagée par les demandes concurrentes
+        cache_hit = false;
+        esp_err_t ret = attestation_sign(CONFIG_ATTESTATION_FRESHNESS_WINDOW_MS, false,
+                                         challenges, challenge_count);
+        if (ret != ESP_OK) {
+            return ret;
+        }
+    }
+
+    return ESP_ERR_TIMEOUT;
+}
+
+/**
+ * @brief Sérialise une réponse pour le transport
+ */
+esp_err_t attestation_encode_response(const attestation_response_t *response,
+                                      uint8_t *output, size_t output_size, size_t *written) {
+    if (response == NULL || output == NULL || written == NULL ||
+        response->signature_len > CRYPTO_BASIC_ECDSA_SIGNATURE_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    size_t total = sizeof(response->report) + 1 + response->signature_len + 4;
+    if (output_size < total) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    size_t pos = 0;
+    memcpy(output, &response->report, sizeof(response->report));
+    pos += sizeof(response->report);
+    output[pos++] = (uint8_t)response->signature_len;
+    memcpy(output + pos, response->signature, response->signature_len);
+    pos += response->signature_len;
+    for (int i = 0; i < 4; i++) {
+        output[pos++] = (uint8_t)(response->age_ms >> (8 * i));
+    }
+
+    *written = pos;
+    return ESP_OK;
+}
+
+/**
+ * @brief Clé publique d'attestation (P-256 non compressée, pour l'enrôlement)
+ */
+esp_err_t attestation_get_public_key(uint8_t *public_key, size_t *public_key_len) {
+    if (public_key == NULL || public_key_len == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!attestation_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (*public_key_len < attestation_key.public_key_len) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    memcpy(public_key, attestation_key.public_key, attestation_key.public_key_len);
+    *public_key_len = attestation_key.public_key_len;
+    return ESP_OK;
+}
+
+/**
+ * @brief Démarre le répondeur UDP (CONFIG_ATTESTATION_UDP_RESPONDER)
+ */
+esp_err_t attestation_responder_start(BaseType_t core) {
+#if CONFIG_ATTESTATION_UDP_RESPONDER
+    if (!attestation_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (attestation_responder_handle != NULL) {
+        return ESP_OK;
+    }
+
+    attestation_socket = socket(AF_INET, SOCK_DGRAM, IPPROTO_IP);
+    if (attestation_socket < 0) {
+        ESP_LOGE(TAG, "❌ Échec création socket d'attestation (errno %d)", errno);
+        return ESP_FAIL;
+    }
+
+    struct sockaddr_in local = {
+        .sin_family = AF_INET,
+        .sin_port = htons(CONFIG_ATTESTATION_UDP_PORT),
+        .sin_addr.s_addr = htonl(INADDR_ANY)
+    };
+    if (bind(attestation_socket, (struct sockaddr *)&local, sizeof(local)) < 0) {
+        ESP_LOGE(TAG, "❌ Port d'attestation %d indisponible (errno %d)", CONFIG_ATTESTATION_UDP_PORT, errno);
+        close(attestation_socket);
+        attestation_socket = -1;
+        return ESP_FAIL;
+    }
+
+    BaseType_t task_ret = xTaskCreatePinnedToCore(
+        attestation_responder_task,
+        "attest_community",
+        ATTESTATION_RESPONDER_STACK_SIZE_COMMUNITY,
+        NULL,
+        ATTESTATION_RESPONDER_PRIORITY_COMMUNITY,
+        &attestation_responder_handle,
+        core
+    );
+    if (task_ret != pdPASS) {
+        ESP_LOGE(TAG, "❌ Échec création tâche répondeur d'attestation");
+        close(attestation_socket);
+        attestation_socket = -1;
+        return ESP_FAIL;
+    }
+
+    ESP_LOGI(TAG, "📡 Répondeur d'attestation sur UDP %d", CONFIG_ATTESTATION_UDP_PORT);
+    return ESP_OK;
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+/**
+ * @brief Obtient les statistiques du service
+ */
+esp_err_t attestation_get_stats(attestation_stats_t *stats) {
+    if (stats == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!attestation_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    portENTER_CRITICAL(&attestation_lock);
+    *stats = attestation_stats;
+    portEXIT_CRITICAL(&attestation_lock);
+    return ESP_OK;
+}
+
+/**
+ * @brief Affiche les statistiques du service
+ */
+void attestation_print_stats(void) {
+    attestation_stats_t stats;
+    if (attestation_get_stats(&stats) != ESP_OK) {
+        return;
+    }
+
+    ESP_LOGI(TAG, "🪪 Attestation: %lu demande(s) dont %lu depuis le cache, %lu signature(s) "
+             "(%lu lot(s) pour %lu défi(s), %lu sur changement, %lu échec(s)), %lu µs/signature (max %lu), "
+             "%lu demande(s) UDP rejetée(s), %lu défi(s) hors budget",
+             stats.requests, stats.cache_hits, stats.reports_signed, stats.batches, stats.batched_challenges,
+             stats.resigns_on_change, stats.sign_failures, stats.last_sign_time_us, stats.max_sign_time_us,
+             stats.udp_rejected, stats.challenges_throttled);
+}
\ No newline at end of file
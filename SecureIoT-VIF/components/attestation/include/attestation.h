@@ -0,0 +1,220 @@
+/**
+ * @file attestation.h
+ * @brief Rapports d'attestation signés et mis en cache (Community Edition)
+ *
+ * L'état du nœud (racine du manifeste d'intégrité, identité du firmware,
+ * compteurs d'incidents, nombre de démarrages) est agrégé dans un rapport
+ * signé en ECDSA P-256 (crypto_basic_ecdsa_sign, plusieurs dizaines de ms
+ * en logiciel). Seule la partie signée fait foi: l'âge joint à la réponse
+ * est indicatif.
+ *
+ * Fraîcheur: le rapport embarque (signés) les derniers défis reçus des
+ * vérificateurs, ATTESTATION_MAX_CHALLENGES au plus. Un vérificateur
+ * n'accepte qu'un rapport contenant son défi: signé après l'émission de
+ * celui-ci, il ne peut pas être rejoué. Un vérificateur qui réutilise son
+ * défi pendant une époque est servi depuis le cache sans signature; les
+ * défis nouveaux arrivés pendant CONFIG_ATTESTATION_BATCH_WINDOW_MS sont
+ * couverts par une seule signature, dans la limite d'un seau à jetons
+ * (CONFIG_ATTESTATION_CHALLENGE_SIGNS_PER_MINUTE).
+ *
+ * Le rapport est aussi re-signé par attestation_tick() (maintenance du
+ * monitoring) à l'échéance de CONFIG_ATTESTATION_FRESHNESS_WINDOW_MS ou
+ * dès que l'état attesté change, au plus une fois par
+ * CONFIG_ATTESTATION_MIN_RESIGN_INTERVAL_MS, en conservant les défis
+ * courants. Le numéro de séquence est strictement croissant, y compris
+ * d'un démarrage à l'autre.
+ *
+ * La clé d'attestation est générée au premier démarrage et conservée en
+ * NVS (non chiffrée en Community: voir crypto_basic_generate_ecdsa_keypair).
+ *
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#ifndef ATTESTATION_H
+#define ATTESTATION_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "crypto_operations_basic.h"
+
+// ================================
+// Constantes Community
+// ================================
+
+#define ATTESTATION_REPORT_MAGIC            (0x52414953)    // "SIAR"
+#define ATTESTATION_REPORT_VERSION          (1)
+#define ATTESTATION_REQUEST_MAGIC           (0x51414953)    // "SIAQ"
+#define ATTESTATION_NONCE_SIZE              (16)            // Défi d'un vérificateur
+#define ATTESTATION_MAX_CHALLENGES          (4)             // Défis couverts par une signature
+#define ATTESTATION_NVS_NAMESPACE           "attest"
+
+#define ATTESTATION_FLAG_INTEGRITY_VERIFIED (1U << 0)       // Vérification de démarrage réussie
+#define ATTESTATION_FLAG_MANIFEST_READY     (1U << 1)       // Racine de manifeste vérifiée
+
+// Réponse sérialisée: rapport, longueur de signature (1 octet), signature DER, âge (ms, non signé)
+#define ATTESTATION_RESPONSE_MAX_SIZE \
+    (sizeof(attestation_report_t) + 1 + CRYPTO_BASIC_ECDSA_SIGNATURE_MAX + 4)
+
+#define ATTESTATION_RESPONDER_STACK_SIZE_COMMUNITY  (3072)
+#define ATTESTATION_RESPONDER_PRIORITY_COMMUNITY    (3)
+#define ATTESTATION_CHALLENGE_SIGN_BURST_COMMUNITY  (4)     // Signatures sur défi en rafale
+
+// ================================
+// Types et structures Community
+// ================================
+
+/**
+ * @brief Rapport d'attestation (partie signée, little-endian)
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t magic;                     // ATTESTATION_REPORT_MAGIC
+    uint16_t version;                   // ATTESTATION_REPORT_VERSION
+    uint16_t flags;                     // ATTESTATION_FLAG_*
+    uint64_t sequence;                  // (boot_count << 32) | rapport du démarrage
+    uint32_t boot_count;                // Démarrages depuis la mise en service
+    uint32_t uptime_s;                  // Temps depuis le démarrage à la signature
+    uint8_t app_elf_sha256[32];         // Identité du firmware en cours
+    uint8_t manifest_root[32];          // Racine de Merkle du manifeste (zéros si non prêt)
+    uint16_t manifest_chunks;           // Chunks couverts par le manifeste
+    uint16_t challenge_count;           // Défis valides dans challenges[]
+    uint32_t incidents_total;           // incident_stats_t
+    uint32_t integrity_failures;
+    uint32_t anomalies_handled;
+    uint32_t security_violations;
+    uint8_t challenges[ATTESTATION_MAX_CHALLENGES][ATTESTATION_NONCE_SIZE];   // Plus récent en tête
+} attestation_report_t;
+
+/**
+ * @brief Réponse à une demande d'attestation
+ */
+typedef struct {
+    attestation_report_t report;
+    uint8_t signature[CRYPTO_BASIC_ECDSA_SIGNATURE_MAX];    // ECDSA DER sur SHA-256(report)
+    size_t signature_len;
+    uint32_t age_ms;                    // Âge du rapport à la réponse (non signé, indicatif)
+} attestation_response_t;
+
+/**
+ * @brief Statistiques du service d'attestation
+ */
+typedef struct {
+    uint32_t reports_signed;            // Signatures produites
+    uint32_t sign_failures;             // Signatures en échec
+    uint32_t resigns_on_change;         // Re-signatures déclenchées par un changement d'état
+    uint32_t requests;                  // Demandes servies (API et UDP)
+    uint32_t cache_hits;                // Demandes servies sans signature
+    uint32_t batches;                   // Signatures couvrant des défis nouveaux
+    uint32_t batched_challenges;        // Défis nouveaux couverts par ces signatures
+    uint32_t udp_rejected;              // Datagrammes de demande mal formés
+    uint32_t challenges_throttled;      // Défis nouveaux ignorés (budget de signatures épuisé)
+    uint32_t last_sign_time_us;         // Coût de la dernière signature
+    uint32_t max_sign_time_us;
+} attestation_stats_t;
+
+// ================================
+// Fonctions Community
+// ================================
+
+/**
+ * @brief Charge (ou génère) la clé d'attestation et compte le démarrage
+ *
+ * Requiert crypto_operations_basic_init() et nvs_flash_init(). Ne signe
+ * rien: le premier rapport est produit par attestation_tick() ou par la
+ * première demande.
+ *
+ * @return ESP_OK, ESP_ERR_NO_MEM (verrou), erreur NVS ou crypto
+ */
+esp_err_t attestation_init(void);
+
+/**
+ * @brief Arrête le répondeur et efface la clé en RAM
+ */
+esp_err_t attestation_deinit(void);
+
+/**
+ * @brief Maintien du rapport en cache (appelé par la maintenance du monitoring)
+ *
+ * Re-signe quand le rapport approche la fin de sa fenêtre de fraîcheur ou
+ * quand l'état attesté a changé (au plus une fois par intervalle minimal).
+ *
+ * @return ESP_OK, ou l'erreur de signature
+ */
+esp_err_t attestation_tick(void);
+
+/**
+ * @brief Force la signature d'un nouveau rapport
+ */
+esp_err_t attestation_refresh(void);
+
+/**
+ * @brief Répond à des défis depuis le rapport en cache
+ *
+ * Sert le cache s'il a moins de CONFIG_ATTESTATION_FRESHNESS_WINDOW_MS et
+ * contient tous les défis; sinon signe un seul rapport les incluant (les
+ * défis en cache complètent les places libres). Les signatures dues à des
+ * défis nouveaux consomment un seau à jetons (ATTESTATION_CHALLENGE_SIGN_BURST_COMMUNITY,
+ * CONFIG_ATTESTATION_CHALLENGE_SIGNS_PER_MINUTE): un flot de défis ne
+ * maintient pas le nœud en signature.
+ *
+ * @param challenges Défis des vérificateurs (NULL si challenge_count = 0: usage local)
+ * @param challenge_count Nombre de défis (ATTESTATION_MAX_CHALLENGES au plus)
+ * @param response Réponse (rapport, signature, âge)
+ * @return ESP_OK, ESP_ERR_INVALID_ARG, ESP_ERR_TIMEOUT si le budget de
+ *         signatures sur défi est épuisé (défis ignorés), ou l'erreur de signature
+ */
+esp_err_t attestation_get_response(const uint8_t (*challenges)[ATTESTATION_NONCE_SIZE],
+                                   size_t challenge_count, attestation_response_t *response);
+
+/**
+ * @brief Sérialise une réponse pour le transport
+ *
+ * @param response Réponse à sérialiser
+ * @param output Buffer (ATTESTATION_RESPONSE_MAX_SIZE octets suffisent)
+ * @param output_size Taille du buffer
+ * @param written Octets écrits
+ * @return ESP_OK, ESP_ERR_INVALID_SIZE si le buffer est trop petit
+ */
+esp_err_t attestation_encode_response(const attestation_response_t *response,
+                                      uint8_t *output, size_t output_size, size_t *written);
+
+/**
+ * @brief Clé publique d'attestation (P-256 non compressée, pour l'enrôlement)
+ */
+esp_err_t attestation_get_public_key(uint8_t *public_key, size_t *public_key_len);
+
+/**
+ * @brief Démarre le répondeur UDP (CONFIG_ATTESTATION_UDP_RESPONDER)
+ *
+ * Chaque datagramme "SIAQ" || défi reçoit un rapport signé contenant ce
+ * défi: immédiatement s'il est déjà en cache, sinon à la fin de la fenêtre
+ * de regroupement. Hors budget de signatures, les défis nouveaux restent
+ * sans réponse. À appeler une fois le WiFi démarré (telemetry_start).
+ *
+ * @param core Cœur de la tâche (celui de la pile WiFi, tskNO_AFFINITY: libre)
+ */
+esp_err_t attestation_responder_start(BaseType_t core);
+
+/**
+ * @brief Obtient les statistiques du service
+ */
+esp_err_t attestation_get_stats(attestation_stats_t *stats);
+
+/**
+ * @brief Affiche les statistiques du service
+ */
+void attestation_print_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ATTESTATION_H */
\ No newline at end of file
@@ -0,0 +1,518 @@
+/**
+ * @file bench.c
+ * @brief Suite de microbenchmarks sur cible (Community Edition)
+ *
+ * Chaque mesure est émise avec printf (pas ESP_LOG) pour que la ligne
+ * JSON reste intacte: BENCH_JSON {"suite":..,"name":..,"value":..,
+ * "unit":..,"better":"higher"|"lower"}.
+ *
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "esp_log.h"
+#include "esp_err.h"
+#include "esp_timer.h"
+#include "rom/ets_sys.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "app_config.h"
+#include "crypto_operations_basic.h"
+#include "crypto_random.h"
+#include "integrity_checker.h"
+#include "dht22_driver.h"
+#include "sensor_manager.h"
+#include "anomaly_detector.h"
+#include "bench.h"
+
+static const char *TAG = "BENCH_COMMUNITY";
+
+static const size_t bench_sha256_sizes[] = { 64, 1024, 4096, 16384 };
+static const size_t bench_gcm_sizes[] = { 16, 64, 256, 1024, 4096 };
+
+#define BENCH_BUFFER_SIZE           (16384)
+#define BENCH_ARRAY_LEN(a)          (sizeof(a) / sizeof((a)[0]))
+
+// ================================
+// Émission JSON
+// ================================
+
+static void bench_emit(bench_suite_t suite, const char *name, double value,
+                       const char *unit, bool higher_is_better) {
+    printf(BENCH_JSON_PREFIX "{\"suite\":\"%s\",\"name\":\"%s\",\"value\":%.3f,"
+           "\"unit\":\"%s\",\"better\":\"%s\"}\n",
+           bench_suite_to_string(suite), name, value, unit,
+           higher_is_better ? "higher" : "lower");
+}
+
+static void bench_emit_error(bench_suite_t suite, const char *name, esp_err_t err) {
+    printf(BENCH_JSON_PREFIX "{\"suite\":\"%s\",\"name\":\"%s\",\"error\":\"%s\"}\n",
+           bench_suite_to_string(suite), name, esp_err_to_name(err));
+}
+
+static inline double bench_mbps(size_t bytes, int64_t elapsed_us) {
+    return (elapsed_us > 0) ? (double)bytes / (double)elapsed_us : 0.0;
+}
+
+static inline size_t bench_iterations(size_t size) {
+    size_t n = BENCH_THROUGHPUT_TARGET_BYTES / size;
+    return (n > 0) ? n : 1;
+}
+
+// ================================
+// Suites
+// ================================
+
+/**
+ * @brief Débit SHA-256 (MB/s) par taille de buffer
+ */
+static esp_err_t bench_sha256(uint8_t *buffer) {
+    uint8_t digest[CRYPTO_BASIC_SHA256_SIZE];
+    char name[32];
+
+    for (size_t s = 0; s < BENCH_ARRAY_LEN(bench_sha256_sizes); s++) {
+        size_t size = bench_sha256_sizes[s];
+        size_t iterations = bench_iterations(size);
+        snprintf(name, sizeof(name), "sha256_%u", (unsigned)size);
+
+        int64_t start = esp_timer_get_time();
+        for (size_t i = 0; i < iterations; i++) {
+            esp_err_t ret = crypto_basic_sha256(buffer, size, digest);
+            if (ret != ESP_OK) {
+                bench_emit_error(BENCH_SUITE_SHA256, name, ret);
+                return ret;
+            }
+        }
+        bench_emit(BENCH_SUITE_SHA256, name,
+                   bench_mbps(size * iterations, esp_timer_get_time() - start), "MB/s", true);
+    }
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Débit AES-128-GCM (MB/s) par taille de message, contexte de session réutilisé
+ */
+static esp_err_t bench_aes_gcm(uint8_t *buffer, uint8_t *output) {
+    uint8_t key[CRYPTO_BASIC_AES_KEY_SIZE];
+    uint8_t iv[CRYPTO_BASIC_AES_IV_SIZE] = {0};
+    uint8_t tag[CRYPTO_BASIC_AES_TAG_SIZE];
+    crypto_basic_gcm_session_t *session = NULL;
+    char name[32];
+
+    esp_err_t ret = crypto_basic_generate_random(key, sizeof(key));
+    if (ret == ESP_OK) {
+        ret = crypto_basic_gcm_session_create(key, &session);
+    }
+    if (ret != ESP_OK) {
+        bench_emit_error(BENCH_SUITE_AES_GCM, "gcm_session_create", ret);
+        return ret;
+    }
+
+    for (size_t s = 0; s < BENCH_ARRAY_LEN(bench_gcm_sizes) && ret == ESP_OK; s++) {
+        size_t size = bench_gcm_sizes[s];
+        size_t iterations = bench_iterations(size);
+        snprintf(name, sizeof(name), "gcm_encrypt_%u", (unsigned)size);
+
+        int64_t start = esp_timer_get_time();
+        for (size_t i = 0; i < iterations && ret == ESP_OK; i++) {
+            uint32_t counter = (uint32_t)i;
+            memcpy(iv, &counter, sizeof(counter));
+            ret = crypto_basic_gcm_session_encrypt(session, iv, NULL, 0, buffer, size, output, tag);
+        }
+
+        if (ret != ESP_OK) {
+            bench_emit_error(BENCH_SUITE_AES_GCM, name, ret);
+            break;
+        }
+        bench_emit(BENCH_SUITE_AES_GCM, name,
+                   bench_mbps(size * iterations, esp_timer_get_time() - start), "MB/s", true);
+    }
+
+    crypto_basic_gcm_session_destroy(session);
+    memset(key, 0, sizeof(key));
+    return ret;
+}
+
+/**
+ * @brief Signatures et vérifications ECDSA P-256 par seconde
+ */
+static esp_err_t bench_ecdsa(void) {
+    crypto_basic_keypair_t keypair;
+    uint8_t hash[CRYPTO_BASIC_SHA256_SIZE];
+    uint8_t signature[CRYPTO_BASIC_ECDSA_SIGNATURE_MAX];
+    size_t signature_len = 0;
+    crypto_basic_ecdsa_verifier_t *verifier = NULL;
+
+    esp_err_t ret = crypto_basic_generate_ecdsa_keypair_ungated(&keypair);
+    if (ret == ESP_OK) {
+        ret = crypto_basic_generate_random(hash, sizeof(hash));
+    }
+    if (ret != ESP_OK) {
+        bench_emit_error(BENCH_SUITE_ECDSA, "ecdsa_keygen", ret);
+        return ret;
+    }
+
+    int64_t start = esp_timer_get_time();
+    for (int i = 0; i < BENCH_ECDSA_ITERATIONS && ret == ESP_OK; i++) {
+        signature_len = sizeof(signature);
+        ret = crypto_basic_ecdsa_sign_ungated(&keypair, hash, sizeof(hash), signature, &signature_len);
+    }
+    int64_t sign_us = esp_timer_get_time() - start;
+    if (ret != ESP_OK) {
+        bench_emit_error(BENCH_SUITE_ECDSA, "ecdsa_sign", ret);
+        goto cleanup;
+    }
+    bench_emit(BENCH_SUITE_ECDSA, "ecdsa_sign", BENCH_ECDSA_ITERATIONS * 1e6 / (double)sign_us,
+               "ops/s", true);
+
+    start = esp_timer_get_time();
+    for (int i = 0; i < BENCH_ECDSA_ITERATIONS && ret == ESP_OK; i++) {
+        ret = crypto_basic_ecdsa_verify(&keypair, hash, sizeof(hash), signature, signature_len);
+    }
+    int64_t verify_us = esp_timer_get_time() - start;
+    if (ret != ESP_OK) {
+        bench_emit_error(BENCH_SUITE_ECDSA, "ecdsa_verify", ret);
+        goto cleanup;
+    }
+    bench_emit(BENCH_SUITE_ECDSA, "ecdsa_verify", BENCH_ECDSA_ITERATIONS * 1e6 / (double)verify_us,
+               "ops/s", true);
+
+    // Clé décodée et table comb précalculées une fois
+    ret = crypto_basic_ecdsa_verifier_create(keypair.public_key, keypair.public_key_len, &verifier);
+    if (ret != ESP_OK) {
+        bench_emit_error(BENCH_SUITE_ECDSA, "ecdsa_verifier_create", ret);
+        goto cleanup;
+    }
+
+    start = esp_timer_get_time();
+    for (int i = 0; i < BENCH_ECDSA_ITERATIONS && ret == ESP_OK; i++) {
+        ret = crypto_basic_ecdsa_verifier_verify(verifier, hash, sizeof(hash), signature, signature_len);
+    }
+    verify_us = esp_timer_get_time() - start;
+    if (ret != ESP_OK) {
+        bench_emit_error(BENCH_SUITE_ECDSA, "ecdsa_verify_cached", ret);
+        goto cleanup;
+    }
+    bench_emit(BENCH_SUITE_ECDSA, "ecdsa_verify_cached", BENCH_ECDSA_ITERATIONS * 1e6 / (double)verify_us,
+               "ops/s", true);
+
+    crypto_basic_ecdsa_batch_item_t batch[BENCH_ECDSA_ITERATIONS];
+    for (int i = 0; i < BENCH_ECDSA_ITERATIONS; i++) {
+        batch[i] = (crypto_basic_ecdsa_batch_item_t){ hash, sizeof(hash), signature, signature_len };
+    }
+    start = esp_timer_get_time();
+    ret = crypto_basic_ecdsa_verifier_verify_batch(verifier, batch, BENCH_ECDSA_ITERATIONS, NULL);
+    verify_us = esp_timer_get_time() - start;
+    if (ret != ESP_OK) {
+        bench_emit_error(BENCH_SUITE_ECDSA, "ecdsa_verify_batch", ret);
+        goto cleanup;
+    }
+    bench_emit(BENCH_SUITE_ECDSA, "ecdsa_verify_batch", BENCH_ECDSA_ITERATIONS * 1e6 / (double)verify_us,
+               "ops/s", true);
+
+cleanup:
+    if (verifier != NULL) {
+        crypto_basic_ecdsa_verifier_destroy(verifier);
+    }
+    memset(&keypair, 0, sizeof(keypair));
+    return ret;
+}
+
+/**
+ * @brief Passe d'intégrité complète vs vérification échantillonnée du démarrage
+ */
+static esp_err_t bench_integrity(void) {
+    bool done = false;
+    uint32_t slices = 0;
+
+    // Passe complète: tranches sans budget jusqu'à la fin de l'image
+    int64_t start = esp_timer_get_time();
+    while (!done) {
+        integrity_status_t status = integrity_sweep_step(UINT32_MAX, 0, &done, NULL);
+        if (status != INTEGRITY_OK) {
+            bench_emit_error(BENCH_SUITE_INTEGRITY, "integrity_full_sweep", ESP_FAIL);
+            return ESP_FAIL;
+        }
+        slices++;
+    }
+    bench_emit(BENCH_SUITE_INTEGRITY, "integrity_full_sweep",
+               (esp_timer_get_time() - start) / 1000.0, "ms", false);
+
+    start = esp_timer_get_time();
+    integrity_status_t status = integrity_check_firmware_basic();
+    int64_t sampled_us = esp_timer_get_time() - start;
+    if (status != INTEGRITY_OK) {
+        bench_emit_error(BENCH_SUITE_INTEGRITY, "integrity_sampled", ESP_FAIL);
+        return ESP_FAIL;
+    }
+    bench_emit(BENCH_SUITE_INTEGRITY, "integrity_sampled", sampled_us / 1000.0, "ms", false);
+
+    ESP_LOGD(TAG, "Passe complète en %lu tranche(s)", slices);
+    return ESP_OK;
+}
+
+/**
+ * @brief Coût d'une lecture DHT22 dans chaque mode
+ *
+ * Le temps mural inclut, en capture par fronts, le sommeil de la tâche
+ * pendant la trame. Le temps CPU (dht22_stats_t.last_cpu_time_us) est celui
+ * réellement occupé: toute la trame en mode bloquant, l'armement et le
+ * décodage en capture par fronts.
+ */
+static esp_err_t bench_sensor(void) {
+    static const struct {
+        dht22_read_mode_t mode;
+        const char *wall_name;
+        const char *cpu_name;
+    } modes[] = {
+        { DHT22_MODE_BLOCKING, "dht22_wall_blocking", "dht22_cpu_blocking" },
+        { DHT22_MODE_EDGE_CAPTURE, "dht22_wall_edge_capture", "dht22_cpu_edge_capture" },
+    };
+    dht22_read_mode_t previous = dht22_get_read_mode();
+    esp_err_t result = ESP_OK;
+
+    for (size_t m = 0; m < BENCH_ARRAY_LEN(modes); m++) {
+        float temperature, humidity;
+        dht22_stats_t stats;
+
+        vTaskDelay(pdMS_TO_TICKS(BENCH_DHT22_INTERVAL_MS));
+
+        esp_err_t ret = dht22_set_read_mode(modes[m].mode);
+        if (ret == ESP_OK) {
+            int64_t start = esp_timer_get_time();
+            ret = dht22_read_data(&temperature, &humidity);
+            int64_t elapsed_us = esp_timer_get_time() - start;
+            if (ret == ESP_OK) {
+                bench_emit(BENCH_SUITE_SENSOR, modes[m].wall_name, (double)elapsed_us, "us", false);
+            }
+        }
+        if (ret != ESP_OK) {
+            bench_emit_error(BENCH_SUITE_SENSOR, modes[m].cpu_name, ret);
+            result = ret;
+            continue;
+        }
+
+        if (dht22_get_stats(&stats) == ESP_OK) {
+            bench_emit(BENCH_SUITE_SENSOR, modes[m].cpu_name,
+                       (double)stats.last_cpu_time_us, "us", false);
+            if (modes[m].mode == DHT22_MODE_EDGE_CAPTURE) {
+                bench_emit(BENCH_SUITE_SENSOR, "dht22_edge_critical",
+                           (double)stats.last_critical_time_us, "us", false);
+            }
+        }
+    }
+
+    dht22_set_read_mode(previous);
+    return result;
+}
+
+/**
+ * @brief Coût du scoring par échantillon (ns) dans chaque mode et par lots
+ */
+static esp_err_t bench_anomaly(float *temps, float *hums, uint8_t *flags, float *scores) {
+    static const struct {
+        anomaly_detection_mode_t mode;
+        const char *name;
+    } modes[] = {
+        { ANOMALY_MODE_THRESHOLD, "anomaly_threshold" },
+        { ANOMALY_MODE_STATISTICAL, "anomaly_statistical" },
+    };
+    anomaly_detection_mode_t previous = anomaly_get_detection_mode();
+
+    // Signal synthétique déterministe: dérive lente + bruit
+    for (size_t i = 0; i < BENCH_ANOMALY_SAMPLES; i++) {
+        temps[i] = 22.0f + 3.0f * sinf(i * 0.01f) + ((i * 7919) % 100) * 0.01f;
+        hums[i] = 50.0f + 10.0f * cosf(i * 0.013f) + ((i * 104729) % 100) * 0.02f;
+    }
+
+    for (size_t m = 0; m < BENCH_ARRAY_LEN(modes); m++) {
+        anomaly_set_detection_mode(modes[m].mode);
+
+        int64_t start = esp_timer_get_time();
+        for (size_t i = 0; i < BENCH_ANOMALY_SAMPLES; i++) {
+            sensor_data_t sample = {
+                .temperature = temps[i],
+                .humidity = hums[i],
+                .timestamp = i * SENSOR_READ_INTERVAL_MS,
+                .quality_score = 100,
+                .sensor_id = 0
+            };
+            (void)anomaly_detect(&sample);
+        }
+        int64_t elapsed_us = esp_timer_get_time() - start;
+        bench_emit(BENCH_SUITE_ANOMALY, modes[m].name,
+                   elapsed_us * 1000.0 / BENCH_ANOMALY_SAMPLES, "ns/sample", false);
+    }
+    anomaly_set_detection_mode(previous);
+
+    int64_t start = esp_timer_get_time();
+    esp_err_t ret = anomaly_detect_batch(temps, hums, BENCH_ANOMALY_SAMPLES, flags, scores);
+    int64_t elapsed_us = esp_timer_get_time() - start;
+    if (ret != ESP_OK) {
+        bench_emit_error(BENCH_SUITE_ANOMALY, "anomaly_batch", ret);
+        return ret;
+    }
+    bench_emit(BENCH_SUITE_ANOMALY, "anomaly_batch",
+               elapsed_us * 1000.0 / BENCH_ANOMALY_SAMPLES, "ns/sample", false);
+
+    // Les échantillons synthétiques ne doivent pas fausser les compteurs réels
+    anomaly_reset_stats_community();
+    return ESP_OK;
+}
+
+/**
+ * @brief Coût d'un IV GCM (ns): réserve du cœur vs DRBG sous mutex
+ *
+ * Les recharges de fond déclenchées pendant la mesure sont comptées dans
+ * le temps de la réserve.
+ */
+static esp_err_t bench_random(void) {
+    uint8_t iv[CRYPTO_RANDOM_IV_SIZE];
+    esp_err_t ret = ESP_OK;
+
+    int64_t start = esp_timer_get_time();
+    for (int i = 0; i < BENCH_RANDOM_ITERATIONS && ret == ESP_OK; i++) {
+        ret = crypto_random_gcm_iv(iv);
+    }
+    int64_t pool_us = esp_timer_get_time() - start;
+    if (ret != ESP_OK) {
+        bench_emit_error(BENCH_SUITE_RANDOM, "gcm_iv_pool", ret);
+        return ret;
+    }
+    bench_emit(BENCH_SUITE_RANDOM, "gcm_iv_pool", pool_us * 1000.0 / BENCH_RANDOM_ITERATIONS, "ns", false);
+
+    int mbedtls_ret = 0;
+    start = esp_timer_get_time();
+    for (int i = 0; i < BENCH_RANDOM_ITERATIONS && mbedtls_ret == 0; i++) {
+        mbedtls_ret = crypto_random_drbg(NULL, iv, sizeof(iv));
+    }
+    int64_t drbg_us = esp_timer_get_time() - start;
+    if (mbedtls_ret != 0) {
+        bench_emit_error(BENCH_SUITE_RANDOM, "gcm_iv_drbg", ESP_FAIL);
+        return ESP_FAIL;
+    }
+    bench_emit(BENCH_SUITE_RANDOM, "gcm_iv_drbg", drbg_us * 1000.0 / BENCH_RANDOM_ITERATIONS, "ns", false);
+
+    return ESP_OK;
+}
+
+// ================================
+// Fonctions publiques
+// ================================
+
+/**
+ * @brief Exécute une suite
+ */
+esp_err_t bench_run_suite(bench_suite_t suite) {
+    esp_err_t ret = ESP_OK;
+    uint8_t *buffer = NULL;
+    uint8_t *output = NULL;
+    float *temps = NULL;
+    float *hums = NULL;
+    float *scores = NULL;
+    uint8_t *flags = NULL;
+
+    switch (suite) {
+        case BENCH_SUITE_SHA256:
+        case BENCH_SUITE_AES_GCM:
+            buffer = malloc(BENCH_BUFFER_SIZE);
+            output = malloc(BENCH_BUFFER_SIZE);
+            if (buffer == NULL || output == NULL) {
+                ret = ESP_ERR_NO_MEM;
+                break;
+            }
+            memset(buffer, 0xA5, BENCH_BUFFER_SIZE);
+            ret = (suite == BENCH_SUITE_SHA256) ? bench_sha256(buffer) : bench_aes_gcm(buffer, output);
+            break;
+
+        case BENCH_SUITE_ECDSA:
+            ret = bench_ecdsa();
+            break;
+
+        case BENCH_SUITE_INTEGRITY:
+            ret = bench_integrity();
+            break;
+
+        case BENCH_SUITE_SENSOR:
+            ret = bench_sensor();
+            break;
+
+        case BENCH_SUITE_ANOMALY:
+            temps = malloc(BENCH_ANOMALY_SAMPLES * sizeof(float));
+            hums = malloc(BENCH_ANOMALY_SAMPLES * sizeof(float));
+            scores = malloc(BENCH_ANOMALY_SAMPLES * sizeof(float));
+            flags = malloc(BENCH_ANOMALY_SAMPLES);
+            if (temps == NULL || hums == NULL || scores == NULL || flags == NULL) {
+                ret = ESP_ERR_NO_MEM;
+                break;
+            }
+            ret = bench_anomaly(temps, hums, flags, scores);
+            break;
+
+        case BENCH_SUITE_RANDOM:
+            ret = bench_random();
+            break;
+
+        default:
+            return ESP_ERR_INVALID_ARG;
+    }
+
+    if (ret == ESP_ERR_NO_MEM) {
+        bench_emit_error(suite, "alloc", ret);
+    }
+
+    free(buffer);
+    free(output);
+    free(temps);
+    free(hums);
+    free(scores);
+    free(flags);
+    return ret;
+}
+
+/**
+ * @brief Exécute toutes les suites
+ */
+esp_err_t bench_run_all(void) {
+    uint32_t failures = 0;
+
+    ESP_LOGI(TAG, "🏁 === Microbenchmarks Community ===");
+    printf(BENCH_JSON_PREFIX "{\"suite\":\"meta\",\"version\":\"%s\",\"cpu_mhz\":%lu,\"backend\":\"%s\","
+           "\"profile\":\"%s\"}\n",
+           SECURE_IOT_VIF_VERSION, (unsigned long)ets_get_cpu_frequency(),
+           crypto_basic_backend_to_string(crypto_basic_get_backend()), CONFIG_APP_PROFILE_NAME);
+
+    for (bench_suite_t suite = 0; suite < BENCH_SUITE_MAX; suite++) {
+        ESP_LOGI(TAG, "▶️ Suite %s", bench_suite_to_string(suite));
+        if (bench_run_suite(suite) != ESP_OK) {
+            failures++;
+        }
+    }
+
+    printf(BENCH_JSON_PREFIX "{\"suite\":\"done\",\"failures\":%lu}\n", (unsigned long)failures);
+    ESP_LOGI(TAG, "🏁 Microbenchmarks terminés (%lu suite(s) en échec)", failures);
+
+    return (failures == 0) ? ESP_OK : ESP_FAIL;
+}
+
+/**
+ * @brief Nom d'une suite
+ */
+const char* bench_suite_to_string(bench_suite_t suite) {
+    switch (suite) {
+        case BENCH_SUITE_SHA256: return "sha256";
+        case BENCH_SUITE_AES_GCM: return "aes_gcm";
+        case BENCH_SUITE_ECDSA: return "ecdsa";
+        case BENCH_SUITE_INTEGRITY: return "integrity";
+        case BENCH_SUITE_SENSOR: return "sensor";
+        case BENCH_SUITE_ANOMALY: return "anomaly";
+        case BENCH_SUITE_RANDOM: return "random";
+        default: return "unknown";
+    }
+}
\ No newline at end of file
@@ -0,0 +1,86 @@
+/**
+ * @file bench.h
+ * @brief Suite de microbenchmarks sur cible (Community Edition)
+ *
+ * Mesure crypto, intégrité, capteur et détection, et publie chaque
+ * résultat sur une ligne JSON préfixée par BENCH_JSON_PREFIX, collectée
+ * par tools/bench_collect.py.
+ *
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+// ================================
+// Constantes Community
+// ================================
+
+#define BENCH_JSON_PREFIX                   "BENCH_JSON "
+#define BENCH_THROUGHPUT_TARGET_BYTES       (256 * 1024)    // Volume par point de débit
+#define BENCH_ECDSA_ITERATIONS              (8)
+#define BENCH_ANOMALY_SAMPLES               (1024)
+#define BENCH_RANDOM_ITERATIONS             (4096)
+#define BENCH_DHT22_INTERVAL_MS             (2500)          // Intervalle minimal DHT22 + marge
+
+// ================================
+// Types et structures Community
+// ================================
+
+/**
+ * @brief Suites de mesures
+ */
+typedef enum {
+    BENCH_SUITE_SHA256 = 0,         // Débit SHA-256 par taille de buffer
+    BENCH_SUITE_AES_GCM,            // Débit AES-GCM (session) par taille de message
+    BENCH_SUITE_ECDSA,              // Signatures / vérifications P-256 par seconde
+    BENCH_SUITE_INTEGRITY,          // Passe complète vs vérification échantillonnée
+    BENCH_SUITE_SENSOR,             // Temps CPU d'une lecture DHT22
+    BENCH_SUITE_ANOMALY,            // Coût du scoring par échantillon
+    BENCH_SUITE_RANDOM,             // Coût d'un tirage d'IV (réserve vs DRBG verrouillé)
+    BENCH_SUITE_MAX
+} bench_suite_t;
+
+// ================================
+// Fonctions Community
+// ================================
+
+/**
+ * @brief Exécute toutes les suites
+ *
+ * Nécessite crypto, intégrité, capteurs et détecteur initialisés, sans
+ * tâches applicatives concurrentes (profil configs/bench.config).
+ *
+ * @return ESP_OK si toutes les suites ont tourné, ESP_FAIL si l'une a échoué
+ */
+esp_err_t bench_run_all(void);
+
+/**
+ * @brief Exécute une suite
+ *
+ * @param suite Suite à exécuter
+ * @return ESP_OK si succès, code d'erreur de la première mesure en échec sinon
+ */
+esp_err_t bench_run_suite(bench_suite_t suite);
+
+/**
+ * @brief Nom d'une suite (clé "suite" du JSON)
+ */
+const char* bench_suite_to_string(bench_suite_t suite);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BENCH_H */
\ No newline at end of file
@@ -0,0 +1,359 @@
+/**
+ * @file boot_scheduler.c
+ * @brief Ordonnanceur d'initialisation parallèle (Community Edition)
+ *
+ * Une tâche par étape, épinglée sur son cœur, attend les bits "terminé"
+ * de ses dépendances dans un groupe d'événements puis exécute son
+ * travail. Les bits "échec" sont rangés dans la moitié haute du même
+ * groupe: une étape dont une dépendance a échoué est sautée sans être
+ * exécutée. Les tâches s'auto-détruisent, aucune mémoire n'est retenue
+ * après le démarrage hormis la chronologie.
+ *
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_err.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/event_groups.h"
+#include "boot_scheduler.h"
+
+static const char *TAG = "BOOT_SCHEDULER";
+
+// Bits "terminé" 0..11, bits "échec" 12..23 (groupe d'événements 24 bits)
+#define BOOT_FAILED_SHIFT                   (BOOT_SCHEDULER_MAX_STAGES)
+#define BOOT_FAILED_BIT(index)              (1UL << ((index) + BOOT_FAILED_SHIFT))
+#define BOOT_FAILED_MASK(done_mask)         ((EventBits_t)(done_mask) << BOOT_FAILED_SHIFT)
+
+static const boot_stage_t *boot_stages = NULL;
+static size_t boot_stage_count = 0;
+static boot_stage_timing_t boot_timings[BOOT_SCHEDULER_MAX_STAGES];
+static uint32_t boot_required_mask = 0;
+static uint32_t boot_deferred_mask = 0;
+static int64_t boot_run_start_us = 0;
+
+static EventGroupHandle_t boot_stage_group = NULL;
+static EventGroupHandle_t boot_gate_group = NULL;
+static StaticEventGroup_t boot_stage_group_buffer;
+static StaticEventGroup_t boot_gate_group_buffer;
+
+static const char *boot_state_names[] = {
+    [BOOT_STAGE_PENDING] = "en attente",
+    [BOOT_STAGE_RUNNING] = "en cours",
+    [BOOT_STAGE_DONE]    = "OK",
+    [BOOT_STAGE_FAILED]  = "ÉCHEC",
+    [BOOT_STAGE_SKIPPED] = "sautée",
+};
+
+// ================================
+// Fonctions internes
+// ================================
+
+/**
+ * @brief Tâche d'exécution d'une étape
+ */
+static void boot_stage_task(void *pvParameters) {
+    size_t index = (size_t)(uintptr_t)pvParameters;
+    const boot_stage_t *stage = &boot_stages[index];
+    boot_stage_timing_t *timing = &boot_timings[index];
+
+    EventBits_t bits = 0;
+    if (stage->depends_on != 0) {
+        bits = xEventGroupWaitBits(boot_stage_group, stage->depends_on,
+                                   pdFALSE, pdTRUE, portMAX_DELAY);
+    }
+    timing->ready_us = esp_timer_get_time();
+    timing->core = xPortGetCoreID();
+
+    if ((bits & BOOT_FAILED_MASK(stage->depends_on)) != 0) {
+        timing->state = BOOT_STAGE_SKIPPED;
+        timing->result = ESP_ERR_INVALID_STATE;
+        timing->start_us = timing->end_us = timing->ready_us;
+        ESP_LOGW(TAG, "⏭️ Étape '%s' sautée: dépendance en échec", stage->name);
+        xEventGroupSetBits(boot_stage_group, BOOT_STAGE_BIT(index) | BOOT_FAILED_BIT(index));
+        vTaskDelete(NULL);
+        return;
+    }
+
+    timing->state = BOOT_STAGE_RUNNING;
+    timing->start_us = esp_timer_get_time();
+    esp_err_t ret = stage->fn();
+    timing->end_us = esp_timer_get_time();
+    timing->result = ret;
+    timing->state = (ret == ESP_OK) ? BOOT_STAGE_DONE : BOOT_STAGE_FAILED;
+
+    EventBits_t done = BOOT_STAGE_BIT(index);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ Étape '%s' en échec: %s", stage->name, esp_err_to_name(ret));
+        done |= BOOT_FAILED_BIT(index);
+    }
+    xEventGroupSetBits(boot_stage_group, done);
+    vTaskDelete(NULL);
+}
+
+/**
+ * @brief Vérifie la table d'étapes avant tout lancement
+ */
+static esp_err_t boot_validate_stages(const boot_stage_t *stages, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        const boot_stage_t *stage = &stages[i];
+
+        if (stage->name == NULL || stage->fn == NULL) {
+            ESP_LOGE(TAG, "❌ Étape %d incomplète", i);
+            return ESP_ERR_INVALID_ARG;
+        }
+        // Dépendances vers l'arrière uniquement: pas de cycle possible
+        if ((stage->depends_on & ~(BOOT_STAGE_BIT(i) - 1)) != 0) {
+            ESP_LOGE(TAG, "❌ Étape '%s': dépendance vers une étape ultérieure", stage->name);
+            return ESP_ERR_INVALID_ARG;
+        }
+        if (!stage->deferred) {
+            for (size_t d = 0; d < i; d++) {
+                if ((stage->depends_on & BOOT_STAGE_BIT(d)) && stages[d].deferred) {
+                    ESP_LOGE(TAG, "❌ Étape '%s': dépend de l'étape différée '%s'",
+                             stage->name, stages[d].name);
+                    return ESP_ERR_INVALID_ARG;
+                }
+            }
+        }
+        if (stage->core != tskNO_AFFINITY &&
+            (stage->core < 0 || stage->core >= portNUM_PROCESSORS)) {
+            ESP_LOGE(TAG, "❌ Étape '%s': cœur %d invalide", stage->name, stage->core);
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief Durée en ms d'un intervalle µs
+ */
+static uint32_t boot_us_to_ms(int64_t delta_us) {
+    return (delta_us > 0) ? (uint32_t)((delta_us + 500) / 1000) : 0;
+}
+
+// ================================
+// Fonctions publiques
+// ================================
+
+/**
+ * @brief Lance toutes les étapes et attend les étapes non différées
+ */
+esp_err_t boot_scheduler_run(const boot_stage_t *stages, size_t count, uint32_t timeout_ms) {
+    if (stages == NULL || count == 0 || count > BOOT_SCHEDULER_MAX_STAGES) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (boot_stages != NULL) {
+        ESP_LOGE(TAG, "❌ Ordonnanceur de démarrage déjà lancé");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    esp_err_t ret = boot_validate_stages(stages, count);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    boot_stage_group = xEventGroupCreateStatic(&boot_stage_group_buffer);
+    boot_gate_group = xEventGroupCreateStatic(&boot_gate_group_buffer);
+    if (boot_stage_group == NULL || boot_gate_group == NULL) {
+        ESP_LOGE(TAG, "❌ Échec création groupes d'événements de démarrage");
+        return ESP_ERR_NO_MEM;
+    }
+
+    boot_stages = stages;
+    boot_stage_count = count;
+    memset(boot_timings, 0, sizeof(boot_timings));
+    boot_required_mask = 0;
+    boot_deferred_mask = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (stages[i].deferred) {
+            boot_deferred_mask |= BOOT_STAGE_BIT(i);
+        } else {
+            boot_required_mask |= BOOT_STAGE_BIT(i);
+        }
+    }
+
+    ESP_LOGI(TAG, "🚦 Démarrage parallèle: %d étape(s), dont %d différée(s)",
+             count, __builtin_popcount(boot_deferred_mask));
+    boot_run_start_us = esp_timer_get_time();
+
+    for (size_t i = 0; i < count; i++) {
+#if CONFIG_FREERTOS_UNICORE
+        BaseType_t core = tskNO_AFFINITY;
+#else
+        BaseType_t core = stages[i].core;
+#endif
+        uint32_t stack_size = stages[i].stack_size ? stages[i].stack_size : BOOT_STAGE_DEFAULT_STACK_SIZE;
+
+        BaseType_t task_ret = xTaskCreatePinnedToCore(boot_stage_task, stages[i].name, stack_size,
+                                                      (void *)(uintptr_t)i, BOOT_STAGE_PRIORITY,
+                                                      NULL, core);
+        if (task_ret != pdPASS) {
+            // Les étapes déjà lancées voient la dépendance en échec et sont sautées
+            ESP_LOGE(TAG, "❌ Échec création tâche d'étape '%s'", stages[i].name);
+            boot_timings[i].state = BOOT_STAGE_FAILED;
+            boot_timings[i].result = ESP_ERR_NO_MEM;
+            xEventGroupSetBits(boot_stage_group, BOOT_STAGE_BIT(i) | BOOT_FAILED_BIT(i));
+        }
+    }
+
+    EventBits_t bits = xEventGroupWaitBits(boot_stage_group, boot_required_mask,
+                                           pdFALSE, pdTRUE, pdMS_TO_TICKS(timeout_ms));
+    if ((bits & boot_required_mask) != boot_required_mask) {
+        ESP_LOGE(TAG, "⏰ Étapes de démarrage non terminées après %lu ms", timeout_ms);
+        return ESP_ERR_TIMEOUT;
+    }
+
+    // Première erreur dans l'ordre de la table: cause racine des étapes sautées
+    for (size_t i = 0; i < count; i++) {
+        if (!stages[i].deferred && boot_timings[i].state != BOOT_STAGE_DONE) {
+            return boot_timings[i].result;
+        }
+    }
+
+    ESP_LOGI(TAG, "✅ Étapes requises terminées en %lu ms",
+             boot_us_to_ms(esp_timer_get_time() - boot_run_start_us));
+    return ESP_OK;
+}
+
+/**
+ * @brief Attend la fin des étapes différées
+ */
+esp_err_t boot_scheduler_wait_deferred(uint32_t timeout_ms) {
+    if (boot_stage_group == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (boot_deferred_mask == 0) {
+        return ESP_OK;
+    }
+
+    EventBits_t bits = xEventGroupWaitBits(boot_stage_group, boot_deferred_mask,
+                                           pdFALSE, pdTRUE, pdMS_TO_TICKS(timeout_ms));
+    if ((bits & boot_deferred_mask) != boot_deferred_mask) {
+        return ESP_ERR_TIMEOUT;
+    }
+
+    return ((bits & BOOT_FAILED_MASK(boot_deferred_mask)) == 0) ? ESP_OK : ESP_FAIL;
+}
+
+/**
+ * @brief Chronologie d'une étape
+ */
+esp_err_t boot_scheduler_get_timing(size_t index, boot_stage_timing_t *timing) {
+    if (timing == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (index >= boot_stage_count) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    *timing = boot_timings[index];
+    return ESP_OK;
+}
+
+/**
+ * @brief Affiche la chronologie de démarrage par étape
+ */
+void boot_scheduler_print_timings(void) {
+    if (boot_stages == NULL) {
+        return;
+    }
+
+    int64_t first_start = INT64_MAX;
+    int64_t last_end = 0;
+    int64_t busy_us = 0;
+
+    ESP_LOGI(TAG, "⏱️ === Chronologie de démarrage (ms depuis le boot) ===");
+    for (size_t i = 0; i < boot_stage_count; i++) {
+        const boot_stage_timing_t *t = &boot_timings[i];
+
+        if (t->state == BOOT_STAGE_PENDING || t->state == BOOT_STAGE_RUNNING) {
+            ESP_LOGI(TAG, "  %-18s %s", boot_stages[i].name, boot_stage_state_to_string(t->state));
+            continue;
+        }
+        ESP_LOGI(TAG, "  %-18s cœur %d  prête %5lu  début %5lu  fin %5lu  durée %5lu  %s%s",
+                 boot_stages[i].name, t->core,
+                 boot_us_to_ms(t->ready_us), boot_us_to_ms(t->start_us),
+                 boot_us_to_ms(t->end_us), boot_us_to_ms(t->end_us - t->start_us),
+                 boot_stage_state_to_string(t->state),
+                 boot_stages[i].deferred ? " (différée)" : "");
+
+        if (t->start_us < first_start) {
+            first_start = t->start_us;
+        }
+        if (t->end_us > last_end) {
+            last_end = t->end_us;
+        }
+        busy_us += t->end_us - t->start_us;
+    }
+
+    if (last_end > first_start) {
+        // Somme des durées vs temps mur: gain de la parallélisation
+        ESP_LOGI(TAG, "  Total: %lu ms mur pour %lu ms de travail cumulé",
+                 boot_us_to_ms(last_end - first_start), boot_us_to_ms(busy_us));
+    }
+}
+
+/**
+ * @brief Nom d'un état d'étape
+ */
+const char* boot_stage_state_to_string(boot_stage_state_t state) {
+    if ((unsigned)state >= sizeof(boot_state_names) / sizeof(boot_state_names[0])) {
+        return "inconnu";
+    }
+    return boot_state_names[state];
+}
+
+/**
+ * @brief Ouvre une barrière
+ */
+void boot_gate_open(uint32_t gates) {
+    if (boot_gate_group == NULL) {
+        ESP_LOGW(TAG, "⚠️ Barrière 0x%lx ouverte avant le démarrage de l'ordonnanceur", gates);
+        return;
+    }
+    xEventGroupSetBits(boot_gate_group, gates);
+    ESP_LOGI(TAG, "🔓 Barrière 0x%lx ouverte", gates);
+}
+
+/**
+ * @brief Barrière(s) ouverte(s) ?
+ */
+bool boot_gate_is_open(uint32_t gates) {
+    if (boot_gate_group == NULL) {
+        return false;
+    }
+    return (xEventGroupGetBits(boot_gate_group) & gates) == gates;
+}
+
+/**
+ * @brief Attend l'ouverture d'une barrière
+ */
+esp_err_t boot_gate_wait(uint32_t gates, uint32_t timeout_ms) {
+    if (boot_gate_group == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    EventBits_t bits = xEventGroupWaitBits(boot_gate_group, gates, pdFALSE, pdTRUE,
+                                           pdMS_TO_TICKS(timeout_ms));
+    return ((bits & gates) == gates) ? ESP_OK : ESP_ERR_TIMEOUT;
+}
+
+/**
+ * @brief Vérifie une barrière avant une action sensible
+ */
+esp_err_t boot_gate_require(uint32_t gates, const char *action) {
+    if (boot_gate_is_open(gates)) {
+        return ESP_OK;
+    }
+
+    ESP_LOGW(TAG, "🔒 %s refusé: vérification de démarrage non terminée",
+             action != NULL ? action : "Action");
+    return ESP_ERR_INVALID_STATE;
+}
\ No newline at end of file
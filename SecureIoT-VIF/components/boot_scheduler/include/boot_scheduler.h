@@ -0,0 +1,151 @@
+/**
+ * @file boot_scheduler.h
+ * @brief Ordonnanceur d'initialisation parallèle (Community Edition)
+ *
+ * Chaque étape de démarrage tourne dans sa propre tâche, épinglée sur
+ * un cœur, dès que ses dépendances sont terminées. Les étapes différées
+ * (vérification d'intégrité) ne retardent pas la mise en service: les
+ * actions sensibles attendent la barrière correspondante.
+ *
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#ifndef BOOT_SCHEDULER_H
+#define BOOT_SCHEDULER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+
+// ================================
+// Constantes Community
+// ================================
+
+#define BOOT_SCHEDULER_MAX_STAGES           (12)
+#define BOOT_STAGE_DEFAULT_STACK_SIZE       (6144)      // Graine DRBG et SHA-256 mbedTLS
+#define BOOT_STAGE_PRIORITY                 (5)         // Au-dessus de app_main, sous les tâches applicatives
+#define BOOT_STAGE_BIT(index)               (1UL << (index))
+
+// Barrières des actions sensibles
+#define BOOT_GATE_INTEGRITY_VERIFIED        (1UL << 0)  // Vérification d'intégrité de démarrage réussie
+
+// ================================
+// Types et structures Community
+// ================================
+
+typedef esp_err_t (*boot_stage_fn_t)(void);
+
+/**
+ * @brief Description d'une étape de démarrage
+ */
+typedef struct {
+    const char *name;               // Nom affiché dans le rapport
+    boot_stage_fn_t fn;             // Travail de l'étape
+    uint32_t depends_on;            // BOOT_STAGE_BIT() des étapes préalables (indices inférieurs)
+    BaseType_t core;                // Cœur (0, 1 ou tskNO_AFFINITY)
+    uint32_t stack_size;            // 0 = BOOT_STAGE_DEFAULT_STACK_SIZE
+    bool deferred;                  // N'est pas attendue par boot_scheduler_run()
+} boot_stage_t;
+
+/**
+ * @brief État d'une étape
+ */
+typedef enum {
+    BOOT_STAGE_PENDING = 0,         // En attente de ses dépendances
+    BOOT_STAGE_RUNNING,             // En cours
+    BOOT_STAGE_DONE,                // Terminée avec succès
+    BOOT_STAGE_FAILED,              // Terminée en erreur
+    BOOT_STAGE_SKIPPED              // Non exécutée: une dépendance a échoué
+} boot_stage_state_t;
+
+/**
+ * @brief Chronologie d'une étape (µs depuis le démarrage)
+ */
+typedef struct {
+    boot_stage_state_t state;
+    esp_err_t result;
+    int64_t ready_us;               // Dépendances satisfaites
+    int64_t start_us;               // Début du travail
+    int64_t end_us;                 // Fin du travail
+    BaseType_t core;                // Cœur effectif
+} boot_stage_timing_t;
+
+// ================================
+// Fonctions Community
+// ================================
+
+/**
+ * @brief Lance toutes les étapes et attend les étapes non différées
+ *
+ * Une étape ne peut dépendre que d'étapes d'indice inférieur (graphe
+ * acyclique par construction), et une étape non différée ne peut pas
+ * dépendre d'une étape différée.
+ *
+ * @param stages Tableau d'étapes (doit rester valide jusqu'à la fin des étapes différées)
+ * @param count Nombre d'étapes
+ * @param timeout_ms Attente maximale des étapes non différées
+ * @return ESP_OK, erreur de la première étape non différée en échec, ESP_ERR_TIMEOUT
+ */
+esp_err_t boot_scheduler_run(const boot_stage_t *stages, size_t count, uint32_t timeout_ms);
+
+/**
+ * @brief Attend la fin des étapes différées
+ *
+ * @return ESP_OK si toutes ont réussi, ESP_FAIL si l'une a échoué ou a été sautée, ESP_ERR_TIMEOUT
+ */
+esp_err_t boot_scheduler_wait_deferred(uint32_t timeout_ms);
+
+/**
+ * @brief Chronologie d'une étape
+ */
+esp_err_t boot_scheduler_get_timing(size_t index, boot_stage_timing_t *timing);
+
+/**
+ * @brief Affiche la chronologie de démarrage par étape
+ */
+void boot_scheduler_print_timings(void);
+
+/**
+ * @brief Nom d'un état d'étape
+ */
+const char* boot_stage_state_to_string(boot_stage_state_t state);
+
+/**
+ * @brief Ouvre une barrière (appelé par l'étape qui la conditionne)
+ */
+void boot_gate_open(uint32_t gates);
+
+/**
+ * @brief Barrière(s) ouverte(s) ?
+ */
+bool boot_gate_is_open(uint32_t gates);
+
+/**
+ * @brief Attend l'ouverture d'une barrière
+ *
+ * @return ESP_OK, ESP_ERR_TIMEOUT, ESP_ERR_INVALID_STATE avant boot_scheduler_run()
+ */
+esp_err_t boot_gate_wait(uint32_t gates, uint32_t timeout_ms);
+
+/**
+ * @brief Vérifie une barrière avant une action sensible (non bloquant)
+ *
+ * @param gates Barrière(s) requise(s)
+ * @param action Nom de l'action, pour le log de refus
+ * @return ESP_OK si ouverte, ESP_ERR_INVALID_STATE sinon
+ */
+esp_err_t boot_gate_require(uint32_t gates, const char *action);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BOOT_SCHEDULER_H */
\ No newline at end of file
@@ -19,7 +19,9 @@ extern "C" {
 
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
 #include "esp_err.h"
+#include "freertos/FreeRTOS.h"
 
 // ================================
 // Types et énumérations Community
@@ -37,6 +39,14 @@ typedef enum {
     INTEGRITY_MAX
 } integrity_status_t;
 
+/**
+ * @brief Chemin de lecture de la flash
+ */
+typedef enum {
+    INTEGRITY_READ_BUFFERED = 0,        // esp_partition_read par blocs sur la pile
+    INTEGRITY_READ_MMAP                 // Image projetée par le MMU du cache flash
+} integrity_read_mode_t;
+
 /**
  * @brief Statistiques d'intégrité Community
  */
@@ -48,8 +58,67 @@ typedef struct {
     uint32_t last_check_duration_ms;    // Durée dernière vérification
     uint32_t chunks_verified;           // Chunks vérifiés au total
     uint32_t chunks_corrupted;          // Chunks corrompus détectés
+    
+    // Vérification incrémentale (balayage par tranches)
+    uint32_t total_chunks;              // Chunks d'une passe complète
+    uint32_t sweep_cursor;              // Prochain chunk à vérifier
+    uint32_t sweep_chunks_done;         // Chunks vérifiés dans la passe courante
+    uint32_t sweeps_completed;          // Passes complètes terminées
+    uint8_t coverage_percent;           // Couverture de la passe courante (%)
+    uint32_t slices_executed;           // Tranches exécutées
+    uint32_t max_slice_duration_us;     // Durée max d'une tranche
+    uint32_t slice_budget_overruns;     // Tranches ayant dépassé le budget
+    uint32_t last_sweep_duration_ms;    // Durée murale de la dernière passe
+    uint64_t last_sweep_complete_time;  // Fin de la dernière passe (ms)
+    
+    // Périmètre vérifié
+    uint32_t image_size;                // Octets de l'image applicative
+    uint32_t partition_size;            // Taille de la partition OTA
+    bool padding_verified;              // Remplissage prouvé à 0xFF
+    uint32_t padding_dirty_chunks;      // Chunks de remplissage non effacés
+    
+    // Condensat de l'image entière (même passe que les chunks)
+    uint32_t image_digest_checks;       // Comparaisons au SHA-256 ajouté au build
+    uint32_t image_digest_failures;     // Comparaisons échouées
+    
+    // Chemin de lecture
+    integrity_read_mode_t read_mode;    // Chemin actif
+    uint32_t mmap_pages;                // Pages MMU occupées par la projection
 } integrity_stats_community_t;
 
+/**
+ * @brief Configuration du balayage incrémental
+ */
+typedef struct {
+    uint32_t chunks_per_slice;          // Chunks max par tranche
+    uint32_t slice_budget_us;           // Budget CPU par tranche (µs)
+    uint32_t slice_period_ms;           // Pause entre deux tranches
+    uint32_t task_priority;             // Priorité de la tâche de balayage
+    uint32_t task_stack_size;           // Pile de la tâche de balayage
+    BaseType_t task_core;               // Cœur de la tâche (tskNO_AFFINITY: libre)
+} integrity_sweep_config_t;
+
+/**
+ * @brief Mesure d'un chemin de lecture (hachage de toute l'image)
+ */
+typedef struct {
+    integrity_read_mode_t mode;         // Chemin mesuré
+    bool available;                     // Chemin utilisable (pages MMU suffisantes)
+    uint32_t chunks;                    // Chunks hachés
+    uint32_t total_time_us;             // Durée totale
+    uint32_t heap_used_bytes;           // Heap consommé pendant la mesure
+    uint32_t mmap_pages;                // Pages MMU consommées
+} integrity_read_bench_t;
+
+/**
+ * @brief Callback appelé par la tâche de balayage en cas d'échec
+ * 
+ * @param status Status de l'échec
+ * @param chunk_id Chunk concerné
+ * @param arg Argument utilisateur
+ */
+typedef void (*integrity_failure_cb_t)(integrity_status_t status, size_t chunk_id, void *arg);
+
 // ================================
 // Constantes Community
 // ================================
@@ -57,6 +126,16 @@ typedef struct {
 #define INTEGRITY_CHUNK_SIZE_COMMUNITY      (8192)      // Plus gros qu'Enterprise
 #define INTEGRITY_SAMPLE_RATIO_COMMUNITY    (0.1f)      // 10% des chunks seulement
 #define INTEGRITY_MAX_CHUNKS_COMMUNITY      (256)       // Limite éducative
+#define INTEGRITY_STREAM_BLOCK_SIZE_COMMUNITY (512)     // Bloc de lecture sur la pile
+#define INTEGRITY_MMAP_RESERVE_PAGES_COMMUNITY (8)      // Pages MMU laissées au reste du système
+
+// Balayage incrémental par défaut
+#define INTEGRITY_SWEEP_CHUNKS_PER_SLICE_COMMUNITY  (4)         // Chunks max par tranche
+#define INTEGRITY_SWEEP_SLICE_BUDGET_US_COMMUNITY   (3000)      // Budget CPU par tranche
+#define INTEGRITY_SWEEP_SLICE_PERIOD_MS_COMMUNITY   (50)        // Pause entre tranches
+#define INTEGRITY_SWEEP_TASK_PRIORITY_COMMUNITY     (2)         // Sous capteurs et monitoring
+#define INTEGRITY_SWEEP_TASK_STACK_COMMUNITY        (4096)
+#define INTEGRITY_SWEEP_TASK_CORE_COMMUNITY         (tskNO_AFFINITY)
 
 // ================================
 // Fonctions d'initialisation
@@ -102,6 +181,59 @@ integrity_status_t integrity_check_firmware_basic(void);
  */
 integrity_status_t integrity_check_chunk_basic(size_t chunk_id);
 
+// ================================
+// Vérification incrémentale
+// ================================
+
+/**
+ * @brief Exécute une tranche du balayage incrémental
+ * 
+ * Reprend au curseur courant et vérifie au plus max_chunks chunks, en
+ * s'arrêtant dès que budget_us est consommé (au moins un chunk par tranche).
+ * Le curseur revient à 0 à la fin d'une passe complète.
+ * 
+ * @param max_chunks Nombre maximal de chunks pour cette tranche
+ * @param budget_us Budget CPU de la tranche en microsecondes (0 = illimité)
+ * @param sweep_done Mis à true si la tranche a terminé une passe (peut être NULL)
+ * @param failed_chunk Premier chunk en échec de la tranche (peut être NULL)
+ * @return integrity_status_t INTEGRITY_OK ou le premier échec de la tranche
+ */
+integrity_status_t integrity_sweep_step(uint32_t max_chunks, uint32_t budget_us,
+                                        bool *sweep_done, size_t *failed_chunk);
+
+/**
+ * @brief Démarre la tâche de balayage incrémental basse priorité
+ * 
+ * Une première passe démarre immédiatement, les suivantes sur demande
+ * (integrity_sweep_request()).
+ * 
+ * @param config Configuration (NULL = valeurs par défaut Community)
+ * @param on_failure Callback d'échec, appelé depuis la tâche (peut être NULL)
+ * @param arg Argument du callback
+ * @return ESP_OK si succès, ESP_ERR_INVALID_STATE si déjà démarrée
+ */
+esp_err_t integrity_sweep_start(const integrity_sweep_config_t *config,
+                                integrity_failure_cb_t on_failure, void *arg);
+
+/**
+ * @brief Arrête la tâche de balayage incrémental
+ * 
+ * @return ESP_OK si succès
+ */
+esp_err_t integrity_sweep_stop(void);
+
+/**
+ * @brief Demande une nouvelle passe complète
+ * 
+ * Non bloquant, utilisable depuis un callback esp_timer. Sans effet si une
+ * passe est déjà en cours: les demandes reçues pendant une passe sont
+ * effacées à sa fin, plusieurs demandes entre deux passes n'en lancent
+ * qu'une.
+ * 
+ * @return ESP_OK si succès, ESP_ERR_INVALID_STATE si la tâche n'existe pas
+ */
+esp_err_t integrity_sweep_request(void);
+
 // ================================
 // Fonctions de statistiques Community
 // ================================
@@ -119,6 +251,47 @@ esp_err_t integrity_get_stats_community(integrity_stats_community_t *stats);
  */
 void integrity_print_stats_community(void);
 
+/**
+ * @brief Sélectionne le chemin de lecture de la flash
+ * 
+ * INTEGRITY_READ_MMAP projette l'image une seule fois et hache directement
+ * depuis le cache flash. Si les pages MMU libres sont insuffisantes, le
+ * chemin reste en lecture bufferisée.
+ * 
+ * @param mode Chemin souhaité
+ * @return ESP_OK si appliqué, ESP_ERR_NO_MEM si repli en lecture bufferisée,
+ *         ESP_ERR_INVALID_STATE si le balayage est actif
+ */
+esp_err_t integrity_set_read_mode(integrity_read_mode_t mode);
+
+/**
+ * @brief Obtient le chemin de lecture actif
+ * 
+ * @return Chemin de lecture actif
+ */
+integrity_read_mode_t integrity_get_read_mode(void);
+
+/**
+ * @brief Compare les deux chemins de lecture sur l'image complète
+ * 
+ * Doit être appelé hors balayage. Le chemin actif est restauré.
+ * 
+ * @param results Tableau de 2 résultats (bufferisé, mmap)
+ * @return ESP_OK si succès
+ */
+esp_err_t integrity_benchmark_read_paths(integrity_read_bench_t results[2]);
+
+/**
+ * @brief Obtient le condensat SHA-256 de l'image entière
+ * 
+ * Calculé pendant le balayage, dans la même lecture que les condensats
+ * par chunk. Exclut le SHA-256 ajouté par le build lorsqu'il est présent.
+ * 
+ * @param digest Buffer de sortie (32 bytes)
+ * @return ESP_OK si succès, ESP_ERR_INVALID_STATE si aucune passe complète
+ */
+esp_err_t integrity_get_image_digest(uint8_t *digest);
+
 /**
  * @brief Réinitialise les statistiques d'intégrité
  * 
@@ -135,12 +308,16 @@ esp_err_t integrity_reset_stats_community(void);
  * 
  * Auto-test pour vérifier que toutes les fonctions de base marchent.
  * 
+ * Compilée seulement avec CONFIG_APP_SELF_TESTS (profil de développement).
+ * 
  * @return ESP_OK si tous les tests passent, ESP_FAIL sinon
  */
 esp_err_t integrity_checker_self_test(void);
 
 /**
  * @brief Affiche les informations du vérificateur Community
+ * 
+ * Compilée seulement avec CONFIG_APP_BANNERS (profil de développement).
  */
 void integrity_checker_print_info(void);
 
@@ -0,0 +1,227 @@
+/**
+ * @file integrity_manifest.h
+ * @brief Manifeste de référence des chunks du firmware - Community Edition
+ * 
+ * Table contiguë de condensats SHA-256 (un par chunk) persistée en NVS,
+ * protégée par une racine de Merkle. Chaque vérification de chunk devient
+ * un simple memcmp contre la table chargée en RAM.
+ * 
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#ifndef INTEGRITY_MANIFEST_H
+#define INTEGRITY_MANIFEST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "integrity_checker.h"
+
+// ================================
+// Constantes du manifeste
+// ================================
+
+#define INTEGRITY_MANIFEST_MAGIC            (0x4D464953)    // "SIFM"
+#define INTEGRITY_MANIFEST_VERSION          (1)
+#define INTEGRITY_MANIFEST_DIGEST_SIZE      (32)            // SHA-256
+#define INTEGRITY_MANIFEST_NVS_NAMESPACE    "integrity"
+#define INTEGRITY_MANIFEST_NVS_KEY          "manifest"
+#define INTEGRITY_MANIFEST_NVS_KEY_NEXT     "manifest_next" // Manifeste de l'image OTA en attente
+
+#define INTEGRITY_MANIFEST_BLOB_SIZE(count) \
+    (sizeof(integrity_manifest_header_t) + (size_t)(count) * INTEGRITY_MANIFEST_DIGEST_SIZE)
+
+// ================================
+// Types et structures
+// ================================
+
+/**
+ * @brief En-tête persisté du manifeste
+ */
+typedef struct {
+    uint32_t magic;                     // INTEGRITY_MANIFEST_MAGIC
+    uint16_t version;                   // INTEGRITY_MANIFEST_VERSION
+    uint16_t chunk_count;               // Nombre de condensats valides
+    uint32_t chunk_size;                // Taille des chunks (octets)
+    uint32_t image_size;                // Octets couverts par le manifeste
+    uint8_t app_elf_sha256[32];         // Identité du firmware de référence
+    uint8_t root_hash[INTEGRITY_MANIFEST_DIGEST_SIZE]; // Racine de Merkle
+} integrity_manifest_header_t;
+
+/**
+ * @brief Image persistée du manifeste (en-tête + table contiguë)
+ * 
+ * Même format pour le manifeste courant et pour celui qui accompagne une
+ * mise à jour OTA (tools/ota_manifest.py). Seuls les header.chunk_count
+ * premiers condensats sont stockés et significatifs.
+ */
+typedef struct {
+    integrity_manifest_header_t header;
+    uint8_t digests[INTEGRITY_MAX_CHUNKS_COMMUNITY][INTEGRITY_MANIFEST_DIGEST_SIZE];
+} integrity_manifest_blob_t;
+
+/**
+ * @brief État du manifeste en RAM
+ */
+typedef enum {
+    INTEGRITY_MANIFEST_EMPTY = 0,       // Aucun manifeste
+    INTEGRITY_MANIFEST_LEARNING,        // Construction en cours (premier boot)
+    INTEGRITY_MANIFEST_READY            // Chargé et vérifié
+} integrity_manifest_state_t;
+
+// ================================
+// Chargement et construction
+// ================================
+
+/**
+ * @brief Charge le manifeste depuis NVS et vérifie sa racine
+ * 
+ * Si aucun manifeste n'existe, ou s'il décrit un autre firmware, le
+ * manifeste passe en mode apprentissage: la prochaine passe de balayage
+ * le construit puis le persiste.
+ * 
+ * @param image_size Octets du firmware à couvrir
+ * @return ESP_OK si chargé ou en apprentissage, ESP_ERR_INVALID_CRC si la
+ *         table stockée ne correspond pas à sa racine
+ */
+esp_err_t integrity_manifest_load(uint32_t image_size);
+
+/**
+ * @brief Enregistre le condensat d'un chunk pendant l'apprentissage
+ * 
+ * @param chunk_id Index du chunk
+ * @param digest Condensat SHA-256 du chunk
+ * @return ESP_OK si succès, ESP_ERR_INVALID_STATE hors apprentissage
+ */
+esp_err_t integrity_manifest_learn_chunk(size_t chunk_id, const uint8_t *digest);
+
+/**
+ * @brief Termine l'apprentissage: calcule la racine et persiste en NVS
+ * 
+ * @return ESP_OK si succès
+ */
+esp_err_t integrity_manifest_commit(void);
+
+/**
+ * @brief Vérifie le format d'un manifeste et la racine de sa table
+ * 
+ * @param blob Manifeste
+ * @param blob_size Octets valides (INTEGRITY_MANIFEST_BLOB_SIZE(chunk_count))
+ * @return ESP_OK, ESP_ERR_INVALID_VERSION si le format ne correspond pas,
+ *         ESP_ERR_INVALID_CRC si la table ne correspond pas à sa racine
+ */
+esp_err_t integrity_manifest_validate_blob(const integrity_manifest_blob_t *blob, size_t blob_size);
+
+/**
+ * @brief Persiste le manifeste d'une image OTA, adopté au premier démarrage de celle-ci
+ * 
+ * Le manifeste courant reste en place: un retour arrière vers l'image
+ * actuelle ne déclenche aucun apprentissage.
+ * 
+ * @param blob Manifeste validé de la nouvelle image
+ * @return ESP_OK si succès
+ */
+esp_err_t integrity_manifest_stage_next(const integrity_manifest_blob_t *blob);
+
+/**
+ * @brief Efface le manifeste (RAM et NVS)
+ * 
+ * @return ESP_OK si succès
+ */
+esp_err_t integrity_manifest_erase(void);
+
+// ================================
+// Vérification
+// ================================
+
+/**
+ * @brief Compare le condensat d'un chunk à la référence (un memcmp)
+ * 
+ * @param chunk_id Index du chunk
+ * @param digest Condensat calculé
+ * @return INTEGRITY_OK si identique ou si le chunk n'est pas couvert,
+ *         INTEGRITY_CORRUPTED sinon
+ */
+integrity_status_t integrity_manifest_check_chunk(size_t chunk_id, const uint8_t *digest);
+
+/**
+ * @brief Indique si un chunk a le même condensat que dans le manifeste chargé
+ * 
+ * Contrairement à integrity_manifest_check_chunk(), répond false pour un
+ * chunk non couvert ou sans manifeste prêt: rien ne permet de lui faire
+ * confiance.
+ */
+bool integrity_manifest_chunk_unchanged(size_t chunk_id, const uint8_t *digest);
+
+/**
+ * @brief Localise le premier chunk corrompu par comparaison des feuilles
+ * 
+ * Les condensats des feuilles sont en RAM: chaque chunk est re-haché depuis
+ * la flash et comparé à sa feuille, avec arrêt à la première divergence.
+ * Coût: au plus n lectures flash et n hachages, sans recalcul de l'arbre.
+ * 
+ * @param chunk_id Chunk corrompu trouvé
+ * @return INTEGRITY_CORRUPTED si un chunk a été isolé, INTEGRITY_OK si
+ *         l'image correspond au manifeste
+ */
+integrity_status_t integrity_manifest_locate_corruption(size_t *chunk_id);
+
+/**
+ * @brief Compare la racine du manifeste à une racine de confiance
+ * 
+ * Court-circuite une vérification d'image complète quand la racine
+ * attendue est connue (signature, attestation...).
+ * 
+ * @param expected_root Racine attendue (32 bytes)
+ * @return true si identique
+ */
+bool integrity_manifest_root_matches(const uint8_t *expected_root);
+
+// ================================
+// Accès
+// ================================
+
+/**
+ * @brief Obtient l'état du manifeste
+ */
+integrity_manifest_state_t integrity_manifest_get_state(void);
+
+/**
+ * @brief Obtient la racine de Merkle du manifeste
+ * 
+ * @param root Buffer de sortie (32 bytes)
+ * @return ESP_OK si succès, ESP_ERR_INVALID_STATE si pas prêt
+ */
+esp_err_t integrity_manifest_get_root(uint8_t *root);
+
+/**
+ * @brief Obtient le nombre de chunks couverts par le manifeste
+ */
+size_t integrity_manifest_get_chunk_count(void);
+
+/**
+ * @brief Calcule la racine de Merkle d'une suite de condensats
+ * 
+ * Découpage RFC 6962: nœud = SHA-256(0x01 || gauche || droite), la
+ * moitié gauche couvrant la plus grande puissance de 2 < n.
+ * 
+ * @param leaves Condensats des chunks
+ * @param count Nombre de condensats
+ * @param root Buffer de sortie (32 bytes)
+ * @return ESP_OK si succès
+ */
+esp_err_t integrity_manifest_merkle_root(const uint8_t (*leaves)[INTEGRITY_MANIFEST_DIGEST_SIZE],
+                                         size_t count, uint8_t *root);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INTEGRITY_MANIFEST_H */
\ No newline at end of file
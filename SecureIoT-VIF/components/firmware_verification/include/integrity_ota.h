@@ -0,0 +1,112 @@
+/**
+ * @file integrity_ota.h
+ * @brief Vérification différentielle d'une image OTA (Community Edition)
+ *
+ * L'image OTA est accompagnée de son manifeste (même format que
+ * integrity_manifest_blob_t, produit par tools/ota_manifest.py). Seuls les
+ * chunks dont le condensat diffère du manifeste courant sont relus et
+ * hachés dans la partition cible; les chunks inchangés, recopiés depuis
+ * l'image précédente, sont hérités via leur condensat identique. Le temps
+ * de vérification suit la taille du delta, pas celle de l'image.
+ *
+ * Séquence: esp_ota_write() ... esp_ota_end(), puis
+ * integrity_ota_begin() -> integrity_ota_verify() -> integrity_ota_finish()
+ * et enfin esp_ota_set_boot_partition(). Au premier démarrage de la
+ * nouvelle image, integrity_manifest_load() adopte le manifeste sans passe
+ * d'apprentissage.
+ *
+ * Le manifeste doit provenir du même canal authentifié que l'image: sa
+ * racine (header.root_hash) engage toute la table, c'est elle qu'il faut
+ * signer.
+ *
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#ifndef INTEGRITY_OTA_H
+#define INTEGRITY_OTA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "esp_partition.h"
+#include "integrity_manifest.h"
+
+// ================================
+// Types et structures Community
+// ================================
+
+/**
+ * @brief Bilan de la dernière vérification différentielle
+ */
+typedef struct {
+    uint32_t chunks_total;              // Chunks de la nouvelle image
+    uint32_t chunks_changed;            // Condensat différent du manifeste courant
+    uint32_t chunks_reused;             // Hérités sans relecture
+    uint32_t chunks_verified;           // Chunks modifiés relus et conformes
+    uint32_t chunks_failed;             // Chunks modifiés non conformes
+    uint32_t bytes_hashed;              // Octets relus dans la partition cible
+    uint32_t verify_time_us;            // Durée de integrity_ota_verify()
+    bool full_verify;                   // Aucun manifeste courant: tout relu
+} integrity_ota_stats_t;
+
+// ================================
+// Fonctions Community
+// ================================
+
+/**
+ * @brief Prépare la vérification d'une image OTA écrite dans une partition
+ *
+ * Valide le format et la racine du manifeste, puis calcule l'ensemble des
+ * chunks modifiés par rapport au manifeste courant. Sans manifeste prêt
+ * (apprentissage en cours), tous les chunks sont considérés modifiés.
+ *
+ * @param partition Partition OTA cible (déjà écrite)
+ * @param blob Manifeste de la nouvelle image, conservé par l'appelant jusqu'à finish/abort
+ * @param blob_size Octets valides du manifeste
+ * @return ESP_OK, ESP_ERR_INVALID_VERSION (format), ESP_ERR_INVALID_CRC (racine),
+ *         ESP_ERR_INVALID_SIZE (image plus grande que la partition), ESP_ERR_INVALID_STATE
+ */
+esp_err_t integrity_ota_begin(const esp_partition_t *partition,
+                              const integrity_manifest_blob_t *blob, size_t blob_size);
+
+/**
+ * @brief Relit et vérifie uniquement les chunks modifiés
+ *
+ * @return ESP_OK si tous les chunks modifiés correspondent au manifeste,
+ *         ESP_ERR_INVALID_CRC sinon
+ */
+esp_err_t integrity_ota_verify(void);
+
+/**
+ * @brief Contrôle l'identité de l'image et met le manifeste en attente
+ *
+ * Exige une vérification réussie et que header.app_elf_sha256 corresponde
+ * à la description de l'application écrite dans la partition. L'appelant
+ * active ensuite la partition (esp_ota_set_boot_partition()).
+ *
+ * @return ESP_OK, ESP_ERR_INVALID_STATE (pas vérifiée), ESP_ERR_INVALID_VERSION (autre image)
+ */
+esp_err_t integrity_ota_finish(void);
+
+/**
+ * @brief Abandonne la vérification en cours
+ */
+void integrity_ota_abort(void);
+
+/**
+ * @brief Obtient le bilan de la dernière vérification
+ */
+esp_err_t integrity_ota_get_stats(integrity_ota_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INTEGRITY_OTA_H */
\ No newline at end of file
@@ -15,16 +15,326 @@
 #include "esp_log.h"
 #include "esp_err.h"
 #include "esp_system.h"
+#include "esp_timer.h"
 #include "esp_partition.h"
 #include "esp_ota_ops.h"
+#include "esp_image_format.h"
+#include "esp_spi_flash.h"
+#include "esp_heap_caps.h"
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 #include "crypto_operations_basic.h"
 #include "integrity_checker.h"
+#include "integrity_manifest.h"
+#include "integrity_internal.h"
+#include "perf_trace.h"
 
 static const char *TAG = "INTEGRITY_COMMUNITY";
 
 // Variables globales pour la vérification Community
 static bool integrity_checker_initialized = false;
 static integrity_stats_community_t integrity_stats = {0};
+static portMUX_TYPE integrity_stats_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// État du balayage incrémental
+static uint64_t sweep_start_time = 0;
+static TaskHandle_t sweep_task_handle = NULL;
+static volatile bool sweep_task_running = false;
+static integrity_sweep_config_t sweep_config;
+static integrity_failure_cb_t sweep_failure_cb = NULL;
+static void *sweep_failure_arg = NULL;
+
+// Périmètre réel de l'image (en-tête + segments + checksum/hash)
+static uint32_t integrity_image_size = 0;
+static volatile bool integrity_padding_proven = false;
+static bool sweep_padding_dirty = false;
+
+// Condensat de l'image entière, calculé pendant la même passe que les chunks
+static uint32_t integrity_image_digest_len = 0;
+static bool integrity_image_hash_appended = false;
+static uint8_t integrity_image_expected_digest[32];
+static uint8_t integrity_image_digest[32];
+static bool integrity_image_digest_valid = false;
+static crypto_basic_sha256_ctx_t sweep_image_ctx;
+
+// Projection de l'image par le MMU du cache flash (lecture sans copie)
+static const uint8_t *integrity_mmap_base = NULL;
+static spi_flash_mmap_handle_t integrity_mmap_handle;
+static uint32_t integrity_mmap_pages = 0;
+
+/**
+ * @brief Octets de la partition appartenant réellement à l'application
+ */
+static uint32_t integrity_covered_size(const esp_partition_t *partition) {
+    if (integrity_image_size == 0 || integrity_image_size > partition->size) {
+        return partition->size;
+    }
+    return integrity_image_size;
+}
+
+/**
+ * @brief Détermine la taille de l'image via l'en-tête et les segments
+ */
+static uint32_t integrity_resolve_image_size(const esp_partition_t *partition) {
+    const esp_partition_pos_t part_pos = {
+        .offset = partition->address,
+        .size = partition->size,
+    };
+    esp_image_metadata_t metadata;
+    
+    esp_err_t ret = esp_image_get_metadata(&part_pos, &metadata);
+    if (ret != ESP_OK || metadata.image_len == 0 || metadata.image_len > partition->size) {
+        ESP_LOGW(TAG, "⚠️  Métadonnées image indisponibles (%s), partition complète vérifiée",
+                 esp_err_to_name(ret));
+        integrity_image_digest_len = partition->size;
+        integrity_image_hash_appended = false;
+        return partition->size;
+    }
+    
+    ESP_LOGI(TAG, "📦 Image: %d bytes en %d segments (partition %d bytes)",
+             metadata.image_len, metadata.image.segment_count, partition->size);
+    
+    // SHA-256 ajouté par le build: couvre tous les octets qui le précèdent
+    integrity_image_digest_len = metadata.image_len;
+    integrity_image_hash_appended = false;
+    if (metadata.image.hash_appended && metadata.image_len > sizeof(integrity_image_expected_digest)) {
+        uint32_t hash_offset = metadata.image_len - sizeof(integrity_image_expected_digest);
+        if (esp_partition_read(partition, hash_offset, integrity_image_expected_digest,
+                               sizeof(integrity_image_expected_digest)) == ESP_OK) {
+            integrity_image_digest_len = hash_offset;
+            integrity_image_hash_appended = true;
+        }
+    }
+    
+    return metadata.image_len;
+}
+
+/**
+ * @brief Vérifie qu'une tranche du remplissage est effacée (0xFF)
+ * 
+ * @param padding_chunk Index du chunk dans la zone située après l'image
+ * @return true si la tranche ne contient que des 0xFF
+ */
+static bool integrity_padding_chunk_erased(const esp_partition_t *partition, size_t padding_chunk) {
+    size_t offset = integrity_covered_size(partition) + INTEGRITY_CHUNK_OFFSET_COMMUNITY(padding_chunk);
+    if (offset >= partition->size) {
+        return true;
+    }
+    
+    size_t chunk_end = (offset + INTEGRITY_CHUNK_SIZE_COMMUNITY > partition->size) ?
+                       partition->size : offset + INTEGRITY_CHUNK_SIZE_COMMUNITY;
+    uint32_t block[INTEGRITY_STREAM_BLOCK_SIZE_COMMUNITY / sizeof(uint32_t)];
+    
+    while (offset < chunk_end) {
+        size_t len = (chunk_end - offset > sizeof(block)) ? sizeof(block) : (chunk_end - offset);
+        if (esp_partition_read(partition, offset, block, len) != ESP_OK) {
+            return false;
+        }
+        
+        // Comparaison par mots de 32 bits, puis octets restants
+        size_t word_count = len / sizeof(uint32_t);
+        for (size_t i = 0; i < word_count; i++) {
+            if (block[i] != 0xFFFFFFFFu) {
+                return false;
+            }
+        }
+        const uint8_t *tail = (const uint8_t *)block;
+        for (size_t i = word_count * sizeof(uint32_t); i < len; i++) {
+            if (tail[i] != 0xFF) {
+                return false;
+            }
+        }
+        offset += len;
+    }
+    
+    return true;
+}
+
+/**
+ * @brief Projette l'image une seule fois si assez de pages MMU sont libres
+ */
+static esp_err_t integrity_mmap_map(const esp_partition_t *partition) {
+    if (integrity_mmap_base != NULL) {
+        return ESP_OK;
+    }
+    
+    const uint32_t size = integrity_covered_size(partition);
+    const uint32_t page_offset = partition->address & (SPI_FLASH_MMU_PAGE_SIZE - 1);
+    const uint32_t needed = (page_offset + size + SPI_FLASH_MMU_PAGE_SIZE - 1) / SPI_FLASH_MMU_PAGE_SIZE;
+    const uint32_t free_pages = spi_flash_mmap_get_free_pages(SPI_FLASH_MMAP_DATA);
+    
+    if (free_pages < needed + INTEGRITY_MMAP_RESERVE_PAGES_COMMUNITY) {
+        ESP_LOGW(TAG, "⚠️  Pages MMU insuffisantes (%d libres, %d requises + %d réservées), lecture bufferisée",
+                 free_pages, needed, INTEGRITY_MMAP_RESERVE_PAGES_COMMUNITY);
+        return ESP_ERR_NO_MEM;
+    }
+    
+    const void *mapped = NULL;
+    esp_err_t ret = esp_partition_mmap(partition, 0, size, SPI_FLASH_MMAP_DATA,
+                                       &mapped, &integrity_mmap_handle);
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "⚠️  Projection de l'image échouée (%s), lecture bufferisée", esp_err_to_name(ret));
+        return ret;
+    }
+    
+    integrity_mmap_base = (const uint8_t *)mapped;
+    integrity_mmap_pages = needed;
+    ESP_LOGI(TAG, "🗺️  Image projetée: %d bytes sur %d pages MMU", size, needed);
+    
+    return ESP_OK;
+}
+
+/**
+ * @brief Libère la projection de l'image
+ */
+static void integrity_mmap_unmap(void) {
+    if (integrity_mmap_base == NULL) {
+        return;
+    }
+    
+    spi_flash_munmap(integrity_mmap_handle);
+    integrity_mmap_base = NULL;
+    integrity_mmap_pages = 0;
+}
+
+/**
+ * @brief Hache un chunk directement depuis la projection de l'image
+ */
+static integrity_status_t integrity_hash_chunk_mapped(size_t chunk_id, size_t offset, size_t read_size,
+                                                      crypto_basic_sha256_ctx_t *image_ctx,
+                                                      uint8_t *chunk_hash) {
+    const uint8_t *mapped = integrity_mmap_base + offset;
+    
+    // Bloc contigu: le backend SHA (hardware si disponible) lit le cache flash
+    if (crypto_basic_sha256(mapped, read_size, chunk_hash) != ESP_OK) {
+        ESP_LOGE(TAG, "❌ Erreur calcul hash chunk %d", chunk_id);
+        return INTEGRITY_ERROR;
+    }
+    
+    if (image_ctx != NULL && offset < integrity_image_digest_len) {
+        size_t image_len = (offset + read_size > integrity_image_digest_len) ?
+                           (integrity_image_digest_len - offset) : read_size;
+        if (crypto_basic_sha256_update(image_ctx, mapped, image_len) != ESP_OK) {
+            ESP_LOGE(TAG, "❌ Erreur calcul hash chunk %d", chunk_id);
+            return INTEGRITY_ERROR;
+        }
+    }
+    
+    return INTEGRITY_OK;
+}
+
+/**
+ * @brief Lit et hache un chunk de la partition par petits blocs
+ */
+integrity_status_t integrity_hash_chunk(const esp_partition_t *partition, size_t chunk_id,
+                                        crypto_basic_sha256_ctx_t *image_ctx, uint8_t *chunk_hash) {
+    PERF_TRACE_SCOPE(PERF_SPAN_INTEGRITY_CHUNK);
+    const size_t covered_size = integrity_covered_size(partition);
+    size_t offset = INTEGRITY_CHUNK_OFFSET_COMMUNITY(chunk_id);
+    if (offset >= covered_size) {
+        return INTEGRITY_INVALID_CHUNK;
+    }
+    
+    size_t read_size = (offset + INTEGRITY_CHUNK_SIZE_COMMUNITY > covered_size) ?
+                       (covered_size - offset) : INTEGRITY_CHUNK_SIZE_COMMUNITY;
+    
+    if (integrity_mmap_base != NULL) {
+        return integrity_hash_chunk_mapped(chunk_id, offset, read_size, image_ctx, chunk_hash);
+    }
+    
+    return integrity_hash_partition_range(partition, chunk_id, offset, read_size, image_ctx, chunk_hash);
+}
+
+/**
+ * @brief Lit et hache une plage de partition par petits blocs
+ */
+integrity_status_t integrity_hash_partition_range(const esp_partition_t *partition, size_t chunk_id,
+                                                  size_t offset, size_t read_size,
+                                                  crypto_basic_sha256_ctx_t *image_ctx, uint8_t *chunk_hash) {
+    uint8_t block[INTEGRITY_STREAM_BLOCK_SIZE_COMMUNITY];
+    crypto_basic_sha256_ctx_t chunk_ctx;
+    if (crypto_basic_sha256_init(&chunk_ctx) != ESP_OK) {
+        return INTEGRITY_ERROR;
+    }
+    
+    integrity_status_t status = INTEGRITY_OK;
+    size_t done = 0;
+    
+    while (done < read_size) {
+        size_t len = (read_size - done > sizeof(block)) ? sizeof(block) : (read_size - done);
+        size_t block_offset = offset + done;
+        
+        esp_err_t ret = esp_partition_read(partition, block_offset, block, len);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "❌ Erreur lecture chunk %d: %s", chunk_id, esp_err_to_name(ret));
+            status = INTEGRITY_CORRUPTED;
+            break;
+        }
+        
+        if (crypto_basic_sha256_update(&chunk_ctx, block, len) != ESP_OK) {
+            status = INTEGRITY_ERROR;
+            break;
+        }
+        
+        // Même bloc versé dans le condensat de l'image (sans le hash ajouté)
+        if (image_ctx != NULL && block_offset < integrity_image_digest_len) {
+            size_t image_len = (block_offset + len > integrity_image_digest_len) ?
+                               (integrity_image_digest_len - block_offset) : len;
+            if (crypto_basic_sha256_update(image_ctx, block, image_len) != ESP_OK) {
+                status = INTEGRITY_ERROR;
+                break;
+            }
+        }
+        
+        done += len;
+    }
+    
+    if (status == INTEGRITY_OK && crypto_basic_sha256_finish(&chunk_ctx, chunk_hash) != ESP_OK) {
+        status = INTEGRITY_ERROR;
+    } else if (status != INTEGRITY_OK) {
+        crypto_basic_sha256_finish(&chunk_ctx, NULL);
+    }
+    
+    if (status == INTEGRITY_ERROR) {
+        ESP_LOGE(TAG, "❌ Erreur calcul hash chunk %d", chunk_id);
+    }
+    
+    return status;
+}
+
+/**
+ * @brief Termine le condensat de l'image et le compare au hash ajouté
+ */
+static integrity_status_t integrity_sweep_finish_image_digest(void) {
+    uint8_t digest[32];
+    if (crypto_basic_sha256_finish(&sweep_image_ctx, digest) != ESP_OK) {
+        return INTEGRITY_ERROR;
+    }
+    
+    bool mismatch = integrity_image_hash_appended &&
+                    memcmp(digest, integrity_image_expected_digest, sizeof(digest)) != 0;
+    
+    portENTER_CRITICAL(&integrity_stats_lock);
+    memcpy(integrity_image_digest, digest, sizeof(digest));
+    integrity_image_digest_valid = true;
+    if (integrity_image_hash_appended) {
+        integrity_stats.image_digest_checks++;
+        if (mismatch) {
+            integrity_stats.image_digest_failures++;
+        }
+    }
+    portEXIT_CRITICAL(&integrity_stats_lock);
+    
+    if (mismatch) {
+        ESP_LOGE(TAG, "❌ Condensat de l'image différent du SHA-256 ajouté au build");
+        return INTEGRITY_CORRUPTED;
+    }
+    
+    ESP_LOGD(TAG, "✅ Condensat image %02x%02x%02x%02x... (%d bytes)",
+             digest[0], digest[1], digest[2], digest[3], integrity_image_digest_len);
+    return INTEGRITY_OK;
+}
 
 /**
  * @brief Initialise le vérificateur d'intégrité Community
@@ -42,12 +352,57 @@ esp_err_t integrity_checker_init(void) {
     memset(&integrity_stats, 0, sizeof(integrity_stats));
     integrity_stats.last_check_time = esp_timer_get_time() / 1000;
     
+    // Borner la vérification à l'image réelle, puis charger le manifeste
+    const esp_partition_t *running = esp_ota_get_running_partition();
+    if (running != NULL) {
+        integrity_image_size = integrity_resolve_image_size(running);
+        integrity_padding_proven = (integrity_image_size >= running->size);
+        integrity_stats.image_size = integrity_image_size;
+        integrity_stats.partition_size = running->size;
+        integrity_stats.padding_verified = integrity_padding_proven;
+        
+        // Lecture sans copie par défaut, repli bufferisé si le MMU est saturé
+        integrity_mmap_map(running);
+        integrity_stats.read_mode = (integrity_mmap_base != NULL) ? INTEGRITY_READ_MMAP : INTEGRITY_READ_BUFFERED;
+        integrity_stats.mmap_pages = integrity_mmap_pages;
+        
+        esp_err_t ret = integrity_manifest_load(integrity_image_size);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "❌ Manifeste de référence invalide: %s", esp_err_to_name(ret));
+            return ret;
+        }
+    }
+    
     integrity_checker_initialized = true;
     ESP_LOGI(TAG, "✅ Vérificateur d'intégrité Community initialisé");
     
     return ESP_OK;
 }
 
+/**
+ * @brief Deinitialise le vérificateur d'intégrité
+ */
+esp_err_t integrity_checker_deinit(void) {
+    if (!integrity_checker_initialized) {
+        return ESP_OK;
+    }
+    
+    integrity_sweep_stop();
+    while (sweep_task_handle != NULL) {
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+    
+    if (sweep_image_ctx.active) {
+        crypto_basic_sha256_finish(&sweep_image_ctx, NULL);
+    }
+    integrity_mmap_unmap();
+    
+    integrity_checker_initialized = false;
+    ESP_LOGI(TAG, "🔓 Vérificateur d'intégrité Community déinitialisé");
+    
+    return ESP_OK;
+}
+
 /**
  * @brief Vérification d'intégrité basique au démarrage
  */
@@ -70,25 +425,18 @@ integrity_status_t integrity_check_firmware_basic(void) {
         return INTEGRITY_ERROR;
     }
     
-    ESP_LOGI(TAG, "📋 Partition courante: %s, taille: %d bytes", 
-             running->label, running->size);
+    ESP_LOGI(TAG, "📋 Partition courante: %s, taille: %d bytes, image: %d bytes", 
+             running->label, running->size, integrity_covered_size(running));
     
-    // Vérification simplifiée par chunks (version éducative)
-    const size_t chunk_size = 8192; // Plus gros chunks qu'Enterprise
-    const size_t total_chunks = (running->size + chunk_size - 1) / chunk_size;
+    // Vérification simplifiée par chunks, limitée aux octets de l'image
+    const size_t chunk_size = INTEGRITY_CHUNK_SIZE_COMMUNITY; // Plus gros chunks qu'Enterprise
+    const size_t total_chunks = INTEGRITY_CALC_CHUNKS_COMMUNITY(integrity_covered_size(running));
     size_t verified_chunks = 0;
     size_t corrupted_chunks = 0;
     
     ESP_LOGI(TAG, "🧩 Vérification par chunks: %d chunks de %d bytes", 
              total_chunks, chunk_size);
     
-    uint8_t *buffer = malloc(chunk_size);
-    if (buffer == NULL) {
-        ESP_LOGE(TAG, "❌ Allocation mémoire échouée");
-        integrity_stats.failed_checks++;
-        return INTEGRITY_ERROR;
-    }
-    
     uint8_t chunk_hash[32];
     
     // Vérifier un échantillon de chunks (pas tous pour Community)
@@ -100,28 +448,17 @@ integrity_status_t integrity_check_firmware_basic(void) {
              sample_chunks, total_chunks);
     
     for (size_t i = 0; i < total_chunks; i += chunk_step) {
-        size_t offset = i * chunk_size;
-        size_t read_size = (offset + chunk_size > running->size) ? 
-                          (running->size - offset) : chunk_size;
-        
-        // Lire le chunk
-        esp_err_t ret = esp_partition_read(running, offset, buffer, read_size);
-        if (ret != ESP_OK) {
-            ESP_LOGE(TAG, "❌ Erreur lecture chunk %d: %s", i, esp_err_to_name(ret));
+        // Lire et hacher le chunk (version simplifiée)
+        if (integrity_hash_chunk(running, i, NULL, chunk_hash) != INTEGRITY_OK) {
             corrupted_chunks++;
             continue;
         }
         
-        // Calculer le hash du chunk (version simplifiée)
-        ret = crypto_basic_sha256(buffer, read_size, chunk_hash);
-        if (ret != ESP_OK) {
-            ESP_LOGE(TAG, "❌ Erreur calcul hash chunk %d", i);
+        // Comparaison contre le manifeste (sans effet tant qu'il est en apprentissage)
+        if (integrity_manifest_check_chunk(i, chunk_hash) != INTEGRITY_OK) {
             corrupted_chunks++;
             continue;
         }
-        
-        // En Community, on vérifie juste que le hash peut être calculé
-        // (pas de vérification contre signature stockée)
         verified_chunks++;
         
         // Log périodique pour éviter le spam
@@ -130,8 +467,6 @@ integrity_status_t integrity_check_firmware_basic(void) {
         }
     }
     
-    free(buffer);
-    
     // Calculer le temps de vérification
     uint32_t check_duration = (esp_timer_get_time() / 1000) - start_time;
     integrity_stats.last_check_time = esp_timer_get_time() / 1000;
@@ -177,39 +512,301 @@ integrity_status_t integrity_check_chunk_basic(size_t chunk_id) {
         return INTEGRITY_ERROR;
     }
     
-    const size_t chunk_size = 8192;
-    size_t offset = chunk_id * chunk_size;
-    
-    if (offset >= running->size) {
+    if (INTEGRITY_CHUNK_OFFSET_COMMUNITY(chunk_id) >= integrity_covered_size(running)) {
         ESP_LOGW(TAG, "⚠️  Chunk %d hors limites", chunk_id);
         return INTEGRITY_INVALID_CHUNK;
     }
     
-    uint8_t *buffer = malloc(chunk_size);
-    if (buffer == NULL) {
-        return INTEGRITY_ERROR;
+    uint8_t chunk_hash[32];
+    integrity_status_t status = integrity_hash_chunk(running, chunk_id, NULL, chunk_hash);
+    
+    if (status != INTEGRITY_OK) {
+        return status;
     }
     
-    size_t read_size = (offset + chunk_size > running->size) ? 
-                      (running->size - offset) : chunk_size;
+    status = integrity_manifest_check_chunk(chunk_id, chunk_hash);
+    if (status != INTEGRITY_OK) {
+        return status;
+    }
     
-    esp_err_t ret = esp_partition_read(running, offset, buffer, read_size);
-    if (ret != ESP_OK) {
-        free(buffer);
-        return INTEGRITY_CORRUPTED;
+    ESP_LOGD(TAG, "✅ Chunk %d conforme au manifeste", chunk_id);
+    return INTEGRITY_OK;
+}
+
+/**
+ * @brief Exécute une tranche du balayage incrémental
+ */
+integrity_status_t integrity_sweep_step(uint32_t max_chunks, uint32_t budget_us,
+                                        bool *sweep_done, size_t *failed_chunk) {
+    if (sweep_done != NULL) {
+        *sweep_done = false;
     }
     
-    // Calcul hash basique (pas de vérification signature en Community)
-    uint8_t chunk_hash[32];
-    ret = crypto_basic_sha256(buffer, read_size, chunk_hash);
-    free(buffer);
+    if (!integrity_checker_initialized) {
+        return INTEGRITY_NOT_INITIALIZED;
+    }
     
-    if (ret != ESP_OK) {
+    const esp_partition_t *running = esp_ota_get_running_partition();
+    if (running == NULL) {
         return INTEGRITY_ERROR;
     }
     
-    ESP_LOGD(TAG, "✅ Chunk %d: hash calculé avec succès", chunk_id);
-    return INTEGRITY_OK;
+    // Le remplissage après l'image n'est parcouru que tant qu'il n'est pas prouvé effacé
+    const uint32_t image_chunks = INTEGRITY_CALC_CHUNKS_COMMUNITY(integrity_covered_size(running));
+    const uint32_t padding_chunks = integrity_padding_proven ? 0 :
+        INTEGRITY_CALC_CHUNKS_COMMUNITY(running->size - integrity_covered_size(running));
+    const uint32_t total_chunks = image_chunks + padding_chunks;
+    uint32_t cursor = integrity_stats.sweep_cursor;
+    if (cursor == 0 || cursor >= total_chunks) {
+        cursor = 0;
+        sweep_padding_dirty = false;
+        sweep_start_time = esp_timer_get_time() / 1000;
+        
+        // Nouveau condensat de l'image pour cette passe
+        if (sweep_image_ctx.active) {
+            crypto_basic_sha256_finish(&sweep_image_ctx, NULL);
+        }
+        crypto_basic_sha256_init(&sweep_image_ctx);
+    }
+    
+    integrity_status_t result = INTEGRITY_OK;
+    uint32_t verified = 0;
+    uint32_t corrupted = 0;
+    uint32_t padding_clean = 0;
+    uint32_t padding_dirty = 0;
+    uint8_t chunk_hash[32];
+    int64_t slice_start = esp_timer_get_time();
+    int64_t elapsed = 0;
+    
+    if (max_chunks == 0) {
+        max_chunks = 1;
+    }
+    
+    const bool learning = (integrity_manifest_get_state() == INTEGRITY_MANIFEST_LEARNING);
+    
+    while (verified + corrupted + padding_clean + padding_dirty < max_chunks && cursor < total_chunks) {
+        if (cursor >= image_chunks) {
+            // Remplissage: simple comparaison à 0xFF, pas de hachage
+            if (integrity_padding_chunk_erased(running, cursor - image_chunks)) {
+                padding_clean++;
+            } else {
+                padding_dirty++;
+                sweep_padding_dirty = true;
+            }
+            cursor++;
+            
+            elapsed = esp_timer_get_time() - slice_start;
+            if (budget_us > 0 && elapsed >= budget_us) {
+                break;
+            }
+            continue;
+        }
+        
+        crypto_basic_sha256_ctx_t *image_ctx = sweep_image_ctx.active ? &sweep_image_ctx : NULL;
+        integrity_status_t status = integrity_hash_chunk(running, cursor, image_ctx, chunk_hash);
+        if (status != INTEGRITY_OK && image_ctx != NULL) {
+            // Bloc manquant: le condensat de l'image de cette passe n'a plus de sens
+            crypto_basic_sha256_finish(&sweep_image_ctx, NULL);
+        } else if (status == INTEGRITY_OK) {
+            if (learning) {
+                integrity_manifest_learn_chunk(cursor, chunk_hash);
+            } else {
+                status = integrity_manifest_check_chunk(cursor, chunk_hash);
+            }
+        }
+        if (status == INTEGRITY_OK) {
+            verified++;
+        } else {
+            corrupted++;
+            if (result == INTEGRITY_OK) {
+                result = status;
+                if (failed_chunk != NULL) {
+                    *failed_chunk = cursor;
+                }
+            }
+        }
+        cursor++;
+        
+        // Dernier chunk de l'image: le condensat complet est disponible
+        if (cursor == image_chunks && sweep_image_ctx.active) {
+            integrity_status_t image_status = integrity_sweep_finish_image_digest();
+            if (image_status != INTEGRITY_OK && result == INTEGRITY_OK) {
+                result = image_status;
+                if (failed_chunk != NULL) {
+                    *failed_chunk = image_chunks - 1;
+                }
+            }
+        }
+        
+        elapsed = esp_timer_get_time() - slice_start;
+        if (budget_us > 0 && elapsed >= budget_us) {
+            break;
+        }
+    }
+    
+    bool done = (cursor >= total_chunks);
+    uint64_t now_ms = esp_timer_get_time() / 1000;
+    
+    portENTER_CRITICAL(&integrity_stats_lock);
+    integrity_stats.total_chunks = total_chunks;
+    integrity_stats.chunks_verified += verified;
+    integrity_stats.chunks_corrupted += corrupted;
+    integrity_stats.padding_dirty_chunks += padding_dirty;
+    integrity_stats.slices_executed++;
+    if ((uint32_t)elapsed > integrity_stats.max_slice_duration_us) {
+        integrity_stats.max_slice_duration_us = (uint32_t)elapsed;
+    }
+    if (budget_us > 0 && elapsed > budget_us) {
+        integrity_stats.slice_budget_overruns++;
+    }
+    integrity_stats.sweep_chunks_done = cursor;
+    integrity_stats.coverage_percent = (uint8_t)((cursor * 100) / total_chunks);
+    if (done) {
+        if (padding_chunks > 0 && !sweep_padding_dirty) {
+            integrity_padding_proven = true;
+            integrity_stats.padding_verified = true;
+        }
+        integrity_stats.sweep_cursor = 0;
+        integrity_stats.sweeps_completed++;
+        integrity_stats.last_sweep_duration_ms = (uint32_t)(now_ms - sweep_start_time);
+        integrity_stats.last_sweep_complete_time = now_ms;
+    } else {
+        integrity_stats.sweep_cursor = cursor;
+    }
+    portEXIT_CRITICAL(&integrity_stats_lock);
+    
+    if (done) {
+        ESP_LOGI(TAG, "✅ Passe de balayage complète: %d chunks en %d ms",
+                 total_chunks, integrity_stats.last_sweep_duration_ms);
+        
+        if (padding_chunks > 0) {
+            if (sweep_padding_dirty) {
+                ESP_LOGW(TAG, "⚠️  Remplissage après l'image non effacé (résidu d'une ancienne image?)");
+            } else {
+                ESP_LOGI(TAG, "🧽 Remplissage prouvé à 0xFF: %d chunks exclus des passes suivantes",
+                         padding_chunks);
+            }
+        }
+        
+        // Première passe: la table de référence est complète, la persister
+        if (learning && integrity_manifest_commit() != ESP_OK) {
+            ESP_LOGW(TAG, "⚠️  Manifeste non persisté, nouvel essai à la prochaine passe");
+        }
+    }
+    
+    if (sweep_done != NULL) {
+        *sweep_done = done;
+    }
+    
+    return result;
+}
+
+/**
+ * @brief Tâche de balayage incrémental basse priorité
+ */
+static void integrity_sweep_task(void *pvParameters) {
+    ESP_LOGI(TAG, "🧹 Tâche de balayage démarrée: %d chunks/tranche, budget %d µs, période %d ms",
+             sweep_config.chunks_per_slice, sweep_config.slice_budget_us, sweep_config.slice_period_ms);
+    
+    while (sweep_task_running) {
+        bool sweep_done = false;
+        size_t failed_chunk = 0;
+        
+        integrity_status_t status = integrity_sweep_step(sweep_config.chunks_per_slice,
+                                                         sweep_config.slice_budget_us,
+                                                         &sweep_done, &failed_chunk);
+        if (status != INTEGRITY_OK) {
+            ESP_LOGE(TAG, "❌ Échec balayage chunk %d: %s",
+                     failed_chunk, integrity_status_to_string(status));
+            if (sweep_failure_cb != NULL) {
+                sweep_failure_cb(status, failed_chunk, sweep_failure_arg);
+            }
+        }
+        
+        if (sweep_done) {
+            // Demandes reçues pendant la passe: déjà couvertes, ne pas enchaîner
+            (void)ulTaskNotifyTake(pdTRUE, 0);
+            
+            // Attendre la demande de passe suivante
+            while (sweep_task_running && ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(1000)) == 0) {
+            }
+        } else {
+            vTaskDelay(pdMS_TO_TICKS(sweep_config.slice_period_ms));
+        }
+    }
+    
+    sweep_task_handle = NULL;
+    vTaskDelete(NULL);
+}
+
+/**
+ * @brief Démarre la tâche de balayage incrémental basse priorité
+ */
+esp_err_t integrity_sweep_start(const integrity_sweep_config_t *config,
+                                integrity_failure_cb_t on_failure, void *arg) {
+    if (!integrity_checker_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    if (sweep_task_handle != NULL) {
+        ESP_LOGW(TAG, "Tâche de balayage déjà démarrée");
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    if (config != NULL) {
+        sweep_config = *config;
+    } else {
+        sweep_config = (integrity_sweep_config_t) {
+            .chunks_per_slice = INTEGRITY_SWEEP_CHUNKS_PER_SLICE_COMMUNITY,
+            .slice_budget_us = INTEGRITY_SWEEP_SLICE_BUDGET_US_COMMUNITY,
+            .slice_period_ms = INTEGRITY_SWEEP_SLICE_PERIOD_MS_COMMUNITY,
+            .task_priority = INTEGRITY_SWEEP_TASK_PRIORITY_COMMUNITY,
+            .task_stack_size = INTEGRITY_SWEEP_TASK_STACK_COMMUNITY,
+            .task_core = INTEGRITY_SWEEP_TASK_CORE_COMMUNITY
+        };
+    }
+    
+    sweep_failure_cb = on_failure;
+    sweep_failure_arg = arg;
+    sweep_task_running = true;
+    
+#if CONFIG_FREERTOS_UNICORE
+    sweep_config.task_core = tskNO_AFFINITY;
+#endif
+    BaseType_t task_ret = xTaskCreatePinnedToCore(integrity_sweep_task, "integrity_sweep",
+                                                  sweep_config.task_stack_size, NULL,
+                                                  sweep_config.task_priority, &sweep_task_handle,
+                                                  sweep_config.task_core);
+    if (task_ret != pdPASS) {
+        ESP_LOGE(TAG, "❌ Échec création tâche de balayage");
+        sweep_task_running = false;
+        return ESP_FAIL;
+    }
+    
+    return ESP_OK;
+}
+
+/**
+ * @brief Arrête la tâche de balayage incrémental
+ */
+esp_err_t integrity_sweep_stop(void) {
+    sweep_task_running = false;
+    if (sweep_task_handle != NULL) {
+        xTaskNotifyGive(sweep_task_handle);
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief Demande une nouvelle passe complète
+ */
+esp_err_t integrity_sweep_request(void) {
+    if (sweep_task_handle == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    xTaskNotifyGive(sweep_task_handle);
+    return ESP_OK;
 }
 
 /**
@@ -224,10 +821,137 @@ esp_err_t integrity_get_stats_community(integrity_stats_community_t *stats) {
         return ESP_ERR_INVALID_STATE;
     }
     
+    portENTER_CRITICAL(&integrity_stats_lock);
     memcpy(stats, &integrity_stats, sizeof(integrity_stats_community_t));
+    portEXIT_CRITICAL(&integrity_stats_lock);
+    return ESP_OK;
+}
+
+/**
+ * @brief Sélectionne le chemin de lecture de la flash
+ */
+esp_err_t integrity_set_read_mode(integrity_read_mode_t mode) {
+    if (!integrity_checker_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    // La projection ne peut pas disparaître sous la tâche de balayage
+    if (sweep_task_handle != NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    const esp_partition_t *running = esp_ota_get_running_partition();
+    if (running == NULL) {
+        return ESP_FAIL;
+    }
+    
+    esp_err_t ret = ESP_OK;
+    if (mode == INTEGRITY_READ_MMAP) {
+        ret = integrity_mmap_map(running);
+    } else {
+        integrity_mmap_unmap();
+    }
+    
+    portENTER_CRITICAL(&integrity_stats_lock);
+    integrity_stats.read_mode = integrity_get_read_mode();
+    integrity_stats.mmap_pages = integrity_mmap_pages;
+    portEXIT_CRITICAL(&integrity_stats_lock);
+    
+    return (ret == ESP_OK) ? ESP_OK : ESP_ERR_NO_MEM;
+}
+
+/**
+ * @brief Obtient le chemin de lecture actif
+ */
+integrity_read_mode_t integrity_get_read_mode(void) {
+    return (integrity_mmap_base != NULL) ? INTEGRITY_READ_MMAP : INTEGRITY_READ_BUFFERED;
+}
+
+/**
+ * @brief Compare les deux chemins de lecture sur l'image complète
+ */
+esp_err_t integrity_benchmark_read_paths(integrity_read_bench_t results[2]) {
+    if (results == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    if (!integrity_checker_initialized || sweep_task_handle != NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    const esp_partition_t *running = esp_ota_get_running_partition();
+    if (running == NULL) {
+        return ESP_FAIL;
+    }
+    
+    const integrity_read_mode_t initial_mode = integrity_get_read_mode();
+    const uint32_t total_chunks = INTEGRITY_CALC_CHUNKS_COMMUNITY(integrity_covered_size(running));
+    const integrity_read_mode_t modes[2] = { INTEGRITY_READ_BUFFERED, INTEGRITY_READ_MMAP };
+    uint8_t chunk_hash[32];
+    
+    ESP_LOGI(TAG, "⏱️  Benchmark chemins de lecture: %d chunks", total_chunks);
+    
+    for (int m = 0; m < 2; m++) {
+        integrity_read_bench_t *result = &results[m];
+        memset(result, 0, sizeof(*result));
+        result->mode = modes[m];
+        
+        size_t free_before = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+        
+        // Chaque chemin part à froid: projection établie dans la mesure
+        integrity_mmap_unmap();
+        int64_t start = esp_timer_get_time();
+        if (modes[m] == INTEGRITY_READ_MMAP && integrity_mmap_map(running) != ESP_OK) {
+            ESP_LOGI(TAG, "  mmap: indisponible");
+            continue;
+        }
+        result->available = true;
+        
+        for (uint32_t i = 0; i < total_chunks; i++) {
+            if (integrity_hash_chunk(running, i, NULL, chunk_hash) == INTEGRITY_OK) {
+                result->chunks++;
+            }
+        }
+        result->total_time_us = (uint32_t)(esp_timer_get_time() - start);
+        
+        size_t free_after = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+        result->heap_used_bytes = (free_before > free_after) ? (uint32_t)(free_before - free_after) : 0;
+        result->mmap_pages = integrity_mmap_pages;
+        
+        ESP_LOGI(TAG, "  %-9s %d chunks en %d ms, heap %d bytes, %d pages MMU",
+                 (modes[m] == INTEGRITY_READ_MMAP) ? "mmap:" : "bufferisé:",
+                 result->chunks, result->total_time_us / 1000,
+                 result->heap_used_bytes, result->mmap_pages);
+    }
+    
+    // Restaurer le chemin initial
+    integrity_mmap_unmap();
+    if (initial_mode == INTEGRITY_READ_MMAP) {
+        integrity_mmap_map(running);
+    }
+    
     return ESP_OK;
 }
 
+/**
+ * @brief Obtient le condensat de l'image calculé par la dernière passe
+ */
+esp_err_t integrity_get_image_digest(uint8_t *digest) {
+    if (digest == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    esp_err_t ret = ESP_ERR_INVALID_STATE;
+    portENTER_CRITICAL(&integrity_stats_lock);
+    if (integrity_image_digest_valid) {
+        memcpy(digest, integrity_image_digest, sizeof(integrity_image_digest));
+        ret = ESP_OK;
+    }
+    portEXIT_CRITICAL(&integrity_stats_lock);
+    
+    return ret;
+}
+
 /**
  * @brief Affiche les statistiques d'intégrité Community
  */
@@ -244,6 +968,23 @@ void integrity_print_stats_community(void) {
     ESP_LOGI(TAG, "Dernière vérification: %lld ms ago", 
              (esp_timer_get_time() / 1000) - integrity_stats.last_check_time);
     ESP_LOGI(TAG, "Durée dernière vérif: %d ms", integrity_stats.last_check_duration_ms);
+    ESP_LOGI(TAG, "Balayage: %d passes, curseur %d/%d (%d%%), dernière passe %d ms",
+             integrity_stats.sweeps_completed, integrity_stats.sweep_cursor,
+             integrity_stats.total_chunks, integrity_stats.coverage_percent,
+             integrity_stats.last_sweep_duration_ms);
+    ESP_LOGI(TAG, "Tranches: %d, max %d µs, %d dépassements de budget",
+             integrity_stats.slices_executed, integrity_stats.max_slice_duration_us,
+             integrity_stats.slice_budget_overruns);
+    ESP_LOGI(TAG, "Périmètre: image %d / partition %d bytes, remplissage %s (%d chunks non effacés)",
+             integrity_stats.image_size, integrity_stats.partition_size,
+             integrity_stats.padding_verified ? "prouvé 0xFF" : "non prouvé",
+             integrity_stats.padding_dirty_chunks);
+    ESP_LOGI(TAG, "Lecture: %s (%d pages MMU)",
+             (integrity_stats.read_mode == INTEGRITY_READ_MMAP) ? "mmap sans copie" : "bufferisée",
+             integrity_stats.mmap_pages);
+    ESP_LOGI(TAG, "Condensat image: %d contrôles, %d échecs%s",
+             integrity_stats.image_digest_checks, integrity_stats.image_digest_failures,
+             integrity_image_hash_appended ? "" : " (pas de SHA-256 ajouté au build)");
     
     if (integrity_stats.total_checks > 0) {
         float success_rate = (float)integrity_stats.successful_checks / 
@@ -262,13 +1003,23 @@ esp_err_t integrity_reset_stats_community(void) {
         return ESP_ERR_INVALID_STATE;
     }
     
+    portENTER_CRITICAL(&integrity_stats_lock);
+    uint32_t image_size = integrity_stats.image_size;
+    uint32_t partition_size = integrity_stats.partition_size;
     memset(&integrity_stats, 0, sizeof(integrity_stats));
     integrity_stats.last_check_time = esp_timer_get_time() / 1000;
+    integrity_stats.image_size = image_size;
+    integrity_stats.partition_size = partition_size;
+    integrity_stats.padding_verified = integrity_padding_proven;
+    integrity_stats.read_mode = integrity_get_read_mode();
+    integrity_stats.mmap_pages = integrity_mmap_pages;
+    portEXIT_CRITICAL(&integrity_stats_lock);
     
     ESP_LOGI(TAG, "🔄 Statistiques d'intégrité réinitialisées");
     return ESP_OK;
 }
 
+#if CONFIG_APP_SELF_TESTS
 /**
  * @brief Test de fonctionnement du vérificateur Community
  */
@@ -309,25 +1060,43 @@ esp_err_t integrity_checker_self_test(void) {
     
     return ESP_OK;
 }
+#endif /* CONFIG_APP_SELF_TESTS */
 
+#if CONFIG_APP_BANNERS
 /**
  * @brief Affiche les informations du vérificateur Community
  */
 void integrity_checker_print_info(void) {
     ESP_LOGI(TAG, "📋 === Vérificateur Intégrité Community ===");
     ESP_LOGI(TAG, "Édition: Community (Éducative)");
-    ESP_LOGI(TAG, "Type: Vérification au démarrage seulement");
-    ESP_LOGI(TAG, "Méthode: Échantillonnage de chunks");
+    ESP_LOGI(TAG, "Type: Échantillonnage au démarrage + balayage incrémental");
+    ESP_LOGI(TAG, "Méthode: Tranches de %d chunks, budget %d µs",
+             INTEGRITY_SWEEP_CHUNKS_PER_SLICE_COMMUNITY, INTEGRITY_SWEEP_SLICE_BUDGET_US_COMMUNITY);
     ESP_LOGI(TAG, "Taille chunk: 8192 bytes");
     ESP_LOGI(TAG, "Hash: SHA-256 software");
     ESP_LOGI(TAG, "Fonctionnalités disponibles:");
     ESP_LOGI(TAG, "  ✅ Vérification au boot");
     ESP_LOGI(TAG, "  ✅ Vérification chunks individuels");
+    ESP_LOGI(TAG, "  ✅ Balayage complet par tranches basse priorité");
     ESP_LOGI(TAG, "  ✅ Statistiques basiques");
     ESP_LOGI(TAG, "Limitations Community:");
     ESP_LOGI(TAG, "  ❌ Pas de vérification temps réel");
     ESP_LOGI(TAG, "  ❌ Pas de vérification de signature");
-    ESP_LOGI(TAG, "  ❌ Échantillonnage seulement");
     ESP_LOGI(TAG, "🎓 Idéal pour comprendre les concepts!");
     ESP_LOGI(TAG, "==========================================");
+}
+#endif /* CONFIG_APP_BANNERS */
+
+/**
+ * @brief Convertit un status d'intégrité en chaîne
+ */
+const char* integrity_status_to_string(integrity_status_t status) {
+    switch (status) {
+        case INTEGRITY_OK:              return "OK";
+        case INTEGRITY_CORRUPTED:       return "Corrompu";
+        case INTEGRITY_ERROR:           return "Erreur système";
+        case INTEGRITY_INVALID_CHUNK:   return "Chunk invalide";
+        case INTEGRITY_NOT_INITIALIZED: return "Non initialisé";
+        default:                        return "Inconnu";
+    }
 }
\ No newline at end of file
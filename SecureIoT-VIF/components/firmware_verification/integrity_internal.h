@@ -0,0 +1,52 @@
+/**
+ * @file integrity_internal.h
+ * @brief Fonctions internes partagées du composant firmware_verification
+ * 
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#ifndef INTEGRITY_INTERNAL_H
+#define INTEGRITY_INTERNAL_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_partition.h"
+#include "crypto_operations_basic.h"
+#include "integrity_checker.h"
+
+/**
+ * @brief Lit et hache un chunk de la partition
+ * 
+ * Lecture par blocs de INTEGRITY_STREAM_BLOCK_SIZE_COMMUNITY octets sur la
+ * pile, sans allocation.
+ * 
+ * @param partition Partition à lire
+ * @param chunk_id Index du chunk
+ * @param image_ctx Condensat de l'image à alimenter avec les mêmes blocs (ou NULL)
+ * @param chunk_hash Condensat de sortie (32 bytes)
+ * @return integrity_status_t Status de la lecture/hachage
+ */
+integrity_status_t integrity_hash_chunk(const esp_partition_t *partition, size_t chunk_id,
+                                        crypto_basic_sha256_ctx_t *image_ctx, uint8_t *chunk_hash);
+
+/**
+ * @brief Lit et hache une plage quelconque d'une partition, toujours par blocs
+ * 
+ * Chemin bufferisé de integrity_hash_chunk(); sert aussi pour une partition
+ * autre que celle en cours d'exécution (cible OTA), qui n'est pas projetée.
+ * 
+ * @param partition Partition à lire
+ * @param chunk_id Index du chunk (messages d'erreur)
+ * @param offset Décalage dans la partition
+ * @param read_size Octets à hacher
+ * @param image_ctx Condensat de l'image à alimenter (ou NULL)
+ * @param chunk_hash Condensat de sortie (32 bytes)
+ * @return integrity_status_t Status de la lecture/hachage
+ */
+integrity_status_t integrity_hash_partition_range(const esp_partition_t *partition, size_t chunk_id,
+                                                  size_t offset, size_t read_size,
+                                                  crypto_basic_sha256_ctx_t *image_ctx, uint8_t *chunk_hash);
+
+#endif /* INTEGRITY_INTERNAL_H */
\ No newline at end of file
@@ -0,0 +1,499 @@
+/**
+ * @file integrity_manifest.c
+ * @brief Manifeste de référence des chunks pour SecureIoT-VIF Community Edition
+ * 
+ * La table de condensats est construite à la première passe de balayage
+ * (confiance au premier démarrage), persistée en NVS et rechargée en une
+ * seule lecture dans une table contiguë.
+ * 
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include "esp_log.h"
+#include "esp_err.h"
+#include "esp_ota_ops.h"
+#include "nvs.h"
+#include "crypto_operations_basic.h"
+#include "integrity_manifest.h"
+#include "integrity_internal.h"
+
+static const char *TAG = "MANIFEST_COMMUNITY";
+
+// Manifeste chargé en RAM
+static integrity_manifest_blob_t manifest __attribute__((aligned(4)));
+static integrity_manifest_state_t manifest_state = INTEGRITY_MANIFEST_EMPTY;
+static uint32_t manifest_learned_chunks = 0;
+
+/**
+ * @brief Combine deux nœuds de l'arbre de Merkle
+ */
+static esp_err_t merkle_combine(const uint8_t *left, const uint8_t *right, uint8_t *out) {
+    uint8_t node[1 + 2 * INTEGRITY_MANIFEST_DIGEST_SIZE];
+    node[0] = 0x01;
+    memcpy(&node[1], left, INTEGRITY_MANIFEST_DIGEST_SIZE);
+    memcpy(&node[1 + INTEGRITY_MANIFEST_DIGEST_SIZE], right, INTEGRITY_MANIFEST_DIGEST_SIZE);
+    return crypto_basic_sha256(node, sizeof(node), out);
+}
+
+/**
+ * @brief Plus grande puissance de 2 strictement inférieure à n (n > 1)
+ */
+static size_t merkle_split(size_t n) {
+    size_t k = 1;
+    while ((k << 1) < n) {
+        k <<= 1;
+    }
+    return k;
+}
+
+/**
+ * @brief Racine du sous-arbre de référence [first, first + count)
+ */
+static esp_err_t merkle_subtree_root(const uint8_t (*leaves)[INTEGRITY_MANIFEST_DIGEST_SIZE],
+                                     size_t first, size_t count, uint8_t *out) {
+    if (count == 1) {
+        memcpy(out, leaves[first], INTEGRITY_MANIFEST_DIGEST_SIZE);
+        return ESP_OK;
+    }
+    
+    size_t k = merkle_split(count);
+    uint8_t left[INTEGRITY_MANIFEST_DIGEST_SIZE];
+    uint8_t right[INTEGRITY_MANIFEST_DIGEST_SIZE];
+    
+    esp_err_t ret = merkle_subtree_root(leaves, first, k, left);
+    if (ret == ESP_OK) {
+        ret = merkle_subtree_root(leaves, first + k, count - k, right);
+    }
+    if (ret == ESP_OK) {
+        ret = merkle_combine(left, right, out);
+    }
+    return ret;
+}
+
+/**
+ * @brief Calcule la racine de Merkle d'une suite de condensats
+ */
+esp_err_t integrity_manifest_merkle_root(const uint8_t (*leaves)[INTEGRITY_MANIFEST_DIGEST_SIZE],
+                                         size_t count, uint8_t *root) {
+    if (leaves == NULL || root == NULL || count == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    return merkle_subtree_root(leaves, 0, count, root);
+}
+
+/**
+ * @brief Passe le manifeste en mode apprentissage pour le firmware courant
+ */
+static void manifest_start_learning(uint32_t image_size, const esp_app_desc_t *app_desc) {
+    memset(&manifest, 0, sizeof(manifest));
+    manifest.header.magic = INTEGRITY_MANIFEST_MAGIC;
+    manifest.header.version = INTEGRITY_MANIFEST_VERSION;
+    manifest.header.chunk_size = INTEGRITY_CHUNK_SIZE_COMMUNITY;
+    manifest.header.image_size = image_size;
+    
+    size_t chunk_count = INTEGRITY_CALC_CHUNKS_COMMUNITY(image_size);
+    if (chunk_count > INTEGRITY_MAX_CHUNKS_COMMUNITY) {
+        ESP_LOGW(TAG, "⚠️  %d chunks, seuls les %d premiers sont couverts par le manifeste",
+                 chunk_count, INTEGRITY_MAX_CHUNKS_COMMUNITY);
+        chunk_count = INTEGRITY_MAX_CHUNKS_COMMUNITY;
+    }
+    manifest.header.chunk_count = (uint16_t)chunk_count;
+    
+    if (app_desc != NULL) {
+        memcpy(manifest.header.app_elf_sha256, app_desc->app_elf_sha256,
+               sizeof(manifest.header.app_elf_sha256));
+    }
+    
+    manifest_learned_chunks = 0;
+    manifest_state = INTEGRITY_MANIFEST_LEARNING;
+    ESP_LOGI(TAG, "🎓 Manifeste en apprentissage: %d chunks à enregistrer", chunk_count);
+}
+
+/**
+ * @brief Vérifie le format d'un manifeste sans toucher à sa racine
+ */
+static bool manifest_blob_format_ok(const integrity_manifest_blob_t *blob, size_t blob_size) {
+    const integrity_manifest_header_t *header = &blob->header;
+    
+    return header->magic == INTEGRITY_MANIFEST_MAGIC &&
+           header->version == INTEGRITY_MANIFEST_VERSION &&
+           header->chunk_size == INTEGRITY_CHUNK_SIZE_COMMUNITY &&
+           header->chunk_count != 0 &&
+           header->chunk_count <= INTEGRITY_MAX_CHUNKS_COMMUNITY &&
+           blob_size == INTEGRITY_MANIFEST_BLOB_SIZE(header->chunk_count);
+}
+
+static inline bool manifest_matches_app(const integrity_manifest_blob_t *blob, const esp_app_desc_t *app_desc) {
+    return app_desc == NULL ||
+           memcmp(blob->header.app_elf_sha256, app_desc->app_elf_sha256, sizeof(blob->header.app_elf_sha256)) == 0;
+}
+
+/**
+ * @brief Manifeste d'une image OTA (même format que le manifeste courant)
+ */
+esp_err_t integrity_manifest_validate_blob(const integrity_manifest_blob_t *blob, size_t blob_size) {
+    if (blob == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    if (!manifest_blob_format_ok(blob, blob_size)) {
+        return ESP_ERR_INVALID_VERSION;
+    }
+    
+    uint8_t root[INTEGRITY_MANIFEST_DIGEST_SIZE];
+    esp_err_t ret = integrity_manifest_merkle_root(
+        (const uint8_t (*)[INTEGRITY_MANIFEST_DIGEST_SIZE])blob->digests, blob->header.chunk_count, root);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    
+    return (memcmp(root, blob->header.root_hash, sizeof(root)) == 0) ? ESP_OK : ESP_ERR_INVALID_CRC;
+}
+
+/**
+ * @brief Lit un manifeste NVS dans la table en RAM
+ * 
+ * @return ESP_OK si le blob existe, taille lue dans blob_size
+ */
+static esp_err_t manifest_read_key(const char *key, size_t *blob_size) {
+    nvs_handle_t handle;
+    esp_err_t ret = nvs_open(INTEGRITY_MANIFEST_NVS_NAMESPACE, NVS_READONLY, &handle);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    
+    *blob_size = sizeof(manifest);
+    ret = nvs_get_blob(handle, key, &manifest, blob_size);
+    nvs_close(handle);
+    return ret;
+}
+
+/**
+ * @brief Adopte le manifeste livré avec l'image OTA qui démarre
+ * 
+ * Ses condensats ont été vérifiés (chunks modifiés) ou hérités (chunks
+ * identiques) avant l'activation de la partition: aucune passe
+ * d'apprentissage n'est nécessaire.
+ * 
+ * @return true si adopté et promu manifeste courant
+ */
+static bool manifest_adopt_next(const esp_app_desc_t *app_desc) {
+    size_t blob_size = 0;
+    if (manifest_read_key(INTEGRITY_MANIFEST_NVS_KEY_NEXT, &blob_size) != ESP_OK) {
+        return false;
+    }
+    
+    if (!manifest_matches_app(&manifest, app_desc) || integrity_manifest_validate_blob(&manifest, blob_size) != ESP_OK) {
+        ESP_LOGW(TAG, "⚠️  Manifeste OTA en attente ignoré (autre image ou table invalide)");
+        return false;
+    }
+    
+    nvs_handle_t handle;
+    esp_err_t ret = nvs_open(INTEGRITY_MANIFEST_NVS_NAMESPACE, NVS_READWRITE, &handle);
+    if (ret == ESP_OK) {
+        ret = nvs_set_blob(handle, INTEGRITY_MANIFEST_NVS_KEY, &manifest, blob_size);
+        if (ret == ESP_OK) {
+            ret = nvs_erase_key(handle, INTEGRITY_MANIFEST_NVS_KEY_NEXT);
+        }
+        if (ret == ESP_OK) {
+            ret = nvs_commit(handle);
+        }
+        nvs_close(handle);
+    }
+    if (ret != ESP_OK) {
+        // Utilisable pour ce démarrage; la promotion sera retentée au suivant
+        ESP_LOGW(TAG, "⚠️  Promotion du manifeste OTA échouée: %s", esp_err_to_name(ret));
+    }
+    
+    manifest_state = INTEGRITY_MANIFEST_READY;
+    ESP_LOGI(TAG, "📦 Manifeste OTA adopté: %d chunks, racine %02x%02x%02x%02x... (sans apprentissage)",
+             manifest.header.chunk_count, manifest.header.root_hash[0], manifest.header.root_hash[1],
+             manifest.header.root_hash[2], manifest.header.root_hash[3]);
+    return true;
+}
+
+/**
+ * @brief Charge le manifeste depuis NVS et vérifie sa racine
+ */
+esp_err_t integrity_manifest_load(uint32_t image_size) {
+    const esp_app_desc_t *app_desc = esp_ota_get_app_description();
+    
+    size_t blob_size = 0;
+    esp_err_t ret = manifest_read_key(INTEGRITY_MANIFEST_NVS_KEY, &blob_size);
+    if (ret != ESP_OK) {
+        if (!manifest_adopt_next(app_desc)) {
+            ESP_LOGI(TAG, "📭 Aucun manifeste stocké (premier démarrage)");
+            manifest_start_learning(image_size, app_desc);
+        }
+        return ESP_OK;
+    }
+    
+    const integrity_manifest_header_t *header = &manifest.header;
+    
+    if (!manifest_blob_format_ok(&manifest, blob_size)) {
+        ESP_LOGW(TAG, "⚠️  Format de manifeste incompatible, reconstruction");
+        manifest_start_learning(image_size, app_desc);
+        return ESP_OK;
+    }
+    
+    if (!manifest_matches_app(&manifest, app_desc)) {
+        if (!manifest_adopt_next(app_desc)) {
+            ESP_LOGI(TAG, "🔄 Nouveau firmware détecté, reconstruction du manifeste");
+            manifest_start_learning(image_size, app_desc);
+        }
+        return ESP_OK;
+    }
+    
+    // La table doit correspondre à sa racine: détecte une altération du stockage
+    ret = integrity_manifest_validate_blob(&manifest, blob_size);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ Racine du manifeste invalide - table altérée");
+        manifest_state = INTEGRITY_MANIFEST_EMPTY;
+        return ESP_ERR_INVALID_CRC;
+    }
+    
+    manifest_state = INTEGRITY_MANIFEST_READY;
+    ESP_LOGI(TAG, "✅ Manifeste chargé: %d chunks, racine %02x%02x%02x%02x...",
+             header->chunk_count, header->root_hash[0], header->root_hash[1],
+             header->root_hash[2], header->root_hash[3]);
+    
+    return ESP_OK;
+}
+
+/**
+ * @brief Enregistre le condensat d'un chunk pendant l'apprentissage
+ */
+esp_err_t integrity_manifest_learn_chunk(size_t chunk_id, const uint8_t *digest) {
+    if (manifest_state != INTEGRITY_MANIFEST_LEARNING) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    if (digest == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    if (chunk_id >= manifest.header.chunk_count) {
+        return ESP_OK; // Chunk hors couverture
+    }
+    
+    // Une passe recommence au chunk 0: repartir d'un compte vide
+    if (chunk_id == 0) {
+        manifest_learned_chunks = 0;
+    }
+    
+    memcpy(manifest.digests[chunk_id], digest, INTEGRITY_MANIFEST_DIGEST_SIZE);
+    manifest_learned_chunks++;
+    return ESP_OK;
+}
+
+/**
+ * @brief Termine l'apprentissage: calcule la racine et persiste en NVS
+ */
+esp_err_t integrity_manifest_commit(void) {
+    if (manifest_state != INTEGRITY_MANIFEST_LEARNING) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    if (manifest_learned_chunks < manifest.header.chunk_count) {
+        ESP_LOGW(TAG, "⚠️  Apprentissage incomplet: %d/%d chunks",
+                 manifest_learned_chunks, manifest.header.chunk_count);
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    esp_err_t ret = integrity_manifest_merkle_root(
+        (const uint8_t (*)[INTEGRITY_MANIFEST_DIGEST_SIZE])manifest.digests,
+        manifest.header.chunk_count, manifest.header.root_hash);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ Échec calcul racine de Merkle");
+        return ret;
+    }
+    
+    nvs_handle_t handle;
+    ret = nvs_open(INTEGRITY_MANIFEST_NVS_NAMESPACE, NVS_READWRITE, &handle);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ Ouverture NVS échouée: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    
+    size_t blob_size = INTEGRITY_MANIFEST_BLOB_SIZE(manifest.header.chunk_count);
+    ret = nvs_set_blob(handle, INTEGRITY_MANIFEST_NVS_KEY, &manifest, blob_size);
+    if (ret == ESP_OK) {
+        ret = nvs_commit(handle);
+    }
+    nvs_close(handle);
+    
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ Écriture manifeste échouée: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    
+    manifest_state = INTEGRITY_MANIFEST_READY;
+    ESP_LOGI(TAG, "💾 Manifeste persisté: %d chunks, %d bytes, racine %02x%02x%02x%02x...",
+             manifest.header.chunk_count, blob_size,
+             manifest.header.root_hash[0], manifest.header.root_hash[1],
+             manifest.header.root_hash[2], manifest.header.root_hash[3]);
+    
+    return ESP_OK;
+}
+
+/**
+ * @brief Persiste le manifeste d'une image OTA
+ */
+esp_err_t integrity_manifest_stage_next(const integrity_manifest_blob_t *blob) {
+    if (blob == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    nvs_handle_t handle;
+    esp_err_t ret = nvs_open(INTEGRITY_MANIFEST_NVS_NAMESPACE, NVS_READWRITE, &handle);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ Ouverture NVS échouée: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    
+    ret = nvs_set_blob(handle, INTEGRITY_MANIFEST_NVS_KEY_NEXT, blob,
+                       INTEGRITY_MANIFEST_BLOB_SIZE(blob->header.chunk_count));
+    if (ret == ESP_OK) {
+        ret = nvs_commit(handle);
+    }
+    nvs_close(handle);
+    
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ Écriture manifeste OTA échouée: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    
+    ESP_LOGI(TAG, "💾 Manifeste OTA en attente: %d chunks", blob->header.chunk_count);
+    return ESP_OK;
+}
+
+/**
+ * @brief Efface le manifeste (RAM et NVS)
+ */
+esp_err_t integrity_manifest_erase(void) {
+    memset(&manifest, 0, sizeof(manifest));
+    manifest_state = INTEGRITY_MANIFEST_EMPTY;
+    manifest_learned_chunks = 0;
+    
+    nvs_handle_t handle;
+    esp_err_t ret = nvs_open(INTEGRITY_MANIFEST_NVS_NAMESPACE, NVS_READWRITE, &handle);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    
+    ret = nvs_erase_key(handle, INTEGRITY_MANIFEST_NVS_KEY);
+    if (ret == ESP_OK || ret == ESP_ERR_NVS_NOT_FOUND) {
+        ret = nvs_commit(handle);
+    }
+    nvs_close(handle);
+    
+    return ret;
+}
+
+/**
+ * @brief Compare le condensat d'un chunk à la référence (un memcmp)
+ */
+integrity_status_t integrity_manifest_check_chunk(size_t chunk_id, const uint8_t *digest) {
+    if (manifest_state != INTEGRITY_MANIFEST_READY || chunk_id >= manifest.header.chunk_count) {
+        return INTEGRITY_OK;
+    }
+    
+    if (memcmp(manifest.digests[chunk_id], digest, INTEGRITY_MANIFEST_DIGEST_SIZE) != 0) {
+        ESP_LOGE(TAG, "❌ Chunk %d ne correspond pas au manifeste", chunk_id);
+        return INTEGRITY_CORRUPTED;
+    }
+    
+    return INTEGRITY_OK;
+}
+
+/**
+ * @brief Indique si un chunk a le même condensat que dans le manifeste chargé
+ */
+bool integrity_manifest_chunk_unchanged(size_t chunk_id, const uint8_t *digest) {
+    if (digest == NULL || manifest_state != INTEGRITY_MANIFEST_READY || chunk_id >= manifest.header.chunk_count) {
+        return false;
+    }
+    
+    return memcmp(manifest.digests[chunk_id], digest, INTEGRITY_MANIFEST_DIGEST_SIZE) == 0;
+}
+
+/**
+ * @brief Localise le premier chunk corrompu par comparaison directe des feuilles
+ */
+integrity_status_t integrity_manifest_locate_corruption(size_t *chunk_id) {
+    if (chunk_id == NULL) {
+        return INTEGRITY_ERROR;
+    }
+    
+    if (manifest_state != INTEGRITY_MANIFEST_READY) {
+        return INTEGRITY_NOT_INITIALIZED;
+    }
+    
+    const esp_partition_t *running = esp_ota_get_running_partition();
+    if (running == NULL) {
+        return INTEGRITY_ERROR;
+    }
+    
+    // Les feuilles sont en RAM: une lecture flash par chunk, arrêt à la première divergence
+    uint8_t current[INTEGRITY_MANIFEST_DIGEST_SIZE];
+    for (size_t i = 0; i < manifest.header.chunk_count; i++) {
+        integrity_status_t status = integrity_hash_chunk(running, i, NULL, current);
+        if (status != INTEGRITY_OK) {
+            return status;
+        }
+        
+        if (memcmp(current, manifest.digests[i], sizeof(current)) != 0) {
+            *chunk_id = i;
+            ESP_LOGE(TAG, "🎯 Chunk corrompu isolé: %d (%d chunks relus)", i, i + 1);
+            return INTEGRITY_CORRUPTED;
+        }
+    }
+    
+    return INTEGRITY_OK;
+}
+
+/**
+ * @brief Compare la racine du manifeste à une racine de confiance
+ */
+bool integrity_manifest_root_matches(const uint8_t *expected_root) {
+    if (expected_root == NULL || manifest_state != INTEGRITY_MANIFEST_READY) {
+        return false;
+    }
+    
+    return memcmp(manifest.header.root_hash, expected_root, INTEGRITY_MANIFEST_DIGEST_SIZE) == 0;
+}
+
+/**
+ * @brief Obtient l'état du manifeste
+ */
+integrity_manifest_state_t integrity_manifest_get_state(void) {
+    return manifest_state;
+}
+
+/**
+ * @brief Obtient la racine de Merkle du manifeste
+ */
+esp_err_t integrity_manifest_get_root(uint8_t *root) {
+    if (root == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    if (manifest_state != INTEGRITY_MANIFEST_READY) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    memcpy(root, manifest.header.root_hash, INTEGRITY_MANIFEST_DIGEST_SIZE);
+    return ESP_OK;
+}
+
+/**
+ * @brief Obtient le nombre de chunks couverts par le manifeste
+ */
+size_t integrity_manifest_get_chunk_count(void) {
+    return (manifest_state == INTEGRITY_MANIFEST_EMPTY) ? 0 : manifest.header.chunk_count;
+}
\ No newline at end of file
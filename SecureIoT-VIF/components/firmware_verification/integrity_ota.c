@@ -0,0 +1,209 @@
+/**
+ * @file integrity_ota.c
+ * @brief Vérification différentielle d'une image OTA (Community Edition)
+ *
+ * Le manifeste livré est conservé par l'appelant; seul le bitmap des
+ * chunks modifiés (INTEGRITY_MAX_CHUNKS_COMMUNITY bits) est tenu ici.
+ *
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#include <string.h>
+#include "esp_log.h"
+#include "esp_err.h"
+#include "esp_timer.h"
+#include "esp_ota_ops.h"
+#include "integrity_ota.h"
+#include "integrity_manifest.h"
+#include "integrity_internal.h"
+
+static const char *TAG = "INTEGRITY_OTA_COMMUNITY";
+
+#define OTA_CHANGED_WORDS   ((INTEGRITY_MAX_CHUNKS_COMMUNITY + 31) / 32)
+
+/**
+ * @brief Étapes d'une vérification OTA
+ */
+typedef enum {
+    OTA_STAGE_IDLE = 0,
+    OTA_STAGE_BEGUN,                    // Manifeste validé, delta calculé
+    OTA_STAGE_VERIFIED                  // Chunks modifiés conformes
+} ota_stage_t;
+
+static ota_stage_t ota_stage = OTA_STAGE_IDLE;
+static const esp_partition_t *ota_partition = NULL;
+static const integrity_manifest_blob_t *ota_blob = NULL;
+static uint32_t ota_changed[OTA_CHANGED_WORDS];
+static integrity_ota_stats_t ota_stats = {0};
+
+static inline bool ota_chunk_changed(size_t chunk_id) {
+    return (ota_changed[chunk_id / 32] & (1UL << (chunk_id % 32))) != 0;
+}
+
+// ================================
+// Fonctions publiques
+// ================================
+
+/**
+ * @brief Prépare la vérification d'une image OTA écrite dans une partition
+ */
+esp_err_t integrity_ota_begin(const esp_partition_t *partition,
+                              const integrity_manifest_blob_t *blob, size_t blob_size) {
+    if (partition == NULL || blob == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (partition == esp_ota_get_running_partition()) {
+        ESP_LOGE(TAG, "❌ La partition cible est celle en cours d'exécution");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    esp_err_t ret = integrity_manifest_validate_blob(blob, blob_size);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ Manifeste OTA rejeté: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    // La table doit couvrir exactement l'image annoncée
+    const integrity_manifest_header_t *header = &blob->header;
+    size_t expected_chunks = INTEGRITY_CALC_CHUNKS_COMMUNITY(header->image_size);
+    if (expected_chunks > INTEGRITY_MAX_CHUNKS_COMMUNITY) {
+        expected_chunks = INTEGRITY_MAX_CHUNKS_COMMUNITY;
+    }
+    if (header->chunk_count != expected_chunks) {
+        ESP_LOGE(TAG, "❌ Manifeste OTA: %d chunks pour %lu octets", header->chunk_count, header->image_size);
+        return ESP_ERR_INVALID_VERSION;
+    }
+    if (header->image_size > partition->size) {
+        ESP_LOGE(TAG, "❌ Image OTA (%lu octets) plus grande que la partition", header->image_size);
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    // Sans manifeste courant prêt, aucun condensat n'est hérité
+    memset(ota_changed, 0, sizeof(ota_changed));
+    memset(&ota_stats, 0, sizeof(ota_stats));
+    ota_stats.chunks_total = header->chunk_count;
+    ota_stats.full_verify = (integrity_manifest_get_state() != INTEGRITY_MANIFEST_READY);
+
+    for (size_t i = 0; i < header->chunk_count; i++) {
+        if (!integrity_manifest_chunk_unchanged(i, blob->digests[i])) {
+            ota_changed[i / 32] |= 1UL << (i % 32);
+            ota_stats.chunks_changed++;
+        }
+    }
+    ota_stats.chunks_reused = ota_stats.chunks_total - ota_stats.chunks_changed;
+
+    ota_partition = partition;
+    ota_blob = blob;
+    ota_stage = OTA_STAGE_BEGUN;
+
+    ESP_LOGI(TAG, "📦 Image OTA %s: %lu/%lu chunks modifiés, %lu hérités%s",
+             partition->label, ota_stats.chunks_changed, ota_stats.chunks_total, ota_stats.chunks_reused,
+             ota_stats.full_verify ? " (pas de manifeste courant)" : "");
+    return ESP_OK;
+}
+
+/**
+ * @brief Relit et vérifie uniquement les chunks modifiés
+ */
+esp_err_t integrity_ota_verify(void) {
+    if (ota_stage == OTA_STAGE_IDLE) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    const integrity_manifest_header_t *header = &ota_blob->header;
+    uint64_t start_us = esp_timer_get_time();
+    uint8_t chunk_hash[INTEGRITY_MANIFEST_DIGEST_SIZE];
+
+    ota_stats.chunks_verified = 0;
+    ota_stats.chunks_failed = 0;
+    ota_stats.bytes_hashed = 0;
+
+    for (size_t i = 0; i < header->chunk_count; i++) {
+        if (!ota_chunk_changed(i)) {
+            continue;
+        }
+
+        size_t offset = INTEGRITY_CHUNK_OFFSET_COMMUNITY(i);
+        size_t read_size = (offset + INTEGRITY_CHUNK_SIZE_COMMUNITY > header->image_size) ?
+                           (header->image_size - offset) : INTEGRITY_CHUNK_SIZE_COMMUNITY;
+
+        integrity_status_t status = integrity_hash_partition_range(ota_partition, i, offset, read_size,
+                                                                   NULL, chunk_hash);
+        ota_stats.bytes_hashed += read_size;
+
+        if (status == INTEGRITY_OK &&
+            memcmp(chunk_hash, ota_blob->digests[i], sizeof(chunk_hash)) == 0) {
+            ota_stats.chunks_verified++;
+        } else {
+            ota_stats.chunks_failed++;
+            ESP_LOGE(TAG, "❌ Chunk OTA %d non conforme au manifeste", i);
+        }
+    }
+
+    ota_stats.verify_time_us = (uint32_t)(esp_timer_get_time() - start_us);
+
+    if (ota_stats.chunks_failed > 0) {
+        ota_stage = OTA_STAGE_BEGUN;
+        return ESP_ERR_INVALID_CRC;
+    }
+
+    ota_stage = OTA_STAGE_VERIFIED;
+    ESP_LOGI(TAG, "✅ Image OTA vérifiée: %lu chunks relus (%lu octets) en %lu µs",
+             ota_stats.chunks_verified, ota_stats.bytes_hashed, ota_stats.verify_time_us);
+    return ESP_OK;
+}
+
+/**
+ * @brief Contrôle l'identité de l'image et met le manifeste en attente
+ */
+esp_err_t integrity_ota_finish(void) {
+    if (ota_stage != OTA_STAGE_VERIFIED) {
+        ESP_LOGE(TAG, "❌ Image OTA non vérifiée");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    // Le manifeste doit décrire l'application réellement écrite
+    esp_app_desc_t app_desc;
+    esp_err_t ret = esp_ota_get_partition_description(ota_partition, &app_desc);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ Description de l'image OTA illisible: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    if (memcmp(app_desc.app_elf_sha256, ota_blob->header.app_elf_sha256, sizeof(app_desc.app_elf_sha256)) != 0) {
+        ESP_LOGE(TAG, "❌ Le manifeste OTA décrit une autre image");
+        return ESP_ERR_INVALID_VERSION;
+    }
+
+    ret = integrity_manifest_stage_next(ota_blob);
+    if (ret == ESP_OK) {
+        ota_stage = OTA_STAGE_IDLE;
+        ota_blob = NULL;
+        ota_partition = NULL;
+    }
+    return ret;
+}
+
+/**
+ * @brief Abandonne la vérification en cours
+ */
+void integrity_ota_abort(void) {
+    ota_stage = OTA_STAGE_IDLE;
+    ota_blob = NULL;
+    ota_partition = NULL;
+    memset(ota_changed, 0, sizeof(ota_changed));
+}
+
+/**
+ * @brief Obtient le bilan de la dernière vérification
+ */
+esp_err_t integrity_ota_get_stats(integrity_ota_stats_t *stats) {
+    if (stats == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    *stats = ota_stats;
+    return ESP_OK;
+}
\ No newline at end of file
@@ -0,0 +1,224 @@
+/**
+ * @file perf_trace.h
+ * @brief Traces de latence des chemins critiques (Community Edition)
+ *
+ * Portées mesurées au compteur de cycles CPU, agrégées dans des
+ * histogrammes log2 à buckets fixes en mémoire statique. Avec
+ * CONFIG_PERF_TRACE_ENABLE désactivé, les macros ne génèrent aucun code.
+ *
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#ifndef PERF_TRACE_H
+#define PERF_TRACE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#if CONFIG_PERF_TRACE_ENABLE
+#include "esp_cpu.h"
+#endif
+
+// ================================
+// Constantes Community
+// ================================
+
+#define PERF_TRACE_BUCKETS                  (32)    // Bucket b: [2^b, 2^(b+1)) cycles
+#define PERF_TASK_STATS_MAX_TASKS           (24)    // Tâches suivies par le rapport d'occupation CPU
+
+// ================================
+// Types et structures Community
+// ================================
+
+/**
+ * @brief Portées instrumentées
+ */
+typedef enum {
+    PERF_SPAN_DHT22_READ = 0,           // dht22_read_data()
+    PERF_SPAN_SENSOR_READ,              // Lecture bloquante (sensor_read_dht22())
+    PERF_SPAN_ANOMALY_DETECT,           // Scoring d'un échantillon (tous modes)
+    PERF_SPAN_ANOMALY_BATCH,            // anomaly_detect_batch()
+    PERF_SPAN_CRYPTO_RANDOM,            // crypto_basic_generate_random()
+    PERF_SPAN_CRYPTO_SHA256,            // crypto_basic_sha256()
+    PERF_SPAN_CRYPTO_AES,               // crypto_basic_aes_encrypt()/decrypt()
+    PERF_SPAN_CRYPTO_GCM_SESSION,       // crypto_basic_gcm_session_*crypt*()
+    PERF_SPAN_CRYPTO_ECDSA_SIGN,        // crypto_basic_ecdsa_sign()
+    PERF_SPAN_CRYPTO_ECDSA_VERIFY,      // crypto_basic_ecdsa_verify()
+    PERF_SPAN_INTEGRITY_CHUNK,          // Hachage d'un chunk de firmware
+    PERF_SPAN_MONITOR_DISPATCH,         // Dispatch d'un événement de sécurité
+    PERF_SPAN_SENSOR_WAKE_LATE,         // Retard de réveil de la tâche capteur (gigue)
+    PERF_SPAN_MAX
+} perf_span_id_t;
+
+/**
+ * @brief Histogramme d'une portée
+ */
+typedef struct {
+    uint32_t count;                     // Mesures enregistrées
+    uint32_t min_cycles;                // Plus courte mesure
+    uint32_t max_cycles;                // Plus longue mesure
+    uint64_t total_cycles;              // Somme (moyenne)
+    uint32_t buckets[PERF_TRACE_BUCKETS];
+} perf_span_hist_t;
+
+/**
+ * @brief Résumé d'une portée en microsecondes
+ */
+typedef struct {
+    uint32_t count;                     // Mesures enregistrées
+    float mean_us;                      // Moyenne
+    float p50_us;                       // Médiane (borne haute du bucket)
+    float p99_us;                       // 99e centile (borne haute du bucket)
+    float max_us;                       // Maximum exact
+} perf_span_summary_t;
+
+/**
+ * @brief État du tas système par rapport au repère de fin d'initialisation
+ */
+typedef struct {
+    size_t free_bytes;                  // Libre maintenant
+    size_t free_at_mark;                // Libre au repère
+    size_t minimum_free;                // Plus bas niveau depuis le boot
+    size_t minimum_at_mark;             // Plus bas niveau au repère
+    size_t largest_block;               // Plus grand bloc allouable
+    bool marked;                        // Repère posé
+} perf_heap_report_t;
+
+/**
+ * @brief Contexte d'une portée limitée au bloc courant
+ */
+typedef struct {
+    perf_span_id_t id;
+    uint32_t start;
+} perf_trace_scope_t;
+
+// ================================
+// Macros d'instrumentation
+// ================================
+
+#if CONFIG_PERF_TRACE_ENABLE
+
+#define PERF_TRACE_CONCAT_(a, b)            a##b
+#define PERF_TRACE_CONCAT(a, b)             PERF_TRACE_CONCAT_(a, b)
+
+/**
+ * @brief Début d'une portée explicite (retourne le compteur de cycles)
+ */
+#define PERF_TRACE_BEGIN()                  esp_cpu_get_ccount()
+
+/**
+ * @brief Fin d'une portée explicite
+ */
+#define PERF_TRACE_END(id, start)           perf_trace_record((id), esp_cpu_get_ccount() - (start))
+
+/**
+ * @brief Mesure le bloc courant jusqu'à sa sortie, quel que soit le return
+ */
+#define PERF_TRACE_SCOPE(id) \
+    perf_trace_scope_t __attribute__((cleanup(perf_trace_scope_end), unused)) \
+        PERF_TRACE_CONCAT(perf_trace_scope_, __LINE__) = { (id), esp_cpu_get_ccount() }
+
+#else
+
+#define PERF_TRACE_BEGIN()                  (0U)
+#define PERF_TRACE_END(id, start)           ((void)(id), (void)(start))
+#define PERF_TRACE_SCOPE(id)                do { } while (0)
+
+#endif
+
+// ================================
+// Fonctions Community
+// ================================
+
+/**
+ * @brief Enregistre une mesure (ne pas appeler depuis une ISR)
+ *
+ * @param id Portée
+ * @param cycles Durée en cycles CPU
+ */
+void perf_trace_record(perf_span_id_t id, uint32_t cycles);
+
+/**
+ * @brief Enregistre une durée mesurée en microsecondes (esp_timer)
+ *
+ * Pour les intervalles qui dépassent la période de CCOUNT ou mesurés
+ * hors du cœur courant (retards de réveil, attentes).
+ */
+void perf_trace_record_us(perf_span_id_t id, uint32_t duration_us);
+
+/**
+ * @brief Fin de portée pour PERF_TRACE_SCOPE (attribut cleanup)
+ */
+void perf_trace_scope_end(perf_trace_scope_t *scope);
+
+/**
+ * @brief Copie l'histogramme d'une portée
+ *
+ * @return ESP_OK, ESP_ERR_INVALID_ARG, ESP_ERR_NOT_SUPPORTED si désactivé
+ */
+esp_err_t perf_trace_get_histogram(perf_span_id_t id, perf_span_hist_t *hist);
+
+/**
+ * @brief Résume une portée (moyenne, p50, p99, max en µs)
+ *
+ * @return ESP_OK, ESP_ERR_INVALID_ARG, ESP_ERR_NOT_SUPPORTED si désactivé
+ */
+esp_err_t perf_trace_get_summary(perf_span_id_t id, perf_span_summary_t *summary);
+
+/**
+ * @brief Remet tous les histogrammes à zéro
+ */
+void perf_trace_reset(void);
+
+/**
+ * @brief Affiche p50/p99/max de chaque portée ayant des mesures
+ */
+void perf_trace_dump(void);
+
+/**
+ * @brief Affiche l'occupation CPU par tâche depuis le rapport précédent
+ *
+ * Statistiques d'exécution FreeRTOS (CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS):
+ * pourcentage d'un cœur, pile libre minimale et affinité de chaque tâche.
+ *
+ * @return ESP_OK, ESP_ERR_NOT_SUPPORTED si les statistiques ne sont pas compilées
+ */
+esp_err_t perf_trace_dump_tasks(void);
+
+/**
+ * @brief Pose le repère du tas (à appeler une fois l'initialisation terminée)
+ */
+void perf_trace_heap_mark(void);
+
+/**
+ * @brief État du tas par rapport au repère
+ */
+esp_err_t perf_trace_get_heap(perf_heap_report_t *report);
+
+/**
+ * @brief Affiche l'état du tas et signale toute consommation depuis le repère
+ *
+ * Un plus bas niveau qui descend sous celui du repère révèle une
+ * allocation transitoire après l'initialisation, même libérée depuis.
+ */
+void perf_trace_dump_heap(void);
+
+/**
+ * @brief Nom lisible d'une portée
+ */
+const char* perf_trace_span_name(perf_span_id_t id);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PERF_TRACE_H */
\ No newline at end of file
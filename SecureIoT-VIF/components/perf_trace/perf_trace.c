@@ -0,0 +1,369 @@
+/**
+ * @file perf_trace.c
+ * @brief Traces de latence des chemins critiques (Community Edition)
+ *
+ * Une mesure coûte une lecture de CCOUNT, un clz et quelques
+ * incréments sous section critique. Le compteur de cycles est propre à
+ * chaque cœur: une portée interrompue par une migration de tâche peut
+ * produire une valeur aberrante, visible dans le max mais sans effet
+ * notable sur p50/p99.
+ *
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#include <string.h>
+#include "esp_log.h"
+#include "esp_err.h"
+#include "esp_heap_caps.h"
+#include "rom/ets_sys.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "perf_trace.h"
+
+static const char *TAG = "PERF_TRACE";
+
+static const char *perf_span_names[PERF_SPAN_MAX] = {
+    [PERF_SPAN_DHT22_READ]          = "dht22_read_data",
+    [PERF_SPAN_SENSOR_READ]         = "sensor_read_dht22",
+    [PERF_SPAN_ANOMALY_DETECT]      = "anomaly_detect",
+    [PERF_SPAN_ANOMALY_BATCH]       = "anomaly_detect_batch",
+    [PERF_SPAN_CRYPTO_RANDOM]       = "crypto_random",
+    [PERF_SPAN_CRYPTO_SHA256]       = "crypto_sha256",
+    [PERF_SPAN_CRYPTO_AES]          = "crypto_aes",
+    [PERF_SPAN_CRYPTO_GCM_SESSION]  = "crypto_gcm_session",
+    [PERF_SPAN_CRYPTO_ECDSA_SIGN]   = "crypto_ecdsa_sign",
+    [PERF_SPAN_CRYPTO_ECDSA_VERIFY] = "crypto_ecdsa_verify",
+    [PERF_SPAN_INTEGRITY_CHUNK]     = "integrity_chunk",
+    [PERF_SPAN_MONITOR_DISPATCH]    = "monitor_dispatch",
+    [PERF_SPAN_SENSOR_WAKE_LATE]    = "sensor_wake_late",
+};
+
+#if CONFIG_PERF_TRACE_ENABLE
+
+static perf_span_hist_t perf_histograms[PERF_SPAN_MAX];
+static portMUX_TYPE perf_lock = portMUX_INITIALIZER_UNLOCKED;
+
+/**
+ * @brief Enregistre une mesure
+ */
+void perf_trace_record(perf_span_id_t id, uint32_t cycles) {
+    if ((unsigned)id >= PERF_SPAN_MAX) {
+        return;
+    }
+
+    uint32_t bucket = (cycles != 0) ? 31U - (uint32_t)__builtin_clz(cycles) : 0U;
+    perf_span_hist_t *hist = &perf_histograms[id];
+
+    portENTER_CRITICAL(&perf_lock);
+    if (hist->count == 0 || cycles < hist->min_cycles) {
+        hist->min_cycles = cycles;
+    }
+    if (cycles > hist->max_cycles) {
+        hist->max_cycles = cycles;
+    }
+    hist->count++;
+    hist->total_cycles += cycles;
+    hist->buckets[bucket]++;
+    portEXIT_CRITICAL(&perf_lock);
+}
+
+/**
+ * @brief Enregistre une durée mesurée en microsecondes
+ */
+void perf_trace_record_us(perf_span_id_t id, uint32_t duration_us) {
+    uint64_t cycles = (uint64_t)duration_us * ets_get_cpu_frequency();
+    perf_trace_record(id, (cycles > UINT32_MAX) ? UINT32_MAX : (uint32_t)cycles);
+}
+
+/**
+ * @brief Fin de portée pour PERF_TRACE_SCOPE
+ */
+void perf_trace_scope_end(perf_trace_scope_t *scope) {
+    perf_trace_record(scope->id, esp_cpu_get_ccount() - scope->start);
+}
+
+/**
+ * @brief Copie l'histogramme d'une portée
+ */
+esp_err_t perf_trace_get_histogram(perf_span_id_t id, perf_span_hist_t *hist) {
+    if ((unsigned)id >= PERF_SPAN_MAX || hist == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    portENTER_CRITICAL(&perf_lock);
+    *hist = perf_histograms[id];
+    portEXIT_CRITICAL(&perf_lock);
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Borne haute (en cycles) du bucket contenant le rang demandé
+ */
+static uint32_t perf_percentile_cycles(const perf_span_hist_t *hist, uint32_t permille) {
+    uint32_t rank = (uint32_t)(((uint64_t)hist->count * permille + 999) / 1000);
+    uint32_t seen = 0;
+
+    if (rank == 0) {
+        rank = 1;
+    }
+
+    for (uint32_t b = 0; b < PERF_TRACE_BUCKETS; b++) {
+        seen += hist->buckets[b];
+        if (seen >= rank) {
+            uint32_t upper = (b >= 31) ? UINT32_MAX : ((1UL << (b + 1)) - 1);
+            return (upper < hist->max_cycles) ? upper : hist->max_cycles;
+        }
+    }
+
+    return hist->max_cycles;
+}
+
+/**
+ * @brief Résume une portée en microsecondes
+ */
+esp_err_t perf_trace_get_summary(perf_span_id_t id, perf_span_summary_t *summary) {
+    if (summary == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    perf_span_hist_t hist;
+    esp_err_t ret = perf_trace_get_histogram(id, &hist);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    float cycles_per_us = (float)ets_get_cpu_frequency();
+    if (cycles_per_us <= 0.0f) {
+        cycles_per_us = 1.0f;
+    }
+
+    memset(summary, 0, sizeof(perf_span_summary_t));
+    summary->count = hist.count;
+    if (hist.count == 0) {
+        return ESP_OK;
+    }
+
+    summary->mean_us = (float)hist.total_cycles / hist.count / cycles_per_us;
+    summary->p50_us = perf_percentile_cycles(&hist, 500) / cycles_per_us;
+    summary->p99_us = perf_percentile_cycles(&hist, 990) / cycles_per_us;
+    summary->max_us = hist.max_cycles / cycles_per_us;
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Remet tous les histogrammes à zéro
+ */
+void perf_trace_reset(void) {
+    portENTER_CRITICAL(&perf_lock);
+    memset(perf_histograms, 0, sizeof(perf_histograms));
+    portEXIT_CRITICAL(&perf_lock);
+}
+
+/**
+ * @brief Affiche p50/p99/max de chaque portée ayant des mesures
+ */
+void perf_trace_dump(void) {
+    ESP_LOGI(TAG, "⏱️ === Latences chemins critiques (µs) ===");
+    ESP_LOGI(TAG, "%-22s %8s %10s %10s %10s %10s", "portée", "n", "moy", "p50", "p99", "max");
+
+    for (perf_span_id_t id = 0; id < PERF_SPAN_MAX; id++) {
+        perf_span_summary_t s;
+        if (perf_trace_get_summary(id, &s) != ESP_OK || s.count == 0) {
+            continue;
+        }
+        ESP_LOGI(TAG, "%-22s %8lu %10.1f %10.1f %10.1f %10.1f",
+                 perf_span_names[id], s.count, s.mean_us, s.p50_us, s.p99_us, s.max_us);
+    }
+
+    ESP_LOGI(TAG, "========================================");
+}
+
+#else /* !CONFIG_PERF_TRACE_ENABLE */
+
+void perf_trace_record(perf_span_id_t id, uint32_t cycles) {
+    (void)id;
+    (void)cycles;
+}
+
+void perf_trace_scope_end(perf_trace_scope_t *scope) {
+    (void)scope;
+}
+
+void perf_trace_record_us(perf_span_id_t id, uint32_t duration_us) {
+    (void)id;
+    (void)duration_us;
+}
+
+esp_err_t perf_trace_get_histogram(perf_span_id_t id, perf_span_hist_t *hist) {
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t perf_trace_get_summary(perf_span_id_t id, perf_span_summary_t *summary) {
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+void perf_trace_reset(void) {
+}
+
+void perf_trace_dump(void) {
+    ESP_LOGI(TAG, "⏱️ Traces de latence désactivées (CONFIG_PERF_TRACE_ENABLE)");
+}
+
+#endif /* CONFIG_PERF_TRACE_ENABLE */
+
+/**
+ * @brief Nom lisible d'une portée
+ */
+const char* perf_trace_span_name(perf_span_id_t id) {
+    return ((unsigned)id < PERF_SPAN_MAX) ? perf_span_names[id] : "inconnue";
+}
+
+// ================================
+// Occupation CPU par tâche
+// ================================
+
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS && CONFIG_FREERTOS_USE_TRACE_FACILITY
+
+// Instantanés statiques: le rapport tourne dans la tâche de monitoring
+static TaskStatus_t perf_task_status[PERF_TASK_STATS_MAX_TASKS];
+static struct {
+    TaskHandle_t handle;
+    uint32_t run_time;
+} perf_task_previous[PERF_TASK_STATS_MAX_TASKS];
+static size_t perf_task_previous_count = 0;
+static uint32_t perf_task_previous_total = 0;
+
+/**
+ * @brief Temps d'exécution du rapport précédent pour une tâche
+ */
+static uint32_t perf_task_previous_run_time(TaskHandle_t handle) {
+    for (size_t i = 0; i < perf_task_previous_count; i++) {
+        if (perf_task_previous[i].handle == handle) {
+            return perf_task_previous[i].run_time;
+        }
+    }
+    return 0;   // Tâche créée depuis le dernier rapport
+}
+
+/**
+ * @brief Affiche l'occupation CPU par tâche depuis le rapport précédent
+ */
+esp_err_t perf_trace_dump_tasks(void) {
+    uint32_t total_run_time = 0;
+    UBaseType_t count = uxTaskGetSystemState(perf_task_status, PERF_TASK_STATS_MAX_TASKS,
+                                             &total_run_time);
+    if (count == 0) {
+        ESP_LOGW(TAG, "⚠️ Plus de %d tâches - rapport d'occupation CPU ignoré",
+                 PERF_TASK_STATS_MAX_TASKS);
+        return ESP_ERR_NO_MEM;
+    }
+
+    // Compteurs 32 bits: la soustraction reste juste après un débordement
+    uint32_t elapsed = total_run_time - perf_task_previous_total;
+    if (elapsed == 0) {
+        elapsed = 1;
+    }
+
+    ESP_LOGI(TAG, "🧮 === Occupation CPU par tâche (%% d'un cœur) ===");
+    ESP_LOGI(TAG, "%-22s %5s %4s %4s %8s %8s", "tâche", "cœur", "prio", "état", "cpu %", "pile");
+
+    for (UBaseType_t i = 0; i < count; i++) {
+        const TaskStatus_t *task = &perf_task_status[i];
+        uint32_t delta = task->ulRunTimeCounter - perf_task_previous_run_time(task->xHandle);
+        float percent = (float)delta * 100.0f / (float)elapsed;
+
+#if CONFIG_FREERTOS_VTASKLIST_INCLUDE_COREID
+        int core = (task->xCoreID == tskNO_AFFINITY) ? -1 : (int)task->xCoreID;
+#else
+        int core = -1;
+#endif
+        ESP_LOGI(TAG, "%-22s %5d %4u %4d %8.1f %8lu",
+                 task->pcTaskName, core, task->uxCurrentPriority, task->eCurrentState,
+                 percent, (uint32_t)task->usStackHighWaterMark);
+    }
+    ESP_LOGI(TAG, "  cœur -1: tâche non épinglée");
+
+    for (UBaseType_t i = 0; i < count; i++) {
+        perf_task_previous[i].handle = perf_task_status[i].xHandle;
+        perf_task_previous[i].run_time = perf_task_status[i].ulRunTimeCounter;
+    }
+    perf_task_previous_count = count;
+    perf_task_previous_total = total_run_time;
+
+    return ESP_OK;
+}
+
+#else
+
+esp_err_t perf_trace_dump_tasks(void) {
+    ESP_LOGD(TAG, "Statistiques d'exécution FreeRTOS non compilées (CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS)");
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+#endif /* CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS */
+
+// ================================
+// Niveau du tas système
+// ================================
+
+static size_t perf_heap_free_at_mark = 0;
+static size_t perf_heap_minimum_at_mark = 0;
+static bool perf_heap_marked = false;
+
+/**
+ * @brief Pose le repère du tas
+ */
+void perf_trace_heap_mark(void) {
+    perf_heap_free_at_mark = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    perf_heap_minimum_at_mark = heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT);
+    perf_heap_marked = true;
+    ESP_LOGI(TAG, "📌 Repère tas: %d octets libres en fin d'initialisation", perf_heap_free_at_mark);
+}
+
+/**
+ * @brief État du tas par rapport au repère
+ */
+esp_err_t perf_trace_get_heap(perf_heap_report_t *report) {
+    if (report == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    report->free_bytes = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    report->minimum_free = heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT);
+    report->largest_block = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+    report->free_at_mark = perf_heap_free_at_mark;
+    report->minimum_at_mark = perf_heap_minimum_at_mark;
+    report->marked = perf_heap_marked;
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Affiche l'état du tas
+ */
+void perf_trace_dump_heap(void) {
+    perf_heap_report_t report;
+    perf_trace_get_heap(&report);
+
+    ESP_LOGI(TAG, "💾 Tas: libre=%d, min=%d, plus grand bloc=%d octets",
+             report.free_bytes, report.minimum_free, report.largest_block);
+
+    if (!report.marked) {
+        return;
+    }
+    if (report.free_bytes < report.free_at_mark) {
+        ESP_LOGW(TAG, "⚠️ Tas: %d octets consommés depuis la fin de l'initialisation",
+                 report.free_at_mark - report.free_bytes);
+    }
+    if (report.minimum_free < report.minimum_at_mark) {
+        ESP_LOGW(TAG, "⚠️ Tas: allocations transitoires après l'initialisation (min %d -> %d)",
+                 report.minimum_at_mark, report.minimum_free);
+    }
+    if (report.free_bytes >= report.free_at_mark && report.minimum_free >= report.minimum_at_mark) {
+        ESP_LOGI(TAG, "✅ Tas stable depuis la fin de l'initialisation");
+    }
+}
\ No newline at end of file
@@ -0,0 +1,212 @@
+/**
+ * @file duty_cycle.c
+ * @brief Cycle de sommeil profond pour nœuds sur batterie (Community Edition)
+ *
+ * Tout l'état vit dans une seule structure RTC_DATA_ATTR: réinitialisée
+ * à la mise sous tension, conservée pendant le sommeil profond et à
+ * travers un redémarrage logiciel (validée par DUTY_CYCLE_RTC_MAGIC).
+ *
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#include <string.h>
+#include "esp_log.h"
+#include "esp_err.h"
+#include "esp_attr.h"
+#include "esp_timer.h"
+#include "esp_sleep.h"
+#include "sdkconfig.h"
+#include "duty_cycle.h"
+
+static const char *TAG = "DUTY_CYCLE_COMMUNITY";
+
+/**
+ * @brief État conservé en mémoire RTC lente
+ */
+typedef struct {
+    uint32_t magic;                                     // DUTY_CYCLE_RTC_MAGIC si valide
+    uint32_t cycles_since_full;                         // Réveils rapides depuis le dernier complet
+    uint64_t clock_base_ms;                             // Horloge monotone au réveil courant
+    uint16_t ring_head;                                 // Prochain emplacement écrit
+    uint16_t ring_count;                                // Échantillons en attente
+    duty_cycle_sample_t ring[DUTY_CYCLE_RING_CAPACITY];
+    duty_cycle_stats_t stats;
+} duty_cycle_rtc_state_t;
+
+static RTC_DATA_ATTR duty_cycle_rtc_state_t rtc_state;
+
+static duty_wake_type_t current_wake = DUTY_WAKE_COLD;
+
+// ================================
+// Fonctions publiques
+// ================================
+
+/**
+ * @brief Détermine le type du réveil courant
+ */
+duty_wake_type_t duty_cycle_begin(void) {
+    if (rtc_state.magic != DUTY_CYCLE_RTC_MAGIC || rtc_state.ring_count > DUTY_CYCLE_RING_CAPACITY ||
+        rtc_state.ring_head >= DUTY_CYCLE_RING_CAPACITY) {
+        memset(&rtc_state, 0, sizeof(rtc_state));
+        rtc_state.magic = DUTY_CYCLE_RTC_MAGIC;
+        current_wake = DUTY_WAKE_COLD;
+    } else if (esp_sleep_get_wakeup_cause() != ESP_SLEEP_WAKEUP_TIMER) {
+        current_wake = DUTY_WAKE_COLD;
+    } else if (rtc_state.cycles_since_full + 1 >= CONFIG_POWER_DUTY_FULL_WAKE_EVERY) {
+        current_wake = DUTY_WAKE_FULL;
+    } else {
+        current_wake = DUTY_WAKE_FAST;
+    }
+
+    ESP_LOGD(TAG, "🔋 Réveil %s, cycle %lu, %u échantillon(s) en mémoire RTC",
+             current_wake == DUTY_WAKE_FAST ? "rapide" : (current_wake == DUTY_WAKE_FULL ? "complet" : "à froid"),
+             rtc_state.stats.cycles, rtc_state.ring_count);
+    return current_wake;
+}
+
+/**
+ * @brief Type du réveil courant
+ */
+duty_wake_type_t duty_cycle_wake_type(void) {
+    return current_wake;
+}
+
+/**
+ * @brief Bascule le cycle courant en réveil complet
+ */
+void duty_cycle_escalate(void) {
+    if (current_wake == DUTY_WAKE_FAST) {
+        current_wake = DUTY_WAKE_FULL;
+        ESP_LOGW(TAG, "🔋 Réveil rapide interrompu: passage en réveil complet");
+    }
+}
+
+/**
+ * @brief Horloge monotone en ms, continue à travers les sommeils profonds
+ */
+uint64_t duty_cycle_now_ms(void) {
+    return rtc_state.clock_base_ms + (uint64_t)(esp_timer_get_time() / 1000);
+}
+
+/**
+ * @brief Ajoute un échantillon à l'anneau RTC
+ */
+void duty_cycle_append(const sensor_data_t *data, float anomaly_score, bool is_anomaly) {
+    duty_cycle_sample_t *slot = &rtc_state.ring[rtc_state.ring_head];
+    slot->data = *data;
+    slot->anomaly_score = anomaly_score;
+    slot->is_anomaly = is_anomaly;
+
+    rtc_state.ring_head = (rtc_state.ring_head + 1) % DUTY_CYCLE_RING_CAPACITY;
+    if (rtc_state.ring_count == DUTY_CYCLE_RING_CAPACITY) {
+        rtc_state.stats.samples_dropped++;
+    } else {
+        rtc_state.ring_count++;
+    }
+    rtc_state.stats.samples++;
+}
+
+/**
+ * @brief Retire les échantillons les plus anciens de l'anneau RTC
+ */
+size_t duty_cycle_drain(duty_cycle_sample_t *samples, size_t max_samples) {
+    size_t count = (rtc_state.ring_count < max_samples) ? rtc_state.ring_count : max_samples;
+    size_t tail = (rtc_state.ring_head + DUTY_CYCLE_RING_CAPACITY - rtc_state.ring_count) % DUTY_CYCLE_RING_CAPACITY;
+
+    for (size_t i = 0; i < count; i++) {
+        samples[i] = rtc_state.ring[tail];
+        tail = (tail + 1) % DUTY_CYCLE_RING_CAPACITY;
+    }
+    rtc_state.ring_count -= (uint16_t)count;
+
+    return count;
+}
+
+/**
+ * @brief Termine le cycle et entre en sommeil profond
+ */
+void duty_cycle_sleep(void) {
+    uint64_t awake_us = (uint64_t)esp_timer_get_time();
+    uint64_t awake_ms = awake_us / 1000;
+    duty_cycle_stats_t *stats = &rtc_state.stats;
+
+    if (current_wake == DUTY_WAKE_FAST) {
+        stats->fast_wakes++;
+        stats->fast_awake_us += awake_us;
+        stats->last_fast_awake_us = (uint32_t)awake_us;
+        rtc_state.cycles_since_full++;
+    } else {
+        stats->full_wakes++;
+        stats->full_awake_us += awake_us;
+        stats->last_full_awake_us = (uint32_t)awake_us;
+        rtc_state.cycles_since_full = 0;
+    }
+    stats->cycles++;
+
+    // Période fixe: le temps éveillé est déduit du sommeil
+    uint64_t sleep_ms = (awake_ms + DUTY_CYCLE_MIN_SLEEP_MS < CONFIG_POWER_DUTY_CYCLE_PERIOD_MS) ?
+                        CONFIG_POWER_DUTY_CYCLE_PERIOD_MS - awake_ms : DUTY_CYCLE_MIN_SLEEP_MS;
+    stats->sleep_ms += sleep_ms;
+    rtc_state.clock_base_ms += awake_ms + sleep_ms;
+
+    ESP_LOGI(TAG, "💤 Sommeil profond %llu ms (éveillé %llu ms, %s)", sleep_ms, awake_ms,
+             current_wake == DUTY_WAKE_FAST ? "réveil rapide" : "réveil complet");
+
+    esp_sleep_enable_timer_wakeup(sleep_ms * 1000);
+    esp_deep_sleep_start();
+}
+
+/**
+ * @brief Obtient les statistiques cumulées
+ */
+esp_err_t duty_cycle_get_stats(duty_cycle_stats_t *stats) {
+    if (stats == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (rtc_state.magic != DUTY_CYCLE_RTC_MAGIC) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    *stats = rtc_state.stats;
+    return ESP_OK;
+}
+
+/**
+ * @brief Énergie estimée par échantillon (µJ)
+ */
+uint32_t duty_cycle_energy_per_sample_uj(const duty_cycle_stats_t *stats) {
+    if (stats->samples == 0) {
+        return 0;
+    }
+
+    // mA x ms x mV / 1000 = µJ ; µA x ms x mV / 10^6 = µJ
+    uint64_t awake_uj = (stats->fast_awake_us / 1000 * CONFIG_POWER_ACTIVE_CURRENT_MA +
+                         stats->full_awake_us / 1000 * CONFIG_POWER_FULL_WAKE_CURRENT_MA) *
+                        CONFIG_POWER_SUPPLY_MV / 1000;
+    uint64_t sleep_uj = stats->sleep_ms * CONFIG_POWER_SLEEP_CURRENT_UA * CONFIG_POWER_SUPPLY_MV / 1000000;
+
+    return (uint32_t)((awake_uj + sleep_uj) / stats->samples);
+}
+
+/**
+ * @brief Affiche le bilan énergétique
+ */
+void duty_cycle_print_energy(void) {
+    duty_cycle_stats_t stats;
+    if (duty_cycle_get_stats(&stats) != ESP_OK || stats.samples == 0) {
+        return;
+    }
+
+    // Référence: CPU actif en permanence, un échantillon par période
+    uint64_t always_on_uj = (uint64_t)CONFIG_POWER_DUTY_CYCLE_PERIOD_MS * CONFIG_POWER_ACTIVE_CURRENT_MA *
+                            CONFIG_POWER_SUPPLY_MV / 1000;
+    uint32_t per_sample_uj = duty_cycle_energy_per_sample_uj(&stats);
+
+    ESP_LOGI(TAG, "⚡ Énergie estimée: %lu µJ/échantillon (toujours actif: %llu µJ, x%llu)",
+             per_sample_uj, always_on_uj, per_sample_uj > 0 ? always_on_uj / per_sample_uj : 0);
+    ESP_LOGI(TAG, "   %lu cycles: %lu rapides (dernier %lu ms), %lu complets (dernier %lu ms), %lu échantillon(s) perdu(s)",
+             stats.cycles, stats.fast_wakes, stats.last_fast_awake_us / 1000,
+             stats.full_wakes, stats.last_full_awake_us / 1000, stats.samples_dropped);
+}
\ No newline at end of file
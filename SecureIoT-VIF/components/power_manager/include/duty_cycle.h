@@ -0,0 +1,151 @@
+/**
+ * @file duty_cycle.h
+ * @brief Cycle de sommeil profond pour nœuds sur batterie (Community Edition)
+ *
+ * Chaque cycle: réveil sur timer, lecture capteur, scoring, ajout à un
+ * anneau en mémoire RTC lente, retour en sommeil profond. Un cycle sur
+ * CONFIG_POWER_DUTY_FULL_WAKE_EVERY (ou sur anomalie) est un réveil
+ * complet: initialisation de sécurité, vérification d'intégrité, radio,
+ * rejeu de l'anneau.
+ *
+ * Le module garde aussi une horloge monotone à travers les sommeils
+ * (esp_timer repart de zéro à chaque réveil) et un modèle d'énergie par
+ * échantillon à partir des temps éveillés mesurés.
+ *
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#ifndef DUTY_CYCLE_H
+#define DUTY_CYCLE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "sensor_manager.h"
+
+// ================================
+// Constantes Community
+// ================================
+
+#define DUTY_CYCLE_RING_CAPACITY            (48)    // 4 réveils complets manqués à 12 cycles
+#define DUTY_CYCLE_MIN_SLEEP_MS             (100)
+#define DUTY_CYCLE_RTC_MAGIC                (0x44435931)  // "DCY1"
+
+// ================================
+// Types et structures Community
+// ================================
+
+/**
+ * @brief Type du réveil courant
+ */
+typedef enum {
+    DUTY_WAKE_COLD = 0,             // Mise sous tension, reset, panique: initialisation complète
+    DUTY_WAKE_FAST,                 // Capteur + détection seulement
+    DUTY_WAKE_FULL                  // Initialisation complète, radio, intégrité
+} duty_wake_type_t;
+
+/**
+ * @brief Échantillon conservé en mémoire RTC
+ */
+typedef struct {
+    sensor_data_t data;             // Horodatage sur l'horloge monotone du module
+    float anomaly_score;            // Score au moment du réveil rapide
+    bool is_anomaly;                // Anomalie détectée
+} duty_cycle_sample_t;
+
+/**
+ * @brief Statistiques cumulées depuis le démarrage à froid
+ */
+typedef struct {
+    uint32_t cycles;                // Cycles terminés
+    uint32_t fast_wakes;            // Réveils rapides
+    uint32_t full_wakes;            // Réveils complets (démarrages à froid inclus)
+    uint32_t samples;               // Échantillons ajoutés à l'anneau RTC
+    uint32_t samples_dropped;       // Écrasés avant un réveil complet
+    uint64_t fast_awake_us;         // Temps éveillé cumulé, réveils rapides
+    uint64_t full_awake_us;         // Temps éveillé cumulé, réveils complets
+    uint64_t sleep_ms;              // Sommeil programmé cumulé
+    uint32_t last_fast_awake_us;    // Dernier réveil rapide
+    uint32_t last_full_awake_us;    // Dernier réveil complet
+} duty_cycle_stats_t;
+
+// ================================
+// Fonctions Community
+// ================================
+
+/**
+ * @brief Détermine le type du réveil courant (à appeler en tête de app_main)
+ *
+ * Une mémoire RTC invalide (mise sous tension) est réinitialisée. Un
+ * réveil autre que le timer est un démarrage à froid, mais l'anneau RTC
+ * est conservé pour être rejoué.
+ */
+duty_wake_type_t duty_cycle_begin(void);
+
+/**
+ * @brief Type du réveil courant
+ */
+duty_wake_type_t duty_cycle_wake_type(void);
+
+/**
+ * @brief Bascule le cycle courant en réveil complet (anomalie ou échec en réveil rapide)
+ */
+void duty_cycle_escalate(void);
+
+/**
+ * @brief Horloge monotone en ms, continue à travers les sommeils profonds
+ *
+ * Le temps du bootloader au réveil n'est pas compté: dérive de l'ordre
+ * de 100 ms par cycle.
+ */
+uint64_t duty_cycle_now_ms(void);
+
+/**
+ * @brief Ajoute un échantillon à l'anneau RTC (écrase le plus ancien si plein)
+ */
+void duty_cycle_append(const sensor_data_t *data, float anomaly_score, bool is_anomaly);
+
+/**
+ * @brief Retire les échantillons les plus anciens de l'anneau RTC
+ *
+ * @return Nombre d'échantillons copiés
+ */
+size_t duty_cycle_drain(duty_cycle_sample_t *samples, size_t max_samples);
+
+/**
+ * @brief Termine le cycle et entre en sommeil profond jusqu'à l'échéance suivante
+ *
+ * La durée de sommeil complète la période CONFIG_POWER_DUTY_CYCLE_PERIOD_MS
+ * à partir du temps déjà passé éveillé.
+ */
+void duty_cycle_sleep(void) __attribute__((noreturn));
+
+/**
+ * @brief Obtient les statistiques cumulées
+ */
+esp_err_t duty_cycle_get_stats(duty_cycle_stats_t *stats);
+
+/**
+ * @brief Énergie estimée par échantillon (µJ), modèle de courants Kconfig
+ *
+ * @return 0 tant qu'aucun échantillon n'a été pris
+ */
+uint32_t duty_cycle_energy_per_sample_uj(const duty_cycle_stats_t *stats);
+
+/**
+ * @brief Affiche le bilan énergétique
+ */
+void duty_cycle_print_energy(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DUTY_CYCLE_H */
\ No newline at end of file
@@ -0,0 +1,262 @@
+/**
+ * @file crypto_arena.c
+ * @brief Arène statique pour les allocations mbedTLS (Community Edition)
+ *
+ * Liste implicite de blocs contigus (en-tête de 8 octets), recherche
+ * first-fit et fusion paresseuse des blocs libres voisins pendant la
+ * recherche. Les temporaires d'une opération sont libérés à sa fin, mais
+ * les sessions GCM, les vérificateurs ECDSA (groupe et table comb) et le
+ * contexte de signature gardent leurs blocs tant qu'ils vivent: l'arène
+ * ne revient pas à un seul bloc libre entre deux appels et doit contenir
+ * ces allocations durables plus le pic d'une opération.
+ * crypto_arena_calloc_or_heap() sert une demande que l'arène ne peut pas
+ * satisfaire depuis le tas, au lieu de faire échouer l'opération.
+ *
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "crypto_arena.h"
+
+static const char *TAG = "CRYPTO_ARENA";
+
+/**
+ * @brief En-tête d'un bloc de l'arène
+ */
+typedef struct {
+    uint32_t size;                  // Taille du bloc, en-tête compris
+    uint32_t used;                  // 1 si alloué
+} crypto_arena_block_t;
+
+#define ARENA_HEADER_SIZE           ((uint32_t)sizeof(crypto_arena_block_t))
+#define ARENA_MIN_BLOCK             (ARENA_HEADER_SIZE + CRYPTO_ARENA_ALIGNMENT)
+#define ARENA_ALIGN_UP(x)           (((x) + CRYPTO_ARENA_ALIGNMENT - 1) & ~(size_t)(CRYPTO_ARENA_ALIGNMENT - 1))
+
+static uint8_t *arena_base = NULL;
+static uint8_t *arena_end = NULL;
+static crypto_arena_stats_t arena_stats;
+
+static SemaphoreHandle_t arena_lock = NULL;
+static StaticSemaphore_t arena_lock_buffer;
+
+// ================================
+// Fonctions internes
+// ================================
+
+static inline crypto_arena_block_t *arena_next(crypto_arena_block_t *block) {
+    return (crypto_arena_block_t *)((uint8_t *)block + block->size);
+}
+
+static inline bool arena_contains(const void *ptr) {
+    return (const uint8_t *)ptr >= arena_base && (const uint8_t *)ptr < arena_end;
+}
+
+/**
+ * @brief Absorbe les blocs libres qui suivent un bloc libre
+ */
+static void arena_merge_forward(crypto_arena_block_t *block) {
+    crypto_arena_block_t *next = arena_next(block);
+    while ((uint8_t *)next < arena_end && !next->used) {
+        block->size += next->size;
+        next = arena_next(block);
+    }
+}
+
+// ================================
+// Fonctions publiques
+// ================================
+
+/**
+ * @brief Initialise l'arène sur un buffer statique
+ */
+esp_err_t crypto_arena_init(void *buffer, size_t size) {
+    if (buffer == NULL || size < CRYPTO_ARENA_MIN_SIZE || size > UINT32_MAX ||
+        ((uintptr_t)buffer % CRYPTO_ARENA_ALIGNMENT) != 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (arena_lock == NULL) {
+        arena_lock = xSemaphoreCreateMutexStatic(&arena_lock_buffer);
+        if (arena_lock == NULL) {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+    size &= ~(size_t)(CRYPTO_ARENA_ALIGNMENT - 1);
+
+    xSemaphoreTake(arena_lock, portMAX_DELAY);
+    arena_base = buffer;
+    arena_end = arena_base + size;
+
+    crypto_arena_block_t *first = (crypto_arena_block_t *)arena_base;
+    first->size = (uint32_t)size;
+    first->used = 0;
+
+    memset(&arena_stats, 0, sizeof(arena_stats));
+    arena_stats.capacity = size;
+    xSemaphoreGive(arena_lock);
+
+    ESP_LOGI(TAG, "🧱 Arène crypto statique: %d octets", size);
+    return ESP_OK;
+}
+
+/**
+ * @brief Détache l'arène
+ */
+void crypto_arena_deinit(void) {
+    if (arena_lock == NULL) {
+        return;
+    }
+
+    xSemaphoreTake(arena_lock, portMAX_DELAY);
+    if (arena_stats.live_blocks != 0) {
+        ESP_LOGW(TAG, "⚠️ %lu bloc(s) encore alloué(s) à la désinstallation", arena_stats.live_blocks);
+    }
+    arena_base = NULL;
+    arena_end = NULL;
+    xSemaphoreGive(arena_lock);
+}
+
+/**
+ * @brief calloc sur l'arène
+ */
+void *crypto_arena_calloc(size_t count, size_t size) {
+    if (size != 0 && count > SIZE_MAX / size) {
+        return NULL;
+    }
+
+    size_t bytes = count * size;
+    if (bytes == 0) {
+        bytes = 1;
+    }
+
+    if (arena_lock == NULL || bytes > arena_stats.capacity) {
+        return NULL;
+    }
+    uint32_t need = (uint32_t)ARENA_ALIGN_UP(bytes) + ARENA_HEADER_SIZE;
+
+    xSemaphoreTake(arena_lock, portMAX_DELAY);
+    for (crypto_arena_block_t *block = (crypto_arena_block_t *)arena_base;
+         arena_base != NULL && (uint8_t *)block < arena_end; block = arena_next(block)) {
+        if (block->used) {
+            continue;
+        }
+
+        arena_merge_forward(block);
+        if (block->size < need) {
+            continue;
+        }
+
+        // Découper si le reste peut porter un bloc
+        if (block->size - need >= ARENA_MIN_BLOCK) {
+            crypto_arena_block_t *rest = (crypto_arena_block_t *)((uint8_t *)block + need);
+            rest->size = block->size - need;
+            rest->used = 0;
+            block->size = need;
+        }
+        block->used = 1;
+
+        arena_stats.used += block->size;
+        arena_stats.live_blocks++;
+        arena_stats.allocations++;
+        if (arena_stats.used > arena_stats.peak) {
+            arena_stats.peak = arena_stats.used;
+        }
+        xSemaphoreGive(arena_lock);
+
+        void *payload = block + 1;
+        memset(payload, 0, block->size - ARENA_HEADER_SIZE);
+        return payload;
+    }
+
+    arena_stats.failures++;
+    xSemaphoreGive(arena_lock);
+    return NULL;
+}
+
+/**
+ * @brief calloc sur l'arène, repli sur le tas si elle est pleine
+ */
+void *crypto_arena_calloc_or_heap(size_t count, size_t size) {
+    void *ptr = crypto_arena_calloc(count, size);
+    if (ptr != NULL || arena_lock == NULL) {
+        return ptr;
+    }
+
+    // Rendu au tas par crypto_arena_free() (pointeur hors arène)
+    ptr = calloc(count, size);
+    if (ptr == NULL) {
+        return NULL;
+    }
+
+    xSemaphoreTake(arena_lock, portMAX_DELAY);
+    bool first_fallback = (arena_stats.heap_fallbacks++ == 0);
+    xSemaphoreGive(arena_lock);
+
+    if (first_fallback) {
+        ESP_LOGW(TAG, "⚠️ Arène pleine: allocation de %d octets servie par le tas (agrandir l'arène)",
+                 count * size);
+    }
+    return ptr;
+}
+
+/**
+ * @brief free sur l'arène
+ */
+void crypto_arena_free(void *ptr) {
+    if (ptr == NULL) {
+        return;
+    }
+
+    if (arena_lock == NULL || !arena_contains(ptr)) {
+        // Alloué par le tas avant l'installation de l'arène
+        if (arena_lock != NULL) {
+            xSemaphoreTake(arena_lock, portMAX_DELAY);
+            arena_stats.foreign_frees++;
+            xSemaphoreGive(arena_lock);
+        }
+        free(ptr);
+        return;
+    }
+
+    crypto_arena_block_t *block = (crypto_arena_block_t *)ptr - 1;
+
+    xSemaphoreTake(arena_lock, portMAX_DELAY);
+    if (!block->used) {
+        xSemaphoreGive(arena_lock);
+        ESP_LOGE(TAG, "❌ Double libération dans l'arène (%p)", ptr);
+        return;
+    }
+
+    block->used = 0;
+    arena_stats.used -= block->size;
+    arena_stats.live_blocks--;
+    arena_merge_forward(block);
+    xSemaphoreGive(arena_lock);
+}
+
+/**
+ * @brief Statistiques de l'arène
+ */
+esp_err_t crypto_arena_get_stats(crypto_arena_stats_t *stats) {
+    if (stats == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (arena_lock == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(arena_lock, portMAX_DELAY);
+    *stats = arena_stats;
+    xSemaphoreGive(arena_lock);
+
+    return ESP_OK;
+}
\ No newline at end of file
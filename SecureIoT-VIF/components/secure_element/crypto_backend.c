@@ -0,0 +1,336 @@
+/**
+ * @file crypto_backend.c
+ * @brief Backends SHA-256 / AES-GCM (software mbedTLS et accélérateurs ESP32)
+ * 
+ * Le backend software passe par mbedTLS. Le backend hardware appelle
+ * directement les pilotes des périphériques du port mbedTLS d'ESP-IDF
+ * (capacités SOC_SHA_SUPPORTED / SOC_AES_SUPPORT_GCM): SHA-256 toujours,
+ * AES-GCM si la puce a le mode GCM. Sur l'ESP32 d'origine, AES-GCM est
+ * celui de mbedTLS, dont les blocs passent par le périphérique AES avec
+ * CONFIG_MBEDTLS_HARDWARE_AES (alors partagé par les deux backends).
+ * 
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#include <string.h>
+#include "esp_log.h"
+#include "esp_err.h"
+#include "mbedtls/sha256.h"
+#include "crypto_backend.h"
+
+#if CRYPTO_BACKEND_HW_AVAILABLE
+#if defined(SOC_SHA_SUPPORT_PARALLEL_ENG) && SOC_SHA_SUPPORT_PARALLEL_ENG
+#include "sha/sha_parallel_engine.h"
+#elif defined(SOC_SHA_SUPPORT_DMA) && SOC_SHA_SUPPORT_DMA
+#include "sha/sha_dma.h"
+#else
+#include "sha/sha_block.h"
+#endif
+#endif
+
+static const char *TAG = "CRYPTO_BACKEND_COMMUNITY";
+
+// ================================
+// Backend software (mbedTLS)
+// ================================
+
+static esp_err_t sw_sha256(const uint8_t *input, size_t input_len, uint8_t *output) {
+    mbedtls_sha256_context sha256_ctx;
+    mbedtls_sha256_init(&sha256_ctx);
+    
+    int mbedtls_ret = mbedtls_sha256_starts_ret(&sha256_ctx, 0); // SHA-256
+    if (mbedtls_ret == 0) {
+        mbedtls_ret = mbedtls_sha256_update_ret(&sha256_ctx, input, input_len);
+    }
+    if (mbedtls_ret == 0) {
+        mbedtls_ret = mbedtls_sha256_finish_ret(&sha256_ctx, output);
+    }
+    
+    mbedtls_sha256_free(&sha256_ctx);
+    
+    if (mbedtls_ret != 0) {
+        ESP_LOGE(TAG, "❌ Échec SHA-256 software: -0x%04x", -mbedtls_ret);
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+static esp_err_t sw_gcm_setkey(crypto_backend_gcm_ctx_t *ctx, const uint8_t *key) {
+    mbedtls_gcm_init(&ctx->sw);
+    
+    int mbedtls_ret = mbedtls_gcm_setkey(&ctx->sw, MBEDTLS_CIPHER_ID_AES, key, 128); // AES-128
+    if (mbedtls_ret != 0) {
+        ESP_LOGE(TAG, "❌ Échec configuration clé AES software: -0x%04x", -mbedtls_ret);
+        mbedtls_gcm_free(&ctx->sw);
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+static esp_err_t sw_gcm_encrypt(crypto_backend_gcm_ctx_t *ctx, const uint8_t *iv,
+                                const uint8_t *aad, size_t aad_len,
+                                const uint8_t *input, size_t input_len,
+                                uint8_t *output, uint8_t *tag) {
+    int mbedtls_ret = mbedtls_gcm_crypt_and_tag(&ctx->sw, MBEDTLS_GCM_ENCRYPT, input_len,
+                                               iv, CRYPTO_BASIC_AES_IV_SIZE, aad, aad_len,
+                                               input, output, CRYPTO_BASIC_AES_TAG_SIZE, tag);
+    if (mbedtls_ret != 0) {
+        ESP_LOGE(TAG, "❌ Échec chiffrement AES-GCM software: -0x%04x", -mbedtls_ret);
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+static esp_err_t sw_gcm_decrypt(crypto_backend_gcm_ctx_t *ctx, const uint8_t *iv,
+                                const uint8_t *aad, size_t aad_len,
+                                const uint8_t *input, size_t input_len,
+                                const uint8_t *tag, uint8_t *output) {
+    int mbedtls_ret = mbedtls_gcm_auth_decrypt(&ctx->sw, input_len, iv, CRYPTO_BASIC_AES_IV_SIZE,
+                                              aad, aad_len, tag, CRYPTO_BASIC_AES_TAG_SIZE,
+                                              input, output);
+    if (mbedtls_ret != 0) {
+        ESP_LOGE(TAG, "❌ Échec déchiffrement AES-GCM software: -0x%04x", -mbedtls_ret);
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+static void sw_gcm_free(crypto_backend_gcm_ctx_t *ctx) {
+    mbedtls_gcm_free(&ctx->sw);
+}
+
+static const crypto_backend_ops_t crypto_backend_software = {
+    .id = CRYPTO_BASIC_BACKEND_SOFTWARE,
+#if CRYPTO_BACKEND_MBEDTLS_AES_HW
+    .name = "software (SHA mbedTLS, AES matériel)",
+#else
+    .name = "software (mbedTLS)",
+#endif
+    .sha256 = sw_sha256,
+    .gcm_setkey = sw_gcm_setkey,
+    .gcm_encrypt = sw_gcm_encrypt,
+    .gcm_decrypt = sw_gcm_decrypt,
+    .gcm_free = sw_gcm_free,
+};
+
+// ================================
+// Backend hardware (accélérateurs SHA/AES)
+// ================================
+
+#if CRYPTO_BACKEND_HW_AVAILABLE
+
+static esp_err_t hw_sha256(const uint8_t *input, size_t input_len, uint8_t *output) {
+    esp_sha(SHA2_256, input, input_len, output);
+    return ESP_OK;
+}
+
+#if CRYPTO_BACKEND_HW_GCM_AVAILABLE
+
+static esp_err_t hw_gcm_setkey(crypto_backend_gcm_ctx_t *ctx, const uint8_t *key) {
+    esp_aes_gcm_init(&ctx->hw);
+    
+    int ret = esp_aes_gcm_setkey(&ctx->hw, MBEDTLS_CIPHER_ID_AES, key, 128); // AES-128
+    if (ret != 0) {
+        ESP_LOGE(TAG, "❌ Échec configuration clé AES hardware: -0x%04x", -ret);
+        esp_aes_gcm_free(&ctx->hw);
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+static esp_err_t hw_gcm_encrypt(crypto_backend_gcm_ctx_t *ctx, const uint8_t *iv,
+                                const uint8_t *aad, size_t aad_len,
+                                const uint8_t *input, size_t input_len,
+                                uint8_t *output, uint8_t *tag) {
+    int ret = esp_aes_gcm_crypt_and_tag(&ctx->hw, MBEDTLS_GCM_ENCRYPT, input_len,
+                                        iv, CRYPTO_BASIC_AES_IV_SIZE, aad, aad_len,
+                                        input, output, CRYPTO_BASIC_AES_TAG_SIZE, tag);
+    if (ret != 0) {
+        ESP_LOGE(TAG, "❌ Échec chiffrement AES-GCM hardware: -0x%04x", -ret);
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+static esp_err_t hw_gcm_decrypt(crypto_backend_gcm_ctx_t *ctx, const uint8_t *iv,
+                                const uint8_t *aad, size_t aad_len,
+                                const uint8_t *input, size_t input_len,
+                                const uint8_t *tag, uint8_t *output) {
+    int ret = esp_aes_gcm_auth_decrypt(&ctx->hw, input_len, iv, CRYPTO_BASIC_AES_IV_SIZE,
+                                       aad, aad_len, tag, CRYPTO_BASIC_AES_TAG_SIZE,
+                                       input, output);
+    if (ret != 0) {
+        ESP_LOGE(TAG, "❌ Échec déchiffrement AES-GCM hardware: -0x%04x", -ret);
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+static void hw_gcm_free(crypto_backend_gcm_ctx_t *ctx) {
+    esp_aes_gcm_free(&ctx->hw);
+}
+
+static const crypto_backend_ops_t crypto_backend_hardware = {
+    .id = CRYPTO_BASIC_BACKEND_HARDWARE,
+    .name = "hardware (SHA/AES-GCM)",
+    .sha256 = hw_sha256,
+    .gcm_setkey = hw_gcm_setkey,
+    .gcm_encrypt = hw_gcm_encrypt,
+    .gcm_decrypt = hw_gcm_decrypt,
+    .gcm_free = hw_gcm_free,
+};
+
+#else
+
+static const crypto_backend_ops_t crypto_backend_hardware = {
+    .id = CRYPTO_BASIC_BACKEND_HARDWARE,
+#if CRYPTO_BACKEND_MBEDTLS_AES_HW
+    .name = "hardware (SHA, GCM mbedTLS sur AES matériel)",
+#else
+    .name = "hardware (SHA, AES-GCM mbedTLS logiciel)",
+#endif
+    .sha256 = hw_sha256,
+    .gcm_setkey = sw_gcm_setkey,
+    .gcm_encrypt = sw_gcm_encrypt,
+    .gcm_decrypt = sw_gcm_decrypt,
+    .gcm_free = sw_gcm_free,
+};
+
+#endif /* CRYPTO_BACKEND_HW_GCM_AVAILABLE */
+
+#endif /* CRYPTO_BACKEND_HW_AVAILABLE */
+
+// ================================
+// Sonde et sélection
+// ================================
+
+static const crypto_backend_ops_t *active_backend = &crypto_backend_software;
+
+// SHA-256("abc") - FIPS 180-2
+static const uint8_t kat_sha256_abc[CRYPTO_BASIC_SHA256_SIZE] = {
+    0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea, 0x41, 0x41, 0x40, 0xde, 0x5d, 0xae, 0x22, 0x23,
+    0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17, 0x7a, 0x9c, 0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad
+};
+
+// AES-128-GCM, clé/IV/clair nuls - cas de test n°2 de la spécification GCM
+static const uint8_t kat_gcm_ciphertext[16] = {
+    0x03, 0x88, 0xda, 0xce, 0x60, 0xb6, 0xa3, 0x92, 0xf3, 0x28, 0xc2, 0xb9, 0x71, 0xb2, 0xfe, 0x78
+};
+static const uint8_t kat_gcm_tag[CRYPTO_BASIC_AES_TAG_SIZE] = {
+    0xab, 0x6e, 0x47, 0xd4, 0x2c, 0xec, 0x13, 0xbd, 0xf5, 0x3a, 0x67, 0xb2, 0x12, 0x57, 0xbd, 0xdf
+};
+
+esp_err_t crypto_backend_gcm_oneshot_encrypt(const crypto_backend_ops_t *backend,
+                                             const uint8_t *key, const uint8_t *iv,
+                                             const uint8_t *aad, size_t aad_len,
+                                             const uint8_t *input, size_t input_len,
+                                             uint8_t *output, uint8_t *tag) {
+    crypto_backend_gcm_ctx_t ctx;
+    esp_err_t ret = backend->gcm_setkey(&ctx, key);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    
+    ret = backend->gcm_encrypt(&ctx, iv, aad, aad_len, input, input_len, output, tag);
+    backend->gcm_free(&ctx);
+    CRYPTO_BASIC_SECURE_ZERO(&ctx, sizeof(ctx));
+    return ret;
+}
+
+esp_err_t crypto_backend_gcm_oneshot_decrypt(const crypto_backend_ops_t *backend,
+                                             const uint8_t *key, const uint8_t *iv,
+                                             const uint8_t *aad, size_t aad_len,
+                                             const uint8_t *input, size_t input_len,
+                                             const uint8_t *tag, uint8_t *output) {
+    crypto_backend_gcm_ctx_t ctx;
+    esp_err_t ret = backend->gcm_setkey(&ctx, key);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    
+    ret = backend->gcm_decrypt(&ctx, iv, aad, aad_len, input, input_len, tag, output);
+    backend->gcm_free(&ctx);
+    CRYPTO_BASIC_SECURE_ZERO(&ctx, sizeof(ctx));
+    return ret;
+}
+
+/**
+ * @brief Vérifie un backend contre des vecteurs de test connus
+ */
+static esp_err_t crypto_backend_probe(const crypto_backend_ops_t *backend) {
+    uint8_t digest[CRYPTO_BASIC_SHA256_SIZE];
+    if (backend->sha256((const uint8_t *)"abc", 3, digest) != ESP_OK ||
+        memcmp(digest, kat_sha256_abc, sizeof(digest)) != 0) {
+        ESP_LOGW(TAG, "⚠️  Sonde SHA-256 %s échouée", backend->name);
+        return ESP_FAIL;
+    }
+    
+    const uint8_t zero_key[CRYPTO_BASIC_AES_KEY_SIZE] = {0};
+    const uint8_t zero_iv[CRYPTO_BASIC_AES_IV_SIZE] = {0};
+    const uint8_t zero_block[16] = {0};
+    uint8_t ciphertext[16];
+    uint8_t plaintext[16];
+    uint8_t tag[CRYPTO_BASIC_AES_TAG_SIZE];
+    
+    if (crypto_backend_gcm_oneshot_encrypt(backend, zero_key, zero_iv, NULL, 0,
+                                           zero_block, sizeof(zero_block), ciphertext, tag) != ESP_OK ||
+        memcmp(ciphertext, kat_gcm_ciphertext, sizeof(ciphertext)) != 0 ||
+        memcmp(tag, kat_gcm_tag, sizeof(tag)) != 0) {
+        ESP_LOGW(TAG, "⚠️  Sonde AES-GCM %s échouée", backend->name);
+        return ESP_FAIL;
+    }
+    
+    if (crypto_backend_gcm_oneshot_decrypt(backend, zero_key, zero_iv, NULL, 0,
+                                           ciphertext, sizeof(ciphertext), tag, plaintext) != ESP_OK ||
+        memcmp(plaintext, zero_block, sizeof(plaintext)) != 0) {
+        ESP_LOGW(TAG, "⚠️  Sonde AES-GCM (déchiffrement) %s échouée", backend->name);
+        return ESP_FAIL;
+    }
+    
+    return ESP_OK;
+}
+
+const crypto_backend_ops_t *crypto_backend_get(crypto_basic_backend_t id) {
+    switch (id) {
+        case CRYPTO_BASIC_BACKEND_SOFTWARE:
+            return &crypto_backend_software;
+#if CRYPTO_BACKEND_HW_AVAILABLE
+        case CRYPTO_BASIC_BACKEND_HARDWARE:
+            return &crypto_backend_hardware;
+#endif
+        default:
+            return NULL;
+    }
+}
+
+const crypto_backend_ops_t *crypto_backend_active(void) {
+    return active_backend;
+}
+
+esp_err_t crypto_backend_select(void) {
+#if defined(CONFIG_CRYPTO_BASIC_BACKEND_SOFTWARE)
+    const bool want_hardware = false;
+#else
+    const bool want_hardware = true;
+#endif
+    
+    active_backend = &crypto_backend_software;
+    
+    const crypto_backend_ops_t *hardware = crypto_backend_get(CRYPTO_BASIC_BACKEND_HARDWARE);
+    if (want_hardware && hardware != NULL && crypto_backend_probe(hardware) == ESP_OK) {
+        active_backend = hardware;
+    }
+    
+    ESP_LOGI(TAG, "⚙️  Backend crypto actif: %s", active_backend->name);
+    
+#if defined(CONFIG_CRYPTO_BASIC_BACKEND_HARDWARE)
+    if (active_backend != hardware) {
+        ESP_LOGE(TAG, "❌ Backend hardware demandé mais indisponible - repli software");
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+#endif
+    
+    return ESP_OK;
+}
\ No newline at end of file
@@ -0,0 +1,112 @@
+/**
+ * @file crypto_backend.h
+ * @brief Interface interne des backends SHA-256 / AES-GCM - Community Edition
+ * 
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#ifndef CRYPTO_BACKEND_H
+#define CRYPTO_BACKEND_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "sdkconfig.h"
+#include "esp_err.h"
+#include "mbedtls/gcm.h"
+#include "crypto_operations_basic.h"
+
+#include "soc/soc_caps.h"
+
+// Backend hardware décrit par les capacités de la puce, pas par son nom
+#if defined(SOC_SHA_SUPPORTED) && SOC_SHA_SUPPORTED
+#define CRYPTO_BACKEND_HW_AVAILABLE 1
+#else
+#define CRYPTO_BACKEND_HW_AVAILABLE 0
+#endif
+
+// GCM matériel uniquement sur les puces dotées du mode GCM (absent de l'ESP32 d'origine)
+#if CRYPTO_BACKEND_HW_AVAILABLE && defined(SOC_AES_SUPPORT_GCM) && SOC_AES_SUPPORT_GCM
+#include "aes/esp_aes_gcm.h"
+#define CRYPTO_BACKEND_HW_GCM_AVAILABLE 1
+#else
+#define CRYPTO_BACKEND_HW_GCM_AVAILABLE 0
+#endif
+
+// Sans mode GCM, AES-GCM mbedTLS chiffre ses blocs sur le périphérique AES
+// quand CONFIG_MBEDTLS_HARDWARE_AES est actif (sdkconfig.defaults)
+#if defined(SOC_AES_SUPPORTED) && SOC_AES_SUPPORTED && CONFIG_MBEDTLS_HARDWARE_AES
+#define CRYPTO_BACKEND_MBEDTLS_AES_HW 1
+#else
+#define CRYPTO_BACKEND_MBEDTLS_AES_HW 0
+#endif
+
+/**
+ * @brief Contexte GCM avec clé expansée, propre à chaque backend
+ */
+typedef union {
+    mbedtls_gcm_context sw;
+#if CRYPTO_BACKEND_HW_GCM_AVAILABLE
+    esp_gcm_context hw;
+#endif
+} crypto_backend_gcm_ctx_t;
+
+/**
+ * @brief Table d'opérations d'un backend crypto
+ */
+typedef struct {
+    crypto_basic_backend_t id;
+    const char *name;
+    esp_err_t (*sha256)(const uint8_t *input, size_t input_len, uint8_t *output);
+    
+    // AES-128-GCM sur contexte réutilisable (clé expansée une fois)
+    esp_err_t (*gcm_setkey)(crypto_backend_gcm_ctx_t *ctx, const uint8_t *key);
+    esp_err_t (*gcm_encrypt)(crypto_backend_gcm_ctx_t *ctx, const uint8_t *iv,
+                             const uint8_t *aad, size_t aad_len,
+                             const uint8_t *input, size_t input_len,
+                             uint8_t *output, uint8_t *tag);
+    esp_err_t (*gcm_decrypt)(crypto_backend_gcm_ctx_t *ctx, const uint8_t *iv,
+                             const uint8_t *aad, size_t aad_len,
+                             const uint8_t *input, size_t input_len,
+                             const uint8_t *tag, uint8_t *output);
+    void (*gcm_free)(crypto_backend_gcm_ctx_t *ctx);
+} crypto_backend_ops_t;
+
+/**
+ * @brief Chiffrement AES-128-GCM ponctuel (expansion de clé à chaque appel)
+ */
+esp_err_t crypto_backend_gcm_oneshot_encrypt(const crypto_backend_ops_t *backend,
+                                             const uint8_t *key, const uint8_t *iv,
+                                             const uint8_t *aad, size_t aad_len,
+                                             const uint8_t *input, size_t input_len,
+                                             uint8_t *output, uint8_t *tag);
+
+/**
+ * @brief Déchiffrement AES-128-GCM ponctuel (expansion de clé à chaque appel)
+ */
+esp_err_t crypto_backend_gcm_oneshot_decrypt(const crypto_backend_ops_t *backend,
+                                             const uint8_t *key, const uint8_t *iv,
+                                             const uint8_t *aad, size_t aad_len,
+                                             const uint8_t *input, size_t input_len,
+                                             const uint8_t *tag, uint8_t *output);
+
+/**
+ * @brief Sélectionne le backend actif selon Kconfig et la sonde
+ * 
+ * @return ESP_OK si le backend demandé est actif, ESP_ERR_NOT_SUPPORTED si
+ *         un repli software a été nécessaire
+ */
+esp_err_t crypto_backend_select(void);
+
+/**
+ * @brief Obtient le backend actif (software tant qu'aucune sélection)
+ */
+const crypto_backend_ops_t *crypto_backend_active(void);
+
+/**
+ * @brief Obtient un backend par identifiant (NULL si indisponible)
+ */
+const crypto_backend_ops_t *crypto_backend_get(crypto_basic_backend_t id);
+
+#endif /* CRYPTO_BACKEND_H */
\ No newline at end of file
@@ -15,22 +15,63 @@
 #include "esp_log.h"
 #include "esp_err.h"
 #include "esp_system.h"
-#include "mbedtls/entropy.h"
-#include "mbedtls/ctr_drbg.h"
+#include "esp_timer.h"
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
 #include "mbedtls/ecdsa.h"
 #include "mbedtls/sha256.h"
 #include "mbedtls/aes.h"
 #include "mbedtls/gcm.h"
+#include "mbedtls/platform.h"
 #include "crypto_operations_basic.h"
+#include "crypto_random.h"
+#include "perf_trace.h"
+#include "crypto_backend.h"
+#if CONFIG_CRYPTO_BASIC_BOOT_GATE
+#include "boot_scheduler.h"
+#endif
 
 static const char *TAG = "CRYPTO_BASIC_COMMUNITY";
 
-// Contextes crypto globaux (software uniquement)
-static mbedtls_entropy_context entropy_ctx;
-static mbedtls_ctr_drbg_context ctr_drbg_ctx;
+// Contextes crypto globaux (software uniquement, DRBG dans crypto_random.c)
 static mbedtls_ecdsa_context ecdsa_ctx;
 static bool crypto_initialized = false;
 
+/**
+ * @brief Session GCM: clé expansée une fois, réutilisée pour chaque message
+ */
+struct crypto_basic_gcm_session {
+    bool in_use;
+    const crypto_backend_ops_t *backend;    // Backend lié à la création
+    crypto_backend_gcm_ctx_t ctx;           // Key schedule pré-calculé
+    uint32_t messages;                      // Messages traités
+};
+
+// Pool statique de sessions (aucune allocation dynamique)
+static struct crypto_basic_gcm_session gcm_sessions[CRYPTO_BASIC_GCM_SESSION_POOL_SIZE];
+static portMUX_TYPE gcm_sessions_lock = portMUX_INITIALIZER_UNLOCKED;
+
+/**
+ * @brief Vérificateur ECDSA: clé décodée une fois, table comb de G dans grp.T
+ */
+struct crypto_basic_ecdsa_verifier {
+    bool in_use;
+    mbedtls_ecdsa_context ecdsa;            // Groupe P-256 + clé publique Q
+    uint32_t verifications;                 // Signatures vérifiées
+};
+
+static struct crypto_basic_ecdsa_verifier ecdsa_verifiers[CRYPTO_BASIC_ECDSA_VERIFIER_POOL_SIZE];
+static portMUX_TYPE ecdsa_verifiers_lock = portMUX_INITIALIZER_UNLOCKED;
+
+#if CONFIG_CRYPTO_BASIC_STATIC_ARENA
+#if !defined(MBEDTLS_PLATFORM_MEMORY)
+#error "CONFIG_CRYPTO_BASIC_STATIC_ARENA nécessite MBEDTLS_PLATFORM_MEMORY"
+#endif
+// Allocations mbedTLS (bignums, contextes de chiffrement) hors du tas système
+static uint64_t crypto_arena_buffer[CONFIG_CRYPTO_BASIC_ARENA_SIZE / sizeof(uint64_t)];
+static bool crypto_arena_installed = false;
+#endif
+
 /**
  * @brief Initialise le système cryptographique de base
  */
@@ -44,23 +85,36 @@ esp_err_t crypto_operations_basic_init(void) {
     
     ESP_LOGI(TAG, "🔐 Initialisation crypto de base Community Edition");
     
-    // Initialisation entropy (software uniquement)
-    mbedtls_entropy_init(&entropy_ctx);
-    mbedtls_ctr_drbg_init(&ctr_drbg_ctx);
+#if CONFIG_CRYPTO_BASIC_STATIC_ARENA
+    // Avant toute allocation mbedTLS; conservée après deinit (blocs encore vivants possibles)
+    if (!crypto_arena_installed) {
+        ret = crypto_arena_init(crypto_arena_buffer, sizeof(crypto_arena_buffer));
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "❌ Échec initialisation arène mbedTLS: %s", esp_err_to_name(ret));
+            return ret;
+        }
+        mbedtls_platform_set_calloc_free(crypto_arena_calloc_or_heap, crypto_arena_free);
+        crypto_arena_installed = true;
+    }
+#endif
+    
     mbedtls_ecdsa_init(&ecdsa_ctx);
     
-    // Seed du générateur aléatoire
-    const char *pers = "secureiot_vif_community";
-    int mbedtls_ret = mbedtls_ctr_drbg_seed(&ctr_drbg_ctx, mbedtls_entropy_func, 
-                                           &entropy_ctx, (const unsigned char *)pers, strlen(pers));
-    if (mbedtls_ret != 0) {
-        ESP_LOGE(TAG, "❌ Échec seed générateur aléatoire: -0x%04x", -mbedtls_ret);
-        return ESP_FAIL;
+    // DRBG partagé et réserves aléatoires par cœur
+    ret = crypto_random_init();
+    if (ret != ESP_OK) {
+        mbedtls_ecdsa_free(&ecdsa_ctx);
+        return ret;
+    }
+    
+    // Sélection du backend SHA/AES (sonde des accélérateurs)
+    if (crypto_backend_select() != ESP_OK) {
+        ESP_LOGW(TAG, "⚠️  Backend crypto configuré indisponible, software utilisé");
     }
     
     crypto_initialized = true;
     ESP_LOGI(TAG, "✅ Crypto de base Community initialisé");
-    ESP_LOGI(TAG, "💡 Version éducative - Crypto software seulement");
+    ESP_LOGI(TAG, "💡 SHA/AES: %s", crypto_backend_active()->name);
     
     return ret;
 }
@@ -73,9 +127,20 @@ esp_err_t crypto_operations_basic_deinit(void) {
         return ESP_OK;
     }
     
+    // Sessions oubliées par leurs propriétaires: effacer les key schedules
+    for (int i = 0; i < CRYPTO_BASIC_GCM_SESSION_POOL_SIZE; i++) {
+        if (gcm_sessions[i].in_use) {
+            crypto_basic_gcm_session_destroy(&gcm_sessions[i]);
+        }
+    }
+    for (int i = 0; i < CRYPTO_BASIC_ECDSA_VERIFIER_POOL_SIZE; i++) {
+        if (ecdsa_verifiers[i].in_use) {
+            crypto_basic_ecdsa_verifier_destroy(&ecdsa_verifiers[i]);
+        }
+    }
+    
     mbedtls_ecdsa_free(&ecdsa_ctx);
-    mbedtls_ctr_drbg_free(&ctr_drbg_ctx);
-    mbedtls_entropy_free(&entropy_ctx);
+    crypto_random_deinit();
     
     crypto_initialized = false;
     ESP_LOGI(TAG, "🔓 Crypto de base Community déinitialisé");
@@ -84,9 +149,11 @@ esp_err_t crypto_operations_basic_deinit(void) {
 }
 
 /**
- * @brief Génère des données aléatoires (software uniquement)
+ * @brief Génère des données aléatoires (réserve du cœur ou DRBG verrouillé)
  */
 esp_err_t crypto_basic_generate_random(uint8_t *buffer, size_t length) {
+    PERF_TRACE_SCOPE(PERF_SPAN_CRYPTO_RANDOM);
+    
     if (!crypto_initialized) {
         ESP_LOGE(TAG, "❌ Crypto non initialisé");
         return ESP_ERR_INVALID_STATE;
@@ -97,52 +164,107 @@ esp_err_t crypto_basic_generate_random(uint8_t *buffer, size_t length) {
         return ESP_ERR_INVALID_ARG;
     }
     
-    int mbedtls_ret = mbedtls_ctr_drbg_random(&ctr_drbg_ctx, buffer, length);
-    if (mbedtls_ret != 0) {
-        ESP_LOGE(TAG, "❌ Échec génération aléatoire: -0x%04x", -mbedtls_ret);
-        return ESP_FAIL;
+    esp_err_t ret = crypto_random_fill(buffer, length);
+    if (ret != ESP_OK) {
+        return ret;
     }
     
-    ESP_LOGD(TAG, "🎲 Généré %d bytes aléatoires (software)", length);
+    ESP_LOGD(TAG, "🎲 Généré %d bytes aléatoires", length);
     return ESP_OK;
 }
 
 /**
- * @brief Calcule un hash SHA-256 (software)
+ * @brief Calcule un hash SHA-256 (backend actif)
  */
 esp_err_t crypto_basic_sha256(const uint8_t *input, size_t input_len, uint8_t *output) {
+    PERF_TRACE_SCOPE(PERF_SPAN_CRYPTO_SHA256);
+    
     if (input == NULL || output == NULL || input_len == 0) {
         ESP_LOGE(TAG, "❌ Paramètres invalides pour SHA-256");
         return ESP_ERR_INVALID_ARG;
     }
     
-    mbedtls_sha256_context sha256_ctx;
-    mbedtls_sha256_init(&sha256_ctx);
+    esp_err_t ret = crypto_backend_active()->sha256(input, input_len, output);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    
+    ESP_LOGD(TAG, "🔒 SHA-256 calculé: %d bytes", input_len);
+    return ESP_OK;
+}
+
+/**
+ * @brief Démarre un hash SHA-256 incrémental
+ */
+esp_err_t crypto_basic_sha256_init(crypto_basic_sha256_ctx_t *ctx) {
+    if (ctx == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
     
-    int mbedtls_ret = mbedtls_sha256_starts_ret(&sha256_ctx, 0); // SHA-256
+    mbedtls_sha256_init(&ctx->sha256);
+    int mbedtls_ret = mbedtls_sha256_starts_ret(&ctx->sha256, 0); // SHA-256
     if (mbedtls_ret != 0) {
         ESP_LOGE(TAG, "❌ Échec initialisation SHA-256: -0x%04x", -mbedtls_ret);
-        mbedtls_sha256_free(&sha256_ctx);
+        mbedtls_sha256_free(&ctx->sha256);
+        ctx->active = false;
         return ESP_FAIL;
     }
     
-    mbedtls_ret = mbedtls_sha256_update_ret(&sha256_ctx, input, input_len);
+    ctx->active = true;
+    return ESP_OK;
+}
+
+/**
+ * @brief Ajoute des données à un hash SHA-256 incrémental
+ */
+esp_err_t crypto_basic_sha256_update(crypto_basic_sha256_ctx_t *ctx,
+                                     const uint8_t *input, size_t input_len) {
+    if (ctx == NULL || (input == NULL && input_len > 0)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    if (!ctx->active) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    if (input_len == 0) {
+        return ESP_OK;
+    }
+    
+    int mbedtls_ret = mbedtls_sha256_update_ret(&ctx->sha256, input, input_len);
     if (mbedtls_ret != 0) {
         ESP_LOGE(TAG, "❌ Échec update SHA-256: -0x%04x", -mbedtls_ret);
-        mbedtls_sha256_free(&sha256_ctx);
         return ESP_FAIL;
     }
     
-    mbedtls_ret = mbedtls_sha256_finish_ret(&sha256_ctx, output);
+    return ESP_OK;
+}
+
+/**
+ * @brief Termine un hash SHA-256 incrémental et libère le contexte
+ */
+esp_err_t crypto_basic_sha256_finish(crypto_basic_sha256_ctx_t *ctx, uint8_t *output) {
+    if (ctx == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    if (!ctx->active) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    int mbedtls_ret = 0;
+    if (output != NULL) {
+        mbedtls_ret = mbedtls_sha256_finish_ret(&ctx->sha256, output);
+    }
+    
+    mbedtls_sha256_free(&ctx->sha256);
+    ctx->active = false;
+    
     if (mbedtls_ret != 0) {
         ESP_LOGE(TAG, "❌ Échec finalisation SHA-256: -0x%04x", -mbedtls_ret);
-        mbedtls_sha256_free(&sha256_ctx);
         return ESP_FAIL;
     }
     
-    mbedtls_sha256_free(&sha256_ctx);
-    ESP_LOGD(TAG, "🔒 SHA-256 calculé (software): %d bytes", input_len);
-    
     return ESP_OK;
 }
 
@@ -152,32 +274,20 @@ esp_err_t crypto_basic_sha256(const uint8_t *input, size_t input_len, uint8_t *o
 esp_err_t crypto_basic_aes_encrypt(const uint8_t *key, const uint8_t *iv, 
                                   const uint8_t *input, size_t input_len,
                                   uint8_t *output, uint8_t *tag) {
+    PERF_TRACE_SCOPE(PERF_SPAN_CRYPTO_AES);
+    
     if (key == NULL || iv == NULL || input == NULL || output == NULL || tag == NULL) {
         ESP_LOGE(TAG, "❌ Paramètres invalides pour AES encrypt");
         return ESP_ERR_INVALID_ARG;
     }
     
-    mbedtls_gcm_context gcm_ctx;
-    mbedtls_gcm_init(&gcm_ctx);
-    
-    int mbedtls_ret = mbedtls_gcm_setkey(&gcm_ctx, MBEDTLS_CIPHER_ID_AES, key, 128); // AES-128
-    if (mbedtls_ret != 0) {
-        ESP_LOGE(TAG, "❌ Échec configuration clé AES: -0x%04x", -mbedtls_ret);
-        mbedtls_gcm_free(&gcm_ctx);
-        return ESP_FAIL;
-    }
-    
-    mbedtls_ret = mbedtls_gcm_crypt_and_tag(&gcm_ctx, MBEDTLS_GCM_ENCRYPT, input_len,
-                                           iv, 12, NULL, 0, input, output, 16, tag);
-    if (mbedtls_ret != 0) {
-        ESP_LOGE(TAG, "❌ Échec chiffrement AES-GCM: -0x%04x", -mbedtls_ret);
-        mbedtls_gcm_free(&gcm_ctx);
-        return ESP_FAIL;
+    esp_err_t ret = crypto_backend_gcm_oneshot_encrypt(crypto_backend_active(), key, iv, NULL, 0,
+                                                       input, input_len, output, tag);
+    if (ret != ESP_OK) {
+        return ret;
     }
     
-    mbedtls_gcm_free(&gcm_ctx);
     ESP_LOGD(TAG, "🔐 AES-128-GCM encrypt réussi: %d bytes", input_len);
-    
     return ESP_OK;
 }
 
@@ -187,39 +297,192 @@ esp_err_t crypto_basic_aes_encrypt(const uint8_t *key, const uint8_t *iv,
 esp_err_t crypto_basic_aes_decrypt(const uint8_t *key, const uint8_t *iv,
                                   const uint8_t *input, size_t input_len,
                                   const uint8_t *tag, uint8_t *output) {
+    PERF_TRACE_SCOPE(PERF_SPAN_CRYPTO_AES);
+    
     if (key == NULL || iv == NULL || input == NULL || tag == NULL || output == NULL) {
         ESP_LOGE(TAG, "❌ Paramètres invalides pour AES decrypt");
         return ESP_ERR_INVALID_ARG;
     }
     
-    mbedtls_gcm_context gcm_ctx;
-    mbedtls_gcm_init(&gcm_ctx);
+    esp_err_t ret = crypto_backend_gcm_oneshot_decrypt(crypto_backend_active(), key, iv, NULL, 0,
+                                                       input, input_len, tag, output);
+    if (ret != ESP_OK) {
+        return ret;
+    }
     
-    int mbedtls_ret = mbedtls_gcm_setkey(&gcm_ctx, MBEDTLS_CIPHER_ID_AES, key, 128); // AES-128
-    if (mbedtls_ret != 0) {
-        ESP_LOGE(TAG, "❌ Échec configuration clé AES: -0x%04x", -mbedtls_ret);
-        mbedtls_gcm_free(&gcm_ctx);
-        return ESP_FAIL;
+    ESP_LOGD(TAG, "🔓 AES-128-GCM decrypt réussi: %d bytes", input_len);
+    return ESP_OK;
+}
+
+/**
+ * @brief Crée une session AES-128-GCM pour une clé
+ */
+esp_err_t crypto_basic_gcm_session_create(const uint8_t *key, crypto_basic_gcm_session_t **session) {
+    if (key == NULL || session == NULL) {
+        return ESP_ERR_INVALID_ARG;
     }
     
-    mbedtls_ret = mbedtls_gcm_auth_decrypt(&gcm_ctx, input_len, iv, 12, NULL, 0,
-                                          tag, 16, input, output);
-    if (mbedtls_ret != 0) {
-        ESP_LOGE(TAG, "❌ Échec déchiffrement AES-GCM: -0x%04x", -mbedtls_ret);
-        mbedtls_gcm_free(&gcm_ctx);
-        return ESP_FAIL;
+    *session = NULL;
+    crypto_basic_gcm_session_t *slot = NULL;
+    
+    portENTER_CRITICAL(&gcm_sessions_lock);
+    for (int i = 0; i < CRYPTO_BASIC_GCM_SESSION_POOL_SIZE; i++) {
+        if (!gcm_sessions[i].in_use) {
+            slot = &gcm_sessions[i];
+            slot->in_use = true;
+            break;
+        }
     }
+    portEXIT_CRITICAL(&gcm_sessions_lock);
     
-    mbedtls_gcm_free(&gcm_ctx);
-    ESP_LOGD(TAG, "🔓 AES-128-GCM decrypt réussi: %d bytes", input_len);
+    if (slot == NULL) {
+        ESP_LOGE(TAG, "❌ Pool de sessions GCM épuisé (%d)", CRYPTO_BASIC_GCM_SESSION_POOL_SIZE);
+        return ESP_ERR_NO_MEM;
+    }
+    
+    slot->backend = crypto_backend_active();
+    slot->messages = 0;
     
+    esp_err_t ret = slot->backend->gcm_setkey(&slot->ctx, key);
+    if (ret != ESP_OK) {
+        CRYPTO_BASIC_SECURE_ZERO(slot, sizeof(*slot));
+        return ret;
+    }
+    
+    *session = slot;
+    ESP_LOGD(TAG, "🔑 Session GCM créée (%s)", slot->backend->name);
     return ESP_OK;
 }
 
 /**
- * @brief Génère une paire de clés ECDSA P-256 (software)
+ * @brief Chiffre un message avec une session AES-128-GCM
  */
-esp_err_t crypto_basic_generate_ecdsa_keypair(crypto_basic_keypair_t *keypair) {
+esp_err_t crypto_basic_gcm_session_encrypt(crypto_basic_gcm_session_t *session, const uint8_t *iv,
+                                           const uint8_t *aad, size_t aad_len,
+                                           const uint8_t *input, size_t input_len,
+                                           uint8_t *output, uint8_t *tag) {
+    PERF_TRACE_SCOPE(PERF_SPAN_CRYPTO_GCM_SESSION);
+    
+    if (session == NULL || !session->in_use || iv == NULL || tag == NULL ||
+        (aad == NULL && aad_len > 0) || ((input == NULL || output == NULL) && input_len > 0)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    esp_err_t ret = session->backend->gcm_encrypt(&session->ctx, iv, aad, aad_len,
+                                                  input, input_len, output, tag);
+    if (ret == ESP_OK) {
+        session->messages++;
+    }
+    return ret;
+}
+
+/**
+ * @brief Déchiffre et authentifie un message avec une session AES-128-GCM
+ */
+esp_err_t crypto_basic_gcm_session_decrypt(crypto_basic_gcm_session_t *session, const uint8_t *iv,
+                                           const uint8_t *aad, size_t aad_len,
+                                           const uint8_t *input, size_t input_len,
+                                           const uint8_t *tag, uint8_t *output) {
+    PERF_TRACE_SCOPE(PERF_SPAN_CRYPTO_GCM_SESSION);
+    
+    if (session == NULL || !session->in_use || iv == NULL || tag == NULL ||
+        (aad == NULL && aad_len > 0) || ((input == NULL || output == NULL) && input_len > 0)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    esp_err_t ret = session->backend->gcm_decrypt(&session->ctx, iv, aad, aad_len,
+                                                  input, input_len, tag, output);
+    if (ret == ESP_OK) {
+        session->messages++;
+    }
+    return ret;
+}
+
+/**
+ * @brief Chiffre un tableau d'enregistrements de taille fixe
+ */
+esp_err_t crypto_basic_gcm_session_encrypt_batch(crypto_basic_gcm_session_t *session,
+                                                 const uint8_t *iv_prefix, uint32_t *counter,
+                                                 const uint8_t *aad, size_t aad_len,
+                                                 const void *records, size_t record_size, size_t count,
+                                                 uint8_t *output, uint8_t *tags) {
+    PERF_TRACE_SCOPE(PERF_SPAN_CRYPTO_GCM_SESSION);
+    
+    if (session == NULL || !session->in_use || iv_prefix == NULL || counter == NULL ||
+        records == NULL || record_size == 0 || output == NULL || tags == NULL ||
+        (aad == NULL && aad_len > 0)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    // Le compteur ne doit jamais reboucler: un IV réutilisé casse GCM
+    if (count > (size_t)(UINT32_MAX - *counter)) {
+        ESP_LOGE(TAG, "❌ Compteur d'IV épuisé, nouvelle clé requise");
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    const uint8_t *input = (const uint8_t *)records;
+    uint8_t iv[CRYPTO_BASIC_AES_IV_SIZE];
+    memcpy(iv, iv_prefix, CRYPTO_BASIC_GCM_IV_PREFIX_SIZE);
+    
+    for (size_t i = 0; i < count; i++) {
+        uint32_t value = *counter;
+        iv[8] = (uint8_t)(value >> 24);
+        iv[9] = (uint8_t)(value >> 16);
+        iv[10] = (uint8_t)(value >> 8);
+        iv[11] = (uint8_t)value;
+        
+        esp_err_t ret = session->backend->gcm_encrypt(&session->ctx, iv, aad, aad_len,
+                                                      input + i * record_size, record_size,
+                                                      output + i * record_size,
+                                                      tags + i * CRYPTO_BASIC_AES_TAG_SIZE);
+        if (ret != ESP_OK) {
+            return ret;
+        }
+        
+        (*counter)++;
+        session->messages++;
+    }
+    
+    ESP_LOGD(TAG, "🔐 Lot GCM chiffré: %d enregistrements de %d bytes", count, record_size);
+    return ESP_OK;
+}
+
+/**
+ * @brief Détruit une session et efface son key schedule
+ */
+esp_err_t crypto_basic_gcm_session_destroy(crypto_basic_gcm_session_t *session) {
+    if (session == NULL || !session->in_use) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    session->backend->gcm_free(&session->ctx);
+    CRYPTO_BASIC_SECURE_ZERO(&session->ctx, sizeof(session->ctx));
+    session->backend = NULL;
+    session->messages = 0;
+    
+    portENTER_CRITICAL(&gcm_sessions_lock);
+    session->in_use = false;
+    portEXIT_CRITICAL(&gcm_sessions_lock);
+    
+    return ESP_OK;
+}
+
+/**
+ * @brief Refuse une action sensible tant que la vérification de démarrage n'a pas réussi
+ */
+static esp_err_t crypto_basic_require_boot_gate(const char *action) {
+#if CONFIG_CRYPTO_BASIC_BOOT_GATE
+    return boot_gate_require(BOOT_GATE_INTEGRITY_VERIFIED, action);
+#else
+    (void)action;
+    return ESP_OK;
+#endif
+}
+
+/**
+ * @brief Génère une paire de clés ECDSA P-256 (software, sans barrière)
+ */
+static esp_err_t crypto_basic_generate_ecdsa_keypair_internal(crypto_basic_keypair_t *keypair) {
     if (!crypto_initialized) {
         ESP_LOGE(TAG, "❌ Crypto non initialisé");
         return ESP_ERR_INVALID_STATE;
@@ -235,7 +498,7 @@ esp_err_t crypto_basic_generate_ecdsa_keypair(crypto_basic_keypair_t *keypair) {
     
     // Générer paire de clés ECDSA P-256
     int mbedtls_ret = mbedtls_ecdsa_genkey(&ecdsa_temp, MBEDTLS_ECP_DP_SECP256R1,
-                                          mbedtls_ctr_drbg_random, &ctr_drbg_ctx);
+                                          crypto_random_drbg, NULL);
     if (mbedtls_ret != 0) {
         ESP_LOGE(TAG, "❌ Échec génération clés ECDSA: -0x%04x", -mbedtls_ret);
         mbedtls_ecdsa_free(&ecdsa_temp);
@@ -271,11 +534,13 @@ esp_err_t crypto_basic_generate_ecdsa_keypair(crypto_basic_keypair_t *keypair) {
 }
 
 /**
- * @brief Signe un hash avec ECDSA (software)
+ * @brief Signe un hash avec ECDSA (software, sans barrière)
  */
-esp_err_t crypto_basic_ecdsa_sign(const crypto_basic_keypair_t *keypair,
-                                 const uint8_t *hash, size_t hash_len,
-                                 uint8_t *signature, size_t *signature_len) {
+static esp_err_t crypto_basic_ecdsa_sign_internal(const crypto_basic_keypair_t *keypair,
+                                                  const uint8_t *hash, size_t hash_len,
+                                                  uint8_t *signature, size_t *signature_len) {
+    PERF_TRACE_SCOPE(PERF_SPAN_CRYPTO_ECDSA_SIGN);
+    
     if (!crypto_initialized) {
         ESP_LOGE(TAG, "❌ Crypto non initialisé");
         return ESP_ERR_INVALID_STATE;
@@ -307,7 +572,7 @@ esp_err_t crypto_basic_ecdsa_sign(const crypto_basic_keypair_t *keypair,
     // Effectuer la signature
     mbedtls_ret = mbedtls_ecdsa_write_signature(&ecdsa_sign, MBEDTLS_MD_SHA256,
                                                hash, hash_len, signature, signature_len,
-                                               mbedtls_ctr_drbg_random, &ctr_drbg_ctx);
+                                               crypto_random_drbg, NULL);
     if (mbedtls_ret != 0) {
         ESP_LOGE(TAG, "❌ Échec signature ECDSA: -0x%04x", -mbedtls_ret);
         mbedtls_ecdsa_free(&ecdsa_sign);
@@ -320,12 +585,54 @@ esp_err_t crypto_basic_ecdsa_sign(const crypto_basic_keypair_t *keypair,
     return ESP_OK;
 }
 
+/**
+ * @brief Génère une paire de clés ECDSA P-256 (barrière de démarrage)
+ */
+esp_err_t crypto_basic_generate_ecdsa_keypair(crypto_basic_keypair_t *keypair) {
+    esp_err_t ret = crypto_basic_require_boot_gate("Génération de clés ECDSA");
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    return crypto_basic_generate_ecdsa_keypair_internal(keypair);
+}
+
+/**
+ * @brief Signe un hash avec ECDSA (barrière de démarrage)
+ */
+esp_err_t crypto_basic_ecdsa_sign(const crypto_basic_keypair_t *keypair,
+                                 const uint8_t *hash, size_t hash_len,
+                                 uint8_t *signature, size_t *signature_len) {
+    esp_err_t ret = crypto_basic_require_boot_gate("Signature ECDSA");
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    return crypto_basic_ecdsa_sign_internal(keypair, hash, hash_len, signature, signature_len);
+}
+
+/**
+ * @brief Génère une paire de clés sans attendre la vérification de démarrage
+ */
+esp_err_t crypto_basic_generate_ecdsa_keypair_ungated(crypto_basic_keypair_t *keypair) {
+    return crypto_basic_generate_ecdsa_keypair_internal(keypair);
+}
+
+/**
+ * @brief Signe sans attendre la vérification de démarrage
+ */
+esp_err_t crypto_basic_ecdsa_sign_ungated(const crypto_basic_keypair_t *keypair,
+                                         const uint8_t *hash, size_t hash_len,
+                                         uint8_t *signature, size_t *signature_len) {
+    return crypto_basic_ecdsa_sign_internal(keypair, hash, hash_len, signature, signature_len);
+}
+
 /**
  * @brief Vérifie une signature ECDSA (software)
  */
 esp_err_t crypto_basic_ecdsa_verify(const crypto_basic_keypair_t *keypair,
                                    const uint8_t *hash, size_t hash_len,
                                    const uint8_t *signature, size_t signature_len) {
+    PERF_TRACE_SCOPE(PERF_SPAN_CRYPTO_ECDSA_VERIFY);
+    
     if (!crypto_initialized) {
         ESP_LOGE(TAG, "❌ Crypto non initialisé");
         return ESP_ERR_INVALID_STATE;
@@ -370,6 +677,270 @@ esp_err_t crypto_basic_ecdsa_verify(const crypto_basic_keypair_t *keypair,
     return ESP_OK;
 }
 
+/**
+ * @brief Précalcule la table comb du point de base (conservée dans grp->T)
+ * 
+ * mbedTLS ne garde la table que si MBEDTLS_ECP_FIXED_POINT_OPTIM est actif
+ * (CONFIG_MBEDTLS_ECP_FIXED_POINT_OPTIM); sinon chaque vérification la
+ * recalcule et seul le décodage de la clé est amorti.
+ */
+static int ecdsa_verifier_warm(mbedtls_ecp_group *grp) {
+    mbedtls_ecp_point R;
+    mbedtls_mpi one;
+    mbedtls_ecp_point_init(&R);
+    mbedtls_mpi_init(&one);
+    
+    int mbedtls_ret = mbedtls_mpi_lset(&one, 1);
+    if (mbedtls_ret == 0) {
+        mbedtls_ret = mbedtls_ecp_mul(grp, &R, &one, &grp->G, crypto_random_drbg, NULL);
+    }
+    
+    mbedtls_mpi_free(&one);
+    mbedtls_ecp_point_free(&R);
+    return mbedtls_ret;
+}
+
+/**
+ * @brief Crée un vérificateur pour une clé publique
+ */
+esp_err_t crypto_basic_ecdsa_verifier_create(const uint8_t *public_key, size_t public_key_len,
+                                             crypto_basic_ecdsa_verifier_t **verifier) {
+    if (!crypto_initialized) {
+        ESP_LOGE(TAG, "❌ Crypto non initialisé");
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    if (public_key == NULL || public_key_len == 0 || verifier == NULL) {
+        ESP_LOGE(TAG, "❌ Paramètres invalides pour vérificateur ECDSA");
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    struct crypto_basic_ecdsa_verifier *slot = NULL;
+    portENTER_CRITICAL(&ecdsa_verifiers_lock);
+    for (int i = 0; i < CRYPTO_BASIC_ECDSA_VERIFIER_POOL_SIZE; i++) {
+        if (!ecdsa_verifiers[i].in_use) {
+            slot = &ecdsa_verifiers[i];
+            slot->in_use = true;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&ecdsa_verifiers_lock);
+    
+    if (slot == NULL) {
+        ESP_LOGE(TAG, "❌ Pool de vérificateurs ECDSA épuisé (%d)", CRYPTO_BASIC_ECDSA_VERIFIER_POOL_SIZE);
+        return ESP_ERR_NO_MEM;
+    }
+    
+    mbedtls_ecdsa_init(&slot->ecdsa);
+    slot->verifications = 0;
+    
+    // Groupe, clé décodée et validée, table comb: une seule fois par clé
+    int mbedtls_ret = mbedtls_ecp_group_load(&slot->ecdsa.grp, MBEDTLS_ECP_DP_SECP256R1);
+    if (mbedtls_ret == 0) {
+        mbedtls_ret = mbedtls_ecp_point_read_binary(&slot->ecdsa.grp, &slot->ecdsa.Q,
+                                                    public_key, public_key_len);
+    }
+    if (mbedtls_ret == 0) {
+        mbedtls_ret = mbedtls_ecp_check_pubkey(&slot->ecdsa.grp, &slot->ecdsa.Q);
+    }
+    if (mbedtls_ret == 0) {
+        mbedtls_ret = ecdsa_verifier_warm(&slot->ecdsa.grp);
+    }
+    if (mbedtls_ret != 0) {
+        ESP_LOGE(TAG, "❌ Échec création vérificateur ECDSA: -0x%04x", -mbedtls_ret);
+        crypto_basic_ecdsa_verifier_destroy(slot);
+        return ESP_FAIL;
+    }
+    
+    *verifier = slot;
+    ESP_LOGD(TAG, "🔑 Vérificateur ECDSA créé (table comb %d points)", slot->ecdsa.grp.T_size);
+    return ESP_OK;
+}
+
+/**
+ * @brief Vérifie une signature avec un vérificateur
+ */
+esp_err_t crypto_basic_ecdsa_verifier_verify(crypto_basic_ecdsa_verifier_t *verifier,
+                                             const uint8_t *hash, size_t hash_len,
+                                             const uint8_t *signature, size_t signature_len) {
+    PERF_TRACE_SCOPE(PERF_SPAN_CRYPTO_ECDSA_VERIFY);
+    
+    if (verifier == NULL || !verifier->in_use || hash == NULL || signature == NULL) {
+        ESP_LOGE(TAG, "❌ Paramètres invalides pour vérification ECDSA");
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    int mbedtls_ret = mbedtls_ecdsa_read_signature(&verifier->ecdsa, hash, hash_len,
+                                                  signature, signature_len);
+    verifier->verifications++;
+    if (mbedtls_ret != 0) {
+        ESP_LOGE(TAG, "❌ Échec vérification signature ECDSA: -0x%04x", -mbedtls_ret);
+        return ESP_FAIL;
+    }
+    
+    return ESP_OK;
+}
+
+/**
+ * @brief Vérifie un lot de signatures avec le même vérificateur
+ */
+esp_err_t crypto_basic_ecdsa_verifier_verify_batch(crypto_basic_ecdsa_verifier_t *verifier,
+                                                   const crypto_basic_ecdsa_batch_item_t *items,
+                                                   size_t count, bool *valid) {
+    if (verifier == NULL || !verifier->in_use || (items == NULL && count > 0)) {
+        ESP_LOGE(TAG, "❌ Paramètres invalides pour lot ECDSA");
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    size_t failures = 0;
+    for (size_t i = 0; i < count; i++) {
+        bool ok = items[i].hash != NULL && items[i].signature != NULL &&
+                  mbedtls_ecdsa_read_signature(&verifier->ecdsa, items[i].hash, items[i].hash_len,
+                                               items[i].signature, items[i].signature_len) == 0;
+        if (valid != NULL) {
+            valid[i] = ok;
+        }
+        failures += !ok;
+    }
+    verifier->verifications += count;
+    
+    if (failures > 0) {
+        ESP_LOGW(TAG, "⚠️ Lot ECDSA: %d/%d signature(s) invalide(s)", failures, count);
+        return ESP_FAIL;
+    }
+    
+    ESP_LOGD(TAG, "✅ Lot ECDSA: %d signature(s) vérifiée(s)", count);
+    return ESP_OK;
+}
+
+/**
+ * @brief Détruit un vérificateur et libère sa table
+ */
+esp_err_t crypto_basic_ecdsa_verifier_destroy(crypto_basic_ecdsa_verifier_t *verifier) {
+    if (verifier == NULL || !verifier->in_use) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    // Libère aussi la table comb (grp.T)
+    mbedtls_ecdsa_free(&verifier->ecdsa);
+    verifier->verifications = 0;
+    
+    portENTER_CRITICAL(&ecdsa_verifiers_lock);
+    verifier->in_use = false;
+    portEXIT_CRITICAL(&ecdsa_verifiers_lock);
+    
+    return ESP_OK;
+}
+
+/**
+ * @brief Obtient le backend SHA-256 / AES-GCM actif
+ */
+crypto_basic_backend_t crypto_basic_get_backend(void) {
+    return crypto_backend_active()->id;
+}
+
+/**
+ * @brief Statistiques de l'arène statique des allocations mbedTLS
+ */
+esp_err_t crypto_basic_get_arena_stats(crypto_arena_stats_t *stats) {
+#if CONFIG_CRYPTO_BASIC_STATIC_ARENA
+    return crypto_arena_get_stats(stats);
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+/**
+ * @brief Convertit un backend en chaîne
+ */
+const char* crypto_basic_backend_to_string(crypto_basic_backend_t backend) {
+    const crypto_backend_ops_t *ops = crypto_backend_get(backend);
+    return (ops != NULL) ? ops->name : "indisponible";
+}
+
+/**
+ * @brief Débit en MB/s d'une mesure (octets par µs)
+ */
+static float crypto_bench_mbps(size_t bytes, int64_t elapsed_us) {
+    return (elapsed_us > 0) ? (float)bytes / (float)elapsed_us : 0.0f;
+}
+
+/**
+ * @brief Mesure le débit SHA-256 et AES-GCM de chaque backend disponible
+ */
+esp_err_t crypto_basic_benchmark_backends(crypto_basic_backend_bench_t *results,
+                                          size_t max_results, size_t *result_count) {
+    if (results == NULL || result_count == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    *result_count = 0;
+    
+    uint8_t *input = malloc(CRYPTO_BASIC_BENCH_BUFFER_SIZE);
+    uint8_t *output = malloc(CRYPTO_BASIC_BENCH_BUFFER_SIZE);
+    if (input == NULL || output == NULL) {
+        free(input);
+        free(output);
+        return ESP_ERR_NO_MEM;
+    }
+    
+    const uint8_t key[CRYPTO_BASIC_AES_KEY_SIZE] = {0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+                                                    0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c};
+    const uint8_t iv[CRYPTO_BASIC_AES_IV_SIZE] = {0};
+    uint8_t tag[CRYPTO_BASIC_AES_TAG_SIZE];
+    uint8_t digest[CRYPTO_BASIC_SHA256_SIZE];
+    const size_t total_bytes = CRYPTO_BASIC_BENCH_BUFFER_SIZE * CRYPTO_BASIC_BENCH_ITERATIONS;
+    
+    for (size_t i = 0; i < CRYPTO_BASIC_BENCH_BUFFER_SIZE; i++) {
+        input[i] = (uint8_t)i;
+    }
+    
+    ESP_LOGI(TAG, "⏱️  Benchmark backends: %d KB par mesure", total_bytes / 1024);
+    
+    for (int id = 0; id < CRYPTO_BASIC_BACKEND_MAX && *result_count < max_results; id++) {
+        const crypto_backend_ops_t *backend = crypto_backend_get((crypto_basic_backend_t)id);
+        crypto_basic_backend_bench_t *result = &results[*result_count];
+        memset(result, 0, sizeof(*result));
+        result->backend = (crypto_basic_backend_t)id;
+        (*result_count)++;
+        
+        if (backend == NULL) {
+            ESP_LOGI(TAG, "  %-46s indisponible", crypto_basic_backend_to_string(result->backend));
+            continue;
+        }
+        result->available = true;
+        
+        int64_t start = esp_timer_get_time();
+        for (int i = 0; i < CRYPTO_BASIC_BENCH_ITERATIONS; i++) {
+            backend->sha256(input, CRYPTO_BASIC_BENCH_BUFFER_SIZE, digest);
+        }
+        result->sha256_mbps = crypto_bench_mbps(total_bytes, esp_timer_get_time() - start);
+        
+        start = esp_timer_get_time();
+        for (int i = 0; i < CRYPTO_BASIC_BENCH_ITERATIONS; i++) {
+            crypto_backend_gcm_oneshot_encrypt(backend, key, iv, NULL, 0,
+                                               input, CRYPTO_BASIC_BENCH_BUFFER_SIZE, output, tag);
+        }
+        result->aes_gcm_encrypt_mbps = crypto_bench_mbps(total_bytes, esp_timer_get_time() - start);
+        
+        start = esp_timer_get_time();
+        for (int i = 0; i < CRYPTO_BASIC_BENCH_ITERATIONS; i++) {
+            crypto_backend_gcm_oneshot_decrypt(backend, key, iv, NULL, 0,
+                                               output, CRYPTO_BASIC_BENCH_BUFFER_SIZE, tag, input);
+        }
+        result->aes_gcm_decrypt_mbps = crypto_bench_mbps(total_bytes, esp_timer_get_time() - start);
+        
+        ESP_LOGI(TAG, "  %-46s SHA-256 %.2f MB/s | GCM enc %.2f MB/s | GCM dec %.2f MB/s",
+                 backend->name, result->sha256_mbps,
+                 result->aes_gcm_encrypt_mbps, result->aes_gcm_decrypt_mbps);
+    }
+    
+    free(input);
+    free(output);
+    return ESP_OK;
+}
+
+#if CONFIG_APP_SELF_TESTS
 /**
  * @brief Auto-test du système cryptographique de base
  */
@@ -391,7 +962,20 @@ esp_err_t crypto_basic_self_test(void) {
         return ret;
     }
     ESP_LOGI(TAG, "✅ Test génération aléatoire: OK");
-    
+
+    // Test 1b: IV GCM tirés de la réserve, jamais répétés
+    uint8_t iv_a[CRYPTO_BASIC_AES_IV_SIZE];
+    uint8_t iv_b[CRYPTO_BASIC_AES_IV_SIZE];
+    ret = crypto_random_gcm_iv(iv_a);
+    if (ret == ESP_OK) {
+        ret = crypto_random_gcm_iv(iv_b);
+    }
+    if (ret != ESP_OK || memcmp(iv_a, iv_b, sizeof(iv_a)) == 0) {
+        ESP_LOGE(TAG, "❌ Auto-test: Échec tirage IV GCM");
+        return (ret != ESP_OK) ? ret : ESP_FAIL;
+    }
+    ESP_LOGI(TAG, "✅ Test tirage IV GCM: OK");
+
     // Test 2: Hash SHA-256
     ret = crypto_basic_sha256(test_data, sizeof(test_data)-1, hash);
     if (ret != ESP_OK) {
@@ -400,8 +984,56 @@ esp_err_t crypto_basic_self_test(void) {
     }
     ESP_LOGI(TAG, "✅ Test SHA-256: OK");
     
+    // Test 2b: SHA-256 incrémental identique au calcul en un bloc
+    crypto_basic_sha256_ctx_t sha_ctx;
+    uint8_t stream_hash[32];
+    const size_t split = (sizeof(test_data) - 1) / 2;
+    ret = crypto_basic_sha256_init(&sha_ctx);
+    if (ret == ESP_OK) {
+        ret = crypto_basic_sha256_update(&sha_ctx, test_data, split);
+    }
+    if (ret == ESP_OK) {
+        ret = crypto_basic_sha256_update(&sha_ctx, test_data + split, sizeof(test_data) - 1 - split);
+    }
+    if (ret == ESP_OK) {
+        ret = crypto_basic_sha256_finish(&sha_ctx, stream_hash);
+    }
+    if (ret != ESP_OK || memcmp(stream_hash, hash, sizeof(hash)) != 0) {
+        ESP_LOGE(TAG, "❌ Auto-test: Échec SHA-256 incrémental");
+        return (ret != ESP_OK) ? ret : ESP_FAIL;
+    }
+    ESP_LOGI(TAG, "✅ Test SHA-256 incrémental: OK");
+    
+    // Test 2c: session GCM avec AAD (aller-retour)
+    const uint8_t session_key[CRYPTO_BASIC_AES_KEY_SIZE] = {0};
+    const uint8_t session_iv[CRYPTO_BASIC_AES_IV_SIZE] = {0};
+    const uint8_t aad[] = "hdr";
+    uint8_t sealed[sizeof(test_data)];
+    uint8_t opened[sizeof(test_data)];
+    uint8_t session_tag[CRYPTO_BASIC_AES_TAG_SIZE];
+    crypto_basic_gcm_session_t *session = NULL;
+    
+    ret = crypto_basic_gcm_session_create(session_key, &session);
+    if (ret == ESP_OK) {
+        ret = crypto_basic_gcm_session_encrypt(session, session_iv, aad, sizeof(aad),
+                                               test_data, sizeof(test_data), sealed, session_tag);
+    }
+    if (ret == ESP_OK) {
+        ret = crypto_basic_gcm_session_decrypt(session, session_iv, aad, sizeof(aad),
+                                               sealed, sizeof(sealed), session_tag, opened);
+    }
+    if (session != NULL) {
+        crypto_basic_gcm_session_destroy(session);
+    }
+    if (ret != ESP_OK || memcmp(opened, test_data, sizeof(test_data)) != 0) {
+        ESP_LOGE(TAG, "❌ Auto-test: Échec session AES-GCM");
+        return (ret != ESP_OK) ? ret : ESP_FAIL;
+    }
+    ESP_LOGI(TAG, "✅ Test session AES-GCM + AAD: OK");
+    
     // Test 3: Génération paire de clés ECDSA
-    ret = crypto_basic_generate_ecdsa_keypair(&test_keypair);
+    // Clé éphémère: l'auto-test tourne avant la fin de la vérification de démarrage
+    ret = crypto_basic_generate_ecdsa_keypair_internal(&test_keypair);
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "❌ Auto-test: Échec génération clés ECDSA");
         return ret;
@@ -409,7 +1041,7 @@ esp_err_t crypto_basic_self_test(void) {
     ESP_LOGI(TAG, "✅ Test génération clés ECDSA: OK");
     
     // Test 4: Signature ECDSA
-    ret = crypto_basic_ecdsa_sign(&test_keypair, hash, sizeof(hash), signature, &signature_len);
+    ret = crypto_basic_ecdsa_sign_internal(&test_keypair, hash, sizeof(hash), signature, &signature_len);
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "❌ Auto-test: Échec signature ECDSA");
         return ret;
@@ -423,30 +1055,60 @@ esp_err_t crypto_basic_self_test(void) {
         return ret;
     }
     ESP_LOGI(TAG, "✅ Test vérification ECDSA: OK");
-    
+
+    // Test 5b: Vérificateur en cache, lot avec une signature altérée rejetée seule
+    crypto_basic_ecdsa_verifier_t *verifier = NULL;
+    ret = crypto_basic_ecdsa_verifier_create(test_keypair.public_key, test_keypair.public_key_len, &verifier);
+    if (ret == ESP_OK) {
+        ret = crypto_basic_ecdsa_verifier_verify(verifier, hash, sizeof(hash), signature, signature_len);
+    }
+    if (ret == ESP_OK) {
+        uint8_t altered_hash[32];
+        memcpy(altered_hash, hash, sizeof(hash));
+        altered_hash[0] ^= 0x01;
+
+        const crypto_basic_ecdsa_batch_item_t batch[] = {
+            { hash, sizeof(hash), signature, signature_len },
+            { altered_hash, sizeof(altered_hash), signature, signature_len },
+        };
+        bool valid[2] = { false, true };
+        esp_err_t batch_ret = crypto_basic_ecdsa_verifier_verify_batch(verifier, batch, 2, valid);
+        ret = (batch_ret == ESP_FAIL && valid[0] && !valid[1]) ? ESP_OK : ESP_FAIL;
+    }
+    if (verifier != NULL) {
+        crypto_basic_ecdsa_verifier_destroy(verifier);
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ Auto-test: Échec vérificateur ECDSA");
+        return ret;
+    }
+    ESP_LOGI(TAG, "✅ Test vérificateur ECDSA + lot: OK");
+
     ESP_LOGI(TAG, "🎉 Auto-test crypto de base réussi - Community Edition opérationnelle");
     ESP_LOGI(TAG, "💡 Toutes opérations en software - Idéal pour apprentissage");
     
     return ESP_OK;
 }
+#endif /* CONFIG_APP_SELF_TESTS */
 
+#if CONFIG_APP_BANNERS
 /**
  * @brief Affiche les informations du système crypto Community
  */
 void crypto_basic_print_info(void) {
     ESP_LOGI(TAG, "📋 === Informations Crypto Community Edition ===");
     ESP_LOGI(TAG, "Édition: Community (Éducative & Recherche)");
-    ESP_LOGI(TAG, "Type: Software uniquement (mbedTLS)");
+    ESP_LOGI(TAG, "Type: Software (mbedTLS), SHA/AES via backend %s", crypto_backend_active()->name);
     ESP_LOGI(TAG, "Algorithmes supportés:");
     ESP_LOGI(TAG, "  🔒 Hash: SHA-256");
     ESP_LOGI(TAG, "  🔐 Chiffrement: AES-128-GCM");
     ESP_LOGI(TAG, "  ✍️  Signature: ECDSA P-256");
-    ESP_LOGI(TAG, "  🎲 Aléatoire: Software entropy");
+    ESP_LOGI(TAG, "  🎲 Aléatoire: CTR-DRBG, réserves par cœur");
     ESP_LOGI(TAG, "Limitations Community:");
     ESP_LOGI(TAG, "  ❌ Pas de HSM hardware");
     ESP_LOGI(TAG, "  ❌ Pas de stockage eFuse");
-    ESP_LOGI(TAG, "  ❌ Pas d'accélération hardware");
     ESP_LOGI(TAG, "  ❌ Clés stockées en RAM");
     ESP_LOGI(TAG, "🎓 Idéal pour apprentissage et prototypage!");
     ESP_LOGI(TAG, "===========================================");
-}
\ No newline at end of file
+}
+#endif /* CONFIG_APP_BANNERS */
\ No newline at end of file
@@ -0,0 +1,465 @@
+/**
+ * @file crypto_random.c
+ * @brief Service d'aléa partagé entre tâches (Community Edition)
+ *
+ * Deux niveaux de verrouillage: un mutex autour du CTR-DRBG (remplissages
+ * en bloc, tirages longs, ECDSA, réensemencement) et un portMUX par
+ * réserve. Un tirage court ne prend que le portMUX du cœur courant, tenu
+ * le temps d'une copie de quelques octets: l'autre cœur ne le demande
+ * que si la tâche a migré entre la lecture du cœur et l'entrée en
+ * section critique.
+ *
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#include <string.h>
+#include "esp_log.h"
+#include "esp_err.h"
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "mbedtls/entropy.h"
+#include "mbedtls/ctr_drbg.h"
+#if CONFIG_CRYPTO_RANDOM_POOL_SOURCE_HW
+#include "esp_random.h"
+#endif
+#include "crypto_random.h"
+
+static const char *TAG = "CRYPTO_RANDOM";
+
+#define RANDOM_INLINE_REFILL_ATTEMPTS   (2)     // Puis repli sur le DRBG direct
+
+/**
+ * @brief Réserve d'octets aléatoires d'un cœur
+ */
+typedef struct {
+    portMUX_TYPE lock;
+    uint16_t offset;                        // Premier octet non tiré
+    bool refill_requested;                  // Recharge de fond déjà demandée
+    uint32_t fast_draws;
+    uint32_t background_refills;
+    uint32_t inline_refills;
+    uint8_t bytes[CRYPTO_RANDOM_POOL_SIZE];
+} crypto_random_pool_t;
+
+static crypto_random_pool_t random_pools[portNUM_PROCESSORS] = {
+    [0 ... portNUM_PROCESSORS - 1] = {
+        .lock = portMUX_INITIALIZER_UNLOCKED,
+        .offset = CRYPTO_RANDOM_POOL_SIZE,  // Vide jusqu'au premier remplissage
+    }
+};
+
+// DRBG et compteurs associés, protégés par drbg_lock
+static mbedtls_entropy_context entropy_ctx;
+static mbedtls_ctr_drbg_context drbg_ctx;
+static crypto_random_stats_t drbg_stats;
+static bool drbg_seeded = false;
+
+static SemaphoreHandle_t drbg_lock = NULL;
+static StaticSemaphore_t drbg_lock_buffer;
+
+static TaskHandle_t random_task_handle = NULL;
+static volatile bool random_ready = false;
+static volatile bool reseed_requested = false;
+
+// ================================
+// DRBG verrouillé
+// ================================
+
+static void drbg_lock_take(void) {
+    if (xSemaphoreTake(drbg_lock, 0) != pdTRUE) {
+        xSemaphoreTake(drbg_lock, portMAX_DELAY);
+        drbg_stats.lock_waits++;
+    }
+}
+
+/**
+ * @brief Génère depuis le DRBG (verrou tenu), par blocs de MBEDTLS_CTR_DRBG_MAX_REQUEST
+ */
+static int drbg_generate(uint8_t *output, size_t length) {
+    if (!drbg_seeded) {
+        return MBEDTLS_ERR_CTR_DRBG_ENTROPY_SOURCE_FAILED;
+    }
+
+    size_t done = 0;
+    while (done < length) {
+        size_t chunk = length - done;
+        if (chunk > MBEDTLS_CTR_DRBG_MAX_REQUEST) {
+            chunk = MBEDTLS_CTR_DRBG_MAX_REQUEST;
+        }
+        int ret = mbedtls_ctr_drbg_random(&drbg_ctx, output + done, chunk);
+        if (ret != 0) {
+            return ret;
+        }
+        done += chunk;
+    }
+
+    drbg_stats.drbg_bytes += length;
+    return 0;
+}
+
+/**
+ * @brief Source de remplissage des réserves (Kconfig)
+ */
+static int pool_source_fill(uint8_t *output, size_t length) {
+#if CONFIG_CRYPTO_RANDOM_POOL_SOURCE_HW
+    // RNG matériel: aléa vrai seulement avec le WiFi/BT actifs ou
+    // bootloader_random_enable(), pseudo-aléa sinon
+    esp_fill_random(output, length);
+    return 0;
+#else
+    drbg_lock_take();
+    int ret = drbg_generate(output, length);
+    xSemaphoreGive(drbg_lock);
+    return ret;
+#endif
+}
+
+// ================================
+// Réserves par cœur
+// ================================
+
+/**
+ * @brief Remplace le contenu d'une réserve par un bloc frais
+ *
+ * Le bloc est généré hors section critique; seule la copie est faite
+ * sous le portMUX de la réserve.
+ */
+static esp_err_t pool_refill(crypto_random_pool_t *pool, bool background) {
+    uint8_t fresh[CRYPTO_RANDOM_POOL_SIZE];
+
+    int ret = pool_source_fill(fresh, sizeof(fresh));
+    if (ret != 0) {
+        memset(fresh, 0, sizeof(fresh));
+        ESP_LOGE(TAG, "❌ Échec remplissage réserve aléatoire: -0x%04x", -ret);
+        return ESP_FAIL;
+    }
+
+    portENTER_CRITICAL(&pool->lock);
+    memcpy(pool->bytes, fresh, sizeof(fresh));
+    pool->offset = 0;
+    pool->refill_requested = false;
+    if (background) {
+        pool->background_refills++;
+    } else {
+        pool->inline_refills++;
+    }
+    portEXIT_CRITICAL(&pool->lock);
+
+    memset(fresh, 0, sizeof(fresh));
+    return ESP_OK;
+}
+
+/**
+ * @brief Tire des octets de la réserve du cœur courant
+ *
+ * @return true si la réserve contenait assez d'octets
+ */
+static bool pool_take(uint8_t *output, size_t length, crypto_random_pool_t **pool_out) {
+    // Une migration avant l'entrée en section critique ne casse rien: la
+    // réserve choisie reste protégée par son propre verrou
+    crypto_random_pool_t *pool = &random_pools[xPortGetCoreID()];
+    bool taken = false;
+    bool notify = false;
+
+    portENTER_CRITICAL(&pool->lock);
+    size_t available = CRYPTO_RANDOM_POOL_SIZE - pool->offset;
+    if (available >= length) {
+        memcpy(output, &pool->bytes[pool->offset], length);
+        memset(&pool->bytes[pool->offset], 0, length);
+        pool->offset += length;
+        pool->fast_draws++;
+        available -= length;
+        taken = true;
+    }
+    if (available < CRYPTO_RANDOM_POOL_LOW_WATER && !pool->refill_requested) {
+        pool->refill_requested = true;
+        notify = true;
+    }
+    portEXIT_CRITICAL(&pool->lock);
+
+    if (notify && random_task_handle != NULL) {
+        xTaskNotifyGive(random_task_handle);
+    }
+
+    *pool_out = pool;
+    return taken;
+}
+
+// ================================
+// Tâche de fond
+// ================================
+
+/**
+ * @brief Réensemence le DRBG (nouvelle entropie) hors du chemin des appelants
+ */
+static void random_reseed(void) {
+    drbg_lock_take();
+    if (!drbg_seeded) {
+        xSemaphoreGive(drbg_lock);
+        return;
+    }
+    int ret = mbedtls_ctr_drbg_reseed(&drbg_ctx, NULL, 0);
+    if (ret == 0) {
+        drbg_stats.reseeds++;
+    } else {
+        drbg_stats.reseed_failures++;
+    }
+    xSemaphoreGive(drbg_lock);
+
+    if (ret != 0) {
+        ESP_LOGW(TAG, "⚠️ Échec réensemencement DRBG: -0x%04x", -ret);
+    }
+}
+
+/**
+ * @brief Recharge les réserves sous le seuil bas, réensemence périodiquement
+ */
+static void crypto_random_task(void *pvParameters) {
+    const TickType_t reseed_interval = pdMS_TO_TICKS(CONFIG_CRYPTO_RANDOM_RESEED_INTERVAL_MS);
+    TickType_t last_reseed = xTaskGetTickCount();
+
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, reseed_interval);
+        if (!random_ready) {
+            continue;
+        }
+
+        if (reseed_requested || xTaskGetTickCount() - last_reseed >= reseed_interval) {
+            reseed_requested = false;
+            random_reseed();
+            last_reseed = xTaskGetTickCount();
+        }
+
+        for (int i = 0; i < portNUM_PROCESSORS; i++) {
+            crypto_random_pool_t *pool = &random_pools[i];
+
+            portENTER_CRITICAL(&pool->lock);
+            bool requested = pool->refill_requested;
+            portEXIT_CRITICAL(&pool->lock);
+
+            if (requested) {
+                pool_refill(pool, true);
+            }
+        }
+    }
+}
+
+// ================================
+// Fonctions publiques
+// ================================
+
+/**
+ * @brief Ensemence le DRBG, remplit les réserves et démarre la tâche de fond
+ */
+esp_err_t crypto_random_init(void) {
+    if (random_ready) {
+        return ESP_OK;
+    }
+
+    if (drbg_lock == NULL) {
+        drbg_lock = xSemaphoreCreateMutexStatic(&drbg_lock_buffer);
+        if (drbg_lock == NULL) {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+    xSemaphoreTake(drbg_lock, portMAX_DELAY);
+    mbedtls_entropy_init(&entropy_ctx);
+    mbedtls_ctr_drbg_init(&drbg_ctx);
+
+    const char *pers = "secureiot_vif_community";
+    int mbedtls_ret = mbedtls_ctr_drbg_seed(&drbg_ctx, mbedtls_entropy_func, &entropy_ctx,
+                                           (const unsigned char *)pers, strlen(pers));
+    if (mbedtls_ret != 0) {
+        mbedtls_ctr_drbg_free(&drbg_ctx);
+        mbedtls_entropy_free(&entropy_ctx);
+        xSemaphoreGive(drbg_lock);
+        ESP_LOGE(TAG, "❌ Échec seed générateur aléatoire: -0x%04x", -mbedtls_ret);
+        return ESP_FAIL;
+    }
+    memset(&drbg_stats, 0, sizeof(drbg_stats));
+    drbg_seeded = true;
+    xSemaphoreGive(drbg_lock);
+
+    for (int i = 0; i < portNUM_PROCESSORS; i++) {
+        crypto_random_pool_t *pool = &random_pools[i];
+
+        if (pool_refill(pool, true) != ESP_OK) {
+            crypto_random_deinit();
+            return ESP_FAIL;
+        }
+
+        portENTER_CRITICAL(&pool->lock);
+        pool->fast_draws = 0;
+        pool->background_refills = 0;
+        pool->inline_refills = 0;
+        portEXIT_CRITICAL(&pool->lock);
+    }
+    random_ready = true;
+
+    // Créée une seule fois: elle reste inactive entre deinit et init
+    if (random_task_handle == NULL) {
+        BaseType_t task_ret = xTaskCreatePinnedToCore(crypto_random_task, "crypto_random",
+                                                      CRYPTO_RANDOM_TASK_STACK_SIZE_COMMUNITY, NULL,
+                                                      CRYPTO_RANDOM_TASK_PRIORITY_COMMUNITY,
+                                                      &random_task_handle, tskNO_AFFINITY);
+        if (task_ret != pdPASS) {
+            random_task_handle = NULL;
+            ESP_LOGW(TAG, "⚠️ Tâche de recharge non créée: réserves rechargées par les appelants");
+        }
+    }
+
+    ESP_LOGI(TAG, "🎲 Aléa: %d réserve(s) de %d octets, source %s, réensemencement toutes les %d s",
+             portNUM_PROCESSORS, CRYPTO_RANDOM_POOL_SIZE,
+#if CONFIG_CRYPTO_RANDOM_POOL_SOURCE_HW
+             "RNG matériel",
+#else
+             "CTR-DRBG",
+#endif
+             CONFIG_CRYPTO_RANDOM_RESEED_INTERVAL_MS / 1000);
+    return ESP_OK;
+}
+
+/**
+ * @brief Libère le DRBG et efface les réserves
+ */
+void crypto_random_deinit(void) {
+    if (drbg_lock == NULL) {
+        return;
+    }
+
+    random_ready = false;
+
+    for (int i = 0; i < portNUM_PROCESSORS; i++) {
+        crypto_random_pool_t *pool = &random_pools[i];
+        portENTER_CRITICAL(&pool->lock);
+        memset(pool->bytes, 0, sizeof(pool->bytes));
+        pool->offset = CRYPTO_RANDOM_POOL_SIZE;
+        pool->refill_requested = false;
+        portEXIT_CRITICAL(&pool->lock);
+    }
+
+    xSemaphoreTake(drbg_lock, portMAX_DELAY);
+    if (drbg_seeded) {
+        mbedtls_ctr_drbg_free(&drbg_ctx);
+        mbedtls_entropy_free(&entropy_ctx);
+        drbg_seeded = false;
+    }
+    xSemaphoreGive(drbg_lock);
+}
+
+/**
+ * @brief Remplit un buffer d'octets aléatoires
+ */
+esp_err_t crypto_random_fill(uint8_t *buffer, size_t length) {
+    if (!random_ready) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (buffer == NULL || length == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (length <= CRYPTO_RANDOM_FAST_MAX) {
+        crypto_random_pool_t *pool;
+        for (int attempt = 0; attempt < RANDOM_INLINE_REFILL_ATTEMPTS; attempt++) {
+            if (pool_take(buffer, length, &pool)) {
+                return ESP_OK;
+            }
+            // Réserve épuisée avant la recharge de fond
+            if (pool_refill(pool, false) != ESP_OK) {
+                return ESP_FAIL;
+            }
+        }
+        // Réserve vidée par d'autres tâches entre la recharge et le tirage
+    }
+
+    drbg_lock_take();
+    int ret = drbg_generate(buffer, length);
+    if (ret == 0) {
+        drbg_stats.direct_draws++;
+    }
+    xSemaphoreGive(drbg_lock);
+
+    if (ret != 0) {
+        ESP_LOGE(TAG, "❌ Échec génération aléatoire: -0x%04x", -ret);
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief Tire un IV AES-GCM de 12 octets
+ */
+esp_err_t crypto_random_gcm_iv(uint8_t iv[CRYPTO_RANDOM_IV_SIZE]) {
+    return crypto_random_fill(iv, CRYPTO_RANDOM_IV_SIZE);
+}
+
+/**
+ * @brief Générateur au format f_rng mbedTLS
+ */
+int crypto_random_drbg(void *p_rng, unsigned char *output, size_t length) {
+    if (drbg_lock == NULL) {
+        return MBEDTLS_ERR_CTR_DRBG_ENTROPY_SOURCE_FAILED;
+    }
+
+    drbg_lock_take();
+    int ret = drbg_generate(output, length);
+    xSemaphoreGive(drbg_lock);
+    return ret;
+}
+
+/**
+ * @brief Demande un réensemencement immédiat
+ */
+void crypto_random_request_reseed(void) {
+    reseed_requested = true;
+    if (random_task_handle != NULL) {
+        xTaskNotifyGive(random_task_handle);
+    }
+}
+
+/**
+ * @brief Obtient les statistiques du service
+ */
+esp_err_t crypto_random_get_stats(crypto_random_stats_t *stats) {
+    if (stats == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (drbg_lock == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(drbg_lock, portMAX_DELAY);
+    *stats = drbg_stats;
+    xSemaphoreGive(drbg_lock);
+
+    for (int i = 0; i < portNUM_PROCESSORS; i++) {
+        crypto_random_pool_t *pool = &random_pools[i];
+        portENTER_CRITICAL(&pool->lock);
+        stats->fast_draws += pool->fast_draws;
+        stats->background_refills += pool->background_refills;
+        stats->inline_refills += pool->inline_refills;
+        portEXIT_CRITICAL(&pool->lock);
+    }
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Affiche les statistiques du service
+ */
+void crypto_random_print_stats(void) {
+    crypto_random_stats_t stats;
+    if (crypto_random_get_stats(&stats) != ESP_OK) {
+        return;
+    }
+
+    ESP_LOGI(TAG, "🎲 Aléa: %lu tirages réserve, %lu directs, recharges %lu fond / %lu appelant, "
+             "%lu réensemencement(s) (%lu échec(s)), %lu attente(s) verrou DRBG",
+             stats.fast_draws, stats.direct_draws, stats.background_refills, stats.inline_refills,
+             stats.reseeds, stats.reseed_failures, stats.lock_waits);
+}
\ No newline at end of file
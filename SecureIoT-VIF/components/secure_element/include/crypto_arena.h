@@ -0,0 +1,105 @@
+/**
+ * @file crypto_arena.h
+ * @brief Arène statique pour les allocations mbedTLS (Community Edition)
+ *
+ * Remplace calloc/free de mbedTLS (mbedtls_platform_set_calloc_free)
+ * par une arène à blocs contigus dans un buffer fourni au démarrage:
+ * les contextes GCM/ECDSA ne touchent plus au tas système et ne le
+ * fragmentent pas.
+ *
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#ifndef CRYPTO_ARENA_H
+#define CRYPTO_ARENA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+// ================================
+// Constantes Community
+// ================================
+
+#define CRYPTO_ARENA_ALIGNMENT              (8)     // Alignement des blocs (uint64_t, mbedtls_mpi_uint)
+#define CRYPTO_ARENA_MIN_SIZE               (256)   // Taille minimale du buffer
+
+// ================================
+// Types et structures Community
+// ================================
+
+/**
+ * @brief Statistiques de l'arène
+ */
+typedef struct {
+    size_t capacity;                // Octets de l'arène
+    size_t used;                    // Octets occupés (en-têtes compris)
+    size_t peak;                    // Pic d'occupation depuis l'initialisation
+    uint32_t live_blocks;           // Blocs alloués
+    uint32_t allocations;           // Allocations réussies
+    uint32_t failures;              // Allocations refusées (arène pleine ou fragmentée)
+    uint32_t heap_fallbacks;        // Refus servis par le tas (crypto_arena_calloc_or_heap)
+    uint32_t foreign_frees;         // Libérations renvoyées au tas (hors arène)
+} crypto_arena_stats_t;
+
+// ================================
+// Fonctions Community
+// ================================
+
+/**
+ * @brief Initialise l'arène sur un buffer statique
+ *
+ * @param buffer Buffer aligné sur CRYPTO_ARENA_ALIGNMENT
+ * @param size Taille du buffer
+ * @return ESP_OK, ESP_ERR_INVALID_ARG, ESP_ERR_NO_MEM (verrou)
+ */
+esp_err_t crypto_arena_init(void *buffer, size_t size);
+
+/**
+ * @brief Détache l'arène (les blocs encore alloués sont abandonnés)
+ */
+void crypto_arena_deinit(void);
+
+/**
+ * @brief calloc sur l'arène (signature mbedtls_platform_set_calloc_free)
+ *
+ * @return Bloc mis à zéro, NULL si l'arène ne peut pas le fournir
+ */
+void *crypto_arena_calloc(size_t count, size_t size);
+
+/**
+ * @brief calloc sur l'arène, repli sur le tas système si elle ne peut pas servir
+ *
+ * Allocateur installé pour mbedTLS: une arène sous-dimensionnée dégrade
+ * l'objectif « pas de tas » (compté dans heap_fallbacks) sans faire
+ * échouer la crypto.
+ *
+ * @return Bloc mis à zéro, NULL si ni l'arène ni le tas ne peuvent le fournir
+ */
+void *crypto_arena_calloc_or_heap(size_t count, size_t size);
+
+/**
+ * @brief free sur l'arène
+ *
+ * Un pointeur hors de l'arène (alloué avant son installation) est
+ * rendu au tas système.
+ */
+void crypto_arena_free(void *ptr);
+
+/**
+ * @brief Statistiques de l'arène
+ */
+esp_err_t crypto_arena_get_stats(crypto_arena_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CRYPTO_ARENA_H */
\ No newline at end of file
@@ -19,7 +19,10 @@ extern "C" {
 
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
 #include "esp_err.h"
+#include "crypto_arena.h"
+#include "mbedtls/sha256.h"
 
 // ================================
 // Constantes crypto Community
@@ -33,6 +36,17 @@ extern "C" {
 #define CRYPTO_BASIC_ECDSA_PRIVATE_KEY_SIZE (32)    // P-256 private key
 #define CRYPTO_BASIC_ECDSA_SIGNATURE_MAX    (72)    // DER encoded max
 
+// Sessions AES-GCM
+#define CRYPTO_BASIC_GCM_SESSION_POOL_SIZE  (4)     // Key schedules en statique
+#define CRYPTO_BASIC_GCM_IV_PREFIX_SIZE     (8)     // IV = préfixe 8 B || compteur 32 bits
+
+// Vérificateurs ECDSA
+#define CRYPTO_BASIC_ECDSA_VERIFIER_POOL_SIZE (4)   // Clés publiques en cache (groupe + table comb ~2 KB chacune)
+
+// Benchmark des backends
+#define CRYPTO_BASIC_BENCH_BUFFER_SIZE      (4096)  // Taille d'un bloc mesuré
+#define CRYPTO_BASIC_BENCH_ITERATIONS       (64)    // 256 KB par mesure
+
 // ================================
 // Types et structures Community
 // ================================
@@ -47,6 +61,39 @@ typedef struct {
     size_t private_key_len;
 } crypto_basic_keypair_t;
 
+/**
+ * @brief Session AES-128-GCM (opaque, issue d'un pool statique)
+ * 
+ * Une session n'est pas protégée contre l'usage concurrent: une par tâche.
+ */
+typedef struct crypto_basic_gcm_session crypto_basic_gcm_session_t;
+
+/**
+ * @brief Vérificateur ECDSA P-256 lié à une clé publique (opaque, pool statique)
+ * 
+ * Garde le groupe chargé, la clé publique décodée et validée, et la table
+ * comb précalculée du point de base. Comme une session GCM: une par tâche.
+ */
+typedef struct crypto_basic_ecdsa_verifier crypto_basic_ecdsa_verifier_t;
+
+/**
+ * @brief Signature d'un lot vérifié avec un même vérificateur
+ */
+typedef struct {
+    const uint8_t *hash;                // Hash signé (SHA-256)
+    size_t hash_len;
+    const uint8_t *signature;           // Signature DER
+    size_t signature_len;
+} crypto_basic_ecdsa_batch_item_t;
+
+/**
+ * @brief Contexte SHA-256 incrémental (stockage fourni par l'appelant)
+ */
+typedef struct {
+    mbedtls_sha256_context sha256;      // État interne du hash
+    bool active;                        // true entre init et finish
+} crypto_basic_sha256_ctx_t;
+
 /**
  * @brief Résultats des opérations crypto basiques
  */
@@ -59,6 +106,26 @@ typedef enum {
     CRYPTO_BASIC_MAX
 } crypto_basic_result_t;
 
+/**
+ * @brief Backends disponibles sous SHA-256 / AES-GCM
+ */
+typedef enum {
+    CRYPTO_BASIC_BACKEND_SOFTWARE = 0,  // mbedTLS software
+    CRYPTO_BASIC_BACKEND_HARDWARE,      // Accélérateurs SHA/AES ESP32
+    CRYPTO_BASIC_BACKEND_MAX
+} crypto_basic_backend_t;
+
+/**
+ * @brief Résultat de benchmark d'un backend
+ */
+typedef struct {
+    crypto_basic_backend_t backend;     // Backend mesuré
+    bool available;                     // Backend disponible sur la cible
+    float sha256_mbps;                  // Débit SHA-256 (MB/s)
+    float aes_gcm_encrypt_mbps;         // Débit AES-128-GCM chiffrement (MB/s)
+    float aes_gcm_decrypt_mbps;         // Débit AES-128-GCM déchiffrement (MB/s)
+} crypto_basic_backend_bench_t;
+
 // ================================
 // Fonctions d'initialisation
 // ================================
@@ -100,9 +167,9 @@ esp_err_t crypto_basic_generate_random(uint8_t *buffer, size_t length);
 // ================================
 
 /**
- * @brief Calcule un hash SHA-256 (software)
+ * @brief Calcule un hash SHA-256
  * 
- * Version software plus lente que l'accélération hardware ESP32.
+ * Exécuté par le backend actif (voir crypto_basic_get_backend()).
  * 
  * @param input Données à hasher
  * @param input_len Taille des données
@@ -111,6 +178,36 @@ esp_err_t crypto_basic_generate_random(uint8_t *buffer, size_t length);
  */
 esp_err_t crypto_basic_sha256(const uint8_t *input, size_t input_len, uint8_t *output);
 
+/**
+ * @brief Démarre un hash SHA-256 incrémental
+ * 
+ * Le contexte appartient à l'appelant (pile ou statique): aucune allocation.
+ * 
+ * @param ctx Contexte à initialiser
+ * @return ESP_OK si succès, ESP_FAIL sinon
+ */
+esp_err_t crypto_basic_sha256_init(crypto_basic_sha256_ctx_t *ctx);
+
+/**
+ * @brief Ajoute des données à un hash SHA-256 incrémental
+ * 
+ * @param ctx Contexte initialisé
+ * @param input Données à hasher (ignoré si input_len == 0)
+ * @param input_len Taille des données
+ * @return ESP_OK si succès, ESP_ERR_INVALID_STATE si contexte inactif
+ */
+esp_err_t crypto_basic_sha256_update(crypto_basic_sha256_ctx_t *ctx,
+                                     const uint8_t *input, size_t input_len);
+
+/**
+ * @brief Termine un hash SHA-256 incrémental et libère le contexte
+ * 
+ * @param ctx Contexte initialisé
+ * @param output Buffer de sortie (32 bytes), NULL pour abandonner le hash
+ * @return ESP_OK si succès, ESP_ERR_INVALID_STATE si contexte inactif
+ */
+esp_err_t crypto_basic_sha256_finish(crypto_basic_sha256_ctx_t *ctx, uint8_t *output);
+
 // ================================
 // Fonctions de chiffrement symétrique
 // ================================
@@ -147,6 +244,84 @@ esp_err_t crypto_basic_aes_decrypt(const uint8_t *key, const uint8_t *iv,
                                   const uint8_t *input, size_t input_len,
                                   const uint8_t *tag, uint8_t *output);
 
+/**
+ * @brief Crée une session AES-128-GCM (clé expansée une seule fois)
+ * 
+ * @param key Clé AES-128 (16 bytes)
+ * @param session Session créée
+ * @return ESP_OK si succès, ESP_ERR_NO_MEM si le pool est épuisé
+ */
+esp_err_t crypto_basic_gcm_session_create(const uint8_t *key, crypto_basic_gcm_session_t **session);
+
+/**
+ * @brief Chiffre un message avec une session AES-128-GCM
+ * 
+ * @param session Session active
+ * @param iv Vecteur d'initialisation (12 bytes, unique par message)
+ * @param aad Données authentifiées non chiffrées (ou NULL)
+ * @param aad_len Taille des AAD
+ * @param input Données à chiffrer
+ * @param input_len Taille des données
+ * @param output Buffer de sortie (input_len bytes)
+ * @param tag Tag d'authentification (16 bytes)
+ * @return ESP_OK si succès, ESP_FAIL sinon
+ */
+esp_err_t crypto_basic_gcm_session_encrypt(crypto_basic_gcm_session_t *session, const uint8_t *iv,
+                                           const uint8_t *aad, size_t aad_len,
+                                           const uint8_t *input, size_t input_len,
+                                           uint8_t *output, uint8_t *tag);
+
+/**
+ * @brief Déchiffre et authentifie un message avec une session AES-128-GCM
+ * 
+ * @param session Session active
+ * @param iv Vecteur d'initialisation (12 bytes)
+ * @param aad Données authentifiées non chiffrées (ou NULL)
+ * @param aad_len Taille des AAD
+ * @param input Données chiffrées
+ * @param input_len Taille des données
+ * @param tag Tag d'authentification (16 bytes)
+ * @param output Buffer de sortie (input_len bytes)
+ * @return ESP_OK si le tag est valide, ESP_FAIL sinon
+ */
+esp_err_t crypto_basic_gcm_session_decrypt(crypto_basic_gcm_session_t *session, const uint8_t *iv,
+                                           const uint8_t *aad, size_t aad_len,
+                                           const uint8_t *input, size_t input_len,
+                                           const uint8_t *tag, uint8_t *output);
+
+/**
+ * @brief Chiffre un tableau d'enregistrements de taille fixe (ex: sensor_data_t)
+ * 
+ * Chaque enregistrement reçoit l'IV préfixe || compteur (big-endian), puis le
+ * compteur est incrémenté. Les sorties sont contiguës: count * record_size
+ * bytes chiffrés et count * 16 bytes de tags.
+ * 
+ * @param session Session active
+ * @param iv_prefix Préfixe fixe de l'IV (8 bytes)
+ * @param counter Compteur de messages, avancé de count
+ * @param aad Données authentifiées communes (ou NULL)
+ * @param aad_len Taille des AAD
+ * @param records Enregistrements à chiffrer
+ * @param record_size Taille d'un enregistrement
+ * @param count Nombre d'enregistrements
+ * @param output Buffer de sortie
+ * @param tags Buffer des tags
+ * @return ESP_OK si succès, ESP_ERR_INVALID_STATE si le compteur reboucle
+ */
+esp_err_t crypto_basic_gcm_session_encrypt_batch(crypto_basic_gcm_session_t *session,
+                                                 const uint8_t *iv_prefix, uint32_t *counter,
+                                                 const uint8_t *aad, size_t aad_len,
+                                                 const void *records, size_t record_size, size_t count,
+                                                 uint8_t *output, uint8_t *tags);
+
+/**
+ * @brief Détruit une session et efface son key schedule
+ * 
+ * @param session Session à détruire
+ * @return ESP_OK si succès
+ */
+esp_err_t crypto_basic_gcm_session_destroy(crypto_basic_gcm_session_t *session);
+
 // ================================
 // Fonctions de signature numérique
 // ================================
@@ -157,8 +332,11 @@ esp_err_t crypto_basic_aes_decrypt(const uint8_t *key, const uint8_t *iv,
  * ATTENTION: Les clés sont stockées en RAM (non sécurisé).
  * En Enterprise, les clés sont protégées par eFuse.
  * 
+ * Action sensible: refusée (ESP_ERR_INVALID_STATE) tant que la barrière
+ * BOOT_GATE_INTEGRITY_VERIFIED est fermée (CONFIG_CRYPTO_BASIC_BOOT_GATE).
+ * 
  * @param keypair Structure pour stocker la paire de clés
- * @return ESP_OK si succès, ESP_FAIL sinon
+ * @return ESP_OK si succès, ESP_ERR_INVALID_STATE avant vérification, ESP_FAIL sinon
  */
 esp_err_t crypto_basic_generate_ecdsa_keypair(crypto_basic_keypair_t *keypair);
 
@@ -170,12 +348,30 @@ esp_err_t crypto_basic_generate_ecdsa_keypair(crypto_basic_keypair_t *keypair);
  * @param hash_len Taille du hash
  * @param signature Buffer pour la signature
  * @param signature_len Pointeur vers la taille de la signature
- * @return ESP_OK si succès, ESP_FAIL sinon
+ * @return ESP_OK si succès, ESP_ERR_INVALID_STATE avant vérification, ESP_FAIL sinon
+ * 
+ * Action sensible: même barrière que crypto_basic_generate_ecdsa_keypair().
  */
 esp_err_t crypto_basic_ecdsa_sign(const crypto_basic_keypair_t *keypair,
                                  const uint8_t *hash, size_t hash_len,
                                  uint8_t *signature, size_t *signature_len);
 
+/**
+ * @brief Génère une paire de clés sans barrière de démarrage
+ * 
+ * Réservé aux clés éphémères de mesure (bench) et aux clés dont chaque
+ * signature porte elle-même l'état de vérification (attestation:
+ * ATTESTATION_FLAG_INTEGRITY_VERIFIED).
+ */
+esp_err_t crypto_basic_generate_ecdsa_keypair_ungated(crypto_basic_keypair_t *keypair);
+
+/**
+ * @brief Signe sans barrière de démarrage (même usage réservé)
+ */
+esp_err_t crypto_basic_ecdsa_sign_ungated(const crypto_basic_keypair_t *keypair,
+                                         const uint8_t *hash, size_t hash_len,
+                                         uint8_t *signature, size_t *signature_len);
+
 /**
  * @brief Vérifie une signature ECDSA (software)
  * 
@@ -190,6 +386,99 @@ esp_err_t crypto_basic_ecdsa_verify(const crypto_basic_keypair_t *keypair,
                                    const uint8_t *hash, size_t hash_len,
                                    const uint8_t *signature, size_t signature_len);
 
+/**
+ * @brief Crée un vérificateur pour une clé publique
+ * 
+ * Charge le groupe P-256, décode et valide la clé (point sur la courbe) et
+ * précalcule la table comb du point de base. Les vérifications suivantes
+ * ne refont aucun de ces calculs.
+ * 
+ * @param public_key Clé publique P-256 non compressée (65 bytes)
+ * @param public_key_len Taille de la clé
+ * @param verifier Vérificateur créé
+ * @return ESP_OK, ESP_ERR_NO_MEM si le pool est épuisé, ESP_FAIL si la clé est invalide
+ */
+esp_err_t crypto_basic_ecdsa_verifier_create(const uint8_t *public_key, size_t public_key_len,
+                                             crypto_basic_ecdsa_verifier_t **verifier);
+
+/**
+ * @brief Vérifie une signature avec un vérificateur
+ * 
+ * @return ESP_OK si signature valide, ESP_FAIL sinon
+ */
+esp_err_t crypto_basic_ecdsa_verifier_verify(crypto_basic_ecdsa_verifier_t *verifier,
+                                             const uint8_t *hash, size_t hash_len,
+                                             const uint8_t *signature, size_t signature_len);
+
+/**
+ * @brief Vérifie un lot de signatures avec le même vérificateur
+ * 
+ * Chaque signature reste vérifiée individuellement (ECDSA n'admet pas de
+ * vérification agrégée sans récupération du point R); le lot partage la
+ * table comb chaude et ne journalise qu'un bilan.
+ * 
+ * @param verifier Vérificateur
+ * @param items Signatures à vérifier
+ * @param count Nombre de signatures
+ * @param valid Résultat par signature (ou NULL)
+ * @return ESP_OK si toutes sont valides, ESP_FAIL si au moins une est invalide
+ */
+esp_err_t crypto_basic_ecdsa_verifier_verify_batch(crypto_basic_ecdsa_verifier_t *verifier,
+                                                   const crypto_basic_ecdsa_batch_item_t *items,
+                                                   size_t count, bool *valid);
+
+/**
+ * @brief Détruit un vérificateur et libère sa table
+ * 
+ * @return ESP_OK si succès
+ */
+esp_err_t crypto_basic_ecdsa_verifier_destroy(crypto_basic_ecdsa_verifier_t *verifier);
+
+// ================================
+// Fonctions de backend
+// ================================
+
+/**
+ * @brief Obtient le backend SHA-256 / AES-GCM actif
+ * 
+ * Choisi à l'initialisation selon CONFIG_CRYPTO_BASIC_BACKEND_* et la sonde
+ * des accélérateurs. Software tant que le crypto n'est pas initialisé.
+ * 
+ * @return Backend actif
+ */
+crypto_basic_backend_t crypto_basic_get_backend(void);
+
+/**
+ * @brief Convertit un backend en chaîne
+ * 
+ * @param backend Backend à convertir
+ * @return Chaîne décrivant le backend
+ */
+const char* crypto_basic_backend_to_string(crypto_basic_backend_t backend);
+
+/**
+ * @brief Mesure le débit SHA-256 et AES-GCM de chaque backend disponible
+ * 
+ * @param results Tableau de résultats (un par backend)
+ * @param max_results Taille du tableau
+ * @param result_count Nombre de résultats écrits
+ * @return ESP_OK si succès, ESP_ERR_NO_MEM si allocation impossible
+ */
+esp_err_t crypto_basic_benchmark_backends(crypto_basic_backend_bench_t *results,
+                                          size_t max_results, size_t *result_count);
+
+// ================================
+// Fonctions mémoire
+// ================================
+
+/**
+ * @brief Statistiques de l'arène statique des allocations mbedTLS
+ * 
+ * @param stats Statistiques de sortie
+ * @return ESP_OK, ESP_ERR_NOT_SUPPORTED sans CONFIG_CRYPTO_BASIC_STATIC_ARENA
+ */
+esp_err_t crypto_basic_get_arena_stats(crypto_arena_stats_t *stats);
+
 // ================================
 // Fonctions utilitaires
 // ================================
@@ -199,12 +488,16 @@ esp_err_t crypto_basic_ecdsa_verify(const crypto_basic_keypair_t *keypair,
  * 
  * Teste toutes les fonctions crypto disponibles en Community Edition.
  * 
+ * Compilée seulement avec CONFIG_APP_SELF_TESTS (profil de développement).
+ * 
  * @return ESP_OK si tous les tests passent, ESP_FAIL sinon
  */
 esp_err_t crypto_basic_self_test(void);
 
 /**
  * @brief Affiche les informations du système crypto Community
+ * 
+ * Compilée seulement avec CONFIG_APP_BANNERS (profil de développement).
  */
 void crypto_basic_print_info(void);
 
@@ -0,0 +1,122 @@
+/**
+ * @file crypto_random.h
+ * @brief Service d'aléa partagé entre tâches (Community Edition)
+ *
+ * Le CTR-DRBG mbedTLS n'est pas réentrant: il est protégé par un mutex et
+ * n'est plus appelé directement sur le chemin des petits tirages. Chaque
+ * cœur possède une réserve d'octets aléatoires remplie en bloc (DRBG ou
+ * RNG matériel selon Kconfig); un tirage court (IV GCM, nonce) copie
+ * quelques octets de la réserve du cœur courant sous son seul verrou,
+ * jamais disputé par l'autre cœur. Une tâche de fond recharge les
+ * réserves sous le seuil bas et réensemence le DRBG périodiquement.
+ *
+ * Les octets tirés sont effacés de la réserve: un même octet n'est
+ * jamais rendu deux fois.
+ *
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#ifndef CRYPTO_RANDOM_H
+#define CRYPTO_RANDOM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+// ================================
+// Constantes Community
+// ================================
+
+#define CRYPTO_RANDOM_POOL_SIZE             (256)   // Octets par réserve (un remplissage DRBG)
+#define CRYPTO_RANDOM_POOL_LOW_WATER        (96)    // Recharge de fond demandée sous ce seuil
+#define CRYPTO_RANDOM_FAST_MAX              (32)    // Tirages plus longs: DRBG verrouillé direct
+#define CRYPTO_RANDOM_IV_SIZE               (12)    // IV AES-GCM
+
+#define CRYPTO_RANDOM_TASK_STACK_SIZE_COMMUNITY (3072)
+#define CRYPTO_RANDOM_TASK_PRIORITY_COMMUNITY   (2)
+
+// ================================
+// Types et structures Community
+// ================================
+
+/**
+ * @brief Statistiques du service d'aléa (toutes réserves confondues)
+ */
+typedef struct {
+    uint32_t fast_draws;            // Tirages servis par une réserve
+    uint32_t direct_draws;          // Tirages longs servis par le DRBG verrouillé
+    uint32_t background_refills;    // Recharges par la tâche de fond
+    uint32_t inline_refills;        // Recharges dans l'appelant (réserve épuisée)
+    uint32_t reseeds;               // Réensemencements périodiques du DRBG
+    uint32_t reseed_failures;       // Réensemencements en échec (source d'entropie)
+    uint32_t lock_waits;            // Mutex DRBG trouvé pris (contention)
+    uint64_t drbg_bytes;            // Octets produits par le DRBG
+} crypto_random_stats_t;
+
+// ================================
+// Fonctions Community
+// ================================
+
+/**
+ * @brief Ensemence le DRBG, remplit les réserves et démarre la tâche de fond
+ *
+ * Appelée par crypto_operations_basic_init().
+ *
+ * @return ESP_OK, ESP_FAIL si l'ensemencement échoue, ESP_ERR_NO_MEM (verrou, tâche)
+ */
+esp_err_t crypto_random_init(void);
+
+/**
+ * @brief Libère le DRBG et efface les réserves (la tâche de fond reste inactive)
+ */
+void crypto_random_deinit(void);
+
+/**
+ * @brief Remplit un buffer d'octets aléatoires
+ *
+ * Jusqu'à CRYPTO_RANDOM_FAST_MAX octets: réserve du cœur courant,
+ * recharge dans l'appelant seulement si elle est épuisée. Au-delà: DRBG
+ * sous mutex.
+ */
+esp_err_t crypto_random_fill(uint8_t *buffer, size_t length);
+
+/**
+ * @brief Tire un IV AES-GCM de 12 octets (chemin rapide)
+ */
+esp_err_t crypto_random_gcm_iv(uint8_t iv[CRYPTO_RANDOM_IV_SIZE]);
+
+/**
+ * @brief Générateur au format f_rng mbedTLS (DRBG sous mutex)
+ *
+ * À passer aux fonctions ECDSA à la place de mbedtls_ctr_drbg_random;
+ * p_rng est ignoré.
+ */
+int crypto_random_drbg(void *p_rng, unsigned char *output, size_t length);
+
+/**
+ * @brief Demande un réensemencement immédiat par la tâche de fond
+ */
+void crypto_random_request_reseed(void);
+
+/**
+ * @brief Obtient les statistiques du service
+ */
+esp_err_t crypto_random_get_stats(crypto_random_stats_t *stats);
+
+/**
+ * @brief Affiche les statistiques du service
+ */
+void crypto_random_print_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CRYPTO_RANDOM_H */
\ No newline at end of file
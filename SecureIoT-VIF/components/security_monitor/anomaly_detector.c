@@ -16,25 +16,87 @@
 #include "esp_log.h"
 #include "esp_err.h"
 #include "esp_system.h"
+#include "esp_timer.h"
+#include "sdkconfig.h"
 #include "anomaly_detector.h"
+#include "perf_trace.h"
 
 static const char *TAG = "ANOMALY_COMMUNITY";
 
 // Variables globales du détecteur Community
 static bool anomaly_detector_initialized = false;
 static anomaly_stats_community_t anomaly_stats = {0};
-static sensor_data_t history_buffer[ANOMALY_HISTORY_SIZE_COMMUNITY];
-static size_t history_index = 0;
-static size_t history_count = 0;
+
+// Test d'initialisation sur les chemins chauds (profil de build)
+#if CONFIG_APP_RUNTIME_GUARDS
+#define ANOMALY_HOT_PATH_NOT_READY()    (!anomaly_detector_initialized)
+#else
+#define ANOMALY_HOT_PATH_NOT_READY()    (false)
+#endif
+
+/**
+ * @brief Cumuls CUSUM bilatéraux d'une grandeur (en écarts-types)
+ */
+typedef struct {
+    float pos;
+    float neg;
+} anomaly_cusum_t;
+
+/**
+ * @brief Historique d'un capteur: une colonne glissante par grandeur
+ */
+typedef struct {
+    windowed_stats_t temperature;
+    windowed_stats_t humidity;
+    anomaly_cusum_t temperature_cusum;
+    anomaly_cusum_t humidity_cusum;
+    uint32_t temperature_storage[WINDOWED_STATS_STORAGE_WORDS(ANOMALY_HISTORY_SIZE_COMMUNITY)];
+    uint32_t humidity_storage[WINDOWED_STATS_STORAGE_WORDS(ANOMALY_HISTORY_SIZE_COMMUNITY)];
+} anomaly_history_t;
+
+static anomaly_history_t history[ANOMALY_MAX_SENSORS_COMMUNITY];
+
+/**
+ * @brief Réinitialise l'historique de tous les capteurs
+ */
+static void anomaly_history_reset(void) {
+    for (size_t i = 0; i < ANOMALY_MAX_SENSORS_COMMUNITY; i++) {
+        memset(&history[i].temperature_cusum, 0, sizeof(anomaly_cusum_t));
+        memset(&history[i].humidity_cusum, 0, sizeof(anomaly_cusum_t));
+        windowed_stats_init(&history[i].temperature, ANOMALY_HISTORY_SIZE_COMMUNITY,
+                            history[i].temperature_storage,
+                            WINDOWED_STATS_STORAGE_WORDS(ANOMALY_HISTORY_SIZE_COMMUNITY),
+                            ANOMALY_EWMA_ALPHA_COMMUNITY);
+        windowed_stats_init(&history[i].humidity, ANOMALY_HISTORY_SIZE_COMMUNITY,
+                            history[i].humidity_storage,
+                            WINDOWED_STATS_STORAGE_WORDS(ANOMALY_HISTORY_SIZE_COMMUNITY),
+                            ANOMALY_EWMA_ALPHA_COMMUNITY);
+    }
+}
 
 // Seuils par défaut Community (plus tolérants)
+#if CONFIG_ANOMALY_FIXED_THRESHOLDS
+// Constants: pliés en immédiats dans le scoring
+static const anomaly_thresholds_t current_thresholds = {
+#else
 static anomaly_thresholds_t current_thresholds = {
-    .temp_min = 5.0f,           // Plus large que Enterprise
-    .temp_max = 45.0f,          // Plus large que Enterprise
-    .humidity_min = 10.0f,      // Plus large que Enterprise
-    .humidity_max = 90.0f,      // Plus large que Enterprise
-    .temp_change_max = 10.0f,   // Plus tolérant
-    .humidity_change_max = 20.0f // Plus tolérant
+#endif
+    .temp_min = ANOMALY_DEFAULT_TEMP_MIN_COMMUNITY,
+    .temp_max = ANOMALY_DEFAULT_TEMP_MAX_COMMUNITY,
+    .humidity_min = ANOMALY_DEFAULT_HUMIDITY_MIN_COMMUNITY,
+    .humidity_max = ANOMALY_DEFAULT_HUMIDITY_MAX_COMMUNITY,
+    .temp_change_max = ANOMALY_DEFAULT_TEMP_CHANGE_COMMUNITY,
+    .humidity_change_max = ANOMALY_DEFAULT_HUMIDITY_CHANGE_COMMUNITY
+};
+
+// Mode actif et paramètres du mode statistique
+static anomaly_detection_mode_t current_mode = ANOMALY_DETECTION_MODE_DEFAULT;
+static anomaly_statistical_params_t current_stat_params = {
+    .z_threshold = ANOMALY_STAT_Z_THRESHOLD_COMMUNITY,
+    .ewma_k = ANOMALY_STAT_EWMA_K_COMMUNITY,
+    .cusum_k = ANOMALY_STAT_CUSUM_K_COMMUNITY,
+    .cusum_h = ANOMALY_STAT_CUSUM_H_COMMUNITY,
+    .warmup_samples = ANOMALY_STAT_WARMUP_COMMUNITY
 };
 
 /**
@@ -47,19 +109,17 @@ esp_err_t anomaly_detector_basic_init(void) {
     }
     
     ESP_LOGI(TAG, "🤖 Initialisation détecteur d'anomalies Community");
-    ESP_LOGI(TAG, "💡 Version éducative - Seuils fixes seulement");
+    ESP_LOGI(TAG, "💡 Modes: seuils fixes ou statistique (z-score/EWMA/CUSUM)");
     
     // Réinitialiser les statistiques et l'historique
     memset(&anomaly_stats, 0, sizeof(anomaly_stats));
-    memset(history_buffer, 0, sizeof(history_buffer));
-    history_index = 0;
-    history_count = 0;
+    anomaly_history_reset();
     
     anomaly_stats.init_time = esp_timer_get_time() / 1000;
     
     anomaly_detector_initialized = true;
     ESP_LOGI(TAG, "✅ Détecteur d'anomalies Community initialisé");
-    ESP_LOGI(TAG, "🎓 Méthode: Seuils fixes pour apprentissage");
+    ESP_LOGI(TAG, "🎓 Méthode active: %s", anomaly_mode_to_string(current_mode));
     
     return ESP_OK;
 }
@@ -79,12 +139,118 @@ esp_err_t anomaly_detector_basic_deinit(void) {
 }
 
 /**
- * @brief Détection d'anomalies par seuils fixes (Community)
+ * @brief Écart à l'échantillon précédent (mode seuils fixes)
  */
-anomaly_result_t anomaly_detect_threshold_based(const sensor_data_t *data) {
+static float anomaly_score_change(const anomaly_history_t *sensor_history,
+                                  const sensor_data_t *data, anomaly_result_t *result) {
+    float score = 0.0f;
+    
+    if (windowed_stats_count(&sensor_history->temperature) == 0) {
+        return score;
+    }
+    
+    float temp_change = fabsf(data->temperature - windowed_stats_last(&sensor_history->temperature));
+    float humidity_change = fabsf(data->humidity - windowed_stats_last(&sensor_history->humidity));
+    
+    if (temp_change > current_thresholds.temp_change_max) {
+        result->temp_change_anomaly = true;
+        score += 0.1f; // 10% du score
+        ESP_LOGD(TAG, "📈 Changement rapide température: %.1f°C (seuil=%.1f°C)",
+                 temp_change, current_thresholds.temp_change_max);
+    }
+    
+    if (humidity_change > current_thresholds.humidity_change_max) {
+        result->humidity_change_anomaly = true;
+        score += 0.1f; // 10% du score
+        ESP_LOGD(TAG, "📈 Changement rapide humidité: %.1f%% (seuil=%.1f%%)",
+                 humidity_change, current_thresholds.humidity_change_max);
+    }
+    
+    return score;
+}
+
+/**
+ * @brief Score statistique d'une grandeur: z-score, résidu EWMA et CUSUM
+ * 
+ * Utilise l'historique avant ajout de la valeur courante.
+ * 
+ * @return Écart normalisé (>= 1.0 si anomalie), 0 pendant la chauffe
+ */
+static float anomaly_score_statistical_column(const windowed_stats_t *window, anomaly_cusum_t *cusum,
+                                              float value, float *z_abs, float *cusum_score) {
+    const anomaly_statistical_params_t *p = &current_stat_params;
+    
+    if (windowed_stats_count(window) < p->warmup_samples) {
+        return 0.0f;
+    }
+    
+    windowed_stats_summary_t summary;
+    windowed_stats_get_summary(window, &summary);
+    
+    float sigma = fmaxf(summary.stddev, ANOMALY_STAT_MIN_STDDEV_COMMUNITY);
+    float z = (value - summary.mean) / sigma;
+    float ewma_residual = fabsf(value - summary.ewma) /
+                          fmaxf(summary.ewma_stddev, ANOMALY_STAT_MIN_STDDEV_COMMUNITY);
+    
+    // CUSUM bilatéral: détecte les dérives lentes sous le seuil z-score
+    cusum->pos = fmaxf(0.0f, cusum->pos + z - p->cusum_k);
+    cusum->neg = fmaxf(0.0f, cusum->neg - z - p->cusum_k);
+    float cusum_max = fmaxf(cusum->pos, cusum->neg);
+    
+    float normalized = fmaxf(fabsf(z) / p->z_threshold,
+                             fmaxf(ewma_residual / p->ewma_k, cusum_max / p->cusum_h));
+    
+    if (cusum_max >= p->cusum_h) {
+        // Réarmement après décision
+        cusum->pos = 0.0f;
+        cusum->neg = 0.0f;
+    }
+    
+    *z_abs = fmaxf(*z_abs, fabsf(z));
+    *cusum_score = fmaxf(*cusum_score, cusum_max);
+    return normalized;
+}
+
+/**
+ * @brief Écarts statistiques glissants (mode statistique)
+ */
+static float anomaly_score_statistical(anomaly_history_t *sensor_history, const sensor_data_t *data,
+                                       anomaly_result_t *result) {
+    float score = 0.0f;
+    
+    float temp_norm = anomaly_score_statistical_column(&sensor_history->temperature,
+                                                       &sensor_history->temperature_cusum,
+                                                       data->temperature,
+                                                       &result->z_score, &result->cusum_score);
+    float humidity_norm = anomaly_score_statistical_column(&sensor_history->humidity,
+                                                           &sensor_history->humidity_cusum,
+                                                           data->humidity,
+                                                           &result->z_score, &result->cusum_score);
+    
+    // 10% à 20% du score par grandeur selon l'amplitude de l'écart
+    if (temp_norm >= 1.0f) {
+        result->temp_change_anomaly = true;
+        score += 0.1f * fminf(temp_norm, 2.0f);
+        ESP_LOGD(TAG, "📈 Écart statistique température: %.2f (normalisé)", temp_norm);
+    }
+    if (humidity_norm >= 1.0f) {
+        result->humidity_change_anomaly = true;
+        score += 0.1f * fminf(humidity_norm, 2.0f);
+        ESP_LOGD(TAG, "📈 Écart statistique humidité: %.2f (normalisé)", humidity_norm);
+    }
+    
+    return score;
+}
+
+/**
+ * @brief Analyse commune aux modes de détection
+ */
+static anomaly_result_t anomaly_run(const sensor_data_t *data, anomaly_detection_mode_t mode) {
+    PERF_TRACE_SCOPE(PERF_SPAN_ANOMALY_DETECT);
     anomaly_result_t result = {0};
+    result.mode = mode;
     
-    if (!anomaly_detector_initialized) {
+    if (ANOMALY_HOT_PATH_NOT_READY()) {
         ESP_LOGE(TAG, "❌ Détecteur non initialisé");
         result.is_anomaly = false;
         result.anomaly_score = 0.0f;
@@ -100,14 +266,14 @@ anomaly_result_t anomaly_detect_threshold_based(const sensor_data_t *data) {
         return result;
     }
     
-    ESP_LOGD(TAG, "🔍 Analyse anomalies par seuils: T=%.1f°C, H=%.1f%%",
-             data->temperature, data->humidity);
+    ESP_LOGD(TAG, "🔍 Analyse anomalies (%s): T=%.1f°C, H=%.1f%%",
+             anomaly_mode_to_string(mode), data->temperature, data->humidity);
     
+    int64_t scoring_start = esp_timer_get_time();
     anomaly_stats.total_analyses++;
     
     bool temp_anomaly = false;
     bool humidity_anomaly = false;
-    bool change_anomaly = false;
     float anomaly_score = 0.0f;
     
     // 1. Vérification seuils absolus
@@ -127,27 +293,15 @@ anomaly_result_t anomaly_detect_threshold_based(const sensor_data_t *data) {
                  data->humidity, current_thresholds.humidity_min, current_thresholds.humidity_max);
     }
     
-    // 2. Vérification changements rapides (si historique disponible)
-    if (history_count > 0) {
-        sensor_data_t *last_data = &history_buffer[(history_index - 1 + ANOMALY_HISTORY_SIZE_COMMUNITY) % ANOMALY_HISTORY_SIZE_COMMUNITY];
-        
-        float temp_change = fabsf(data->temperature - last_data->temperature);
-        float humidity_change = fabsf(data->humidity - last_data->humidity);
-        
-        if (temp_change > current_thresholds.temp_change_max) {
-            change_anomaly = true;
-            anomaly_score += 0.1f; // 10% du score
-            ESP_LOGD(TAG, "📈 Changement rapide température: %.1f°C (seuil=%.1f°C)",
-                     temp_change, current_thresholds.temp_change_max);
-        }
-        
-        if (humidity_change > current_thresholds.humidity_change_max) {
-            change_anomaly = true;
-            anomaly_score += 0.1f; // 10% du score
-            ESP_LOGD(TAG, "📈 Changement rapide humidité: %.1f%% (seuil=%.1f%%)",
-                     humidity_change, current_thresholds.humidity_change_max);
-        }
+    // 2. Écarts relatifs à l'historique de ce capteur
+    anomaly_history_t *sensor_history = &history[data->sensor_id % ANOMALY_MAX_SENSORS_COMMUNITY];
+    if (mode == ANOMALY_MODE_STATISTICAL) {
+        anomaly_score += anomaly_score_statistical(sensor_history, data, &result);
+    } else {
+        anomaly_score += anomaly_score_change(sensor_history, data, &result);
     }
+    bool change_anomaly = result.temp_change_anomaly || result.humidity_change_anomaly;
+    anomaly_score = fminf(anomaly_score, 1.0f);
     
     // 3. Déterminer si c'est une anomalie
     bool is_anomaly = temp_anomaly || humidity_anomaly || change_anomaly;
@@ -165,28 +319,165 @@ anomaly_result_t anomaly_detect_threshold_based(const sensor_data_t *data) {
     result.humidity_anomaly = humidity_anomaly;
     result.change_anomaly = change_anomaly;
     
+    // Ajouter à l'historique (O(1) quelle que soit la fenêtre)
+    windowed_stats_push(&sensor_history->temperature, data->temperature);
+    windowed_stats_push(&sensor_history->humidity, data->humidity);
+    
+    // Latence de scoring (hors journalisation)
+    result.scoring_latency_us = (uint32_t)(esp_timer_get_time() - scoring_start);
+    anomaly_stats.last_latency_us = result.scoring_latency_us;
+    anomaly_stats.total_latency_us += result.scoring_latency_us;
+    if (result.scoring_latency_us > anomaly_stats.max_latency_us) {
+        anomaly_stats.max_latency_us = result.scoring_latency_us;
+    }
+    
     // Mettre à jour les statistiques
     if (is_anomaly) {
         anomaly_stats.anomalies_detected++;
         anomaly_stats.last_anomaly_time = data->timestamp;
-        ESP_LOGW(TAG, "🚨 Anomalie détectée: score=%.3f, T=%s, H=%s, Δ=%s",
+        ESP_LOGW(TAG, "🚨 Anomalie détectée (%s): score=%.3f, T=%s, H=%s, Δ=%s, z=%.2f, cusum=%.2f",
+                 anomaly_mode_to_string(mode),
                  anomaly_score,
                  temp_anomaly ? "OUI" : "non",
                  humidity_anomaly ? "OUI" : "non", 
-                 change_anomaly ? "OUI" : "non");
+                 change_anomaly ? "OUI" : "non",
+                 result.z_score, result.cusum_score);
     } else {
         anomaly_stats.normal_analyses++;
-        ESP_LOGD(TAG, "✅ Données normales: score=%.3f", anomaly_score);
+        ESP_LOGD(TAG, "✅ Données normales: score=%.3f (%lu µs)", anomaly_score, result.scoring_latency_us);
     }
     
-    // Ajouter à l'historique
-    history_buffer[history_index] = *data;
-    history_index = (history_index + 1) % ANOMALY_HISTORY_SIZE_COMMUNITY;
-    if (history_count < ANOMALY_HISTORY_SIZE_COMMUNITY) {
-        history_count++;
+    return result;
+}
+
+/**
+ * @brief Détection d'anomalies par seuils fixes (Community)
+ */
+anomaly_result_t anomaly_detect_threshold_based(const sensor_data_t *data) {
+    return anomaly_run(data, ANOMALY_MODE_THRESHOLD);
+}
+
+/**
+ * @brief Détection statistique glissante
+ */
+anomaly_result_t anomaly_detect_statistical(const sensor_data_t *data) {
+    return anomaly_run(data, ANOMALY_MODE_STATISTICAL);
+}
+
+/**
+ * @brief Score d'un échantillon du lot, sans branche
+ * 
+ * Les comparaisons produisent 0/1 et sont combinées arithmétiquement.
+ */
+static inline __attribute__((always_inline))
+uint8_t anomaly_batch_flags(float t, float h, float dt, float dh,
+                            const anomaly_thresholds_t *th, float *score) {
+    int32_t t_out = (int32_t)(t < th->temp_min) | (int32_t)(t > th->temp_max);
+    int32_t h_out = (int32_t)(h < th->humidity_min) | (int32_t)(h > th->humidity_max);
+    int32_t t_jump = (int32_t)(dt > th->temp_change_max);
+    int32_t h_jump = (int32_t)(dh > th->humidity_change_max);
+    
+    *score = 0.4f * (float)t_out + 0.4f * (float)h_out +
+             0.1f * (float)t_jump + 0.1f * (float)h_jump;
+    
+    return (uint8_t)(t_out | (h_out << 1) | (t_jump << 2) | (h_jump << 3));
+}
+
+/**
+ * @brief Scoring par lots en seuils fixes sur des colonnes (SoA)
+ */
+esp_err_t anomaly_detect_batch(const float *temps, const float *hums, size_t n,
+                               uint8_t *flags, float *scores) {
+    PERF_TRACE_SCOPE(PERF_SPAN_ANOMALY_BATCH);
+    
+    if (ANOMALY_HOT_PATH_NOT_READY()) {
+        return ESP_ERR_INVALID_STATE;
     }
     
-    return result;
+    if (temps == NULL || hums == NULL || flags == NULL || scores == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    if (n == 0) {
+        return ESP_OK;
+    }
+    
+    // Copie locale: les seuils restent en registres dans la boucle
+    const anomaly_thresholds_t th = current_thresholds;
+    const float *__restrict t = temps;
+    const float *__restrict h = hums;
+    uint8_t *__restrict f = flags;
+    float *__restrict sc = scores;
+    uint32_t anomalies = 0;
+    
+    // Premier échantillon: pas de précédent, donc pas de saut
+    f[0] = anomaly_batch_flags(t[0], h[0], 0.0f, 0.0f, &th, &sc[0]);
+    anomalies += (f[0] != 0);
+    
+    for (size_t i = 1; i < n; i++) {
+        float dt = fabsf(t[i] - t[i - 1]);
+        float dh = fabsf(h[i] - h[i - 1]);
+        f[i] = anomaly_batch_flags(t[i], h[i], dt, dh, &th, &sc[i]);
+        anomalies += (f[i] != 0);
+    }
+    
+    anomaly_stats.batch_calls++;
+    anomaly_stats.batch_samples += n;
+    anomaly_stats.batch_anomalies += anomalies;
+    
+    return ESP_OK;
+}
+
+/**
+ * @brief Détection selon le mode actif
+ */
+anomaly_result_t anomaly_detect(const sensor_data_t *data) {
+    return anomaly_run(data, current_mode);
+}
+
+/**
+ * @brief Sélectionne le mode de détection
+ */
+esp_err_t anomaly_set_detection_mode(anomaly_detection_mode_t mode) {
+    if (mode >= ANOMALY_MODE_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    current_mode = mode;
+    ESP_LOGI(TAG, "⚙️ Mode de détection: %s", anomaly_mode_to_string(mode));
+    return ESP_OK;
+}
+
+/**
+ * @brief Obtient le mode de détection actif
+ */
+anomaly_detection_mode_t anomaly_get_detection_mode(void) {
+    return current_mode;
+}
+
+/**
+ * @brief Nom lisible d'un mode de détection
+ */
+const char* anomaly_mode_to_string(anomaly_detection_mode_t mode) {
+    switch (mode) {
+        case ANOMALY_MODE_THRESHOLD:    return "seuils fixes";
+        case ANOMALY_MODE_STATISTICAL:  return "statistique";
+        default:                        return "inconnu";
+    }
+}
+
+/**
+ * @brief Convertit un code d'erreur en chaîne
+ */
+const char* anomaly_error_to_string(anomaly_error_t error) {
+    switch (error) {
+        case ANOMALY_SUCCESS:                   return "Succès";
+        case ANOMALY_ERROR_NOT_INITIALIZED:     return "Non initialisé";
+        case ANOMALY_ERROR_INVALID_DATA:        return "Données invalides";
+        case ANOMALY_ERROR_INSUFFICIENT_DATA:   return "Données insuffisantes";
+        case ANOMALY_ERROR_THRESHOLD_INVALID:   return "Seuils invalides";
+        default:                                return "Erreur inconnue";
+    }
 }
 
 /**
@@ -208,6 +499,10 @@ esp_err_t anomaly_set_thresholds_community(const anomaly_thresholds_t *threshold
         return ESP_ERR_INVALID_ARG;
     }
     
+#if CONFIG_ANOMALY_FIXED_THRESHOLDS
+    ESP_LOGW(TAG, "⚠️ Seuils constants dans ce profil de build");
+    return ESP_ERR_NOT_SUPPORTED;
+#else
     memcpy(&current_thresholds, thresholds, sizeof(anomaly_thresholds_t));
     
     ESP_LOGI(TAG, "⚙️ Seuils Community mis à jour:");
@@ -219,6 +514,7 @@ esp_err_t anomaly_set_thresholds_community(const anomaly_thresholds_t *threshold
              current_thresholds.humidity_change_max);
     
     return ESP_OK;
+#endif
 }
 
 /**
@@ -237,6 +533,45 @@ esp_err_t anomaly_get_thresholds_community(anomaly_thresholds_t *thresholds) {
     return ESP_OK;
 }
 
+/**
+ * @brief Configure les paramètres du mode statistique
+ */
+esp_err_t anomaly_set_statistical_params(const anomaly_statistical_params_t *params) {
+    if (!anomaly_detector_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    if (params == NULL || params->z_threshold <= 0.0f || params->ewma_k <= 0.0f ||
+        params->cusum_k < 0.0f || params->cusum_h <= 0.0f ||
+        params->warmup_samples < 2 || params->warmup_samples > ANOMALY_HISTORY_SIZE_COMMUNITY) {
+        ESP_LOGE(TAG, "❌ Paramètres statistiques invalides");
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    memcpy(&current_stat_params, params, sizeof(anomaly_statistical_params_t));
+    for (size_t i = 0; i < ANOMALY_MAX_SENSORS_COMMUNITY; i++) {
+        memset(&history[i].temperature_cusum, 0, sizeof(anomaly_cusum_t));
+        memset(&history[i].humidity_cusum, 0, sizeof(anomaly_cusum_t));
+    }
+    
+    ESP_LOGI(TAG, "⚙️ Paramètres statistiques: z=%.1fσ, EWMA=%.1fσ, CUSUM k=%.1fσ h=%.1fσ, chauffe=%d",
+             params->z_threshold, params->ewma_k, params->cusum_k, params->cusum_h,
+             params->warmup_samples);
+    return ESP_OK;
+}
+
+/**
+ * @brief Obtient les paramètres du mode statistique
+ */
+esp_err_t anomaly_get_statistical_params(anomaly_statistical_params_t *params) {
+    if (params == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    memcpy(params, &current_stat_params, sizeof(anomaly_statistical_params_t));
+    return ESP_OK;
+}
+
 /**
  * @brief Obtient les statistiques du détecteur Community
  */
@@ -253,6 +588,125 @@ esp_err_t anomaly_get_stats_community(anomaly_stats_community_t *stats) {
     return ESP_OK;
 }
 
+/**
+ * @brief Obtient les statistiques glissantes de l'historique d'un capteur
+ */
+esp_err_t anomaly_get_history_stats(uint8_t sensor_id,
+                                    windowed_stats_summary_t *temperature,
+                                    windowed_stats_summary_t *humidity) {
+    if (!anomaly_detector_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    if (sensor_id >= ANOMALY_MAX_SENSORS_COMMUNITY) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    
+    if (temperature != NULL) {
+        windowed_stats_get_summary(&history[sensor_id].temperature, temperature);
+    }
+    if (humidity != NULL) {
+        windowed_stats_get_summary(&history[sensor_id].humidity, humidity);
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief Sauvegarde une grandeur d'un capteur
+ */
+static void anomaly_save_column(const windowed_stats_t *window, const anomaly_cusum_t *cusum,
+                                anomaly_column_snapshot_t *column) {
+    windowed_stats_save(window, column->values, ANOMALY_HISTORY_SIZE_COMMUNITY, &column->state);
+    column->cusum_pos = cusum->pos;
+    column->cusum_neg = cusum->neg;
+}
+
+/**
+ * @brief Restaure une grandeur d'un capteur
+ */
+static esp_err_t anomaly_restore_column(windowed_stats_t *window, anomaly_cusum_t *cusum,
+                                        const anomaly_column_snapshot_t *column) {
+    cusum->pos = column->cusum_pos;
+    cusum->neg = column->cusum_neg;
+    return windowed_stats_restore(window, column->values, &column->state);
+}
+
+/**
+ * @brief Sauvegarde l'état du détecteur (historiques, mode, seuils, statistiques)
+ */
+esp_err_t anomaly_detector_save_state(anomaly_snapshot_t *snapshot) {
+    if (snapshot == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!anomaly_detector_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    memset(snapshot, 0, sizeof(*snapshot));
+    snapshot->mode = current_mode;
+    snapshot->thresholds = current_thresholds;
+    snapshot->stat_params = current_stat_params;
+    snapshot->stats = anomaly_stats;
+    
+    esp_err_t ret = ESP_OK;
+    for (uint8_t i = 0; i < ANOMALY_MAX_SENSORS_COMMUNITY; i++) {
+        if (history[i].temperature.total_samples == 0) {
+            continue;
+        }
+        if (snapshot->sensor_count == ANOMALY_SNAPSHOT_SENSORS_COMMUNITY) {
+            ret = ESP_ERR_INVALID_SIZE;
+            break;
+        }
+        
+        anomaly_sensor_snapshot_t *sensor = &snapshot->sensors[snapshot->sensor_count++];
+        sensor->sensor_id = i;
+        anomaly_save_column(&history[i].temperature, &history[i].temperature_cusum, &sensor->temperature);
+        anomaly_save_column(&history[i].humidity, &history[i].humidity_cusum, &sensor->humidity);
+    }
+    
+    snapshot->magic = ANOMALY_SNAPSHOT_MAGIC;
+    return ret;
+}
+
+/**
+ * @brief Restaure l'état du détecteur depuis une sauvegarde
+ */
+esp_err_t anomaly_detector_restore_state(const anomaly_snapshot_t *snapshot) {
+    if (snapshot == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!anomaly_detector_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (snapshot->magic != ANOMALY_SNAPSHOT_MAGIC ||
+        snapshot->sensor_count > ANOMALY_SNAPSHOT_SENSORS_COMMUNITY ||
+        snapshot->mode >= ANOMALY_MODE_MAX) {
+        return ESP_ERR_INVALID_CRC;
+    }
+    
+    anomaly_history_reset();
+    for (uint8_t i = 0; i < snapshot->sensor_count; i++) {
+        const anomaly_sensor_snapshot_t *sensor = &snapshot->sensors[i];
+        if (sensor->sensor_id >= ANOMALY_MAX_SENSORS_COMMUNITY ||
+            anomaly_restore_column(&history[sensor->sensor_id].temperature,
+                                   &history[sensor->sensor_id].temperature_cusum, &sensor->temperature) != ESP_OK ||
+            anomaly_restore_column(&history[sensor->sensor_id].humidity,
+                                   &history[sensor->sensor_id].humidity_cusum, &sensor->humidity) != ESP_OK) {
+            anomaly_history_reset();
+            return ESP_ERR_INVALID_CRC;
+        }
+    }
+    
+    current_mode = snapshot->mode;
+#if !CONFIG_ANOMALY_FIXED_THRESHOLDS
+    current_thresholds = snapshot->thresholds;
+#endif
+    current_stat_params = snapshot->stat_params;
+    anomaly_stats = snapshot->stats;
+    
+    return ESP_OK;
+}
+
 /**
  * @brief Affiche les statistiques du détecteur Community
  */
@@ -280,7 +734,33 @@ void anomaly_print_stats_community(void) {
     
     uint64_t uptime = (esp_timer_get_time() / 1000) - anomaly_stats.init_time;
     ESP_LOGI(TAG, "Temps de fonctionnement: %lld ms", uptime);
-    ESP_LOGI(TAG, "Taille historique: %d/%d", history_count, ANOMALY_HISTORY_SIZE_COMMUNITY);
+    ESP_LOGI(TAG, "Mode de détection: %s", anomaly_mode_to_string(current_mode));
+    
+    if (anomaly_stats.batch_calls > 0) {
+        ESP_LOGI(TAG, "Scoring par lots: %lu appels, %llu échantillons, %llu signalés",
+                 anomaly_stats.batch_calls, anomaly_stats.batch_samples,
+                 anomaly_stats.batch_anomalies);
+    }
+    
+    if (anomaly_stats.total_analyses > 0) {
+        ESP_LOGI(TAG, "Latence scoring: dernière=%lu µs, moy=%llu µs, max=%lu µs",
+                 anomaly_stats.last_latency_us,
+                 anomaly_stats.total_latency_us / anomaly_stats.total_analyses,
+                 anomaly_stats.max_latency_us);
+    }
+    
+    for (uint8_t i = 0; i < ANOMALY_MAX_SENSORS_COMMUNITY; i++) {
+        windowed_stats_summary_t temp_summary, hum_summary;
+        anomaly_get_history_stats(i, &temp_summary, &hum_summary);
+        if (temp_summary.count == 0) {
+            continue;
+        }
+        ESP_LOGI(TAG, "Historique capteur %d: %d/%d", i, temp_summary.count, ANOMALY_HISTORY_SIZE_COMMUNITY);
+        ESP_LOGI(TAG, "  🌡️ moy=%.1f°C σ=%.2f [%.1f, %.1f] EWMA=%.1f",
+                 temp_summary.mean, temp_summary.stddev, temp_summary.min, temp_summary.max, temp_summary.ewma);
+        ESP_LOGI(TAG, "  💧 moy=%.1f%% σ=%.2f [%.1f, %.1f] EWMA=%.1f",
+                 hum_summary.mean, hum_summary.stddev, hum_summary.min, hum_summary.max, hum_summary.ewma);
+    }
     
     ESP_LOGI(TAG, "Seuils actuels:");
     ESP_LOGI(TAG, "  🌡️ T: [%.1f, %.1f]°C, Δ%.1f°C",
@@ -302,15 +782,14 @@ esp_err_t anomaly_reset_stats_community(void) {
     }
     
     memset(&anomaly_stats, 0, sizeof(anomaly_stats));
-    memset(history_buffer, 0, sizeof(history_buffer));
-    history_index = 0;
-    history_count = 0;
+    anomaly_history_reset();
     anomaly_stats.init_time = esp_timer_get_time() / 1000;
     
     ESP_LOGI(TAG, "🔄 Statistiques détecteur anomalies réinitialisées");
     return ESP_OK;
 }
 
+#if CONFIG_APP_SELF_TESTS
 /**
  * @brief Test de fonctionnement du détecteur Community
  */
@@ -366,6 +845,41 @@ esp_err_t anomaly_detector_self_test(void) {
         ESP_LOGI(TAG, "✅ Anomalie correctement détectée: score=%.3f", result.anomaly_score);
     }
     
+    // Test du mode statistique: historique stable puis saut dans les seuils absolus
+    sensor_data_t stat_data = {
+        .humidity = 50.0f,
+        .read_duration_ms = 100,
+        .quality_score = 95,
+        .sensor_id = ANOMALY_MAX_SENSORS_COMMUNITY - 1
+    };
+    for (int i = 0; i < current_stat_params.warmup_samples + 5; i++) {
+        stat_data.temperature = 22.0f + 0.2f * (i % 2);
+        stat_data.timestamp = esp_timer_get_time() / 1000;
+        anomaly_detect_statistical(&stat_data);
+    }
+    stat_data.temperature = 30.0f;
+    result = anomaly_detect_statistical(&stat_data);
+    if (!result.is_anomaly) {
+        ESP_LOGW(TAG, "⚠️ Saut non détecté en mode statistique (z=%.2f)", result.z_score);
+    } else {
+        ESP_LOGI(TAG, "✅ Saut détecté en mode statistique: z=%.2f, latence=%lu µs",
+                 result.z_score, result.scoring_latency_us);
+    }
+    
+    // Test du scoring par lots: doit concorder avec la règle par échantillon
+    const float batch_temps[4] = {22.0f, 22.1f, 60.0f, 21.0f};
+    const float batch_hums[4] = {50.0f, 50.5f, 95.0f, 49.0f};
+    uint8_t batch_flags[4];
+    float batch_scores[4];
+    ret = anomaly_detect_batch(batch_temps, batch_hums, 4, batch_flags, batch_scores);
+    if (ret != ESP_OK || batch_flags[0] != 0 || batch_flags[1] != 0 ||
+        batch_flags[2] != (ANOMALY_FLAG_TEMPERATURE | ANOMALY_FLAG_HUMIDITY | ANOMALY_FLAG_TEMP_CHANGE |
+                           ANOMALY_FLAG_HUMIDITY_CHANGE)) {
+        ESP_LOGE(TAG, "❌ Scoring par lots incohérent");
+        return ESP_FAIL;
+    }
+    ESP_LOGI(TAG, "✅ Scoring par lots cohérent: score[2]=%.2f", batch_scores[2]);
+    
     // Test des statistiques
     anomaly_stats_community_t stats;
     ret = anomaly_get_stats_community(&stats);
@@ -375,30 +889,34 @@ esp_err_t anomaly_detector_self_test(void) {
     }
     
     ESP_LOGI(TAG, "✅ Auto-test détecteur Community réussi");
-    ESP_LOGI(TAG, "💡 Détection par seuils fixes opérationnelle");
+    ESP_LOGI(TAG, "💡 Détection par seuils fixes et statistique opérationnelle");
     
     return ESP_OK;
 }
+#endif /* CONFIG_APP_SELF_TESTS */
 
+#if CONFIG_APP_BANNERS
 /**
  * @brief Affiche les informations du détecteur Community
  */
 void anomaly_detector_print_info(void) {
     ESP_LOGI(TAG, "📋 === Détecteur Anomalies Community ===");
     ESP_LOGI(TAG, "Édition: Community (Éducative)");
-    ESP_LOGI(TAG, "Méthode: Seuils fixes seulement");
+    ESP_LOGI(TAG, "Méthode: %s (sélectionnable)", anomaly_mode_to_string(current_mode));
     ESP_LOGI(TAG, "Historique: %d échantillons", ANOMALY_HISTORY_SIZE_COMMUNITY);
     ESP_LOGI(TAG, "Fonctionnalités disponibles:");
     ESP_LOGI(TAG, "  ✅ Détection par seuils absolus");
     ESP_LOGI(TAG, "  ✅ Détection changements rapides");
+    ESP_LOGI(TAG, "  ✅ Z-score, EWMA et CUSUM glissants (O(1) par échantillon)");
+    ESP_LOGI(TAG, "  ✅ Scoring par lots sur colonnes (rattrapage, ré-analyse)");
     ESP_LOGI(TAG, "  ✅ Configuration seuils personnalisés");
     ESP_LOGI(TAG, "  ✅ Statistiques détaillées");
     ESP_LOGI(TAG, "  ✅ Historique simple");
     ESP_LOGI(TAG, "Limitations Community:");
     ESP_LOGI(TAG, "  ❌ Pas d'apprentissage automatique");
     ESP_LOGI(TAG, "  ❌ Pas d'adaptation comportementale");
-    ESP_LOGI(TAG, "  ❌ Seuils fixes uniquement");
     ESP_LOGI(TAG, "  ❌ Historique limité");
     ESP_LOGI(TAG, "🎓 Idéal pour comprendre la détection!");
     ESP_LOGI(TAG, "======================================");
-}
\ No newline at end of file
+}
+#endif /* CONFIG_APP_BANNERS */
\ No newline at end of file
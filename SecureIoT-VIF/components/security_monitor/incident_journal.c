@@ -0,0 +1,685 @@
+/**
+ * @file incident_journal.c
+ * @brief Journal d'incidents persistant en flash (Community Edition)
+ *
+ * Organisation de la partition: secteurs de SPI_FLASH_SEC_SIZE octets
+ * utilisés en anneau. Chaque secteur commence par un en-tête de 32
+ * octets (numéro de génération, compteur d'effacements, démarrage) suivi
+ * d'enregistrements de 32 octets écrits séquentiellement. Les ajouts
+ * sont regroupés en RAM et écrits par pages de 256 octets; un secteur
+ * n'est effacé qu'au moment où l'anneau le réutilise, ce qui répartit
+ * l'usure uniformément. L'effacement est fait par la maintenance
+ * (incident_journal_maintain) dès que le secteur actif dépasse
+ * INCIDENT_JOURNAL_PREPARE_PERCENT: l'ajout ne fait que basculer sur un
+ * secteur déjà vierge.
+ *
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#include <string.h>
+#include <stddef.h>
+#include "esp_log.h"
+#include "esp_err.h"
+#include "esp_timer.h"
+#include "esp_partition.h"
+#include "esp_spi_flash.h"
+#include "esp_rom_crc.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "app_config.h"
+#include "incident_journal.h"
+
+static const char *TAG = "INCIDENT_JOURNAL";
+
+#define JOURNAL_BUFFER_RECORDS      (INCIDENT_JOURNAL_PAGE_SIZE / INCIDENT_JOURNAL_RECORD_SIZE)
+#define JOURNAL_SIZE_MAX_BYTES      ((uint32_t)LOG_ROTATION_SIZE_KB * 1024)
+#define JOURNAL_BOOT_ID_UNKNOWN     (0xFFFFFFFFUL)  // En-têtes antérieurs au champ boot_id
+
+/**
+ * @brief En-tête de secteur (32 octets)
+ */
+typedef struct {
+    uint32_t magic;                 // INCIDENT_JOURNAL_MAGIC
+    uint32_t sequence;              // Génération du secteur (croissante, 0 = invalide)
+    uint32_t erase_count;           // Effacements subis par ce secteur
+    uint32_t boot_id;               // Démarrage ayant ouvert le secteur
+    uint32_t reserved[3];           // Réservé (0xFF)
+    uint32_t crc;                   // CRC32 des 28 premiers octets
+} journal_sector_header_t;
+
+_Static_assert(sizeof(incident_journal_record_t) == INCIDENT_JOURNAL_RECORD_SIZE,
+               "incident_journal_record_t doit faire 32 octets");
+_Static_assert(sizeof(journal_sector_header_t) == INCIDENT_JOURNAL_RECORD_SIZE,
+               "L'en-tête de secteur occupe un emplacement d'enregistrement");
+_Static_assert((SPI_FLASH_SEC_SIZE % INCIDENT_JOURNAL_PAGE_SIZE) == 0,
+               "Un secteur doit contenir un nombre entier de pages");
+
+// Variables globales du journal
+static bool journal_mounted = false;
+static const esp_partition_t *journal_partition = NULL;
+static SemaphoreHandle_t journal_mutex = NULL;
+static StaticSemaphore_t journal_mutex_buffer;
+
+// Index RAM: génération et usure de chaque secteur
+static uint32_t journal_sector_count = 0;
+static uint32_t journal_slots_per_sector = 0;
+static uint32_t sector_sequence[INCIDENT_JOURNAL_MAX_SECTORS];
+static uint32_t sector_erase_count[INCIDENT_JOURNAL_MAX_SECTORS];
+static uint32_t active_sector = 0;
+static uint32_t flash_slot = 0;     // Prochain emplacement libre en flash (secteur actif)
+static int32_t prepared_sector = -1; // Secteur suivant déjà effacé (-1: aucun)
+static bool preparing = false;      // Effacement du secteur suivant en cours, hors verrou
+static uint32_t journal_prepare_slots = 0;
+
+// Tampon de regroupement: emplacements [flash_slot, flash_slot + pending_count)
+static incident_journal_record_t page_buffer[JOURNAL_BUFFER_RECORDS];
+static uint32_t pending_count = 0;
+
+static uint32_t next_seq = 1;
+static uint16_t current_boot_id = 0;
+static incident_journal_stats_t journal_stats = {0};
+
+// ================================
+// Fonctions internes
+// ================================
+
+static inline size_t journal_slot_offset(uint32_t sector, uint32_t slot) {
+    return (size_t)sector * SPI_FLASH_SEC_SIZE + (size_t)(slot + 1) * INCIDENT_JOURNAL_RECORD_SIZE;
+}
+
+static inline uint32_t journal_crc(const void *data) {
+    return esp_rom_crc32_le(0, (const uint8_t *)data, INCIDENT_JOURNAL_RECORD_SIZE - sizeof(uint32_t));
+}
+
+static bool journal_record_valid(const incident_journal_record_t *record) {
+    return record->seq != INCIDENT_JOURNAL_SEQ_FREE && record->crc == journal_crc(record);
+}
+
+/**
+ * @brief Efface un secteur (l'index doit déjà l'avoir invalidé)
+ */
+static esp_err_t journal_erase_sector(uint32_t sector) {
+    esp_err_t ret = esp_partition_erase_range(journal_partition,
+                                              (size_t)sector * SPI_FLASH_SEC_SIZE,
+                                              SPI_FLASH_SEC_SIZE);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ Échec effacement secteur %lu: %s", sector, esp_err_to_name(ret));
+    }
+    return ret;
+}
+
+/**
+ * @brief Écrit l'en-tête d'un secteur vierge
+ */
+static esp_err_t journal_write_header(uint32_t sector, uint32_t sequence) {
+    journal_sector_header_t header;
+    memset(&header, 0xFF, sizeof(header));
+    header.magic = INCIDENT_JOURNAL_MAGIC;
+    header.sequence = sequence;
+    header.erase_count = sector_erase_count[sector];
+    header.boot_id = current_boot_id;
+    header.crc = journal_crc(&header);
+
+    esp_err_t ret = esp_partition_write(journal_partition, (size_t)sector * SPI_FLASH_SEC_SIZE,
+                                        &header, sizeof(header));
+    if (ret != ESP_OK) {
+        journal_stats.write_errors++;
+        ESP_LOGE(TAG, "❌ Échec écriture en-tête secteur %lu: %s", sector, esp_err_to_name(ret));
+        return ret;
+    }
+
+    sector_sequence[sector] = sequence;
+    journal_stats.bytes_written += sizeof(header);
+    return ESP_OK;
+}
+
+/**
+ * @brief Efface un secteur et y écrit un nouvel en-tête
+ */
+static esp_err_t journal_format_sector(uint32_t sector, uint32_t sequence) {
+    // Invalide dans l'index tant que l'en-tête n'est pas réécrit
+    sector_sequence[sector] = 0;
+    if (prepared_sector == (int32_t)sector) {
+        prepared_sector = -1;
+    }
+
+    esp_err_t ret = journal_erase_sector(sector);
+    if (ret != ESP_OK) {
+        journal_stats.write_errors++;
+        return ret;
+    }
+    sector_erase_count[sector]++;
+
+    return journal_write_header(sector, sequence);
+}
+
+/**
+ * @brief Passe au secteur suivant de l'anneau (le plus ancien)
+ *
+ * @param allow_erase Effacement synchrone permis si le secteur n'a pas été
+ *                    préparé par incident_journal_maintain()
+ * @return ESP_ERR_NOT_FINISHED si le secteur suivant n'est pas prêt et que
+ *         l'effacement n'est pas permis (ou déjà en cours hors verrou)
+ */
+static esp_err_t journal_rotate_locked(bool allow_erase) {
+    uint32_t next = (active_sector + 1) % journal_sector_count;
+    uint32_t sequence = sector_sequence[active_sector] + 1;
+    esp_err_t ret;
+
+    if (prepared_sector == (int32_t)next) {
+        ret = journal_write_header(next, sequence);
+        if (ret == ESP_OK) {
+            prepared_sector = -1;
+        }
+    } else if (!allow_erase || preparing) {
+        return ESP_ERR_NOT_FINISHED;
+    } else {
+        ret = journal_format_sector(next, sequence);
+    }
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    active_sector = next;
+    flash_slot = 0;
+    journal_stats.sector_rotations++;
+    ESP_LOGD(TAG, "🔄 Rotation journal: secteur %lu (génération %lu, %lu effacements)",
+             next, sequence, sector_erase_count[next]);
+    return ESP_OK;
+}
+
+/**
+ * @brief Écrit le tampon RAM en une seule opération flash
+ *
+ * Secteur actif plein: bascule d'abord sur le secteur suivant (voir
+ * journal_rotate_locked pour allow_erase).
+ */
+static esp_err_t journal_flush_locked(bool allow_erase) {
+    if (pending_count == 0) {
+        return ESP_OK;
+    }
+
+    if (flash_slot >= journal_slots_per_sector) {
+        esp_err_t ret = journal_rotate_locked(allow_erase);
+        if (ret != ESP_OK) {
+            return ret;
+        }
+    }
+
+    int64_t start_us = esp_timer_get_time();
+    size_t len = pending_count * INCIDENT_JOURNAL_RECORD_SIZE;
+    esp_err_t ret = esp_partition_write(journal_partition,
+                                        journal_slot_offset(active_sector, flash_slot),
+                                        page_buffer, len);
+    if (ret != ESP_OK) {
+        // Le tampon est conservé: nouvelle tentative au prochain vidage
+        journal_stats.write_errors++;
+        ESP_LOGE(TAG, "❌ Échec écriture journal: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    uint32_t elapsed_us = (uint32_t)(esp_timer_get_time() - start_us);
+    journal_stats.flushes++;
+    journal_stats.bytes_written += len;
+    journal_stats.last_flush_us = elapsed_us;
+    if (elapsed_us > journal_stats.max_flush_us) {
+        journal_stats.max_flush_us = elapsed_us;
+    }
+
+    flash_slot += pending_count;
+    pending_count = 0;
+    return ESP_OK;
+}
+
+/**
+ * @brief Parcourt le journal du plus récent au plus ancien
+ */
+static size_t journal_collect_locked(incident_journal_record_t *records, size_t max_records) {
+    size_t n = 0;
+
+    // Enregistrements encore en RAM: les plus récents
+    for (uint32_t i = pending_count; i > 0 && n < max_records; i--) {
+        records[n++] = page_buffer[i - 1];
+    }
+
+    // Puis les secteurs de l'anneau, à rebours, tant que les générations se suivent
+    uint32_t sector = active_sector;
+    uint32_t expected_sequence = sector_sequence[active_sector];
+    int32_t slot = (int32_t)flash_slot - 1;
+
+    for (uint32_t visited = 0; visited < journal_sector_count && n < max_records; visited++) {
+        if (expected_sequence == 0 || sector_sequence[sector] != expected_sequence) {
+            break;
+        }
+
+        for (; slot >= 0 && n < max_records; slot--) {
+            incident_journal_record_t record;
+            if (esp_partition_read(journal_partition, journal_slot_offset(sector, (uint32_t)slot),
+                                   &record, sizeof(record)) != ESP_OK) {
+                continue;
+            }
+            if (journal_record_valid(&record)) {
+                records[n++] = record;
+            }
+        }
+
+        sector = (sector + journal_sector_count - 1) % journal_sector_count;
+        slot = (int32_t)journal_slots_per_sector - 1;
+        expected_sequence--;
+    }
+
+    return n;
+}
+
+/**
+ * @brief Trouve le premier emplacement libre du secteur actif
+ *
+ * Les emplacements sont remplis dans l'ordre: les libres forment un
+ * suffixe, une recherche dichotomique suffit.
+ */
+static uint32_t journal_find_free_slot(uint32_t sector) {
+    uint32_t lo = 0;
+    uint32_t hi = journal_slots_per_sector;
+
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        uint32_t seq = 0;
+        if (esp_partition_read(journal_partition, journal_slot_offset(sector, mid),
+                               &seq, sizeof(seq)) == ESP_OK && seq == INCIDENT_JOURNAL_SEQ_FREE) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+
+    return lo;
+}
+
+/**
+ * @brief Reconstruit l'index RAM à partir des en-têtes de secteurs
+ */
+static esp_err_t journal_mount(void) {
+    bool found = false;
+    bool boot_known = false;
+    uint32_t last_boot_id = 0;
+    prepared_sector = -1;
+
+    for (uint32_t i = 0; i < journal_sector_count; i++) {
+        journal_sector_header_t header;
+        sector_sequence[i] = 0;
+        sector_erase_count[i] = 0;
+
+        if (esp_partition_read(journal_partition, (size_t)i * SPI_FLASH_SEC_SIZE,
+                               &header, sizeof(header)) != ESP_OK) {
+            continue;
+        }
+        if (header.magic != INCIDENT_JOURNAL_MAGIC || header.crc != journal_crc(&header) ||
+            header.sequence == 0) {
+            continue;
+        }
+
+        sector_sequence[i] = header.sequence;
+        sector_erase_count[i] = header.erase_count;
+        if (header.boot_id != JOURNAL_BOOT_ID_UNKNOWN && (!boot_known || header.boot_id > last_boot_id)) {
+            last_boot_id = header.boot_id;
+            boot_known = true;
+        }
+        if (!found || header.sequence > sector_sequence[active_sector]) {
+            active_sector = i;
+            found = true;
+        }
+    }
+
+    if (!found) {
+        ESP_LOGI(TAG, "🆕 Aucun journal trouvé - formatage de la partition");
+        active_sector = 0;
+        flash_slot = 0;
+        return journal_format_sector(0, 1);
+    }
+
+    flash_slot = journal_find_free_slot(active_sector);
+
+    // Reprendre la numérotation après le dernier incident persistant; le
+    // démarrage suit aussi les en-têtes (journal vide ou effacé)
+    incident_journal_record_t last;
+    if (journal_collect_locked(&last, 1) == 1) {
+        next_seq = last.seq + 1;
+        if (!boot_known || last.boot_id > last_boot_id) {
+            last_boot_id = last.boot_id;
+            boot_known = true;
+        }
+    }
+    if (boot_known) {
+        current_boot_id = (uint16_t)(last_boot_id + 1);
+    }
+
+    if (flash_slot >= journal_slots_per_sector) {
+        return journal_rotate_locked(true);
+    }
+
+    return ESP_OK;
+}
+
+// ================================
+// Fonctions publiques
+// ================================
+
+/**
+ * @brief Monte le journal sur la partition dédiée
+ */
+esp_err_t incident_journal_init(void) {
+    if (journal_mounted) {
+        ESP_LOGW(TAG, "Journal d'incidents déjà monté");
+        return ESP_OK;
+    }
+
+    journal_partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                                 (esp_partition_subtype_t)INCIDENT_JOURNAL_PARTITION_SUBTYPE,
+                                                 INCIDENT_JOURNAL_PARTITION_LABEL);
+    if (journal_partition == NULL) {
+        ESP_LOGW(TAG, "⚠️ Partition '%s' absente - journal d'incidents désactivé",
+                 INCIDENT_JOURNAL_PARTITION_LABEL);
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    uint32_t usable = journal_partition->size;
+    if (usable > JOURNAL_SIZE_MAX_BYTES) {
+        usable = JOURNAL_SIZE_MAX_BYTES;
+    }
+    journal_sector_count = usable / SPI_FLASH_SEC_SIZE;
+    if (journal_sector_count > INCIDENT_JOURNAL_MAX_SECTORS) {
+        journal_sector_count = INCIDENT_JOURNAL_MAX_SECTORS;
+    }
+    if (journal_sector_count < 2) {
+        ESP_LOGE(TAG, "❌ Partition '%s' trop petite (%lu octets, 2 secteurs minimum)",
+                 INCIDENT_JOURNAL_PARTITION_LABEL, journal_partition->size);
+        return ESP_ERR_INVALID_SIZE;
+    }
+    journal_slots_per_sector = SPI_FLASH_SEC_SIZE / INCIDENT_JOURNAL_RECORD_SIZE - 1;
+    journal_prepare_slots = journal_slots_per_sector * INCIDENT_JOURNAL_PREPARE_PERCENT / 100;
+
+    if (journal_mutex == NULL) {
+        journal_mutex = xSemaphoreCreateMutexStatic(&journal_mutex_buffer);
+        if (journal_mutex == NULL) {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+    memset(&journal_stats, 0, sizeof(journal_stats));
+    pending_count = 0;
+    next_seq = 1;
+    current_boot_id = 0;
+
+    esp_err_t ret = journal_mount();
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ Échec montage journal d'incidents: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    journal_mounted = true;
+    ESP_LOGI(TAG, "📒 Journal d'incidents monté: %lu secteurs x %lu enregistrements, "
+             "secteur actif %lu (emplacement %lu), démarrage #%u",
+             journal_sector_count, journal_slots_per_sector, active_sector,
+             flash_slot, current_boot_id);
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Vide le tampon RAM et démonte le journal
+ */
+esp_err_t incident_journal_deinit(void) {
+    if (!journal_mounted) {
+        return ESP_OK;
+    }
+
+    esp_err_t ret = incident_journal_flush();
+    journal_mounted = false;
+
+    ESP_LOGI(TAG, "Journal d'incidents démonté");
+    return ret;
+}
+
+/**
+ * @brief Ajoute un incident au journal
+ */
+esp_err_t incident_journal_append(const security_event_t *event, uint16_t repeat_count) {
+    if (event == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (!journal_mounted) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    esp_err_t ret = ESP_OK;
+    xSemaphoreTake(journal_mutex, portMAX_DELAY);
+
+    // Tampon plein (secteur suivant pas encore prêt, ou écriture en échec):
+    // effacement synchrone en dernier recours plutôt que perdre l'incident
+    if (pending_count >= JOURNAL_BUFFER_RECORDS) {
+        ret = journal_flush_locked(false);
+        if (ret == ESP_ERR_NOT_FINISHED && !preparing) {
+            journal_stats.inline_erases++;
+            ret = journal_flush_locked(true);
+        }
+        if (ret != ESP_OK) {
+            journal_stats.records_dropped++;
+            xSemaphoreGive(journal_mutex);
+            return ESP_ERR_NO_MEM;
+        }
+    }
+
+    incident_journal_record_t *record = &page_buffer[pending_count];
+    record->seq = next_seq++;
+    record->boot_id = current_boot_id;
+    record->repeat_count = repeat_count;
+    record->uptime_ms = (uint32_t)(esp_timer_get_time() / 1000);
+    record->event = *event;
+    record->crc = journal_crc(record);
+
+    pending_count++;
+    journal_stats.records_appended++;
+
+    // Vider dès qu'une page flash est complète (ou le secteur plein), sans
+    // effacer: secteur suivant pas encore prêt, les enregistrements restent en RAM
+    uint32_t base_slot = (flash_slot >= journal_slots_per_sector) ? 0 : flash_slot;
+    uint32_t end_slot = base_slot + pending_count;
+    if (end_slot >= journal_slots_per_sector ||
+        ((end_slot + 1) * INCIDENT_JOURNAL_RECORD_SIZE) % INCIDENT_JOURNAL_PAGE_SIZE == 0) {
+        ret = journal_flush_locked(false);
+        if (ret == ESP_ERR_NOT_FINISHED) {
+            ret = ESP_OK;
+        }
+    }
+
+    xSemaphoreGive(journal_mutex);
+    return ret;
+}
+
+/**
+ * @brief Écrit en flash les enregistrements encore en RAM
+ */
+esp_err_t incident_journal_flush(void) {
+    if (!journal_mounted) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(journal_mutex, portMAX_DELAY);
+    esp_err_t ret = journal_flush_locked(true);
+    xSemaphoreGive(journal_mutex);
+
+    return ret;
+}
+
+/**
+ * @brief Pré-efface le secteur suivant au-delà du seuil de remplissage
+ */
+esp_err_t incident_journal_maintain(void) {
+    if (!journal_mounted) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(journal_mutex, portMAX_DELAY);
+    uint32_t next = (active_sector + 1) % journal_sector_count;
+    bool needed = !preparing && prepared_sector != (int32_t)next &&
+                  flash_slot + pending_count >= journal_prepare_slots;
+    if (needed) {
+        // Le plus ancien secteur sort de l'index avant l'effacement
+        sector_sequence[next] = 0;
+        preparing = true;
+    }
+    xSemaphoreGive(journal_mutex);
+
+    if (!needed) {
+        return ESP_OK;
+    }
+
+    // Effacement hors verrou: les ajouts continuent pendant ce temps
+    esp_err_t ret = journal_erase_sector(next);
+
+    xSemaphoreTake(journal_mutex, portMAX_DELAY);
+    preparing = false;
+    if (ret == ESP_OK) {
+        sector_erase_count[next]++;
+        prepared_sector = (int32_t)next;
+        journal_stats.sectors_prepared++;
+    } else {
+        journal_stats.write_errors++;
+    }
+    xSemaphoreGive(journal_mutex);
+
+    return ret;
+}
+
+/**
+ * @brief Efface tout le journal
+ */
+esp_err_t incident_journal_erase(void) {
+    if (!journal_mounted) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(journal_mutex, portMAX_DELAY);
+    if (preparing) {
+        xSemaphoreGive(journal_mutex);
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    pending_count = 0;
+    prepared_sector = -1;
+    esp_err_t ret = ESP_OK;
+    for (uint32_t i = 0; i < journal_sector_count && ret == ESP_OK; i++) {
+        // Les secteurs restent vierges jusqu'à leur réutilisation par l'anneau
+        if (i == 0) {
+            ret = journal_format_sector(0, 1);
+            continue;
+        }
+        sector_sequence[i] = 0;
+        ret = journal_erase_sector(i);
+        if (ret == ESP_OK) {
+            sector_erase_count[i]++;
+        } else {
+            journal_stats.write_errors++;
+        }
+    }
+    active_sector = 0;
+    flash_slot = 0;
+    if (ret == ESP_OK) {
+        prepared_sector = 1;    // Déjà vierge
+    }
+
+    xSemaphoreGive(journal_mutex);
+
+    ESP_LOGI(TAG, "🗑️ Journal d'incidents effacé");
+    return ret;
+}
+
+/**
+ * @brief Lit les N derniers incidents, du plus récent au plus ancien
+ */
+esp_err_t incident_journal_get_last(incident_journal_record_t *records, size_t max_records,
+                                    size_t *count) {
+    if (records == NULL || count == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    *count = 0;
+    if (!journal_mounted) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(journal_mutex, portMAX_DELAY);
+    *count = journal_collect_locked(records, max_records);
+    xSemaphoreGive(journal_mutex);
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Obtient les statistiques du journal
+ */
+esp_err_t incident_journal_get_stats(incident_journal_stats_t *stats) {
+    if (stats == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    memset(stats, 0, sizeof(incident_journal_stats_t));
+    if (!journal_mounted) {
+        return ESP_OK;
+    }
+
+    xSemaphoreTake(journal_mutex, portMAX_DELAY);
+
+    *stats = journal_stats;
+    stats->mounted = true;
+    stats->sector_count = journal_sector_count;
+    stats->records_per_sector = journal_slots_per_sector;
+    stats->capacity_records = journal_sector_count * journal_slots_per_sector;
+    stats->records_pending = pending_count;
+    stats->next_seq = next_seq;
+    stats->boot_id = current_boot_id;
+
+    stats->min_erase_count = UINT32_MAX;
+    for (uint32_t i = 0; i < journal_sector_count; i++) {
+        if (sector_erase_count[i] < stats->min_erase_count) {
+            stats->min_erase_count = sector_erase_count[i];
+        }
+        if (sector_erase_count[i] > stats->max_erase_count) {
+            stats->max_erase_count = sector_erase_count[i];
+        }
+    }
+
+    xSemaphoreGive(journal_mutex);
+    return ESP_OK;
+}
+
+/**
+ * @brief Affiche les statistiques du journal
+ */
+void incident_journal_print_stats(void) {
+    incident_journal_stats_t stats;
+    incident_journal_get_stats(&stats);
+
+    if (!stats.mounted) {
+        ESP_LOGW(TAG, "Journal d'incidents non monté");
+        return;
+    }
+
+    ESP_LOGI(TAG, "📒 === Journal d'incidents Community ===");
+    ESP_LOGI(TAG, "Capacité: %lu enregistrements (%lu secteurs)",
+             stats.capacity_records, stats.sector_count);
+    ESP_LOGI(TAG, "Ajoutés: %lu, en attente: %lu, perdus: %lu",
+             stats.records_appended, stats.records_pending, stats.records_dropped);
+    ESP_LOGI(TAG, "Écritures flash: %lu (%lu octets), dernière %lu µs, max %lu µs",
+             stats.flushes, stats.bytes_written, stats.last_flush_us, stats.max_flush_us);
+    ESP_LOGI(TAG, "Rotations: %lu (%lu pré-effacement(s), %lu effacement(s) à l'ajout), "
+             "usure secteurs: %lu-%lu effacements",
+             stats.sector_rotations, stats.sectors_prepared, stats.inline_erases,
+             stats.min_erase_count, stats.max_erase_count);
+    ESP_LOGI(TAG, "Erreurs: %lu, prochain incident #%lu, démarrage #%u",
+             stats.write_errors, stats.next_seq, stats.boot_id);
+    ESP_LOGI(TAG, "========================================");
+}
\ No newline at end of file
@@ -15,7 +15,10 @@
 #include "esp_log.h"
 #include "esp_err.h"
 #include "esp_system.h"
+#include "esp_timer.h"
+#include "sdkconfig.h"
 #include "incident_manager.h"
+#include "incident_journal.h"
 
 static const char *TAG = "INCIDENT_COMMUNITY";
 
@@ -23,6 +26,58 @@ static const char *TAG = "INCIDENT_COMMUNITY";
 static bool incident_manager_initialized = false;
 static incident_stats_t incident_stats = {0};
 
+/**
+ * @brief Incident ouvert dans la fenêtre de déduplication
+ */
+typedef struct {
+    bool active;                    // Emplacement utilisé
+    uint8_t type;                   // security_event_type_t
+    uint8_t source;                 // Source de l'événement
+    uint32_t count;                 // Occurrences (première incluse)
+    uint32_t first_ms;              // Première occurrence
+    uint32_t last_ms;               // Dernière occurrence
+    security_event_t last_event;    // Dernière occurrence (sévérité maximale)
+} incident_open_t;
+
+/**
+ * @brief Limitation de débit et escalade d'un type d'événement
+ */
+typedef struct {
+    uint32_t tokens_milli;          // Jetons disponibles (x1000)
+    uint32_t last_refill_ms;        // Dernière recharge du seau
+    uint32_t window_start_ms;       // Début de la fenêtre d'escalade
+    uint32_t window_count;          // Événements bruts dans la fenêtre
+    uint32_t limited_pending;       // Événements limités depuis le dernier résumé
+    bool escalated;                 // Sévérité relevée en cours
+} incident_rate_t;
+
+#define INCIDENT_TOKEN_MILLI            (1000)
+#define INCIDENT_BUCKET_CAPACITY_MILLI  ((uint32_t)INCIDENT_RATE_BURST * INCIDENT_TOKEN_MILLI)
+
+static incident_open_t open_incidents[INCIDENT_DEDUP_SLOTS];
+static incident_rate_t type_rates[SECURITY_EVENT_MAX];
+
+static inline uint32_t incident_now_ms(void) {
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+static void incident_record(const void *event_data, uint16_t repeat_count);
+
+/**
+ * @brief Remet le pipeline à zéro (seaux pleins, aucun incident ouvert)
+ */
+static void incident_pipeline_reset(void) {
+    uint32_t now_ms = incident_now_ms();
+    
+    memset(open_incidents, 0, sizeof(open_incidents));
+    memset(type_rates, 0, sizeof(type_rates));
+    for (size_t i = 0; i < SECURITY_EVENT_MAX; i++) {
+        type_rates[i].tokens_milli = INCIDENT_BUCKET_CAPACITY_MILLI;
+        type_rates[i].last_refill_ms = now_ms;
+        type_rates[i].window_start_ms = now_ms;
+    }
+}
+
 /**
  * @brief Initialise le gestionnaire d'incidents Community
  */
@@ -38,6 +93,13 @@ esp_err_t incident_manager_init(void) {
     // Réinitialiser les statistiques
     memset(&incident_stats, 0, sizeof(incident_stats));
     incident_stats.init_time = esp_timer_get_time() / 1000;
+    incident_pipeline_reset();
+    
+    // Journal persistant: optionnel, les compteurs RAM restent disponibles sans lui
+    esp_err_t ret = incident_journal_init();
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "⚠️ Journal d'incidents indisponible: %s", esp_err_to_name(ret));
+    }
     
     incident_manager_initialized = true;
     ESP_LOGI(TAG, "✅ Gestionnaire d'incidents Community initialisé");
@@ -45,6 +107,226 @@ esp_err_t incident_manager_init(void) {
     return ESP_OK;
 }
 
+/**
+ * @brief Deinitialise le gestionnaire d'incidents
+ */
+esp_err_t incident_manager_deinit(void) {
+    if (!incident_manager_initialized) {
+        return ESP_OK;
+    }
+    
+    // Ne pas perdre les incidents encore en RAM
+    incident_journal_deinit();
+    
+    incident_manager_initialized = false;
+    ESP_LOGI(TAG, "Gestionnaire d'incidents désactivé");
+    
+    return ESP_OK;
+}
+
+/**
+ * @brief Persiste un incident dans le journal flash (si disponible)
+ */
+static void incident_record(const void *event_data, uint16_t repeat_count) {
+    if (event_data == NULL) {
+        return;
+    }
+    
+    esp_err_t ret = incident_journal_append((const security_event_t *)event_data, repeat_count);
+    if (ret != ESP_OK && ret != ESP_ERR_INVALID_STATE) {
+        ESP_LOGW(TAG, "⚠️ Incident non journalisé: %s", esp_err_to_name(ret));
+    }
+}
+
+// ================================
+// Pipeline de déduplication et de limitation
+// ================================
+
+/**
+ * @brief Clôture un incident ouvert
+ * 
+ * La première occurrence a déjà été journalisée par son gestionnaire:
+ * seules les répétitions donnent lieu à un enregistrement de synthèse.
+ */
+static void incident_close(incident_open_t *slot) {
+    if (slot->count > 1) {
+        ESP_LOGI(TAG, "🔁 Incident clos: %s (source %u), %lu occurrences en %lu ms",
+                 security_event_type_to_string(slot->type), slot->source,
+                 slot->count, slot->last_ms - slot->first_ms);
+        incident_record(&slot->last_event,
+                        slot->count > UINT16_MAX ? UINT16_MAX : (uint16_t)slot->count);
+    }
+    
+    slot->active = false;
+    incident_stats.incidents_closed++;
+}
+
+/**
+ * @brief Met à jour le débit brut d'un type et l'état d'escalade
+ */
+static void incident_update_escalation(incident_rate_t *rate, uint8_t type, uint32_t now_ms) {
+    if (now_ms - rate->window_start_ms >= INCIDENT_ESCALATION_WINDOW_MS) {
+        if (rate->escalated && rate->window_count <= INCIDENT_ESCALATION_THRESHOLD) {
+            rate->escalated = false;
+            ESP_LOGI(TAG, "📉 Fin d'escalade: %s (%lu événements sur la fenêtre)",
+                     security_event_type_to_string(type), rate->window_count);
+        }
+        rate->window_start_ms = now_ms;
+        rate->window_count = 0;
+    }
+    
+    rate->window_count++;
+    if (!rate->escalated && rate->window_count > INCIDENT_ESCALATION_THRESHOLD) {
+        rate->escalated = true;
+        incident_stats.escalations++;
+        ESP_LOGW(TAG, "📈 Escalade: %s dépasse %d événements en %d ms - sévérité relevée",
+                 security_event_type_to_string(type), INCIDENT_ESCALATION_THRESHOLD,
+                 INCIDENT_ESCALATION_WINDOW_MS);
+    }
+}
+
+/**
+ * @brief Consomme un jeton du seau d'un type (recharge incluse)
+ * 
+ * L'horloge du seau n'avance que du temps converti en milli-jetons: des
+ * appels rapprochés (rafale limitée) ne perdent pas la recharge fractionnaire.
+ */
+static bool incident_take_token(incident_rate_t *rate, uint32_t now_ms) {
+    uint32_t elapsed_ms = now_ms - rate->last_refill_ms;
+    uint64_t refill = (uint64_t)elapsed_ms * INCIDENT_RATE_PER_MINUTE * INCIDENT_TOKEN_MILLI / 60000;
+    uint64_t tokens = rate->tokens_milli + refill;
+    
+    if (tokens >= INCIDENT_BUCKET_CAPACITY_MILLI) {
+        rate->tokens_milli = INCIDENT_BUCKET_CAPACITY_MILLI;
+        rate->last_refill_ms = now_ms;
+    } else {
+        rate->tokens_milli = (uint32_t)tokens;
+        rate->last_refill_ms += (uint32_t)(refill * 60000 /
+                                           ((uint64_t)INCIDENT_RATE_PER_MINUTE * INCIDENT_TOKEN_MILLI));
+    }
+    
+    if (rate->tokens_milli < INCIDENT_TOKEN_MILLI) {
+        return false;
+    }
+    
+    rate->tokens_milli -= INCIDENT_TOKEN_MILLI;
+    return true;
+}
+
+/**
+ * @brief Admet un événement dans le pipeline d'incidents
+ */
+incident_decision_t incident_admit(security_event_t *event) {
+    if (!incident_manager_initialized || event == NULL) {
+        return INCIDENT_DECISION_NEW;
+    }
+    
+    uint32_t now_ms = incident_now_ms();
+    uint8_t type = (event->type < SECURITY_EVENT_MAX) ? event->type : SECURITY_EVENT_NONE;
+    incident_rate_t *rate = &type_rates[type];
+    
+    incident_stats.events_submitted++;
+    
+    incident_update_escalation(rate, type, now_ms);
+    if (rate->escalated && event->severity < SECURITY_SEVERITY_CRITICAL) {
+        event->severity++;
+    }
+    
+    // Répétition d'un incident ouvert: simple mise à jour de compteur
+    incident_open_t *free_slot = NULL;
+    incident_open_t *oldest = NULL;
+    for (size_t i = 0; i < INCIDENT_DEDUP_SLOTS; i++) {
+        incident_open_t *slot = &open_incidents[i];
+        
+        if (slot->active && now_ms - slot->last_ms >= INCIDENT_DEDUP_WINDOW_MS) {
+            incident_close(slot);
+        }
+        
+        if (!slot->active) {
+            if (free_slot == NULL) {
+                free_slot = slot;
+            }
+            continue;
+        }
+        
+        if (slot->type == event->type && slot->source == event->source) {
+            uint8_t severity = slot->last_event.severity > event->severity ?
+                               slot->last_event.severity : event->severity;
+            slot->count++;
+            slot->last_ms = now_ms;
+            slot->last_event = *event;
+            slot->last_event.severity = severity;
+            incident_stats.events_coalesced++;
+            return INCIDENT_DECISION_COALESCED;
+        }
+        
+        if (oldest == NULL || now_ms - slot->last_ms > now_ms - oldest->last_ms) {
+            oldest = slot;
+        }
+    }
+    
+    // Nouvel incident: soumis au seau à jetons de son type
+    if (!incident_take_token(rate, now_ms)) {
+        rate->limited_pending++;
+        incident_stats.events_rate_limited++;
+        return INCIDENT_DECISION_RATE_LIMITED;
+    }
+    
+    incident_open_t *slot = (free_slot != NULL) ? free_slot : oldest;
+    if (slot->active) {
+        incident_close(slot);
+    }
+    
+    slot->active = true;
+    slot->type = event->type;
+    slot->source = event->source;
+    slot->count = 1;
+    slot->first_ms = now_ms;
+    slot->last_ms = now_ms;
+    slot->last_event = *event;
+    
+    return INCIDENT_DECISION_NEW;
+}
+
+/**
+ * @brief Maintenance périodique du pipeline
+ */
+void incident_manager_tick(void) {
+    if (!incident_manager_initialized) {
+        return;
+    }
+    
+    uint32_t now_ms = incident_now_ms();
+    
+    for (size_t i = 0; i < INCIDENT_DEDUP_SLOTS; i++) {
+        if (open_incidents[i].active &&
+            now_ms - open_incidents[i].last_ms >= INCIDENT_DEDUP_WINDOW_MS) {
+            incident_close(&open_incidents[i]);
+        }
+    }
+    
+    // Un seul résumé par type et par passage, quel que soit le volume limité
+    for (size_t i = 0; i < SECURITY_EVENT_MAX; i++) {
+        if (type_rates[i].limited_pending > 0) {
+            ESP_LOGW(TAG, "🚦 %lu événements '%s' limités (> %d nouveaux incidents/min)",
+                     type_rates[i].limited_pending,
+                     security_event_type_to_string((security_event_type_t)i),
+                     INCIDENT_RATE_PER_MINUTE);
+            type_rates[i].limited_pending = 0;
+        }
+    }
+    
+    // Secteur suivant effacé ici, hors du chemin d'ajout
+    esp_err_t prepare_ret = incident_journal_maintain();
+    esp_err_t ret = incident_journal_flush();
+    if (ret == ESP_OK) {
+        ret = prepare_ret;
+    }
+    if (ret != ESP_OK && ret != ESP_ERR_INVALID_STATE) {
+        ESP_LOGW(TAG, "📒 Échec écriture journal d'incidents: %s", esp_err_to_name(ret));
+    }
+}
+
 /**
  * @brief Gestion d'un échec de vérification d'intégrité
  */
@@ -58,6 +340,7 @@ esp_err_t incident_handle_integrity_failure(const void *event_data) {
     incident_stats.integrity_failures++;
     incident_stats.total_incidents++;
     incident_stats.last_incident_time = esp_timer_get_time() / 1000;
+    incident_record(event_data, 1);
     
     // Actions Community (simplifiées)
     ESP_LOGI(TAG, "📋 Actions Community:");
@@ -85,6 +368,7 @@ esp_err_t incident_handle_anomaly(const void *event_data) {
     incident_stats.anomalies_handled++;
     incident_stats.total_incidents++;
     incident_stats.last_incident_time = esp_timer_get_time() / 1000;
+    incident_record(event_data, 1);
     
     // Actions Community pour anomalies
     ESP_LOGI(TAG, "📋 Actions anomalie Community:");
@@ -99,16 +383,19 @@ esp_err_t incident_handle_anomaly(const void *event_data) {
 }
 
 /**
- * @brief Gestion d'un échec d'attestation (pas disponible en Community)
+ * @brief Gestion d'un échec d'attestation (rapport non signé)
  */
 esp_err_t incident_handle_attestation_failure(const void *event_data) {
     if (!incident_manager_initialized) {
         return ESP_ERR_INVALID_STATE;
     }
     
-    ESP_LOGW(TAG, "🟠 INCIDENT: Échec attestation (non supporté en Community)");
-    ESP_LOGI(TAG, "💡 L'attestation continue est disponible en Enterprise Edition");
-    ESP_LOGI(TAG, "🎓 Community Edition: apprentissage des concepts de base");
+    ESP_LOGW(TAG, "🟠 INCIDENT: Échec signature attestation, aucune réponse aux défis non couverts par le cache");
+    
+    incident_stats.other_incidents++;
+    incident_stats.total_incidents++;
+    incident_stats.last_incident_time = esp_timer_get_time() / 1000;
+    incident_record(event_data, 1);
     
     return ESP_OK;
 }
@@ -126,6 +413,7 @@ esp_err_t incident_handle_unauthorized_access(const void *event_data) {
     incident_stats.security_violations++;
     incident_stats.total_incidents++;
     incident_stats.last_incident_time = esp_timer_get_time() / 1000;
+    incident_record(event_data, 1);
     
     // Actions Community (éducatives)
     ESP_LOGI(TAG, "📋 Actions sécurité Community:");
@@ -170,6 +458,10 @@ void incident_print_stats(void) {
     ESP_LOGI(TAG, "Anomalies gérées: %d", incident_stats.anomalies_handled);
     ESP_LOGI(TAG, "Violations sécurité: %d", incident_stats.security_violations);
     ESP_LOGI(TAG, "Autres incidents: %d", incident_stats.other_incidents);
+    ESP_LOGI(TAG, "Pipeline: %lu soumis, %lu fusionnés, %lu limités, %lu clos, %lu escalades",
+             incident_stats.events_submitted, incident_stats.events_coalesced,
+             incident_stats.events_rate_limited, incident_stats.incidents_closed,
+             incident_stats.escalations);
     
     if (incident_stats.total_incidents > 0) {
         uint64_t last_incident_ago = (esp_timer_get_time() / 1000) - incident_stats.last_incident_time;
@@ -182,6 +474,8 @@ void incident_print_stats(void) {
     ESP_LOGI(TAG, "Temps de surveillance: %lld ms", uptime);
     
     ESP_LOGI(TAG, "========================================");
+    
+    incident_journal_print_stats();
 }
 
 /**
@@ -199,6 +493,7 @@ esp_err_t incident_reset_stats(void) {
     return ESP_OK;
 }
 
+#if CONFIG_APP_SELF_TESTS
 /**
  * @brief Test de fonctionnement du gestionnaire Community
  */
@@ -228,6 +523,19 @@ esp_err_t incident_manager_self_test(void) {
         return ret;
     }
     
+    // Test du pipeline: les répétitions d'une même source sont fusionnées
+    ESP_LOGI(TAG, "🧪 Test déduplication...");
+    security_event_t test_event;
+    security_event_init(&test_event, SECURITY_EVENT_SENSOR_MALFUNCTION,
+                        SECURITY_SEVERITY_LOW, SECURITY_EVENT_SOURCE_NONE);
+    if (incident_admit(&test_event) != INCIDENT_DECISION_NEW ||
+        incident_admit(&test_event) != INCIDENT_DECISION_COALESCED) {
+        ESP_LOGE(TAG, "❌ Échec déduplication");
+        incident_pipeline_reset();
+        return ESP_FAIL;
+    }
+    incident_pipeline_reset();
+    
     // Test des statistiques
     incident_stats_t stats;
     ret = incident_get_stats(&stats);
@@ -247,7 +555,9 @@ esp_err_t incident_manager_self_test(void) {
     
     return ESP_OK;
 }
+#endif /* CONFIG_APP_SELF_TESTS */
 
+#if CONFIG_APP_BANNERS
 /**
  * @brief Affiche les informations du gestionnaire Community
  */
@@ -260,11 +570,12 @@ void incident_manager_print_info(void) {
     ESP_LOGI(TAG, "  ✅ Gestion anomalies capteurs");
     ESP_LOGI(TAG, "  ✅ Logging et statistiques");
     ESP_LOGI(TAG, "  ✅ Notifications console");
+    ESP_LOGI(TAG, "  ✅ Déduplication, limitation de débit et escalade de sévérité");
     ESP_LOGI(TAG, "Limitations Community:");
     ESP_LOGI(TAG, "  ❌ Pas d'actions automatiques");
     ESP_LOGI(TAG, "  ❌ Pas de redémarrage auto");
-    ESP_LOGI(TAG, "  ❌ Pas d'escalade d'incidents");
     ESP_LOGI(TAG, "  ❌ Pas de notifications externes");
     ESP_LOGI(TAG, "🎓 Version éducative pour comprendre la gestion!");
     ESP_LOGI(TAG, "============================================");
-}
\ No newline at end of file
+}
+#endif /* CONFIG_APP_BANNERS */
\ No newline at end of file
@@ -22,12 +22,35 @@ extern "C" {
 #include <stdbool.h>
 #include "esp_err.h"
 #include "sensor_manager.h"
+#include "windowed_stats.h"
 
 // ================================
 // Constantes Community
 // ================================
 
 #define ANOMALY_HISTORY_SIZE_COMMUNITY      (30)        // Réduit vs Enterprise
+#define ANOMALY_MAX_SENSORS_COMMUNITY       (SENSOR_MAX_INSTANCES)  // Historique par capteur
+#define ANOMALY_EWMA_ALPHA_COMMUNITY        (0.1f)
+
+// Mode statistique (z-score glissant, EWMA, CUSUM)
+// σ estimé sur 30 échantillons et bruit DHT22 corrélé: seuils larges pour
+// ne pas signaler une trace saine (host_sim --anomaly-rate 0: 0 anomalie)
+#define ANOMALY_STAT_Z_THRESHOLD_COMMUNITY      (6.0f)  // |x - μ| / σ
+#define ANOMALY_STAT_EWMA_K_COMMUNITY           (6.0f)  // |x - EWMA| / σ_ewma
+#define ANOMALY_STAT_CUSUM_K_COMMUNITY          (1.0f)  // Tolérance CUSUM (en σ)
+#define ANOMALY_STAT_CUSUM_H_COMMUNITY          (8.0f)  // Seuil de décision CUSUM (en σ)
+#define ANOMALY_STAT_WARMUP_COMMUNITY           (10)    // Échantillons avant scoring
+#define ANOMALY_STAT_MIN_STDDEV_COMMUNITY       (0.1f)  // Résolution DHT22
+
+// Sauvegarde de l'état (mémoire RTC entre deux sommeils profonds)
+#define ANOMALY_SNAPSHOT_SENSORS_COMMUNITY      (2)     // Capteurs conservés
+#define ANOMALY_SNAPSHOT_MAGIC                  (0x414E5331)  // "ANS1"
+
+// Drapeaux par échantillon de anomaly_detect_batch()
+#define ANOMALY_FLAG_TEMPERATURE            (1U << 0)   // Température hors seuils
+#define ANOMALY_FLAG_HUMIDITY               (1U << 1)   // Humidité hors seuils
+#define ANOMALY_FLAG_TEMP_CHANGE            (1U << 2)   // Saut de température
+#define ANOMALY_FLAG_HUMIDITY_CHANGE        (1U << 3)   // Saut d'humidité
 #define ANOMALY_DETECTION_WINDOW_COMMUNITY  (5)         // Réduit vs Enterprise
 #define ANOMALY_SCORE_THRESHOLD_COMMUNITY   (0.3f)      // Plus tolérant
 
@@ -47,6 +70,26 @@ typedef enum {
     ANOMALY_MAX
 } anomaly_error_t;
 
+/**
+ * @brief Modes de détection disponibles
+ */
+typedef enum {
+    ANOMALY_MODE_THRESHOLD = 0,     // Seuils fixes + écart à l'échantillon précédent
+    ANOMALY_MODE_STATISTICAL,       // Seuils absolus + z-score / EWMA / CUSUM glissants
+    ANOMALY_MODE_MAX
+} anomaly_detection_mode_t;
+
+/**
+ * @brief Paramètres du mode statistique (exprimés en écarts-types)
+ */
+typedef struct {
+    float z_threshold;              // Seuil z-score sur la fenêtre
+    float ewma_k;                   // Seuil résidu EWMA
+    float cusum_k;                  // Dérive tolérée par échantillon
+    float cusum_h;                  // Seuil de décision CUSUM
+    uint16_t warmup_samples;        // Échantillons avant activation
+} anomaly_statistical_params_t;
+
 /**
  * @brief Structure des seuils de détection Community
  */
@@ -73,7 +116,15 @@ typedef struct {
     // Détails des anomalies (Community)
     bool temp_anomaly;              // Anomalie température ?
     bool humidity_anomaly;          // Anomalie humidité ?
-    bool change_anomaly;            // Changement rapide ?
+    bool change_anomaly;            // Changement rapide / écart statistique ?
+    bool temp_change_anomaly;       // ... sur la température ?
+    bool humidity_change_anomaly;   // ... sur l'humidité ?
+    
+    // Scoring
+    anomaly_detection_mode_t mode;  // Mode ayant produit le résultat
+    float z_score;                  // Plus grand |z| (mode statistique)
+    float cusum_score;              // Plus grand cumul CUSUM en σ (mode statistique)
+    uint32_t scoring_latency_us;    // Durée du scoring de cet échantillon
 } anomaly_result_t;
 
 /**
@@ -85,8 +136,50 @@ typedef struct {
     uint32_t anomalies_detected;    // Anomalies détectées
     uint64_t last_anomaly_time;     // Dernière anomalie (timestamp)
     uint64_t init_time;             // Timestamp d'initialisation
+    
+    // Latence de scoring par échantillon
+    uint32_t last_latency_us;
+    uint32_t max_latency_us;
+    uint64_t total_latency_us;
+    
+    // Scoring par lots
+    uint32_t batch_calls;           // Appels à anomaly_detect_batch()
+    uint64_t batch_samples;         // Échantillons scorés par lots
+    uint64_t batch_anomalies;       // Échantillons signalés par lots
 } anomaly_stats_community_t;
 
+/**
+ * @brief Sauvegarde d'une grandeur d'un capteur (fenêtre + CUSUM)
+ */
+typedef struct {
+    float values[ANOMALY_HISTORY_SIZE_COMMUNITY];   // Du plus ancien au plus récent
+    windowed_stats_state_t state;
+    float cusum_pos;
+    float cusum_neg;
+} anomaly_column_snapshot_t;
+
+/**
+ * @brief Sauvegarde de l'historique d'un capteur
+ */
+typedef struct {
+    uint8_t sensor_id;
+    anomaly_column_snapshot_t temperature;
+    anomaly_column_snapshot_t humidity;
+} anomaly_sensor_snapshot_t;
+
+/**
+ * @brief Sauvegarde complète du détecteur, de taille fixe et sans pointeurs
+ */
+typedef struct {
+    uint32_t magic;                                 // ANOMALY_SNAPSHOT_MAGIC si valide
+    anomaly_detection_mode_t mode;
+    anomaly_thresholds_t thresholds;
+    anomaly_statistical_params_t stat_params;
+    anomaly_stats_community_t stats;
+    uint8_t sensor_count;
+    anomaly_sensor_snapshot_t sensors[ANOMALY_SNAPSHOT_SENSORS_COMMUNITY];
+} anomaly_snapshot_t;
+
 // ================================
 // Fonctions d'initialisation
 // ================================
@@ -124,6 +217,69 @@ esp_err_t anomaly_detector_basic_deinit(void);
  */
 anomaly_result_t anomaly_detect_threshold_based(const sensor_data_t *data);
 
+/**
+ * @brief Détection statistique glissante
+ * 
+ * Seuils absolus conservés, puis pour chaque grandeur:
+ * - z-score sur la fenêtre d'historique du capteur
+ * - résidu par rapport à l'EWMA
+ * - CUSUM bilatéral sur l'écart normalisé (dérives lentes)
+ * Coût O(1) par échantillon, indépendant de la taille de fenêtre.
+ * 
+ * @param data Données capteur à analyser
+ * @return anomaly_result_t Résultat de l'analyse
+ */
+anomaly_result_t anomaly_detect_statistical(const sensor_data_t *data);
+
+/**
+ * @brief Scoring par lots en seuils fixes sur des colonnes (SoA)
+ * 
+ * Même règle que anomaly_detect_threshold_based(): seuils absolus et saut
+ * par rapport à l'échantillon précédent du lot (aucun saut pour le
+ * premier). La boucle est sans branche pour être vectorisable. Aucun
+ * historique n'est modifié: adapté au rattrapage et à la ré-analyse.
+ * 
+ * @param temps Températures (n valeurs)
+ * @param hums Humidités (n valeurs)
+ * @param n Nombre d'échantillons
+ * @param flags Drapeaux ANOMALY_FLAG_* par échantillon (sortie, 0 = normal)
+ * @param scores Score 0.0-1.0 par échantillon (sortie)
+ * @return ESP_OK si succès, ESP_ERR_INVALID_ARG / ESP_ERR_INVALID_STATE sinon
+ */
+esp_err_t anomaly_detect_batch(const float *temps, const float *hums, size_t n,
+                               uint8_t *flags, float *scores);
+
+/**
+ * @brief Détection selon le mode actif
+ * 
+ * @param data Données capteur à analyser
+ * @return anomaly_result_t Résultat de l'analyse
+ */
+anomaly_result_t anomaly_detect(const sensor_data_t *data);
+
+/**
+ * @brief Sélectionne le mode de détection utilisé par anomaly_detect()
+ * 
+ * @param mode Mode de détection
+ * @return ESP_OK si succès, ESP_ERR_INVALID_ARG si mode inconnu
+ */
+esp_err_t anomaly_set_detection_mode(anomaly_detection_mode_t mode);
+
+/**
+ * @brief Obtient le mode de détection actif
+ * 
+ * @return Mode actif
+ */
+anomaly_detection_mode_t anomaly_get_detection_mode(void);
+
+/**
+ * @brief Nom lisible d'un mode de détection
+ * 
+ * @param mode Mode de détection
+ * @return Chaîne décrivant le mode
+ */
+const char* anomaly_mode_to_string(anomaly_detection_mode_t mode);
+
 // ================================
 // Fonctions de configuration Community
 // ================================
@@ -146,6 +302,22 @@ esp_err_t anomaly_set_thresholds_community(const anomaly_thresholds_t *threshold
  */
 esp_err_t anomaly_get_thresholds_community(anomaly_thresholds_t *thresholds);
 
+/**
+ * @brief Configure les paramètres du mode statistique
+ * 
+ * @param params Nouveaux paramètres
+ * @return ESP_OK si succès, ESP_ERR_INVALID_ARG si paramètres invalides
+ */
+esp_err_t anomaly_set_statistical_params(const anomaly_statistical_params_t *params);
+
+/**
+ * @brief Obtient les paramètres du mode statistique
+ * 
+ * @param params Pointeur vers la structure de paramètres
+ * @return ESP_OK si succès, ESP_ERR_INVALID_ARG sinon
+ */
+esp_err_t anomaly_get_statistical_params(anomaly_statistical_params_t *params);
+
 // ================================
 // Fonctions de statistiques Community
 // ================================
@@ -158,6 +330,38 @@ esp_err_t anomaly_get_thresholds_community(anomaly_thresholds_t *thresholds);
  */
 esp_err_t anomaly_get_stats_community(anomaly_stats_community_t *stats);
 
+/**
+ * @brief Obtient les statistiques glissantes de l'historique d'un capteur
+ * 
+ * @param sensor_id Identifiant du capteur (sensor_data_t.sensor_id)
+ * @param temperature Statistiques température (sortie, peut être NULL)
+ * @param humidity Statistiques humidité (sortie, peut être NULL)
+ * @return ESP_OK si succès, ESP_ERR_NOT_FOUND si identifiant hors plage
+ */
+esp_err_t anomaly_get_history_stats(uint8_t sensor_id,
+                                    windowed_stats_summary_t *temperature,
+                                    windowed_stats_summary_t *humidity);
+
+/**
+ * @brief Sauvegarde l'état du détecteur (historiques, mode, seuils, statistiques)
+ * 
+ * Seuls les ANOMALY_SNAPSHOT_SENSORS_COMMUNITY premiers capteurs ayant un
+ * historique sont conservés.
+ * 
+ * @param snapshot Sauvegarde (sortie)
+ * @return ESP_OK, ESP_ERR_INVALID_SIZE si des capteurs ont été ignorés
+ */
+esp_err_t anomaly_detector_save_state(anomaly_snapshot_t *snapshot);
+
+/**
+ * @brief Restaure l'état du détecteur depuis une sauvegarde
+ * 
+ * @param snapshot Sauvegarde produite par anomaly_detector_save_state()
+ * @return ESP_OK, ESP_ERR_INVALID_STATE si non initialisé,
+ *         ESP_ERR_INVALID_CRC si la sauvegarde n'est pas valide
+ */
+esp_err_t anomaly_detector_restore_state(const anomaly_snapshot_t *snapshot);
+
 /**
  * @brief Affiche les statistiques du détecteur Community
  */
@@ -177,12 +381,16 @@ esp_err_t anomaly_reset_stats_community(void);
 /**
  * @brief Test de fonctionnement du détecteur Community
  * 
+ * Compilée seulement avec CONFIG_APP_SELF_TESTS (profil de développement).
+ * 
  * @return ESP_OK si tous les tests passent, ESP_FAIL sinon
  */
 esp_err_t anomaly_detector_self_test(void);
 
 /**
  * @brief Affiche les informations du détecteur Community
+ * 
+ * Compilée seulement avec CONFIG_APP_BANNERS (profil de développement).
  */
 void anomaly_detector_print_info(void);
 
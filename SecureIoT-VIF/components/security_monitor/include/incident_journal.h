@@ -0,0 +1,184 @@
+/**
+ * @file incident_journal.h
+ * @brief Journal d'incidents persistant en flash (Community Edition)
+ *
+ * Journal en ajout seul sur une partition dédiée: enregistrements de
+ * taille fixe, tampon RAM vidé par pages flash entières, rotation
+ * circulaire des secteurs avec compteur d'effacements, et index RAM
+ * pour retrouver les N derniers incidents sans balayage. Le secteur
+ * suivant est effacé à l'avance par incident_journal_maintain(): les
+ * ajouts n'attendent pas un effacement flash.
+ *
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#ifndef INCIDENT_JOURNAL_H
+#define INCIDENT_JOURNAL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "security_event.h"
+
+// ================================
+// Constantes Community
+// ================================
+
+#define INCIDENT_JOURNAL_PARTITION_LABEL    "incidents"     // Voir partitions.csv
+#define INCIDENT_JOURNAL_PARTITION_SUBTYPE  (0x40)          // Sous-type data personnalisé
+#define INCIDENT_JOURNAL_MAGIC              (0x4E524A49)    // "IJRN"
+#define INCIDENT_JOURNAL_RECORD_SIZE        (32)            // Enregistrement et en-tête de secteur
+#define INCIDENT_JOURNAL_PAGE_SIZE          (256)           // Page d'écriture flash
+#define INCIDENT_JOURNAL_MAX_SECTORS        (16)            // Secteurs suivis par l'index
+#define INCIDENT_JOURNAL_SEQ_FREE           (0xFFFFFFFFUL)  // Emplacement jamais écrit
+#define INCIDENT_JOURNAL_PREPARE_PERCENT    (50)            // Remplissage déclenchant le pré-effacement
+
+// ================================
+// Types et structures Community
+// ================================
+
+/**
+ * @brief Enregistrement d'incident en flash (32 octets)
+ */
+typedef struct {
+    uint32_t seq;                   // Numéro d'incident global (croissant)
+    uint16_t boot_id;               // Démarrage ayant produit l'incident
+    uint16_t repeat_count;          // Occurrences fusionnées (1 = unique)
+    uint32_t uptime_ms;             // Uptime à l'enregistrement
+    security_event_t event;         // Événement d'origine (16 octets)
+    uint32_t crc;                   // CRC32 des 28 premiers octets
+} incident_journal_record_t;
+
+/**
+ * @brief Statistiques du journal d'incidents
+ */
+typedef struct {
+    bool mounted;                   // Partition trouvée et montée
+    uint32_t sector_count;          // Secteurs utilisés par le journal
+    uint32_t records_per_sector;    // Enregistrements par secteur
+    uint32_t capacity_records;      // Capacité totale (historique conservé)
+    uint32_t records_appended;      // Enregistrements ajoutés depuis le démarrage
+    uint32_t records_pending;       // Enregistrements encore en RAM
+    uint32_t records_dropped;       // Enregistrements perdus (flash en échec)
+    uint32_t flushes;               // Écritures flash effectuées
+    uint32_t bytes_written;         // Octets écrits en flash
+    uint32_t sector_rotations;      // Bascules vers le secteur suivant
+    uint32_t sectors_prepared;      // Secteurs pré-effacés par la maintenance
+    uint32_t inline_erases;         // Effacements sur le chemin d'ajout (maintenance en retard)
+    uint32_t write_errors;          // Échecs d'écriture ou d'effacement
+    uint32_t min_erase_count;       // Usure minimale d'un secteur
+    uint32_t max_erase_count;       // Usure maximale d'un secteur
+    uint32_t last_flush_us;         // Durée de la dernière écriture
+    uint32_t max_flush_us;          // Durée maximale d'une écriture (hors effacement)
+    uint32_t next_seq;              // Prochain numéro d'incident
+    uint16_t boot_id;               // Démarrage courant (suit le plus récent enregistrement ou en-tête)
+} incident_journal_stats_t;
+
+// ================================
+// Fonctions d'initialisation
+// ================================
+
+/**
+ * @brief Monte le journal sur la partition INCIDENT_JOURNAL_PARTITION_LABEL
+ *
+ * Relit les en-têtes de secteurs pour reconstruire l'index et formate
+ * la partition si elle ne contient aucun journal.
+ *
+ * @return ESP_OK si succès, ESP_ERR_NOT_FOUND si la partition est absente
+ */
+esp_err_t incident_journal_init(void);
+
+/**
+ * @brief Vide le tampon RAM et démonte le journal
+ *
+ * @return ESP_OK si succès
+ */
+esp_err_t incident_journal_deinit(void);
+
+// ================================
+// Fonctions d'écriture
+// ================================
+
+/**
+ * @brief Ajoute un incident au journal
+ *
+ * Copie en RAM uniquement; la flash n'est écrite que lorsqu'une page
+ * entière est complète ou lors d'un incident_journal_flush(). Secteur
+ * actif plein: bascule sur le secteur pré-effacé; s'il n'est pas prêt, les
+ * enregistrements attendent en RAM, et un effacement synchrone n'a lieu
+ * que si le tampon est plein (inline_erases).
+ *
+ * @param event Événement à journaliser
+ * @param repeat_count Occurrences représentées par cet enregistrement (1 = unique)
+ * @return ESP_OK si succès, ESP_ERR_INVALID_STATE si non monté
+ */
+esp_err_t incident_journal_append(const security_event_t *event, uint16_t repeat_count);
+
+/**
+ * @brief Écrit en flash les enregistrements encore en RAM
+ *
+ * @return ESP_OK si succès, code d'erreur flash sinon
+ */
+esp_err_t incident_journal_flush(void);
+
+/**
+ * @brief Pré-efface le secteur suivant de l'anneau (maintenance périodique)
+ *
+ * Sans effet tant que le secteur actif est rempli à moins de
+ * INCIDENT_JOURNAL_PREPARE_PERCENT. L'effacement se fait hors du verrou du
+ * journal; le plus ancien secteur quitte l'historique à ce moment-là.
+ *
+ * @return ESP_OK si succès, ESP_ERR_INVALID_STATE si non monté
+ */
+esp_err_t incident_journal_maintain(void);
+
+/**
+ * @brief Efface tout le journal
+ *
+ * @return ESP_OK si succès
+ */
+esp_err_t incident_journal_erase(void);
+
+// ================================
+// Fonctions de lecture
+// ================================
+
+/**
+ * @brief Lit les N derniers incidents, du plus récent au plus ancien
+ *
+ * Inclut les enregistrements encore en RAM. Les enregistrements
+ * corrompus (CRC invalide) sont ignorés.
+ *
+ * @param records Tableau de sortie
+ * @param max_records Taille du tableau
+ * @param count Nombre d'enregistrements lus (sortie)
+ * @return ESP_OK si succès
+ */
+esp_err_t incident_journal_get_last(incident_journal_record_t *records, size_t max_records,
+                                    size_t *count);
+
+/**
+ * @brief Obtient les statistiques du journal
+ *
+ * @param stats Pointeur vers la structure de statistiques
+ * @return ESP_OK si succès, ESP_ERR_INVALID_ARG sinon
+ */
+esp_err_t incident_journal_get_stats(incident_journal_stats_t *stats);
+
+/**
+ * @brief Affiche les statistiques du journal
+ */
+void incident_journal_print_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INCIDENT_JOURNAL_H */
\ No newline at end of file
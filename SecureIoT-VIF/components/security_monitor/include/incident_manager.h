@@ -20,11 +20,37 @@ extern "C" {
 #include <stdint.h>
 #include <stddef.h>
 #include "esp_err.h"
+#include "security_event.h"
+
+// ================================
+// Constantes Community
+// ================================
+
+// Déduplication: répétitions (type, source) fusionnées dans un incident ouvert
+#define INCIDENT_DEDUP_SLOTS                (8)         // Incidents ouverts simultanément
+#define INCIDENT_DEDUP_WINDOW_MS            (10000)     // Silence avant clôture d'un incident
+
+// Limitation de débit: seau à jetons par type d'événement
+#define INCIDENT_RATE_BURST                 (5)         // Nouveaux incidents en rafale
+#define INCIDENT_RATE_PER_MINUTE            (12)        // Recharge du seau
+
+// Escalade: débit brut d'un type au-delà duquel la sévérité est relevée
+#define INCIDENT_ESCALATION_WINDOW_MS       (60000)     // Fenêtre de mesure du débit
+#define INCIDENT_ESCALATION_THRESHOLD       (30)        // Événements par fenêtre
 
 // ================================
 // Types et structures Community
 // ================================
 
+/**
+ * @brief Décision du pipeline d'incidents pour un événement
+ */
+typedef enum {
+    INCIDENT_DECISION_NEW = 0,          // Nouvel incident: à traiter et journaliser
+    INCIDENT_DECISION_COALESCED,        // Répétition fusionnée dans un incident ouvert
+    INCIDENT_DECISION_RATE_LIMITED      // Rejeté par la limitation de débit
+} incident_decision_t;
+
 /**
  * @brief Statistiques des incidents Community
  */
@@ -36,6 +62,13 @@ typedef struct {
     uint32_t other_incidents;       // Autres incidents
     uint64_t last_incident_time;    // Dernier incident (timestamp)
     uint64_t init_time;             // Timestamp d'initialisation
+    
+    // Pipeline de déduplication et de limitation
+    uint32_t events_submitted;      // Événements présentés au pipeline
+    uint32_t events_coalesced;      // Répétitions fusionnées
+    uint32_t events_rate_limited;   // Événements rejetés par le seau à jetons
+    uint32_t incidents_closed;      // Incidents clôturés (fenêtre expirée)
+    uint32_t escalations;           // Passages en sévérité relevée
 } incident_stats_t;
 
 // ================================
@@ -58,6 +91,33 @@ esp_err_t incident_manager_init(void);
  */
 esp_err_t incident_manager_deinit(void);
 
+// ================================
+// Pipeline d'incidents Community
+// ================================
+
+/**
+ * @brief Admet un événement dans le pipeline d'incidents
+ * 
+ * Fusionne les répétitions (même type, même source) dans l'incident
+ * ouvert, applique la limitation de débit par type et relève la
+ * sévérité si le débit dépasse INCIDENT_ESCALATION_THRESHOLD. Coût
+ * constant: seul un événement INCIDENT_DECISION_NEW doit être loggé
+ * et transmis au gestionnaire de son type.
+ * 
+ * @param event Événement (sévérité éventuellement relevée en sortie)
+ * @return Décision du pipeline
+ */
+incident_decision_t incident_admit(security_event_t *event);
+
+/**
+ * @brief Maintenance périodique du pipeline
+ * 
+ * Clôture les incidents dont la fenêtre a expiré (un enregistrement
+ * de synthèse est journalisé s'il y a eu des répétitions), résume les
+ * événements limités et vide le journal.
+ */
+void incident_manager_tick(void);
+
 // ================================
 // Fonctions de gestion d'incidents Community
 // ================================
@@ -65,9 +125,9 @@ esp_err_t incident_manager_deinit(void);
 /**
  * @brief Gestion d'un échec de vérification d'intégrité
  * 
- * Version Community: logging et statistiques uniquement.
+ * Version Community: logging, statistiques et journal persistant.
  * 
- * @param event_data Données de l'événement (peut être NULL)
+ * @param event_data Événement security_event_t à journaliser (peut être NULL)
  * @return ESP_OK si traité, ESP_ERR_INVALID_STATE si non initialisé
  */
 esp_err_t incident_handle_integrity_failure(const void *event_data);
@@ -75,9 +135,9 @@ esp_err_t incident_handle_integrity_failure(const void *event_data);
 /**
  * @brief Gestion d'une anomalie détectée
  * 
- * Version Community: analyse basique et logging.
+ * Version Community: analyse basique, logging et journal persistant.
  * 
- * @param event_data Données de l'événement (peut être NULL)
+ * @param event_data Événement security_event_t à journaliser (peut être NULL)
  * @return ESP_OK si traité, ESP_ERR_INVALID_STATE si non initialisé
  */
 esp_err_t incident_handle_anomaly(const void *event_data);
@@ -85,19 +145,23 @@ esp_err_t incident_handle_anomaly(const void *event_data);
 /**
  * @brief Gestion d'un échec d'attestation
  * 
- * Note: L'attestation n'est pas disponible en Community Edition.
+ * Appelé par le dispatcher pour un SECURITY_EVENT_ATTESTATION_FAILURE
+ * admis par incident_admit(): un échec persistant est fusionné puis limité,
+ * pas journalisé à chaque maintenance. Tant que la signature échoue, seuls
+ * les défis déjà présents dans le rapport en cache (encore frais) reçoivent
+ * une réponse. Comptabilisé dans other_incidents.
  * 
- * @param event_data Données de l'événement (peut être NULL)
- * @return ESP_OK (information seulement)
+ * @param event_data Événement security_event_t à journaliser (peut être NULL)
+ * @return ESP_OK si traité, ESP_ERR_INVALID_STATE si non initialisé
  */
 esp_err_t incident_handle_attestation_failure(const void *event_data);
 
 /**
  * @brief Gestion d'un accès non autorisé
  * 
- * Version Community: logging et alerte console.
+ * Version Community: logging, alerte console et journal persistant.
  * 
- * @param event_data Données de l'événement (peut être NULL)
+ * @param event_data Événement security_event_t à journaliser (peut être NULL)
  * @return ESP_OK si traité, ESP_ERR_INVALID_STATE si non initialisé
  */
 esp_err_t incident_handle_unauthorized_access(const void *event_data);
@@ -133,12 +197,16 @@ esp_err_t incident_reset_stats(void);
 /**
  * @brief Test de fonctionnement du gestionnaire Community
  * 
+ * Compilée seulement avec CONFIG_APP_SELF_TESTS (profil de développement).
+ * 
  * @return ESP_OK si tous les tests passent, ESP_FAIL sinon
  */
 esp_err_t incident_manager_self_test(void);
 
 /**
  * @brief Affiche les informations du gestionnaire Community
+ * 
+ * Compilée seulement avec CONFIG_APP_BANNERS (profil de développement).
  */
 void incident_manager_print_info(void);
 
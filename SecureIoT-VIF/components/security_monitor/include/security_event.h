@@ -0,0 +1,163 @@
+/**
+ * @file security_event.h
+ * @brief Format binaire compact des événements de sécurité Community
+ *
+ * Enregistrement de 16 octets (type, sévérité, horodatage, charge utile
+ * typée) copié par valeur dans la queue du dispatcher. La description
+ * textuelle n'est construite qu'au moment du log ou de l'export.
+ *
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#ifndef SECURITY_EVENT_H
+#define SECURITY_EVENT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "app_config.h"
+#include "anomaly_detector.h"
+
+// ================================
+// Constantes Community
+// ================================
+
+#define SECURITY_EVENT_RECORD_SIZE          (16)    // Taille d'un enregistrement
+#define SECURITY_EVENT_DESC_MAX_LEN         (96)    // Tampon conseillé pour le formatage
+#define SECURITY_EVENT_SOURCE_NONE          (0xFF)  // Pas de source identifiée
+
+// ================================
+// Types et structures Community
+// ================================
+
+/**
+ * @brief Charge utile d'une anomalie capteur
+ */
+typedef struct {
+    float score;                    // Score d'anomalie 0.0-1.0
+    int16_t temperature_dc;         // Température analysée (0.1 °C)
+    uint16_t humidity_dc;           // Humidité analysée (0.1 %)
+} security_event_anomaly_t;
+
+/**
+ * @brief Charge utile d'un échec d'intégrité
+ */
+typedef struct {
+    uint32_t chunk_id;              // Chunk en échec
+    int32_t status;                 // Statut du vérificateur (integrity_status_t)
+} security_event_integrity_t;
+
+/**
+ * @brief Enregistrement d'événement de sécurité (16 octets)
+ *
+ * Le champ detail dépend du type: pour une anomalie, drapeaux
+ * ANOMALY_FLAG_* (bits 0-3) et mode de détection (bits 4-7).
+ */
+typedef struct {
+    uint8_t type;                   // security_event_type_t
+    uint8_t severity;               // security_severity_t
+    uint8_t source;                 // Capteur ou sous-système (SECURITY_EVENT_SOURCE_NONE)
+    uint8_t detail;                 // Détail spécifique au type
+    uint32_t timestamp_us;          // Émission (32 bits bas de esp_timer_get_time)
+    union {
+        security_event_anomaly_t anomaly;
+        security_event_integrity_t integrity;
+        uint32_t words[2];          // Charge brute pour les autres types
+    } payload;
+} security_event_t;
+
+// ================================
+// Fonctions de construction
+// ================================
+
+/**
+ * @brief Initialise un enregistrement vide et l'horodate
+ *
+ * @param event Enregistrement à remplir
+ * @param type Type d'événement
+ * @param severity Sévérité
+ * @param source Capteur ou sous-système à l'origine
+ */
+void security_event_init(security_event_t *event, security_event_type_t type,
+                         security_severity_t severity, uint8_t source);
+
+/**
+ * @brief Construit un événement d'anomalie à partir d'un résultat de détection
+ *
+ * Aucun formatage de chaîne: seules les valeurs utiles sont recopiées.
+ *
+ * @param event Enregistrement à remplir
+ * @param result Résultat du détecteur
+ * @param sensor_id Identifiant du capteur analysé
+ * @param severity Sévérité
+ */
+void security_event_from_anomaly(security_event_t *event, const anomaly_result_t *result,
+                                 uint8_t sensor_id, security_severity_t severity);
+
+/**
+ * @brief Construit un événement d'échec d'intégrité
+ *
+ * @param event Enregistrement à remplir
+ * @param status Statut du vérificateur d'intégrité
+ * @param chunk_id Chunk en échec
+ * @param severity Sévérité
+ */
+void security_event_from_integrity(security_event_t *event, int32_t status,
+                                   uint32_t chunk_id, security_severity_t severity);
+
+// ================================
+// Formatage différé
+// ================================
+
+/**
+ * @brief Construit la description textuelle d'un événement
+ *
+ * À appeler uniquement au moment du log ou de l'export.
+ *
+ * @param event Enregistrement à décrire
+ * @param buf Tampon de sortie (SECURITY_EVENT_DESC_MAX_LEN conseillé)
+ * @param len Taille du tampon
+ * @return Nombre de caractères écrits (hors terminateur)
+ */
+size_t security_event_format(const security_event_t *event, char *buf, size_t len);
+
+/**
+ * @brief Nom lisible d'un type d'événement
+ */
+const char* security_event_type_to_string(security_event_type_t type);
+
+/**
+ * @brief Nom lisible d'une sévérité
+ */
+const char* security_event_severity_to_string(security_severity_t severity);
+
+// ================================
+// Macros utilitaires Community
+// ================================
+
+/**
+ * @brief Drapeaux ANOMALY_FLAG_* d'un événement d'anomalie
+ */
+#define SECURITY_EVENT_ANOMALY_FLAGS(event)     ((event)->detail & 0x0F)
+
+/**
+ * @brief Mode de détection d'un événement d'anomalie
+ */
+#define SECURITY_EVENT_ANOMALY_MODE(event)      ((anomaly_detection_mode_t)((event)->detail >> 4))
+
+/**
+ * @brief Âge d'un événement en µs (correct malgré le rebouclage 32 bits)
+ */
+#define SECURITY_EVENT_AGE_US(event, now_us)    ((uint32_t)(now_us) - (event)->timestamp_us)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SECURITY_EVENT_H */
\ No newline at end of file
@@ -0,0 +1,148 @@
+/**
+ * @file security_event.c
+ * @brief Format binaire compact des événements de sécurité Community
+ *
+ * Construction des enregistrements de 16 octets et formatage différé
+ * de leur description.
+ *
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "esp_timer.h"
+#include "security_event.h"
+
+_Static_assert(sizeof(security_event_t) == SECURITY_EVENT_RECORD_SIZE,
+               "security_event_t doit rester un enregistrement de 16 octets");
+
+/**
+ * @brief Initialise un enregistrement vide et l'horodate
+ */
+void security_event_init(security_event_t *event, security_event_type_t type,
+                         security_severity_t severity, uint8_t source) {
+    memset(event, 0, sizeof(security_event_t));
+    event->type = (uint8_t)type;
+    event->severity = (uint8_t)severity;
+    event->source = source;
+    event->timestamp_us = (uint32_t)esp_timer_get_time();
+}
+
+/**
+ * @brief Construit un événement d'anomalie à partir d'un résultat de détection
+ */
+void security_event_from_anomaly(security_event_t *event, const anomaly_result_t *result,
+                                 uint8_t sensor_id, security_severity_t severity) {
+    security_event_init(event, SECURITY_EVENT_ANOMALY_DETECTED, severity, sensor_id);
+
+    uint8_t flags = 0;
+    if (result->temp_anomaly) {
+        flags |= ANOMALY_FLAG_TEMPERATURE;
+    }
+    if (result->humidity_anomaly) {
+        flags |= ANOMALY_FLAG_HUMIDITY;
+    }
+    if (result->temp_change_anomaly) {
+        flags |= ANOMALY_FLAG_TEMP_CHANGE;
+    }
+    if (result->humidity_change_anomaly) {
+        flags |= ANOMALY_FLAG_HUMIDITY_CHANGE;
+    }
+    event->detail = (uint8_t)((result->mode << 4) | flags);
+
+    float humidity = result->humidity > 0.0f ? result->humidity : 0.0f;
+    event->payload.anomaly.score = result->anomaly_score;
+    event->payload.anomaly.temperature_dc = (int16_t)lroundf(result->temperature * 10.0f);
+    event->payload.anomaly.humidity_dc = (uint16_t)lroundf(humidity * 10.0f);
+}
+
+/**
+ * @brief Construit un événement d'échec d'intégrité
+ */
+void security_event_from_integrity(security_event_t *event, int32_t status,
+                                   uint32_t chunk_id, security_severity_t severity) {
+    security_event_init(event, SECURITY_EVENT_INTEGRITY_FAILURE, severity,
+                        SECURITY_EVENT_SOURCE_NONE);
+    event->payload.integrity.chunk_id = chunk_id;
+    event->payload.integrity.status = status;
+}
+
+/**
+ * @brief Construit la description textuelle d'un événement
+ */
+size_t security_event_format(const security_event_t *event, char *buf, size_t len) {
+    if (event == NULL || buf == NULL || len == 0) {
+        return 0;
+    }
+
+    int written;
+
+    switch (event->type) {
+        case SECURITY_EVENT_ANOMALY_DETECTED: {
+            const security_event_anomaly_t *a = &event->payload.anomaly;
+            uint8_t flags = SECURITY_EVENT_ANOMALY_FLAGS(event);
+            written = snprintf(buf, len,
+                               "Anomalie %s capteur %u: score=%.3f, T=%.1f°C, H=%.1f%% [%s%s%s%s]",
+                               anomaly_mode_to_string(SECURITY_EVENT_ANOMALY_MODE(event)),
+                               event->source, a->score,
+                               a->temperature_dc / 10.0f, a->humidity_dc / 10.0f,
+                               (flags & ANOMALY_FLAG_TEMPERATURE) ? "T" : "",
+                               (flags & ANOMALY_FLAG_HUMIDITY) ? "H" : "",
+                               (flags & ANOMALY_FLAG_TEMP_CHANGE) ? "ΔT" : "",
+                               (flags & ANOMALY_FLAG_HUMIDITY_CHANGE) ? "ΔH" : "");
+            break;
+        }
+
+        case SECURITY_EVENT_INTEGRITY_FAILURE:
+            written = snprintf(buf, len, "Échec vérification intégrité chunk %lu (statut %ld)",
+                               (unsigned long)event->payload.integrity.chunk_id,
+                               (long)event->payload.integrity.status);
+            break;
+
+        default:
+            written = snprintf(buf, len, "%s (source %u, détail 0x%02x)",
+                               security_event_type_to_string(event->type),
+                               event->source, event->detail);
+            break;
+    }
+
+    if (written < 0) {
+        buf[0] = '\0';
+        return 0;
+    }
+
+    return ((size_t)written < len) ? (size_t)written : len - 1;
+}
+
+/**
+ * @brief Nom lisible d'un type d'événement
+ */
+const char* security_event_type_to_string(security_event_type_t type) {
+    switch (type) {
+        case SECURITY_EVENT_NONE: return "Aucun";
+        case SECURITY_EVENT_INTEGRITY_FAILURE: return "Échec intégrité";
+        case SECURITY_EVENT_ANOMALY_DETECTED: return "Anomalie";
+        case SECURITY_EVENT_SENSOR_MALFUNCTION: return "Dysfonctionnement capteur";
+        case SECURITY_EVENT_COMMUNICATION_FAILURE: return "Échec communication";
+        case SECURITY_EVENT_POWER_ANOMALY: return "Anomalie alimentation";
+        case SECURITY_EVENT_ATTESTATION_FAILURE: return "Échec attestation";
+        default: return "Inconnu";
+    }
+}
+
+/**
+ * @brief Nom lisible d'une sévérité
+ */
+const char* security_event_severity_to_string(security_severity_t severity) {
+    switch (severity) {
+        case SECURITY_SEVERITY_INFO: return "INFO";
+        case SECURITY_SEVERITY_LOW: return "LOW";
+        case SECURITY_SEVERITY_MEDIUM: return "MEDIUM";
+        case SECURITY_SEVERITY_HIGH: return "HIGH";
+        case SECURITY_SEVERITY_CRITICAL: return "CRITICAL";
+        default: return "UNKNOWN";
+    }
+}
\ No newline at end of file
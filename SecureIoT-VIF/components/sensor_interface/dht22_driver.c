@@ -14,18 +14,241 @@
 #include <stdlib.h>
 #include "esp_log.h"
 #include "esp_err.h"
+#include "esp_attr.h"
+#include "esp_timer.h"
+#include "sdkconfig.h"
 #include "driver/gpio.h"
 #include "rom/ets_sys.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/semphr.h"
 #include "freertos/portmacro.h"
 #include "dht22_driver.h"
+#include "perf_trace.h"
+
+#if CONFIG_ESP_TIMER_SUPPORTS_ISR_DISPATCH_METHOD
+#include "hal/gpio_ll.h"
+#include "soc/gpio_struct.h"
+// Relâchement de ligne depuis l'ISR esp_timer: pas de latence de la tâche esp_timer (cœur 0)
+#define DHT22_START_TIMER_DISPATCH      ESP_TIMER_ISR
+#else
+#define DHT22_START_TIMER_DISPATCH      ESP_TIMER_TASK
+#endif
 
 static const char *TAG = "DHT22_COMMUNITY";
 
 // Variables globales du driver DHT22
 static bool dht22_initialized = false;
 static dht22_stats_t dht22_stats = {0};
+static dht22_read_mode_t dht22_read_mode = DHT22_READ_MODE_DEFAULT;
+
+// Alimentation maintenue pendant le sommeil profond (survit au réveil)
+static RTC_DATA_ATTR bool dht22_power_retained = false;
+
+// ================================
+// État de la capture par fronts
+// ================================
+
+/**
+ * @brief Front horodaté par l'ISR
+ */
+typedef struct {
+    uint32_t time_us;               // esp_timer_get_time() tronqué à 32 bits
+    uint32_t level;                 // Niveau après le front
+} dht22_edge_t;
+
+static dht22_edge_t dht22_edges[DHT22_MAX_EDGES];
+static volatile uint32_t dht22_edge_count = 0;
+static volatile bool dht22_capture_busy = false;
+static bool dht22_isr_installed = false;
+
+static esp_timer_handle_t dht22_start_timer = NULL;
+static esp_timer_handle_t dht22_frame_timer = NULL;
+static dht22_read_cb_t dht22_capture_cb = NULL;
+static void *dht22_capture_arg = NULL;
+static uint32_t dht22_capture_start_ms = 0;
+static uint32_t dht22_capture_setup_us = 0;     // Armement de la capture (temps CPU)
+
+// Lecture synchrone au-dessus de la capture (dht22_read_data en mode fronts)
+static SemaphoreHandle_t dht22_sync_done = NULL;
+static StaticSemaphore_t dht22_sync_done_buffer;
+static esp_err_t dht22_sync_result = ESP_OK;
+static float dht22_sync_temperature = 0.0f;
+static float dht22_sync_humidity = 0.0f;
+
+static void dht22_start_timer_cb(void *arg);
+static void dht22_frame_timer_cb(void *arg);
+
+// ================================
+// Fonctions internes communes
+// ================================
+
+/**
+ * @brief Reconstruit les 5 octets de trame à partir des durées HIGH
+ */
+static void dht22_decode_bits(const uint32_t pulse_durations[DHT22_FRAME_BITS], uint8_t data[5]) {
+    memset(data, 0, 5);
+    for (int i = 0; i < DHT22_FRAME_BITS; i++) {
+        // Si l'impulsion HIGH > 40µs, c'est un bit 1
+        data[i / 8] |= (uint8_t)((pulse_durations[i] > DHT22_BIT_THRESHOLD) << (7 - (i % 8)));
+    }
+}
+
+/**
+ * @brief Vérifie, convertit une trame et met à jour les statistiques
+ */
+static esp_err_t dht22_process_frame(const uint8_t data[5], uint32_t start_time,
+                                     float *temperature, float *humidity) {
+    // Vérification du checksum
+    uint8_t checksum = data[0] + data[1] + data[2] + data[3];
+    if (checksum != data[4]) {
+        ESP_LOGE(TAG, "❌ Erreur checksum DHT22: calculé=0x%02X, reçu=0x%02X", 
+                 checksum, data[4]);
+        dht22_stats.checksum_errors++;
+        return ESP_ERR_INVALID_CRC;
+    }
+    
+    // Conversion des données
+    // Humidité: 16 bits (bytes 0-1)
+    uint16_t humidity_raw = (data[0] << 8) | data[1];
+    *humidity = (float)humidity_raw / 10.0f;
+    
+    // Température: 16 bits (bytes 2-3), bit 15 = signe
+    uint16_t temperature_raw = (data[2] << 8) | data[3];
+    if (temperature_raw & 0x8000) {
+        // Température négative
+        temperature_raw &= 0x7FFF;
+        *temperature = -((float)temperature_raw / 10.0f);
+    } else {
+        // Température positive
+        *temperature = (float)temperature_raw / 10.0f;
+    }
+    
+    // Vérification des plages
+    if (*temperature < DHT22_TEMP_MIN || *temperature > DHT22_TEMP_MAX ||
+        *humidity < DHT22_HUMIDITY_MIN || *humidity > DHT22_HUMIDITY_MAX) {
+        ESP_LOGW(TAG, "⚠️  Valeurs hors plage: T=%.1f°C, H=%.1f%%", *temperature, *humidity);
+        dht22_stats.out_of_range_reads++;
+        return ESP_ERR_INVALID_RESPONSE;
+    }
+    
+    // Mise à jour des statistiques
+    uint32_t read_duration = (esp_timer_get_time() / 1000) - start_time;
+    dht22_stats.successful_reads++;
+    dht22_stats.last_read_time = esp_timer_get_time() / 1000;
+    dht22_stats.total_read_time_ms += read_duration;
+    
+    // Mise à jour min/max
+    if (dht22_stats.successful_reads == 1 || *temperature < dht22_stats.min_temperature) {
+        dht22_stats.min_temperature = *temperature;
+    }
+    if (dht22_stats.successful_reads == 1 || *temperature > dht22_stats.max_temperature) {
+        dht22_stats.max_temperature = *temperature;
+    }
+    if (dht22_stats.successful_reads == 1 || *humidity < dht22_stats.min_humidity) {
+        dht22_stats.min_humidity = *humidity;
+    }
+    if (dht22_stats.successful_reads == 1 || *humidity > dht22_stats.max_humidity) {
+        dht22_stats.max_humidity = *humidity;
+    }
+    
+    ESP_LOGD(TAG, "✅ DHT22 lu avec succès: T=%.1f°C, H=%.1f%% (durée=%dms)",
+             *temperature, *humidity, read_duration);
+    
+    return ESP_OK;
+}
+
+/**
+ * @brief ISR de front: horodatage uniquement, aucun décodage
+ */
+static void IRAM_ATTR dht22_gpio_isr(void *arg) {
+    uint32_t idx = dht22_edge_count;
+    if (idx < DHT22_MAX_EDGES) {
+        dht22_edges[idx].time_us = (uint32_t)esp_timer_get_time();
+        dht22_edges[idx].level = (uint32_t)gpio_get_level(DHT22_GPIO_PIN);
+        dht22_edge_count = idx + 1;
+    }
+}
+
+/**
+ * @brief Crée les timers et installe l'ISR de capture
+ * 
+ * L'ISR de front est allouée sur le cœur appelant: à appeler depuis le cœur
+ * capteur (SENSOR_TASK_CORE), loin des interruptions radio. Le timer de
+ * trame reste en tâche esp_timer: sa latence ne retarde que le décodage.
+ */
+static esp_err_t dht22_capture_init(void) {
+    esp_timer_create_args_t start_args = {
+        .callback = dht22_start_timer_cb,
+        .arg = NULL,
+        .dispatch_method = DHT22_START_TIMER_DISPATCH,
+        .name = "dht22_start"
+    };
+    esp_err_t ret = esp_timer_create(&start_args, &dht22_start_timer);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    
+    esp_timer_create_args_t frame_args = {
+        .callback = dht22_frame_timer_cb,
+        .arg = NULL,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "dht22_frame"
+    };
+    ret = esp_timer_create(&frame_args, &dht22_frame_timer);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    
+    dht22_sync_done = xSemaphoreCreateBinaryStatic(&dht22_sync_done_buffer);
+    if (dht22_sync_done == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    
+    // Le service peut déjà être installé par un autre composant (sur son cœur)
+    ret = gpio_install_isr_service(0);
+    if (ret == ESP_ERR_INVALID_STATE) {
+        ESP_LOGW(TAG, "⚠️ Service ISR GPIO déjà installé: capture sur le cœur de son installateur");
+    } else if (ret != ESP_OK) {
+        return ret;
+    }
+    
+    gpio_set_intr_type(DHT22_GPIO_PIN, GPIO_INTR_ANYEDGE);
+    gpio_intr_disable(DHT22_GPIO_PIN);
+    ret = gpio_isr_handler_add(DHT22_GPIO_PIN, dht22_gpio_isr, NULL);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    
+    dht22_isr_installed = true;
+    return ESP_OK;
+}
+
+/**
+ * @brief Libère les ressources de capture
+ */
+static void dht22_capture_deinit(void) {
+    if (dht22_isr_installed) {
+        gpio_intr_disable(DHT22_GPIO_PIN);
+        gpio_isr_handler_remove(DHT22_GPIO_PIN);
+        dht22_isr_installed = false;
+    }
+    if (dht22_start_timer != NULL) {
+        esp_timer_stop(dht22_start_timer);
+        esp_timer_delete(dht22_start_timer);
+        dht22_start_timer = NULL;
+    }
+    if (dht22_frame_timer != NULL) {
+        esp_timer_stop(dht22_frame_timer);
+        esp_timer_delete(dht22_frame_timer);
+        dht22_frame_timer = NULL;
+    }
+    if (dht22_sync_done != NULL) {
+        vSemaphoreDelete(dht22_sync_done);
+        dht22_sync_done = NULL;
+    }
+    dht22_capture_busy = false;
+}
 
 /**
  * @brief Initialise le driver DHT22
@@ -72,27 +295,68 @@ esp_err_t dht22_driver_init(void) {
         
         // Activer l'alimentation du capteur
         gpio_set_level(DHT22_POWER_GPIO, 1);
-        ESP_LOGI(TAG, "⚡ Alimentation DHT22 activée sur GPIO %d", DHT22_POWER_GPIO);
         
-        // Attendre que le capteur se stabilise
-        vTaskDelay(pdMS_TO_TICKS(2000));
+        if (dht22_power_retained) {
+            // Niveau haut verrouillé pendant le sommeil: capteur déjà stable
+            gpio_hold_dis(DHT22_POWER_GPIO);
+            ESP_LOGD(TAG, "⚡ Alimentation DHT22 maintenue pendant le sommeil");
+        } else {
+            ESP_LOGI(TAG, "⚡ Alimentation DHT22 activée sur GPIO %d", DHT22_POWER_GPIO);
+            
+            // Attendre que le capteur se stabilise
+            vTaskDelay(pdMS_TO_TICKS(2000));
+        }
     }
     
     // Initialiser les statistiques
     memset(&dht22_stats, 0, sizeof(dht22_stats));
     dht22_stats.init_time = esp_timer_get_time() / 1000;
     
-    // Test initial
+    // Test initial (inutile au réveil: ligne au repos pendant tout le sommeil)
     gpio_set_level(DHT22_GPIO_PIN, 1);
-    vTaskDelay(pdMS_TO_TICKS(100));
+    if (!dht22_power_retained) {
+        vTaskDelay(pdMS_TO_TICKS(100));
+    }
+    dht22_power_retained = false;
+    
+    // Capture par fronts (ISR désactivée hors lecture)
+    ret = dht22_capture_init();
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ Erreur initialisation capture par fronts: %s", esp_err_to_name(ret));
+        dht22_capture_deinit();
+        return ret;
+    }
     
     dht22_initialized = true;
     ESP_LOGI(TAG, "✅ Driver DHT22 Community initialisé");
+    ESP_LOGI(TAG, "⏱️ Mode lecture: %s",
+             dht22_read_mode == DHT22_MODE_EDGE_CAPTURE ? "capture par fronts" : "bloquant");
     ESP_LOGI(TAG, "💡 Fonctionnalité complète - identique à Enterprise");
     
     return ESP_OK;
 }
 
+/**
+ * @brief Maintient l'alimentation du capteur pendant le sommeil profond
+ */
+esp_err_t dht22_retain_power_in_sleep(void) {
+    if (DHT22_POWER_GPIO < 0) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    if (!dht22_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    esp_err_t ret = gpio_hold_en(DHT22_POWER_GPIO);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    gpio_deep_sleep_hold_en();
+    dht22_power_retained = true;
+    
+    return ESP_OK;
+}
+
 /**
  * @brief Deinitialise le driver DHT22
  */
@@ -107,6 +371,7 @@ esp_err_t dht22_driver_deinit(void) {
         ESP_LOGI(TAG, "⚡ Alimentation DHT22 désactivée");
     }
     
+    dht22_capture_deinit();
     dht22_initialized = false;
     ESP_LOGI(TAG, "🔓 Driver DHT22 déinitialisé");
     
@@ -132,29 +397,20 @@ static uint32_t dht22_read_pulse(int level, uint32_t timeout_us) {
 }
 
 /**
- * @brief Lit les données du capteur DHT22
+ * @brief Lecture bloquante: scrutation de la ligne en section critique
  */
-esp_err_t dht22_read_data(float *temperature, float *humidity) {
-    if (!dht22_initialized) {
-        ESP_LOGE(TAG, "❌ Driver DHT22 non initialisé");
-        return ESP_ERR_INVALID_STATE;
-    }
-    
-    if (temperature == NULL || humidity == NULL) {
-        ESP_LOGE(TAG, "❌ Paramètres invalides");
-        return ESP_ERR_INVALID_ARG;
-    }
-    
+static esp_err_t dht22_read_blocking(float *temperature, float *humidity) {
     ESP_LOGD(TAG, "📊 Début lecture DHT22...");
     
     uint32_t start_time = esp_timer_get_time() / 1000;
     dht22_stats.total_reads++;
     
     uint8_t data[5] = {0};
-    uint32_t pulse_durations[40];
+    uint32_t pulse_durations[DHT22_FRAME_BITS];
     
     // Désactiver les interruptions pour un timing précis
     portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+    int64_t critical_start = esp_timer_get_time();
     portENTER_CRITICAL(&mux);
     
     // Phase 1: Signal de démarrage
@@ -169,6 +425,7 @@ esp_err_t dht22_read_data(float *temperature, float *humidity) {
     uint32_t timeout = dht22_read_pulse(1, 100);
     if (timeout == 0) {
         portEXIT_CRITICAL(&mux);
+        dht22_stats.last_critical_time_us = (uint32_t)(esp_timer_get_time() - critical_start);
         ESP_LOGE(TAG, "❌ Timeout attente réponse DHT22");
         dht22_stats.failed_reads++;
         return ESP_ERR_TIMEOUT;
@@ -178,6 +435,7 @@ esp_err_t dht22_read_data(float *temperature, float *humidity) {
     timeout = dht22_read_pulse(0, 100);
     if (timeout == 0) {
         portEXIT_CRITICAL(&mux);
+        dht22_stats.last_critical_time_us = (uint32_t)(esp_timer_get_time() - critical_start);
         ESP_LOGE(TAG, "❌ Timeout signal préparation DHT22");
         dht22_stats.failed_reads++;
         return ESP_ERR_TIMEOUT;
@@ -187,17 +445,19 @@ esp_err_t dht22_read_data(float *temperature, float *humidity) {
     timeout = dht22_read_pulse(1, 100);
     if (timeout == 0) {
         portEXIT_CRITICAL(&mux);
+        dht22_stats.last_critical_time_us = (uint32_t)(esp_timer_get_time() - critical_start);
         ESP_LOGE(TAG, "❌ Timeout fin préparation DHT22");
         dht22_stats.failed_reads++;
         return ESP_ERR_TIMEOUT;
     }
     
     // Phase 3: Lecture des 40 bits de données
-    for (int i = 0; i < 40; i++) {
+    for (int i = 0; i < DHT22_FRAME_BITS; i++) {
         // Chaque bit commence par un LOW de 50µs
         uint32_t low_duration = dht22_read_pulse(0, 70);
         if (low_duration == 0) {
             portEXIT_CRITICAL(&mux);
+            dht22_stats.last_critical_time_us = (uint32_t)(esp_timer_get_time() - critical_start);
             ESP_LOGE(TAG, "❌ Timeout bit %d (LOW)", i);
             dht22_stats.failed_reads++;
             return ESP_ERR_TIMEOUT;
@@ -207,6 +467,7 @@ esp_err_t dht22_read_data(float *temperature, float *humidity) {
         uint32_t high_duration = dht22_read_pulse(1, 80);
         if (high_duration == 0) {
             portEXIT_CRITICAL(&mux);
+            dht22_stats.last_critical_time_us = (uint32_t)(esp_timer_get_time() - critical_start);
             ESP_LOGE(TAG, "❌ Timeout bit %d (HIGH)", i);
             dht22_stats.failed_reads++;
             return ESP_ERR_TIMEOUT;
@@ -216,77 +477,215 @@ esp_err_t dht22_read_data(float *temperature, float *humidity) {
     }
     
     portEXIT_CRITICAL(&mux);
+    dht22_stats.last_critical_time_us = (uint32_t)(esp_timer_get_time() - critical_start);
     
-    // Phase 4: Décodage des données
-    for (int i = 0; i < 40; i++) {
-        int byte_idx = i / 8;
-        int bit_idx = 7 - (i % 8);
-        
-        // Si l'impulsion HIGH > 40µs, c'est un bit 1
-        if (pulse_durations[i] > 40) {
-            data[byte_idx] |= (1 << bit_idx);
+    // Phase 4: Décodage, checksum et conversion
+    dht22_decode_bits(pulse_durations, data);
+    esp_err_t ret = dht22_process_frame(data, start_time, temperature, humidity);
+    
+    // Scrutation active: tout le temps écoulé depuis le signal de démarrage occupe le CPU
+    dht22_stats.last_cpu_time_us = (uint32_t)(esp_timer_get_time() - critical_start);
+    return ret;
+}
+
+// ================================
+// Lecture par capture de fronts
+// ================================
+
+/**
+ * @brief Fin de l'impulsion de démarrage: libère la ligne et lance la fenêtre de trame
+ * 
+ * Exécuté dans l'ISR esp_timer si disponible (accès GPIO par la HAL, en IRAM),
+ * sinon dans la tâche esp_timer; aucune section critique. La capture est
+ * armée par dht22_read_async().
+ */
+static void IRAM_ATTR dht22_start_timer_cb(void *arg) {
+#if CONFIG_ESP_TIMER_SUPPORTS_ISR_DISPATCH_METHOD
+    gpio_ll_set_level(&GPIO, DHT22_GPIO_PIN, 1);
+#else
+    gpio_set_level(DHT22_GPIO_PIN, 1);
+#endif
+    esp_timer_start_once(dht22_frame_timer, DHT22_ASYNC_FRAME_TIMEOUT_US);
+}
+
+/**
+ * @brief Fin de fenêtre de capture: décodage de la trame en tâche
+ * 
+ * Les 40 bits de données sont les 40 dernières impulsions HIGH complètes;
+ * celles qui précèdent (relâchement hôte, préparation capteur) sont ignorées.
+ */
+static void dht22_frame_timer_cb(void *arg) {
+    int64_t decode_start = esp_timer_get_time();
+    gpio_intr_disable(DHT22_GPIO_PIN);
+    
+    uint32_t edge_count = dht22_edge_count;
+    uint32_t pulse_durations[DHT22_FRAME_BITS];
+    int pulse_count = 0;
+    
+    // Parcours à rebours: HIGH = front montant suivi d'un front descendant
+    for (int i = (int)edge_count - 1; i > 0 && pulse_count < DHT22_FRAME_BITS; i--) {
+        if (dht22_edges[i].level == 0 && dht22_edges[i - 1].level == 1) {
+            pulse_count++;
+            pulse_durations[DHT22_FRAME_BITS - pulse_count] =
+                dht22_edges[i].time_us - dht22_edges[i - 1].time_us;
         }
     }
     
-    // Phase 5: Vérification du checksum
-    uint8_t checksum = data[0] + data[1] + data[2] + data[3];
-    if (checksum != data[4]) {
-        ESP_LOGE(TAG, "❌ Erreur checksum DHT22: calculé=0x%02X, reçu=0x%02X", 
-                 checksum, data[4]);
-        dht22_stats.checksum_errors++;
-        return ESP_ERR_INVALID_CRC;
-    }
+    dht22_stats.edge_captures++;
+    dht22_stats.last_edge_count = edge_count;
+    dht22_stats.last_critical_time_us = 0;
     
-    // Phase 6: Conversion des données
-    // Humidité: 16 bits (bytes 0-1)
-    uint16_t humidity_raw = (data[0] << 8) | data[1];
-    *humidity = (float)humidity_raw / 10.0f;
+    esp_err_t result;
+    float temperature = 0.0f;
+    float humidity = 0.0f;
     
-    // Température: 16 bits (bytes 2-3), bit 15 = signe
-    uint16_t temperature_raw = (data[2] << 8) | data[3];
-    if (temperature_raw & 0x8000) {
-        // Température négative
-        temperature_raw &= 0x7FFF;
-        *temperature = -((float)temperature_raw / 10.0f);
+    if (pulse_count < DHT22_FRAME_BITS) {
+        ESP_LOGE(TAG, "❌ Trame DHT22 incomplète: %d/%d bits (%u fronts)",
+                 pulse_count, DHT22_FRAME_BITS, edge_count);
+        dht22_stats.capture_timeouts++;
+        dht22_stats.failed_reads++;
+        result = ESP_ERR_TIMEOUT;
     } else {
-        // Température positive
-        *temperature = (float)temperature_raw / 10.0f;
+        uint8_t data[5];
+        dht22_decode_bits(pulse_durations, data);
+        result = dht22_process_frame(data, dht22_capture_start_ms, &temperature, &humidity);
+        dht22_stats.last_cpu_time_us = dht22_capture_setup_us +
+                                       (uint32_t)(esp_timer_get_time() - decode_start);
     }
     
-    // Vérification des plages
-    if (*temperature < DHT22_TEMP_MIN || *temperature > DHT22_TEMP_MAX ||
-        *humidity < DHT22_HUMIDITY_MIN || *humidity > DHT22_HUMIDITY_MAX) {
-        ESP_LOGW(TAG, "⚠️  Valeurs hors plage: T=%.1f°C, H=%.1f%%", *temperature, *humidity);
-        dht22_stats.out_of_range_reads++;
-        return ESP_ERR_INVALID_RESPONSE;
+    dht22_read_cb_t callback = dht22_capture_cb;
+    void *callback_arg = dht22_capture_arg;
+    dht22_capture_busy = false;
+    
+    if (callback != NULL) {
+        callback(result, temperature, humidity, callback_arg);
+    }
+}
+
+/**
+ * @brief Démarre une lecture asynchrone par capture de fronts
+ */
+esp_err_t dht22_read_async(dht22_read_cb_t callback, void *arg) {
+    if (!dht22_initialized) {
+        ESP_LOGE(TAG, "❌ Driver DHT22 non initialisé");
+        return ESP_ERR_INVALID_STATE;
     }
     
-    // Mise à jour des statistiques
-    uint32_t read_duration = (esp_timer_get_time() / 1000) - start_time;
-    dht22_stats.successful_reads++;
-    dht22_stats.last_read_time = esp_timer_get_time() / 1000;
-    dht22_stats.total_read_time_ms += read_duration;
+    if (callback == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
     
-    // Mise à jour min/max
-    if (dht22_stats.successful_reads == 1 || *temperature < dht22_stats.min_temperature) {
-        dht22_stats.min_temperature = *temperature;
+    if (dht22_capture_busy) {
+        return ESP_ERR_INVALID_STATE;
     }
-    if (dht22_stats.successful_reads == 1 || *temperature > dht22_stats.max_temperature) {
-        dht22_stats.max_temperature = *temperature;
+    
+    int64_t setup_start = esp_timer_get_time();
+    dht22_capture_busy = true;
+    dht22_capture_cb = callback;
+    dht22_capture_arg = arg;
+    dht22_capture_start_ms = esp_timer_get_time() / 1000;
+    dht22_stats.total_reads++;
+    
+    // Signal de démarrage: LOW pendant 1ms, temporisé sans bloquer le CPU.
+    // Capture armée dès maintenant: les fronts avant la trame sont ignorés au décodage
+    gpio_set_level(DHT22_GPIO_PIN, 0);
+    dht22_edge_count = 0;
+    gpio_intr_enable(DHT22_GPIO_PIN);
+    esp_err_t ret = esp_timer_start_once(dht22_start_timer, DHT22_START_SIGNAL_DURATION);
+    if (ret != ESP_OK) {
+        gpio_intr_disable(DHT22_GPIO_PIN);
+        gpio_set_level(DHT22_GPIO_PIN, 1);
+        dht22_stats.failed_reads++;
+        dht22_capture_busy = false;
+        return ret;
     }
-    if (dht22_stats.successful_reads == 1 || *humidity < dht22_stats.min_humidity) {
-        dht22_stats.min_humidity = *humidity;
+    
+    dht22_capture_setup_us = (uint32_t)(esp_timer_get_time() - setup_start);
+    return ESP_OK;
+}
+
+/**
+ * @brief Callback de la lecture synchrone en mode capture
+ */
+static void dht22_sync_read_cb(esp_err_t result, float temperature, float humidity, void *arg) {
+    dht22_sync_result = result;
+    dht22_sync_temperature = temperature;
+    dht22_sync_humidity = humidity;
+    xSemaphoreGive(dht22_sync_done);
+}
+
+/**
+ * @brief Lecture synchrone en mode capture: la tâche dort pendant la trame
+ */
+static esp_err_t dht22_read_edge_capture(float *temperature, float *humidity) {
+    xSemaphoreTake(dht22_sync_done, 0);
+    
+    esp_err_t ret = dht22_read_async(dht22_sync_read_cb, NULL);
+    if (ret != ESP_OK) {
+        return ret;
     }
-    if (dht22_stats.successful_reads == 1 || *humidity > dht22_stats.max_humidity) {
-        dht22_stats.max_humidity = *humidity;
+    
+    if (xSemaphoreTake(dht22_sync_done, pdMS_TO_TICKS(DHT22_ASYNC_READ_TIMEOUT_MS)) != pdTRUE) {
+        ESP_LOGE(TAG, "❌ Timeout attente capture DHT22");
+        return ESP_ERR_TIMEOUT;
     }
     
-    ESP_LOGD(TAG, "✅ DHT22 lu avec succès: T=%.1f°C, H=%.1f%% (durée=%dms)",
-             *temperature, *humidity, read_duration);
+    if (dht22_sync_result == ESP_OK) {
+        *temperature = dht22_sync_temperature;
+        *humidity = dht22_sync_humidity;
+    }
     
+    return dht22_sync_result;
+}
+
+/**
+ * @brief Lit les données du capteur DHT22
+ */
+esp_err_t dht22_read_data(float *temperature, float *humidity) {
+    PERF_TRACE_SCOPE(PERF_SPAN_DHT22_READ);
+    
+    if (!dht22_initialized) {
+        ESP_LOGE(TAG, "❌ Driver DHT22 non initialisé");
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    if (temperature == NULL || humidity == NULL) {
+        ESP_LOGE(TAG, "❌ Paramètres invalides");
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    if (dht22_read_mode == DHT22_MODE_EDGE_CAPTURE) {
+        return dht22_read_edge_capture(temperature, humidity);
+    }
+    
+    return dht22_read_blocking(temperature, humidity);
+}
+
+/**
+ * @brief Sélectionne le mode utilisé par dht22_read_data()
+ */
+esp_err_t dht22_set_read_mode(dht22_read_mode_t mode) {
+    if (mode != DHT22_MODE_BLOCKING && mode != DHT22_MODE_EDGE_CAPTURE) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    if (dht22_capture_busy) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    dht22_read_mode = mode;
+    ESP_LOGI(TAG, "⏱️ Mode lecture DHT22: %s",
+             mode == DHT22_MODE_EDGE_CAPTURE ? "capture par fronts" : "bloquant");
     return ESP_OK;
 }
 
+/**
+ * @brief Obtient le mode de lecture actif
+ */
+dht22_read_mode_t dht22_get_read_mode(void) {
+    return dht22_read_mode;
+}
+
 /**
  * @brief Obtient les statistiques du driver DHT22
  */
@@ -334,6 +733,14 @@ void dht22_print_stats(void) {
         ESP_LOGI(TAG, "Temps lecture moyen: %dms", avg_read_time);
     }
     
+    ESP_LOGI(TAG, "Mode lecture: %s",
+             dht22_read_mode == DHT22_MODE_EDGE_CAPTURE ? "capture par fronts" : "bloquant");
+    ESP_LOGI(TAG, "Captures par fronts: %d (incomplètes: %d, derniers fronts: %d)",
+             dht22_stats.edge_captures, dht22_stats.capture_timeouts,
+             dht22_stats.last_edge_count);
+    ESP_LOGI(TAG, "Section critique (dernière lecture): %dµs", dht22_stats.last_critical_time_us);
+    ESP_LOGI(TAG, "Temps CPU (dernière lecture): %dµs", dht22_stats.last_cpu_time_us);
+    
     ESP_LOGI(TAG, "===================================");
 }
 
@@ -352,6 +759,7 @@ esp_err_t dht22_reset_stats(void) {
     return ESP_OK;
 }
 
+#if CONFIG_APP_SELF_TESTS
 /**
  * @brief Test de fonctionnement du driver DHT22
  */
@@ -395,7 +803,9 @@ esp_err_t dht22_self_test(void) {
     
     return ESP_OK;
 }
+#endif /* CONFIG_APP_SELF_TESTS */
 
+#if CONFIG_APP_BANNERS
 /**
  * @brief Affiche les informations du driver DHT22
  */
@@ -415,7 +825,9 @@ void dht22_print_info(void) {
     ESP_LOGI(TAG, "  ✅ Vérification checksum automatique");
     ESP_LOGI(TAG, "  ✅ Validation plages de données");
     ESP_LOGI(TAG, "  ✅ Statistiques complètes");
+    ESP_LOGI(TAG, "  ✅ Lecture non bloquante par capture de fronts (ISR + esp_timer)");
     ESP_LOGI(TAG, "  ✅ Gestion d'erreurs robuste");
     ESP_LOGI(TAG, "🎓 Identique à Enterprise Edition!");
     ESP_LOGI(TAG, "===============================");
-}
\ No newline at end of file
+}
+#endif /* CONFIG_APP_BANNERS */
\ No newline at end of file
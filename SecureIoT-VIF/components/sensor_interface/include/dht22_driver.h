@@ -43,10 +43,36 @@ extern "C" {
 #define DHT22_BIT_1_HIGH_DURATION       (70)       // ~70µs pour bit 1
 #define DHT22_BIT_THRESHOLD             (40)       // Seuil de décision
 
+// Capture par interruptions de front (mode asynchrone)
+#define DHT22_FRAME_BITS                (40)
+#define DHT22_MAX_EDGES                 (96)       // 83 fronts attendus + marge
+#define DHT22_ASYNC_FRAME_TIMEOUT_US    (8000)     // Trame ~5 ms après relâchement
+#define DHT22_ASYNC_READ_TIMEOUT_MS     (50)       // Attente max côté tâche
+
 // ================================
 // Types et structures
 // ================================
 
+/**
+ * @brief Mode de lecture du DHT22
+ */
+typedef enum {
+    DHT22_MODE_BLOCKING = 0,        // Scrutation en section critique (~5 ms)
+    DHT22_MODE_EDGE_CAPTURE         // Horodatage des fronts par ISR, décodage en tâche
+} dht22_read_mode_t;
+
+/**
+ * @brief Callback de fin de lecture asynchrone
+ * 
+ * Appelé depuis la tâche esp_timer, jamais depuis une ISR.
+ * 
+ * @param result ESP_OK ou code d'erreur de la lecture
+ * @param temperature Température (°C), valide si result == ESP_OK
+ * @param humidity Humidité (%), valide si result == ESP_OK
+ * @param arg Argument utilisateur
+ */
+typedef void (*dht22_read_cb_t)(esp_err_t result, float temperature, float humidity, void *arg);
+
 /**
  * @brief Statistiques du driver DHT22
  */
@@ -63,6 +89,13 @@ typedef struct {
     float max_temperature;          // Température maximale lue
     float min_humidity;             // Humidité minimale lue
     float max_humidity;             // Humidité maximale lue
+    
+    // Capture par fronts
+    uint32_t edge_captures;         // Lectures en mode capture
+    uint32_t capture_timeouts;      // Trames incomplètes
+    uint32_t last_edge_count;       // Fronts de la dernière trame
+    uint32_t last_critical_time_us; // Temps en section critique (dernière lecture)
+    uint32_t last_cpu_time_us;      // Temps CPU de la dernière lecture réussie (hors ISR de front)
 } dht22_stats_t;
 
 // ================================
@@ -85,6 +118,18 @@ esp_err_t dht22_driver_init(void);
  */
 esp_err_t dht22_driver_deinit(void);
 
+/**
+ * @brief Maintient l'alimentation du capteur pendant le sommeil profond
+ * 
+ * Verrouille DHT22_POWER_GPIO à l'état haut (gpio_hold_en): au réveil,
+ * dht22_driver_init() saute les 2 s de stabilisation. Le capteur consomme
+ * quelques dizaines de µA en veille, bien moins que 2 s de CPU actif.
+ * 
+ * @return ESP_OK, ESP_ERR_NOT_SUPPORTED sans GPIO d'alimentation,
+ *         ESP_ERR_INVALID_STATE si le driver n'est pas initialisé
+ */
+esp_err_t dht22_retain_power_in_sleep(void);
+
 // ================================
 // Fonctions de lecture
 // ================================
@@ -105,6 +150,38 @@ esp_err_t dht22_driver_deinit(void);
  */
 esp_err_t dht22_read_data(float *temperature, float *humidity);
 
+/**
+ * @brief Démarre une lecture asynchrone par capture de fronts
+ * 
+ * Retourne immédiatement. L'impulsion de démarrage est temporisée par
+ * esp_timer, les fronts sont horodatés par ISR et la trame est décodée en
+ * tâche, puis remise au callback.
+ * 
+ * @param callback Callback de fin de lecture
+ * @param arg Argument utilisateur
+ * @return ESP_OK si lancée, ESP_ERR_INVALID_STATE si une lecture est en cours
+ */
+esp_err_t dht22_read_async(dht22_read_cb_t callback, void *arg);
+
+/**
+ * @brief Sélectionne le mode utilisé par dht22_read_data()
+ * 
+ * En DHT22_MODE_EDGE_CAPTURE, dht22_read_data() lance une lecture
+ * asynchrone et bloque la tâche appelante (sans occuper le CPU) jusqu'au
+ * résultat.
+ * 
+ * @param mode Mode de lecture
+ * @return ESP_OK si succès
+ */
+esp_err_t dht22_set_read_mode(dht22_read_mode_t mode);
+
+/**
+ * @brief Obtient le mode de lecture actif
+ * 
+ * @return Mode de lecture actif
+ */
+dht22_read_mode_t dht22_get_read_mode(void);
+
 // ================================
 // Fonctions de statistiques
 // ================================
@@ -136,12 +213,16 @@ esp_err_t dht22_reset_stats(void);
 /**
  * @brief Test de fonctionnement du driver DHT22
  * 
+ * Compilée seulement avec CONFIG_APP_SELF_TESTS (profil de développement).
+ * 
  * @return ESP_OK si tous les tests passent, ESP_FAIL sinon
  */
 esp_err_t dht22_self_test(void);
 
 /**
  * @brief Affiche les informations du driver DHT22
+ * 
+ * Compilée seulement avec CONFIG_APP_BANNERS (profil de développement).
  */
 void dht22_print_info(void);
 
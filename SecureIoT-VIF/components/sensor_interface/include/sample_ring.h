@@ -0,0 +1,135 @@
+/**
+ * @file sample_ring.h
+ * @brief Anneau d'échantillons capteurs sans verrou - Community Edition
+ * 
+ * Un producteur (tâche capteurs), plusieurs consommateurs à curseurs
+ * indépendants. L'anneau écrase les échantillons les plus anciens; chaque
+ * consommateur en retard compte ses pertes au lieu de bloquer le producteur.
+ * 
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#ifndef SAMPLE_RING_H
+#define SAMPLE_RING_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "sensor_manager.h"
+
+// ================================
+// Constantes de l'anneau
+// ================================
+
+#define SAMPLE_RING_CAPACITY            (256)   // Puissance de 2: ~21 min à 5 s pour un capteur
+#define SAMPLE_RING_MAX_CONSUMERS       (4)
+#define SAMPLE_RING_ALIGN               (32)    // Alignement des emplacements et curseurs
+#define SAMPLE_RING_CONSUMER_NAME_LEN   (16)
+#define SAMPLE_RING_CONSUMER_INVALID    (0xFF)
+
+// ================================
+// Types et structures
+// ================================
+
+/**
+ * @brief Statistiques d'un consommateur
+ */
+typedef struct {
+    uint32_t samples_read;          // Échantillons lus
+    uint32_t samples_dropped;       // Échantillons écrasés avant lecture
+    uint32_t lag;                   // Échantillons en attente au moment de l'appel
+} sample_ring_consumer_stats_t;
+
+/**
+ * @brief Statistiques globales de l'anneau
+ */
+typedef struct {
+    uint32_t samples_pushed;        // Échantillons produits depuis l'init
+    uint32_t capacity;              // Capacité de l'anneau
+    uint32_t consumers;             // Consommateurs enregistrés
+} sample_ring_stats_t;
+
+// ================================
+// Fonctions d'initialisation
+// ================================
+
+/**
+ * @brief Initialise l'anneau d'échantillons (stockage statique)
+ * 
+ * @return ESP_OK si succès
+ */
+esp_err_t sample_ring_init(void);
+
+/**
+ * @brief Enregistre un consommateur
+ * 
+ * @param name Nom du consommateur (copié)
+ * @param from_oldest true pour commencer au plus ancien échantillon
+ *                    disponible, false pour ne lire que les suivants
+ * @param consumer_id Identifiant attribué (sortie)
+ * @return ESP_OK si succès, ESP_ERR_NO_MEM si plus d'emplacement
+ */
+esp_err_t sample_ring_register_consumer(const char *name, bool from_oldest, uint8_t *consumer_id);
+
+// ================================
+// Production et consommation
+// ================================
+
+/**
+ * @brief Ajoute un échantillon (producteur unique, jamais bloquant)
+ * 
+ * @param sample Échantillon à copier dans l'anneau
+ * @return ESP_OK si succès
+ */
+esp_err_t sample_ring_push(const sensor_data_t *sample);
+
+/**
+ * @brief Lit un lot d'échantillons pour un consommateur
+ * 
+ * Chaque consommateur ne doit être lu que depuis une seule tâche.
+ * 
+ * @param consumer_id Identifiant du consommateur
+ * @param samples Tableau de sortie
+ * @param max_samples Capacité du tableau
+ * @return Nombre d'échantillons lus
+ */
+size_t sample_ring_read(uint8_t consumer_id, sensor_data_t *samples, size_t max_samples);
+
+// ================================
+// Fonctions de statistiques
+// ================================
+
+/**
+ * @brief Obtient les statistiques d'un consommateur
+ * 
+ * @param consumer_id Identifiant du consommateur
+ * @param stats Pointeur vers la structure de statistiques
+ * @return ESP_OK si succès, ESP_ERR_NOT_FOUND si consommateur inconnu
+ */
+esp_err_t sample_ring_get_consumer_stats(uint8_t consumer_id, sample_ring_consumer_stats_t *stats);
+
+/**
+ * @brief Obtient les statistiques globales de l'anneau
+ * 
+ * @param stats Pointeur vers la structure de statistiques
+ * @return ESP_OK si succès
+ */
+esp_err_t sample_ring_get_stats(sample_ring_stats_t *stats);
+
+/**
+ * @brief Affiche les statistiques de l'anneau et des consommateurs
+ */
+void sample_ring_print_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SAMPLE_RING_H */
\ No newline at end of file
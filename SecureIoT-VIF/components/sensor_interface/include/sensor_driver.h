@@ -0,0 +1,66 @@
+/**
+ * @file sensor_driver.h
+ * @brief Interface de driver capteur pour SecureIoT-VIF Community Edition
+ * 
+ * Table d'opérations enregistrée auprès du gestionnaire de capteurs.
+ * Chaque instance fournit son contexte; un même driver peut donc servir
+ * plusieurs capteurs.
+ * 
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#ifndef SENSOR_DRIVER_H
+#define SENSOR_DRIVER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+// ================================
+// Types et structures
+// ================================
+
+/**
+ * @brief Callback de fin de lecture asynchrone d'un driver
+ * 
+ * Peut être appelé depuis n'importe quelle tâche (jamais depuis une ISR).
+ * 
+ * @param result ESP_OK ou code d'erreur de la lecture
+ * @param temperature Température (°C), valide si result == ESP_OK
+ * @param humidity Humidité (%), valide si result == ESP_OK
+ * @param arg Argument fourni à read_async
+ */
+typedef void (*sensor_read_done_cb_t)(esp_err_t result, float temperature, float humidity, void *arg);
+
+/**
+ * @brief Table d'opérations d'un driver capteur
+ * 
+ * read est obligatoire. read_async est optionnel: s'il est fourni, le
+ * planificateur lance en parallèle les lectures des capteurs échus au
+ * lieu de les enchaîner.
+ */
+typedef struct {
+    const char *type_name;          // Type de capteur (ex: "DHT22")
+    esp_err_t (*init)(void *ctx);
+    esp_err_t (*read)(void *ctx, float *temperature, float *humidity);
+    esp_err_t (*read_async)(void *ctx, sensor_read_done_cb_t callback, void *arg);
+    esp_err_t (*deinit)(void *ctx);
+    
+    // Plages physiques valides du capteur
+    float temperature_min;
+    float temperature_max;
+    float humidity_min;
+    float humidity_max;
+} sensor_driver_ops_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SENSOR_DRIVER_H */
\ No newline at end of file
@@ -21,6 +21,25 @@ extern "C" {
 #include <stddef.h>
 #include "esp_err.h"
 #include "app_config.h"
+#include "sensor_driver.h"
+
+// ================================
+// Constantes du registre de capteurs
+// ================================
+
+#define SENSOR_MAX_INSTANCES                (8)
+#define SENSOR_NAME_MAX_LEN                 (16)
+#define SENSOR_ID_INVALID                   (0xFF)
+
+// Planification
+#define SENSOR_SCHEDULER_BATCH_WINDOW_MS    (20)    // Capteurs échus groupés dans une passe
+#define SENSOR_SCHEDULER_STAGGER_MS         (50)    // Décalage entre capteurs / lectures bloquantes
+#define SENSOR_SCHEDULER_ASYNC_TIMEOUT_MS   (100)   // Attente max des lectures asynchrones
+#define SENSOR_SCHEDULER_MIN_PERIOD_MS      (2000)  // DHT22: 0.5 Hz maximum
+
+// Statistiques glissantes par instance (windowed_stats.h)
+#define SENSOR_STATS_WINDOW_SIZE            (64)    // ~5 min à 5 s
+#define SENSOR_STATS_EWMA_ALPHA             (0.1f)
 
 // ================================
 // Types et structures
@@ -35,6 +54,7 @@ typedef struct {
     uint64_t timestamp;             // Timestamp en millisecondes
     uint32_t read_duration_ms;      // Durée de lecture en ms
     uint8_t quality_score;          // Score de qualité 0-100
+    uint8_t sensor_id;              // Instance source dans le registre
 } sensor_data_t;
 
 /**
@@ -51,12 +71,24 @@ typedef struct {
     uint32_t total_read_time_ms;    // Temps total de lecture
     float min_temperature;          // Température minimale
     float max_temperature;          // Température maximale
-    float avg_temperature;          // Température moyenne
+    float avg_temperature;          // Température moyenne (fenêtre glissante)
     float min_humidity;             // Humidité minimale
     float max_humidity;             // Humidité maximale
-    float avg_humidity;             // Humidité moyenne
+    float avg_humidity;             // Humidité moyenne (fenêtre glissante)
+    float stddev_temperature;       // Écart-type température (fenêtre glissante)
+    float stddev_humidity;          // Écart-type humidité (fenêtre glissante)
 } sensor_stats_t;
 
+/**
+ * @brief Configuration d'enregistrement d'une instance de capteur
+ */
+typedef struct {
+    const char *name;                   // Nom de l'instance (copié)
+    const sensor_driver_ops_t *ops;     // Table d'opérations du driver
+    void *ctx;                          // Contexte propre à l'instance
+    uint32_t period_ms;                 // Période d'échantillonnage
+} sensor_config_t;
+
 // ================================
 // Fonctions d'initialisation
 // ================================
@@ -75,12 +107,78 @@ esp_err_t sensor_manager_init(void);
  */
 esp_err_t sensor_manager_deinit(void);
 
+// ================================
+// Registre de capteurs
+// ================================
+
+/**
+ * @brief Enregistre une instance de capteur
+ * 
+ * Le driver est initialisé immédiatement. La première échéance est décalée
+ * de SENSOR_SCHEDULER_STAGGER_MS par emplacement pour étaler les lectures.
+ * 
+ * @param config Configuration de l'instance
+ * @param sensor_id Identifiant attribué (sortie)
+ * @return ESP_OK si succès, ESP_ERR_NO_MEM si le registre est plein
+ */
+esp_err_t sensor_register(const sensor_config_t *config, uint8_t *sensor_id);
+
+/**
+ * @brief Retire une instance du registre et déinitialise son driver
+ * 
+ * @param sensor_id Identifiant de l'instance
+ * @return ESP_OK si succès, ESP_ERR_INVALID_STATE si une lecture est en cours
+ */
+esp_err_t sensor_unregister(uint8_t sensor_id);
+
+/**
+ * @brief Modifie la période d'échantillonnage d'une instance
+ * 
+ * @param sensor_id Identifiant de l'instance
+ * @param period_ms Nouvelle période (>= SENSOR_SCHEDULER_MIN_PERIOD_MS)
+ * @return ESP_OK si succès
+ */
+esp_err_t sensor_set_period(uint8_t sensor_id, uint32_t period_ms);
+
+/**
+ * @brief Nombre d'instances enregistrées
+ * 
+ * @return Nombre d'instances
+ */
+size_t sensor_get_count(void);
+
+/**
+ * @brief Lit immédiatement une instance (hors planification)
+ * 
+ * @param sensor_id Identifiant de l'instance
+ * @param data Pointeur vers la structure de données
+ * @return ESP_OK si succès, code d'erreur sinon
+ */
+esp_err_t sensor_read(uint8_t sensor_id, sensor_data_t *data);
+
+/**
+ * @brief Exécute une passe du planificateur
+ * 
+ * Lance en parallèle les lectures asynchrones de tous les capteurs échus
+ * (fenêtre SENSOR_SCHEDULER_BATCH_WINDOW_MS) et au plus une lecture
+ * bloquante; les autres capteurs bloquants échus sont décalés à la passe
+ * suivante.
+ * 
+ * @param data Tableau des lectures réussies (sortie)
+ * @param max_count Capacité du tableau
+ * @param count Nombre de lectures réussies (sortie)
+ * @param next_wake_ms Délai avant la prochaine échéance (sortie)
+ * @return ESP_OK si succès
+ */
+esp_err_t sensor_scheduler_poll(sensor_data_t *data, size_t max_count,
+                                size_t *count, uint32_t *next_wake_ms);
+
 // ================================
 // Fonctions de lecture des capteurs
 // ================================
 
 /**
- * @brief Lit les données du capteur DHT22
+ * @brief Lit les données du capteur DHT22 embarqué (instance par défaut)
  * 
  * @param data Pointeur vers la structure de données
  * @return ESP_OK si succès, code d'erreur sinon
@@ -100,7 +198,7 @@ esp_err_t sensor_read_dht22(sensor_data_t *data);
 uint8_t sensor_calculate_quality(const sensor_data_t *data);
 
 /**
- * @brief Obtient les statistiques du gestionnaire de capteurs
+ * @brief Obtient les statistiques du DHT22 embarqué (instance par défaut)
  * 
  * @param stats Pointeur vers la structure de statistiques
  * @return ESP_OK si succès, ESP_ERR_INVALID_ARG sinon
@@ -108,7 +206,16 @@ uint8_t sensor_calculate_quality(const sensor_data_t *data);
 esp_err_t sensor_get_stats(sensor_stats_t *stats);
 
 /**
- * @brief Obtient la dernière lecture de capteur
+ * @brief Obtient les statistiques d'une instance
+ * 
+ * @param sensor_id Identifiant de l'instance
+ * @param stats Pointeur vers la structure de statistiques
+ * @return ESP_OK si succès, ESP_ERR_NOT_FOUND si instance inconnue
+ */
+esp_err_t sensor_get_instance_stats(uint8_t sensor_id, sensor_stats_t *stats);
+
+/**
+ * @brief Obtient la dernière lecture réussie, toutes instances confondues
  * 
  * @param data Pointeur vers la structure de données
  * @return ESP_OK si succès, ESP_ERR_NOT_FOUND si aucune lecture
@@ -130,12 +237,16 @@ esp_err_t sensor_reset_stats(void);
 /**
  * @brief Test de fonctionnement du gestionnaire de capteurs
  * 
+ * Compilée seulement avec CONFIG_APP_SELF_TESTS (profil de développement).
+ * 
  * @return ESP_OK si tous les tests passent, ESP_FAIL sinon
  */
 esp_err_t sensor_manager_self_test(void);
 
 /**
  * @brief Affiche les informations du gestionnaire de capteurs
+ * 
+ * Compilée seulement avec CONFIG_APP_BANNERS (profil de développement).
  */
 void sensor_manager_print_info(void);
 
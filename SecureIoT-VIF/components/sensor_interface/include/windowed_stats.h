@@ -0,0 +1,209 @@
+/**
+ * @file windowed_stats.h
+ * @brief Statistiques glissantes en O(1) - Community Edition
+ * 
+ * Une instance suit une colonne de valeurs float sur une fenêtre de taille
+ * fixe: moyenne/variance de Welford (ajout et retrait), EWMA et min/max par
+ * deques monotones. Le coût d'un ajout ne dépend pas de la taille de la
+ * fenêtre. Plusieurs grandeurs (température, humidité...) utilisent une
+ * instance chacune: les échantillons sont stockés colonne par colonne.
+ * 
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#ifndef WINDOWED_STATS_H
+#define WINDOWED_STATS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+// ================================
+// Constantes
+// ================================
+
+#define WINDOWED_STATS_MAX_WINDOW       (4096)
+#define WINDOWED_STATS_DEFAULT_ALPHA    (0.1f)
+
+/**
+ * @brief Taille du stockage d'une fenêtre, en mots de 32 bits
+ * 
+ * Valeurs float + deux deques d'indices 16 bits (min et max).
+ */
+#define WINDOWED_STATS_STORAGE_WORDS(window)    (2 * (window))
+
+// ================================
+// Types et structures
+// ================================
+
+/**
+ * @brief État d'une colonne de statistiques glissantes
+ * 
+ * Les champs sont internes; utiliser les accesseurs.
+ */
+typedef struct {
+    float *values;                  // Fenêtre circulaire
+    uint16_t *min_deque;            // Positions à valeurs croissantes
+    uint16_t *max_deque;            // Positions à valeurs décroissantes
+    uint16_t capacity;
+    uint16_t count;
+    uint16_t write_pos;
+    uint16_t min_head;
+    uint16_t min_count;
+    uint16_t max_head;
+    uint16_t max_count;
+    
+    double mean;                    // Welford sur la fenêtre
+    double m2;
+    
+    float alpha;                    // EWMA
+    float ewma;
+    float ewma_var;
+    
+    float last;                     // Dernière valeur ajoutée
+    uint32_t total_samples;         // Échantillons depuis l'init
+} windowed_stats_t;
+
+/**
+ * @brief Instantané des statistiques d'une colonne
+ */
+typedef struct {
+    uint16_t count;                 // Échantillons dans la fenêtre
+    float mean;
+    float variance;                 // Variance d'échantillon (n - 1)
+    float stddev;
+    float min;
+    float max;
+    float ewma;
+    float ewma_stddev;
+    float last;
+} windowed_stats_summary_t;
+
+/**
+ * @brief État scalaire d'une colonne, sans pointeurs (sauvegarde/restauration)
+ * 
+ * Avec les valeurs de la fenêtre, suffit à reconstruire la colonne après
+ * un sommeil profond: moyenne, variance et min/max sont recalculés en
+ * rejouant la fenêtre, l'EWMA et le compteur sont repris tels quels.
+ */
+typedef struct {
+    uint16_t count;                 // Valeurs sauvegardées
+    float ewma;
+    float ewma_var;
+    uint32_t total_samples;
+} windowed_stats_state_t;
+
+// ================================
+// Fonctions
+// ================================
+
+/**
+ * @brief Initialise une colonne sur un stockage fourni par l'appelant
+ * 
+ * @param ws Colonne à initialiser
+ * @param window Taille de fenêtre (1..WINDOWED_STATS_MAX_WINDOW)
+ * @param storage Stockage d'au moins WINDOWED_STATS_STORAGE_WORDS(window) mots
+ * @param storage_words Taille du stockage en mots de 32 bits
+ * @param ewma_alpha Facteur de lissage EWMA (0 < alpha <= 1)
+ * @return ESP_OK si succès, ESP_ERR_INVALID_ARG / ESP_ERR_INVALID_SIZE sinon
+ */
+esp_err_t windowed_stats_init(windowed_stats_t *ws, uint16_t window,
+                              uint32_t *storage, size_t storage_words, float ewma_alpha);
+
+/**
+ * @brief Vide la fenêtre (le stockage est conservé)
+ * 
+ * @param ws Colonne
+ */
+void windowed_stats_reset(windowed_stats_t *ws);
+
+/**
+ * @brief Ajoute une valeur, en retirant la plus ancienne si la fenêtre est pleine
+ * 
+ * @param ws Colonne
+ * @param value Valeur à ajouter
+ */
+void windowed_stats_push(windowed_stats_t *ws, float value);
+
+/**
+ * @brief Nombre de valeurs dans la fenêtre
+ */
+uint16_t windowed_stats_count(const windowed_stats_t *ws);
+
+/**
+ * @brief Moyenne de la fenêtre (0 si vide)
+ */
+float windowed_stats_mean(const windowed_stats_t *ws);
+
+/**
+ * @brief Variance d'échantillon de la fenêtre (0 si moins de 2 valeurs)
+ */
+float windowed_stats_variance(const windowed_stats_t *ws);
+
+/**
+ * @brief Écart-type d'échantillon de la fenêtre
+ */
+float windowed_stats_stddev(const windowed_stats_t *ws);
+
+/**
+ * @brief Minimum de la fenêtre (0 si vide)
+ */
+float windowed_stats_min(const windowed_stats_t *ws);
+
+/**
+ * @brief Maximum de la fenêtre (0 si vide)
+ */
+float windowed_stats_max(const windowed_stats_t *ws);
+
+/**
+ * @brief Moyenne mobile exponentielle
+ */
+float windowed_stats_ewma(const windowed_stats_t *ws);
+
+/**
+ * @brief Dernière valeur ajoutée
+ */
+float windowed_stats_last(const windowed_stats_t *ws);
+
+/**
+ * @brief Sauvegarde la fenêtre (du plus ancien au plus récent) et l'état scalaire
+ * 
+ * @param ws Colonne
+ * @param values Valeurs de la fenêtre (sortie)
+ * @param max_values Capacité de values: seules les plus récentes sont gardées
+ * @param state État scalaire (sortie)
+ */
+void windowed_stats_save(const windowed_stats_t *ws, float *values, uint16_t max_values,
+                         windowed_stats_state_t *state);
+
+/**
+ * @brief Reconstruit une colonne initialisée à partir d'une sauvegarde
+ * 
+ * @param ws Colonne (windowed_stats_init déjà appelé)
+ * @param values Valeurs sauvegardées
+ * @param state État scalaire sauvegardé
+ * @return ESP_OK, ESP_ERR_INVALID_SIZE si la sauvegarde dépasse la fenêtre
+ */
+esp_err_t windowed_stats_restore(windowed_stats_t *ws, const float *values,
+                                 const windowed_stats_state_t *state);
+
+/**
+ * @brief Remplit un instantané de toutes les statistiques
+ * 
+ * @param ws Colonne
+ * @param summary Instantané (sortie)
+ */
+void windowed_stats_get_summary(const windowed_stats_t *ws, windowed_stats_summary_t *summary);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* WINDOWED_STATS_H */
\ No newline at end of file
@@ -0,0 +1,279 @@
+/**
+ * @file sample_ring.c
+ * @brief Anneau d'échantillons capteurs sans verrou pour SecureIoT-VIF Community Edition
+ * 
+ * Chaque emplacement porte un numéro de séquence (seqlock): impair pendant
+ * l'écriture, 2 * index + 2 une fois l'échantillon publié. Un consommateur
+ * valide la séquence avant et après sa copie; une séquence inattendue
+ * signifie que le producteur l'a dépassé, il se recale alors sur le plus
+ * ancien échantillon encore valide et comptabilise les pertes.
+ * 
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#include <string.h>
+#include <stdatomic.h>
+#include "esp_log.h"
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "sample_ring.h"
+
+static const char *TAG = "SAMPLE_RING_COMMUNITY";
+
+#define SAMPLE_RING_MASK                (SAMPLE_RING_CAPACITY - 1)
+
+_Static_assert((SAMPLE_RING_CAPACITY & SAMPLE_RING_MASK) == 0,
+               "SAMPLE_RING_CAPACITY doit être une puissance de 2");
+
+/**
+ * @brief Emplacement de l'anneau
+ */
+typedef struct {
+    atomic_uint seq;                // Séquence seqlock de l'emplacement
+    sensor_data_t sample;
+} __attribute__((aligned(SAMPLE_RING_ALIGN))) sample_ring_slot_t;
+
+/**
+ * @brief Curseur d'un consommateur (une ligne par consommateur)
+ */
+typedef struct {
+    bool in_use;
+    char name[SAMPLE_RING_CONSUMER_NAME_LEN];
+    uint32_t cursor;                // Prochain index à lire
+    uint32_t samples_read;
+    uint32_t samples_dropped;
+} __attribute__((aligned(SAMPLE_RING_ALIGN))) sample_ring_consumer_t;
+
+// Variables globales de l'anneau
+static bool sample_ring_initialized = false;
+static sample_ring_slot_t ring_slots[SAMPLE_RING_CAPACITY];
+static atomic_uint ring_head __attribute__((aligned(SAMPLE_RING_ALIGN)));
+static sample_ring_consumer_t ring_consumers[SAMPLE_RING_MAX_CONSUMERS];
+static portMUX_TYPE ring_consumers_lock = portMUX_INITIALIZER_UNLOCKED;
+
+/**
+ * @brief Séquence d'un emplacement publié pour l'index donné
+ */
+static inline uint32_t sample_ring_published_seq(uint32_t index) {
+    return 2 * index + 2;
+}
+
+/**
+ * @brief Initialise l'anneau d'échantillons
+ */
+esp_err_t sample_ring_init(void) {
+    if (sample_ring_initialized) {
+        ESP_LOGW(TAG, "Anneau d'échantillons déjà initialisé");
+        return ESP_OK;
+    }
+    
+    for (uint32_t i = 0; i < SAMPLE_RING_CAPACITY; i++) {
+        atomic_init(&ring_slots[i].seq, 0);
+    }
+    atomic_init(&ring_head, 0);
+    memset(ring_consumers, 0, sizeof(ring_consumers));
+    
+    sample_ring_initialized = true;
+    ESP_LOGI(TAG, "✅ Anneau d'échantillons initialisé: %d emplacements (%d octets)",
+             SAMPLE_RING_CAPACITY, (int)sizeof(ring_slots));
+    
+    return ESP_OK;
+}
+
+/**
+ * @brief Enregistre un consommateur
+ */
+esp_err_t sample_ring_register_consumer(const char *name, bool from_oldest, uint8_t *consumer_id) {
+    if (!sample_ring_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    if (name == NULL || consumer_id == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    uint8_t slot = SAMPLE_RING_CONSUMER_INVALID;
+    portENTER_CRITICAL(&ring_consumers_lock);
+    for (uint8_t i = 0; i < SAMPLE_RING_MAX_CONSUMERS; i++) {
+        if (!ring_consumers[i].in_use) {
+            ring_consumers[i].in_use = true;
+            slot = i;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&ring_consumers_lock);
+    
+    if (slot == SAMPLE_RING_CONSUMER_INVALID) {
+        ESP_LOGE(TAG, "❌ Plus d'emplacement consommateur (%d)", SAMPLE_RING_MAX_CONSUMERS);
+        return ESP_ERR_NO_MEM;
+    }
+    
+    sample_ring_consumer_t *consumer = &ring_consumers[slot];
+    uint32_t head = atomic_load_explicit(&ring_head, memory_order_acquire);
+    uint32_t cursor = head;
+    if (from_oldest) {
+        cursor = (head > SAMPLE_RING_CAPACITY) ? head - SAMPLE_RING_CAPACITY : 0;
+    }
+    
+    strncpy(consumer->name, name, SAMPLE_RING_CONSUMER_NAME_LEN - 1);
+    consumer->name[SAMPLE_RING_CONSUMER_NAME_LEN - 1] = '\0';
+    consumer->cursor = cursor;
+    consumer->samples_read = 0;
+    consumer->samples_dropped = 0;
+    
+    *consumer_id = slot;
+    ESP_LOGI(TAG, "📍 Consommateur '%s' enregistré (id=%d)", consumer->name, slot);
+    return ESP_OK;
+}
+
+/**
+ * @brief Ajoute un échantillon
+ */
+esp_err_t sample_ring_push(const sensor_data_t *sample) {
+    if (!sample_ring_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    if (sample == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    // Producteur unique: la tête n'est modifiée qu'ici
+    uint32_t head = atomic_load_explicit(&ring_head, memory_order_relaxed);
+    sample_ring_slot_t *slot = &ring_slots[head & SAMPLE_RING_MASK];
+    
+    atomic_store_explicit(&slot->seq, 2 * head + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    memcpy(&slot->sample, sample, sizeof(sensor_data_t));
+    atomic_store_explicit(&slot->seq, sample_ring_published_seq(head), memory_order_release);
+    
+    atomic_store_explicit(&ring_head, head + 1, memory_order_release);
+    return ESP_OK;
+}
+
+/**
+ * @brief Lit un lot d'échantillons pour un consommateur
+ */
+size_t sample_ring_read(uint8_t consumer_id, sensor_data_t *samples, size_t max_samples) {
+    if (!sample_ring_initialized || samples == NULL ||
+        consumer_id >= SAMPLE_RING_MAX_CONSUMERS || !ring_consumers[consumer_id].in_use) {
+        return 0;
+    }
+    
+    sample_ring_consumer_t *consumer = &ring_consumers[consumer_id];
+    uint32_t cursor = consumer->cursor;
+    uint32_t head = atomic_load_explicit(&ring_head, memory_order_acquire);
+    size_t count = 0;
+    
+    // Trop de retard: les plus anciens sont déjà écrasés
+    if (head - cursor > SAMPLE_RING_CAPACITY) {
+        consumer->samples_dropped += head - cursor - SAMPLE_RING_CAPACITY;
+        cursor = head - SAMPLE_RING_CAPACITY;
+    }
+    
+    while (count < max_samples && cursor != head) {
+        sample_ring_slot_t *slot = &ring_slots[cursor & SAMPLE_RING_MASK];
+        uint32_t expected = sample_ring_published_seq(cursor);
+        
+        uint32_t seq_before = atomic_load_explicit(&slot->seq, memory_order_acquire);
+        if (seq_before == expected) {
+            memcpy(&samples[count], &slot->sample, sizeof(sensor_data_t));
+            atomic_thread_fence(memory_order_acquire);
+            uint32_t seq_after = atomic_load_explicit(&slot->seq, memory_order_relaxed);
+            if (seq_after == expected) {
+                count++;
+                cursor++;
+                continue;
+            }
+        }
+        
+        // Dépassé par le producteur pendant la lecture: se recaler
+        head = atomic_load_explicit(&ring_head, memory_order_acquire);
+        uint32_t oldest = head - SAMPLE_RING_CAPACITY + 1;  // L'emplacement suivant peut être en écriture
+        if ((int32_t)(oldest - cursor) > 0) {
+            consumer->samples_dropped += oldest - cursor;
+            cursor = oldest;
+        } else {
+            cursor++;
+            consumer->samples_dropped++;
+        }
+    }
+    
+    consumer->cursor = cursor;
+    consumer->samples_read += count;
+    return count;
+}
+
+/**
+ * @brief Obtient les statistiques d'un consommateur
+ */
+esp_err_t sample_ring_get_consumer_stats(uint8_t consumer_id, sample_ring_consumer_stats_t *stats) {
+    if (stats == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    if (consumer_id >= SAMPLE_RING_MAX_CONSUMERS || !ring_consumers[consumer_id].in_use) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    
+    const sample_ring_consumer_t *consumer = &ring_consumers[consumer_id];
+    uint32_t head = atomic_load_explicit(&ring_head, memory_order_acquire);
+    uint32_t lag = head - consumer->cursor;
+    
+    stats->samples_read = consumer->samples_read;
+    stats->samples_dropped = consumer->samples_dropped;
+    stats->lag = (lag > SAMPLE_RING_CAPACITY) ? SAMPLE_RING_CAPACITY : lag;
+    return ESP_OK;
+}
+
+/**
+ * @brief Obtient les statistiques globales de l'anneau
+ */
+esp_err_t sample_ring_get_stats(sample_ring_stats_t *stats) {
+    if (stats == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    if (!sample_ring_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    stats->samples_pushed = atomic_load_explicit(&ring_head, memory_order_acquire);
+    stats->capacity = SAMPLE_RING_CAPACITY;
+    stats->consumers = 0;
+    for (uint8_t i = 0; i < SAMPLE_RING_MAX_CONSUMERS; i++) {
+        if (ring_consumers[i].in_use) {
+            stats->consumers++;
+        }
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief Affiche les statistiques de l'anneau et des consommateurs
+ */
+void sample_ring_print_stats(void) {
+    sample_ring_stats_t stats;
+    if (sample_ring_get_stats(&stats) != ESP_OK) {
+        ESP_LOGW(TAG, "Anneau d'échantillons non initialisé");
+        return;
+    }
+    
+    ESP_LOGI(TAG, "📊 === Anneau d'échantillons Community ===");
+    ESP_LOGI(TAG, "Échantillons produits: %d", stats.samples_pushed);
+    ESP_LOGI(TAG, "Capacité: %d", stats.capacity);
+    
+    for (uint8_t i = 0; i < SAMPLE_RING_MAX_CONSUMERS; i++) {
+        sample_ring_consumer_stats_t consumer_stats;
+        if (sample_ring_get_consumer_stats(i, &consumer_stats) != ESP_OK) {
+            continue;
+        }
+        ESP_LOGI(TAG, "  [%d] %s: lus=%d, perdus=%d, retard=%d",
+                 i, ring_consumers[i].name, consumer_stats.samples_read,
+                 consumer_stats.samples_dropped, consumer_stats.lag);
+    }
+    
+    ESP_LOGI(TAG, "=========================================");
+}
\ No newline at end of file
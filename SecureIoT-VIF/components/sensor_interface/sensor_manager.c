@@ -19,15 +19,235 @@
 #include "driver/gpio.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+#include "sdkconfig.h"
 #include "sensor_manager.h"
+#include "perf_trace.h"
+#include "windowed_stats.h"
 #include "dht22_driver.h"
 
 static const char *TAG = "SENSOR_COMMUNITY";
 
+/**
+ * @brief État de la lecture asynchrone d'une instance
+ */
+typedef enum {
+    SENSOR_ASYNC_IDLE = 0,
+    SENSOR_ASYNC_PENDING,
+    SENSOR_ASYNC_DONE
+} sensor_async_state_t;
+
+/**
+ * @brief Instance de capteur enregistrée
+ */
+typedef struct {
+    bool in_use;
+    char name[SENSOR_NAME_MAX_LEN];
+    const sensor_driver_ops_t *ops;
+    void *ctx;
+    uint32_t period_ms;
+    uint64_t next_due_ms;
+    sensor_stats_t stats;
+    
+    // Fenêtres glissantes (une colonne par grandeur)
+    windowed_stats_t temperature_window;
+    windowed_stats_t humidity_window;
+    uint32_t temperature_storage[WINDOWED_STATS_STORAGE_WORDS(SENSOR_STATS_WINDOW_SIZE)];
+    uint32_t humidity_storage[WINDOWED_STATS_STORAGE_WORDS(SENSOR_STATS_WINDOW_SIZE)];
+    
+    // Lecture asynchrone en cours (protégée par sensor_registry_lock)
+    sensor_async_state_t async_state;
+    esp_err_t async_result;
+    float async_temperature;
+    float async_humidity;
+    int64_t async_start_us;
+    int64_t async_done_us;
+} sensor_instance_t;
+
 // Variables globales du gestionnaire de capteurs
 static bool sensor_manager_initialized = false;
-static sensor_stats_t sensor_stats = {0};
+static sensor_instance_t sensor_instances[SENSOR_MAX_INSTANCES];
+static portMUX_TYPE sensor_registry_lock = portMUX_INITIALIZER_UNLOCKED;
+static SemaphoreHandle_t sensor_async_done = NULL;
+static StaticSemaphore_t sensor_async_done_buffer;
+static uint8_t sensor_dht22_id = SENSOR_ID_INVALID;
 static sensor_data_t last_sensor_data = {0};
+static uint32_t last_sensor_data_count = 0;
+
+// ================================
+// Adaptateur DHT22 embarqué
+// ================================
+
+static esp_err_t sensor_dht22_init(void *ctx) {
+    return dht22_driver_init();
+}
+
+static esp_err_t sensor_dht22_read(void *ctx, float *temperature, float *humidity) {
+    return dht22_read_data(temperature, humidity);
+}
+
+static esp_err_t sensor_dht22_read_async(void *ctx, sensor_read_done_cb_t callback, void *arg) {
+    if (dht22_get_read_mode() == DHT22_MODE_BLOCKING) {
+        // Mode bloquant imposé: complétion immédiate dans la tâche appelante
+        float temperature = 0.0f, humidity = 0.0f;
+        esp_err_t ret = dht22_read_data(&temperature, &humidity);
+        callback(ret, temperature, humidity, arg);
+        return ESP_OK;
+    }
+    return dht22_read_async(callback, arg);
+}
+
+static esp_err_t sensor_dht22_deinit(void *ctx) {
+    return dht22_driver_deinit();
+}
+
+static const sensor_driver_ops_t sensor_dht22_ops = {
+    .type_name = "DHT22",
+    .init = sensor_dht22_init,
+    .read = sensor_dht22_read,
+    .read_async = sensor_dht22_read_async,
+    .deinit = sensor_dht22_deinit,
+    .temperature_min = DHT22_TEMP_MIN,
+    .temperature_max = DHT22_TEMP_MAX,
+    .humidity_min = DHT22_HUMIDITY_MIN,
+    .humidity_max = DHT22_HUMIDITY_MAX
+};
+
+// ================================
+// Fonctions internes
+// ================================
+
+/**
+ * @brief Retourne l'instance si l'identifiant est valide
+ */
+static sensor_instance_t *sensor_get_instance(uint8_t sensor_id) {
+    if (sensor_id >= SENSOR_MAX_INSTANCES || !sensor_instances[sensor_id].in_use) {
+        return NULL;
+    }
+    return &sensor_instances[sensor_id];
+}
+
+/**
+ * @brief Planifie la prochaine échéance sans rattraper les périodes manquées
+ */
+static void sensor_schedule_next(sensor_instance_t *inst, uint64_t now_ms) {
+    inst->next_due_ms += inst->period_ms;
+    if (inst->next_due_ms <= now_ms) {
+        inst->next_due_ms = now_ms + inst->period_ms;
+    }
+}
+
+/**
+ * @brief Valide une lecture et met à jour les statistiques de l'instance
+ */
+static esp_err_t sensor_record_reading(sensor_instance_t *inst, esp_err_t ret,
+                                       float temperature, float humidity,
+                                       uint32_t read_duration, sensor_data_t *data) {
+    sensor_stats_t *stats = &inst->stats;
+    stats->total_readings++;
+    
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ Erreur lecture %s: %s", inst->name, esp_err_to_name(ret));
+        stats->failed_readings++;
+        stats->last_error_time = esp_timer_get_time() / 1000;
+        return ret;
+    }
+    
+    // Valider les données
+    if (temperature < inst->ops->temperature_min || temperature > inst->ops->temperature_max ||
+        humidity < inst->ops->humidity_min || humidity > inst->ops->humidity_max) {
+        ESP_LOGW(TAG, "⚠️  Données hors limites (%s): T=%.1f°C, H=%.1f%%",
+                 inst->name, temperature, humidity);
+        stats->invalid_readings++;
+        return ESP_ERR_INVALID_RESPONSE;
+    }
+    
+    // Remplir la structure de données
+    data->temperature = temperature;
+    data->humidity = humidity;
+    data->timestamp = esp_timer_get_time() / 1000;
+    data->read_duration_ms = read_duration;
+    data->sensor_id = (uint8_t)(inst - sensor_instances);
+    
+    // Calculer la qualité des données (basique)
+    data->quality_score = sensor_calculate_quality(data);
+    
+    // Mettre à jour les statistiques
+    stats->successful_readings++;
+    stats->last_reading_time = data->timestamp;
+    stats->total_read_time_ms += read_duration;
+    
+    // Mettre à jour les min/max
+    if (stats->successful_readings == 1 || temperature < stats->min_temperature) {
+        stats->min_temperature = temperature;
+    }
+    if (stats->successful_readings == 1 || temperature > stats->max_temperature) {
+        stats->max_temperature = temperature;
+    }
+    if (stats->successful_readings == 1 || humidity < stats->min_humidity) {
+        stats->min_humidity = humidity;
+    }
+    if (stats->successful_readings == 1 || humidity > stats->max_humidity) {
+        stats->max_humidity = humidity;
+    }
+    
+    // Moyennes et écarts-types glissants (O(1) par lecture)
+    windowed_stats_push(&inst->temperature_window, temperature);
+    windowed_stats_push(&inst->humidity_window, humidity);
+    stats->avg_temperature = windowed_stats_mean(&inst->temperature_window);
+    stats->avg_humidity = windowed_stats_mean(&inst->humidity_window);
+    stats->stddev_temperature = windowed_stats_stddev(&inst->temperature_window);
+    stats->stddev_humidity = windowed_stats_stddev(&inst->humidity_window);
+    
+    // Sauvegarder la dernière lecture
+    memcpy(&last_sensor_data, data, sizeof(sensor_data_t));
+    last_sensor_data_count++;
+    
+    ESP_LOGD(TAG, "✅ Lecture %s réussie: T=%.1f°C, H=%.1f%%, Q=%d, durée=%dms",
+             inst->name, temperature, humidity, data->quality_score, read_duration);
+    
+    return ESP_OK;
+}
+
+/**
+ * @brief Lecture bloquante d'une instance
+ */
+static esp_err_t sensor_read_instance(sensor_instance_t *inst, sensor_data_t *data) {
+    PERF_TRACE_SCOPE(PERF_SPAN_SENSOR_READ);
+    uint32_t start_time = esp_timer_get_time() / 1000;
+    
+    float temperature = 0.0f, humidity = 0.0f;
+    esp_err_t ret = inst->ops->read(inst->ctx, &temperature, &humidity);
+    
+    uint32_t read_duration = (esp_timer_get_time() / 1000) - start_time;
+    return sensor_record_reading(inst, ret, temperature, humidity, read_duration, data);
+}
+
+/**
+ * @brief Fin de lecture asynchrone: mémorise le résultat et réveille la passe
+ * 
+ * Une complétion arrivée après l'expiration de la passe est ignorée.
+ */
+static void sensor_async_read_done(esp_err_t result, float temperature, float humidity, void *arg) {
+    sensor_instance_t *inst = (sensor_instance_t *)arg;
+    bool signal = false;
+    
+    portENTER_CRITICAL(&sensor_registry_lock);
+    if (inst->async_state == SENSOR_ASYNC_PENDING) {
+        inst->async_result = result;
+        inst->async_temperature = temperature;
+        inst->async_humidity = humidity;
+        inst->async_done_us = esp_timer_get_time();
+        inst->async_state = SENSOR_ASYNC_DONE;
+        signal = true;
+    }
+    portEXIT_CRITICAL(&sensor_registry_lock);
+    
+    if (signal) {
+        xSemaphoreGive(sensor_async_done);
+    }
+}
 
 /**
  * @brief Initialise le gestionnaire de capteurs Community
@@ -40,19 +260,34 @@ esp_err_t sensor_manager_init(void) {
     
     ESP_LOGI(TAG, "🌡️ Initialisation gestionnaire de capteurs Community");
     
-    // Initialiser le driver DHT22
-    esp_err_t ret = dht22_driver_init();
+    memset(sensor_instances, 0, sizeof(sensor_instances));
+    memset(&last_sensor_data, 0, sizeof(last_sensor_data));
+    last_sensor_data_count = 0;
+    
+    sensor_async_done = xSemaphoreCreateCountingStatic(SENSOR_MAX_INSTANCES, 0, &sensor_async_done_buffer);
+    if (sensor_async_done == NULL) {
+        ESP_LOGE(TAG, "❌ Échec création sémaphore de complétion");
+        return ESP_ERR_NO_MEM;
+    }
+    
+    sensor_manager_initialized = true;
+    
+    // Enregistrer le DHT22 embarqué
+    sensor_config_t dht22_config = {
+        .name = "dht22",
+        .ops = &sensor_dht22_ops,
+        .ctx = NULL,
+        .period_ms = SENSOR_READ_INTERVAL_MS
+    };
+    esp_err_t ret = sensor_register(&dht22_config, &sensor_dht22_id);
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "❌ Échec initialisation driver DHT22: %s", esp_err_to_name(ret));
+        vSemaphoreDelete(sensor_async_done);
+        sensor_async_done = NULL;
+        sensor_manager_initialized = false;
         return ret;
     }
     
-    // Réinitialiser les statistiques
-    memset(&sensor_stats, 0, sizeof(sensor_stats));
-    memset(&last_sensor_data, 0, sizeof(last_sensor_data));
-    sensor_stats.start_time = esp_timer_get_time() / 1000;
-    
-    sensor_manager_initialized = true;
     ESP_LOGI(TAG, "✅ Gestionnaire de capteurs Community initialisé");
     ESP_LOGI(TAG, "💡 Fonctionnalité complète - identique à Enterprise");
     
@@ -67,95 +302,329 @@ esp_err_t sensor_manager_deinit(void) {
         return ESP_OK;
     }
     
-    esp_err_t ret = dht22_driver_deinit();
+    esp_err_t ret = ESP_OK;
+    for (uint8_t i = 0; i < SENSOR_MAX_INSTANCES; i++) {
+        if (sensor_instances[i].in_use && sensor_instances[i].ops->deinit != NULL) {
+            esp_err_t deinit_ret = sensor_instances[i].ops->deinit(sensor_instances[i].ctx);
+            if (deinit_ret != ESP_OK) {
+                ret = deinit_ret;
+            }
+        }
+        sensor_instances[i].in_use = false;
+    }
+    
+    if (sensor_async_done != NULL) {
+        vSemaphoreDelete(sensor_async_done);
+        sensor_async_done = NULL;
+    }
+    
+    sensor_dht22_id = SENSOR_ID_INVALID;
     sensor_manager_initialized = false;
     
     ESP_LOGI(TAG, "🔓 Gestionnaire de capteurs déinitialisé");
     return ret;
 }
 
+// ================================
+// Registre de capteurs
+// ================================
+
 /**
- * @brief Lit les données du capteur DHT22
+ * @brief Enregistre une instance de capteur
  */
-esp_err_t sensor_read_dht22(sensor_data_t *data) {
+esp_err_t sensor_register(const sensor_config_t *config, uint8_t *sensor_id) {
     if (!sensor_manager_initialized) {
-        ESP_LOGE(TAG, "❌ Gestionnaire non initialisé");
         return ESP_ERR_INVALID_STATE;
     }
     
-    if (data == NULL) {
-        ESP_LOGE(TAG, "❌ Paramètre data invalide");
+    if (config == NULL || sensor_id == NULL || config->ops == NULL ||
+        config->ops->read == NULL || config->period_ms < SENSOR_SCHEDULER_MIN_PERIOD_MS) {
         return ESP_ERR_INVALID_ARG;
     }
     
-    ESP_LOGD(TAG, "📊 Lecture capteur DHT22...");
+    // Réserver un emplacement
+    uint8_t slot = SENSOR_ID_INVALID;
+    portENTER_CRITICAL(&sensor_registry_lock);
+    for (uint8_t i = 0; i < SENSOR_MAX_INSTANCES; i++) {
+        if (!sensor_instances[i].in_use && sensor_instances[i].ops == NULL) {
+            sensor_instances[i].ops = config->ops;  // Réservé, pas encore actif
+            slot = i;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&sensor_registry_lock);
     
-    uint32_t start_time = esp_timer_get_time() / 1000;
-    sensor_stats.total_readings++;
+    if (slot == SENSOR_ID_INVALID) {
+        ESP_LOGE(TAG, "❌ Registre de capteurs plein (%d)", SENSOR_MAX_INSTANCES);
+        return ESP_ERR_NO_MEM;
+    }
     
-    // Lire les données du DHT22
-    float temperature, humidity;
-    esp_err_t ret = dht22_read_data(&temperature, &humidity);
+    sensor_instance_t *inst = &sensor_instances[slot];
     
-    uint32_t read_duration = (esp_timer_get_time() / 1000) - start_time;
+    if (config->ops->init != NULL) {
+        esp_err_t ret = config->ops->init(config->ctx);
+        if (ret != ESP_OK) {
+            inst->ops = NULL;
+            return ret;
+        }
+    }
     
-    if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "❌ Erreur lecture DHT22: %s", esp_err_to_name(ret));
-        sensor_stats.failed_readings++;
-        sensor_stats.last_error_time = esp_timer_get_time() / 1000;
-        return ret;
+    strncpy(inst->name, config->name != NULL ? config->name : config->ops->type_name,
+            SENSOR_NAME_MAX_LEN - 1);
+    inst->name[SENSOR_NAME_MAX_LEN - 1] = '\0';
+    inst->ctx = config->ctx;
+    inst->period_ms = config->period_ms;
+    inst->async_state = SENSOR_ASYNC_IDLE;
+    memset(&inst->stats, 0, sizeof(inst->stats));
+    windowed_stats_init(&inst->temperature_window, SENSOR_STATS_WINDOW_SIZE,
+                        inst->temperature_storage, WINDOWED_STATS_STORAGE_WORDS(SENSOR_STATS_WINDOW_SIZE),
+                        SENSOR_STATS_EWMA_ALPHA);
+    windowed_stats_init(&inst->humidity_window, SENSOR_STATS_WINDOW_SIZE,
+                        inst->humidity_storage, WINDOWED_STATS_STORAGE_WORDS(SENSOR_STATS_WINDOW_SIZE),
+                        SENSOR_STATS_EWMA_ALPHA);
+    inst->stats.start_time = esp_timer_get_time() / 1000;
+    
+    // Étaler les premières échéances entre emplacements
+    inst->next_due_ms = inst->stats.start_time + (uint64_t)slot * SENSOR_SCHEDULER_STAGGER_MS;
+    inst->in_use = true;
+    
+    *sensor_id = slot;
+    ESP_LOGI(TAG, "📍 Capteur '%s' (%s) enregistré: id=%d, période=%dms",
+             inst->name, config->ops->type_name, slot, config->period_ms);
+    
+    return ESP_OK;
+}
+
+/**
+ * @brief Retire une instance du registre
+ */
+esp_err_t sensor_unregister(uint8_t sensor_id) {
+    sensor_instance_t *inst = sensor_get_instance(sensor_id);
+    if (inst == NULL) {
+        return ESP_ERR_NOT_FOUND;
     }
     
-    // Valider les données
-    if (temperature < DHT22_TEMP_MIN || temperature > DHT22_TEMP_MAX ||
-        humidity < DHT22_HUMIDITY_MIN || humidity > DHT22_HUMIDITY_MAX) {
-        ESP_LOGW(TAG, "⚠️  Données hors limites: T=%.1f°C, H=%.1f%%", temperature, humidity);
-        sensor_stats.invalid_readings++;
-        return ESP_ERR_INVALID_RESPONSE;
+    portENTER_CRITICAL(&sensor_registry_lock);
+    bool busy = (inst->async_state == SENSOR_ASYNC_PENDING);
+    if (!busy) {
+        inst->in_use = false;
     }
+    portEXIT_CRITICAL(&sensor_registry_lock);
     
-    // Remplir la structure de données
-    data->temperature = temperature;
-    data->humidity = humidity;
-    data->timestamp = esp_timer_get_time() / 1000;
-    data->read_duration_ms = read_duration;
+    if (busy) {
+        return ESP_ERR_INVALID_STATE;
+    }
     
-    // Calculer la qualité des données (basique)
-    data->quality_score = sensor_calculate_quality(data);
+    esp_err_t ret = ESP_OK;
+    if (inst->ops->deinit != NULL) {
+        ret = inst->ops->deinit(inst->ctx);
+    }
     
-    // Mettre à jour les statistiques
-    sensor_stats.successful_readings++;
-    sensor_stats.last_reading_time = data->timestamp;
-    sensor_stats.total_read_time_ms += read_duration;
+    if (sensor_id == sensor_dht22_id) {
+        sensor_dht22_id = SENSOR_ID_INVALID;
+    }
     
-    // Mettre à jour les min/max
-    if (sensor_stats.successful_readings == 1 || temperature < sensor_stats.min_temperature) {
-        sensor_stats.min_temperature = temperature;
+    ESP_LOGI(TAG, "🔓 Capteur '%s' retiré (id=%d)", inst->name, sensor_id);
+    inst->ops = NULL;
+    return ret;
+}
+
+/**
+ * @brief Modifie la période d'échantillonnage d'une instance
+ */
+esp_err_t sensor_set_period(uint8_t sensor_id, uint32_t period_ms) {
+    sensor_instance_t *inst = sensor_get_instance(sensor_id);
+    if (inst == NULL) {
+        return ESP_ERR_NOT_FOUND;
     }
-    if (sensor_stats.successful_readings == 1 || temperature > sensor_stats.max_temperature) {
-        sensor_stats.max_temperature = temperature;
+    
+    if (period_ms < SENSOR_SCHEDULER_MIN_PERIOD_MS) {
+        return ESP_ERR_INVALID_ARG;
     }
-    if (sensor_stats.successful_readings == 1 || humidity < sensor_stats.min_humidity) {
-        sensor_stats.min_humidity = humidity;
+    
+    inst->period_ms = period_ms;
+    return ESP_OK;
+}
+
+/**
+ * @brief Nombre d'instances enregistrées
+ */
+size_t sensor_get_count(void) {
+    size_t count = 0;
+    for (uint8_t i = 0; i < SENSOR_MAX_INSTANCES; i++) {
+        if (sensor_instances[i].in_use) {
+            count++;
+        }
     }
-    if (sensor_stats.successful_readings == 1 || humidity > sensor_stats.max_humidity) {
-        sensor_stats.max_humidity = humidity;
+    return count;
+}
+
+/**
+ * @brief Lit immédiatement une instance
+ */
+esp_err_t sensor_read(uint8_t sensor_id, sensor_data_t *data) {
+    if (!sensor_manager_initialized) {
+        ESP_LOGE(TAG, "❌ Gestionnaire non initialisé");
+        return ESP_ERR_INVALID_STATE;
     }
     
-    // Calculer les moyennes mobiles
-    if (sensor_stats.successful_readings > 1) {
-        sensor_stats.avg_temperature = (sensor_stats.avg_temperature * (sensor_stats.successful_readings - 1) + temperature) / sensor_stats.successful_readings;
-        sensor_stats.avg_humidity = (sensor_stats.avg_humidity * (sensor_stats.successful_readings - 1) + humidity) / sensor_stats.successful_readings;
-    } else {
-        sensor_stats.avg_temperature = temperature;
-        sensor_stats.avg_humidity = humidity;
+    if (data == NULL) {
+        ESP_LOGE(TAG, "❌ Paramètre data invalide");
+        return ESP_ERR_INVALID_ARG;
     }
     
-    // Sauvegarder la dernière lecture
-    memcpy(&last_sensor_data, data, sizeof(sensor_data_t));
+    sensor_instance_t *inst = sensor_get_instance(sensor_id);
+    if (inst == NULL) {
+        return ESP_ERR_NOT_FOUND;
+    }
     
-    ESP_LOGD(TAG, "✅ Lecture DHT22 réussie: T=%.1f°C, H=%.1f%%, Q=%d, durée=%dms",
-             temperature, humidity, data->quality_score, read_duration);
+    return sensor_read_instance(inst, data);
+}
+
+/**
+ * @brief Lit les données du capteur DHT22
+ */
+esp_err_t sensor_read_dht22(sensor_data_t *data) {
+    ESP_LOGD(TAG, "📊 Lecture capteur DHT22...");
+    return sensor_read(sensor_dht22_id, data);
+}
+
+// ================================
+// Planificateur
+// ================================
+
+/**
+ * @brief Exécute une passe du planificateur
+ */
+esp_err_t sensor_scheduler_poll(sensor_data_t *data, size_t max_count,
+                                size_t *count, uint32_t *next_wake_ms) {
+    if (!sensor_manager_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    if (data == NULL || count == NULL || next_wake_ms == NULL || max_count == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    *count = 0;
+    uint64_t now_ms = esp_timer_get_time() / 1000;
+    uint64_t horizon_ms = now_ms + SENSOR_SCHEDULER_BATCH_WINDOW_MS;
+    size_t reserved = 0;
+    size_t launched = 0;
+    sensor_instance_t *blocking = NULL;
+    bool blocking_deferred = false;
+    
+    // Purger les complétions d'une passe précédente expirée
+    while (xSemaphoreTake(sensor_async_done, 0) == pdTRUE) {
+    }
+    
+    // Phase 1: lancer en parallèle toutes les lectures asynchrones échues
+    for (uint8_t i = 0; i < SENSOR_MAX_INSTANCES; i++) {
+        sensor_instance_t *inst = &sensor_instances[i];
+        if (!inst->in_use || inst->next_due_ms > horizon_ms) {
+            continue;
+        }
+        
+        if (inst->ops->read_async == NULL) {
+            // Une seule lecture bloquante par passe: la plus en retard
+            if (blocking == NULL || inst->next_due_ms < blocking->next_due_ms) {
+                blocking_deferred |= (blocking != NULL);
+                blocking = inst;
+            } else {
+                blocking_deferred = true;
+            }
+            continue;
+        }
+        
+        if (reserved >= max_count) {
+            continue;   // Reste échu, traité à la passe suivante
+        }
+        
+        portENTER_CRITICAL(&sensor_registry_lock);
+        inst->async_state = SENSOR_ASYNC_PENDING;
+        inst->async_start_us = esp_timer_get_time();
+        portEXIT_CRITICAL(&sensor_registry_lock);
+        
+        esp_err_t ret = inst->ops->read_async(inst->ctx, sensor_async_read_done, inst);
+        if (ret != ESP_OK) {
+            portENTER_CRITICAL(&sensor_registry_lock);
+            inst->async_state = SENSOR_ASYNC_IDLE;
+            portEXIT_CRITICAL(&sensor_registry_lock);
+            sensor_record_reading(inst, ret, 0.0f, 0.0f, 0, &data[*count]);
+            sensor_schedule_next(inst, now_ms);
+            continue;
+        }
+        
+        reserved++;
+        launched++;
+    }
+    
+    // Phase 2: la lecture bloquante s'exécute pendant que les trames asynchrones arrivent
+    if (blocking != NULL && reserved < max_count) {
+        reserved++;
+        if (sensor_read_instance(blocking, &data[*count]) == ESP_OK) {
+            (*count)++;
+        }
+        sensor_schedule_next(blocking, now_ms);
+    } else if (blocking != NULL) {
+        blocking_deferred = true;
+    }
+    
+    // Phase 3: attendre les complétions asynchrones
+    TickType_t wait_start = xTaskGetTickCount();
+    TickType_t wait_budget = pdMS_TO_TICKS(SENSOR_SCHEDULER_ASYNC_TIMEOUT_MS);
+    for (size_t done = 0; done < launched; done++) {
+        TickType_t elapsed = xTaskGetTickCount() - wait_start;
+        TickType_t remaining = (elapsed < wait_budget) ? (wait_budget - elapsed) : 0;
+        if (xSemaphoreTake(sensor_async_done, remaining) != pdTRUE) {
+            break;
+        }
+    }
+    
+    // Phase 4: collecter les résultats (les lectures non terminées expirent)
+    for (uint8_t i = 0; i < SENSOR_MAX_INSTANCES && launched > 0; i++) {
+        sensor_instance_t *inst = &sensor_instances[i];
+        if (!inst->in_use) {
+            continue;
+        }
+        
+        portENTER_CRITICAL(&sensor_registry_lock);
+        sensor_async_state_t state = inst->async_state;
+        esp_err_t result = inst->async_result;
+        float temperature = inst->async_temperature;
+        float humidity = inst->async_humidity;
+        int64_t duration_us = inst->async_done_us - inst->async_start_us;
+        inst->async_state = SENSOR_ASYNC_IDLE;
+        portEXIT_CRITICAL(&sensor_registry_lock);
+        
+        if (state == SENSOR_ASYNC_IDLE) {
+            continue;
+        }
+        
+        if (state == SENSOR_ASYNC_PENDING) {
+            result = ESP_ERR_TIMEOUT;
+            duration_us = (int64_t)SENSOR_SCHEDULER_ASYNC_TIMEOUT_MS * 1000;
+        }
+        
+        if (sensor_record_reading(inst, result, temperature, humidity,
+                                  (uint32_t)(duration_us / 1000), &data[*count]) == ESP_OK) {
+            (*count)++;
+        }
+        sensor_schedule_next(inst, now_ms);
+    }
+    
+    // Prochaine échéance (les lectures bloquantes différées repassent après un décalage)
+    now_ms = esp_timer_get_time() / 1000;
+    uint64_t next_due_ms = now_ms + SENSOR_READ_INTERVAL_MS;
+    for (uint8_t i = 0; i < SENSOR_MAX_INSTANCES; i++) {
+        if (sensor_instances[i].in_use && sensor_instances[i].next_due_ms < next_due_ms) {
+            next_due_ms = sensor_instances[i].next_due_ms;
+        }
+    }
+    if (blocking_deferred && next_due_ms < now_ms + SENSOR_SCHEDULER_STAGGER_MS) {
+        next_due_ms = now_ms + SENSOR_SCHEDULER_STAGGER_MS;
+    }
+    *next_wake_ms = (next_due_ms > now_ms) ? (uint32_t)(next_due_ms - now_ms) : 0;
     
     return ESP_OK;
 }
@@ -198,6 +667,13 @@ uint8_t sensor_calculate_quality(const sensor_data_t *data) {
  * @brief Obtient les statistiques du gestionnaire de capteurs
  */
 esp_err_t sensor_get_stats(sensor_stats_t *stats) {
+    return sensor_get_instance_stats(sensor_dht22_id, stats);
+}
+
+/**
+ * @brief Obtient les statistiques d'une instance
+ */
+esp_err_t sensor_get_instance_stats(uint8_t sensor_id, sensor_stats_t *stats) {
     if (stats == NULL) {
         return ESP_ERR_INVALID_ARG;
     }
@@ -206,7 +682,12 @@ esp_err_t sensor_get_stats(sensor_stats_t *stats) {
         return ESP_ERR_INVALID_STATE;
     }
     
-    memcpy(stats, &sensor_stats, sizeof(sensor_stats_t));
+    sensor_instance_t *inst = sensor_get_instance(sensor_id);
+    if (inst == NULL) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    
+    memcpy(stats, &inst->stats, sizeof(sensor_stats_t));
     return ESP_OK;
 }
 
@@ -222,7 +703,7 @@ esp_err_t sensor_get_last_reading(sensor_data_t *data) {
         return ESP_ERR_INVALID_STATE;
     }
     
-    if (sensor_stats.successful_readings == 0) {
+    if (last_sensor_data_count == 0) {
         return ESP_ERR_NOT_FOUND;
     }
     
@@ -240,27 +721,41 @@ void sensor_print_stats(void) {
     }
     
     ESP_LOGI(TAG, "📊 === Statistiques Capteurs Community ===");
-    ESP_LOGI(TAG, "Lectures totales: %d", sensor_stats.total_readings);
-    ESP_LOGI(TAG, "Lectures réussies: %d", sensor_stats.successful_readings);
-    ESP_LOGI(TAG, "Lectures échouées: %d", sensor_stats.failed_readings);
-    ESP_LOGI(TAG, "Lectures invalides: %d", sensor_stats.invalid_readings);
-    
-    if (sensor_stats.total_readings > 0) {
-        float success_rate = (float)sensor_stats.successful_readings / sensor_stats.total_readings * 100.0f;
-        ESP_LOGI(TAG, "Taux de réussite: %.1f%%", success_rate);
-    }
+    ESP_LOGI(TAG, "Capteurs enregistrés: %d/%d", sensor_get_count(), SENSOR_MAX_INSTANCES);
     
-    if (sensor_stats.successful_readings > 0) {
-        ESP_LOGI(TAG, "Température: moy=%.1f°C, min=%.1f°C, max=%.1f°C",
-                 sensor_stats.avg_temperature, sensor_stats.min_temperature, sensor_stats.max_temperature);
-        ESP_LOGI(TAG, "Humidité: moy=%.1f%%, min=%.1f%%, max=%.1f%%",
-                 sensor_stats.avg_humidity, sensor_stats.min_humidity, sensor_stats.max_humidity);
+    for (uint8_t i = 0; i < SENSOR_MAX_INSTANCES; i++) {
+        sensor_instance_t *inst = &sensor_instances[i];
+        if (!inst->in_use) {
+            continue;
+        }
         
-        uint32_t avg_read_time = sensor_stats.total_read_time_ms / sensor_stats.successful_readings;
-        ESP_LOGI(TAG, "Temps lecture moyen: %dms", avg_read_time);
+        const sensor_stats_t *stats = &inst->stats;
+        ESP_LOGI(TAG, "--- [%d] %s (%s, période=%dms) ---",
+                 i, inst->name, inst->ops->type_name, inst->period_ms);
+        ESP_LOGI(TAG, "Lectures totales: %d", stats->total_readings);
+        ESP_LOGI(TAG, "Lectures réussies: %d", stats->successful_readings);
+        ESP_LOGI(TAG, "Lectures échouées: %d", stats->failed_readings);
+        ESP_LOGI(TAG, "Lectures invalides: %d", stats->invalid_readings);
         
-        uint64_t uptime = (esp_timer_get_time() / 1000) - sensor_stats.start_time;
-        ESP_LOGI(TAG, "Temps de fonctionnement: %lld ms", uptime);
+        if (stats->total_readings > 0) {
+            float success_rate = (float)stats->successful_readings / stats->total_readings * 100.0f;
+            ESP_LOGI(TAG, "Taux de réussite: %.1f%%", success_rate);
+        }
+        
+        if (stats->successful_readings > 0) {
+            ESP_LOGI(TAG, "Température: moy=%.1f°C (σ=%.2f), min=%.1f°C, max=%.1f°C",
+                     stats->avg_temperature, stats->stddev_temperature,
+                     stats->min_temperature, stats->max_temperature);
+            ESP_LOGI(TAG, "Humidité: moy=%.1f%% (σ=%.2f), min=%.1f%%, max=%.1f%%",
+                     stats->avg_humidity, stats->stddev_humidity,
+                     stats->min_humidity, stats->max_humidity);
+            
+            uint32_t avg_read_time = stats->total_read_time_ms / stats->successful_readings;
+            ESP_LOGI(TAG, "Temps lecture moyen: %dms", avg_read_time);
+            
+            uint64_t uptime = (esp_timer_get_time() / 1000) - stats->start_time;
+            ESP_LOGI(TAG, "Temps de fonctionnement: %lld ms", uptime);
+        }
     }
     
     ESP_LOGI(TAG, "=======================================");
@@ -274,13 +769,21 @@ esp_err_t sensor_reset_stats(void) {
         return ESP_ERR_INVALID_STATE;
     }
     
-    memset(&sensor_stats, 0, sizeof(sensor_stats));
-    sensor_stats.start_time = esp_timer_get_time() / 1000;
+    uint64_t now_ms = esp_timer_get_time() / 1000;
+    for (uint8_t i = 0; i < SENSOR_MAX_INSTANCES; i++) {
+        memset(&sensor_instances[i].stats, 0, sizeof(sensor_stats_t));
+        sensor_instances[i].stats.start_time = now_ms;
+        if (sensor_instances[i].in_use) {
+            windowed_stats_reset(&sensor_instances[i].temperature_window);
+            windowed_stats_reset(&sensor_instances[i].humidity_window);
+        }
+    }
     
     ESP_LOGI(TAG, "🔄 Statistiques capteurs réinitialisées");
     return ESP_OK;
 }
 
+#if CONFIG_APP_SELF_TESTS
 /**
  * @brief Test de fonctionnement du gestionnaire de capteurs
  */
@@ -322,7 +825,9 @@ esp_err_t sensor_manager_self_test(void) {
     
     return ESP_OK;
 }
+#endif /* CONFIG_APP_SELF_TESTS */
 
+#if CONFIG_APP_BANNERS
 /**
  * @brief Affiche les informations du gestionnaire de capteurs
  */
@@ -331,16 +836,19 @@ void sensor_manager_print_info(void) {
     ESP_LOGI(TAG, "Édition: Community (Fonctionnalité complète)");
     ESP_LOGI(TAG, "Capteurs supportés:");
     ESP_LOGI(TAG, "  🌡️ DHT22: Température et humidité");
+    ESP_LOGI(TAG, "  🔌 Drivers additionnels via sensor_register() (max %d)", SENSOR_MAX_INSTANCES);
     ESP_LOGI(TAG, "Fonctionnalités:");
     ESP_LOGI(TAG, "  ✅ Lecture données temps réel");
     ESP_LOGI(TAG, "  ✅ Validation automatique");
     ESP_LOGI(TAG, "  ✅ Calcul qualité des données");
     ESP_LOGI(TAG, "  ✅ Statistiques complètes");
     ESP_LOGI(TAG, "  ✅ Historique et moyennes");
+    ESP_LOGI(TAG, "  ✅ Planification groupée et décalée par capteur");
     ESP_LOGI(TAG, "Configuration actuelle:");
     ESP_LOGI(TAG, "  📍 GPIO DHT22 Data: %d", DHT22_GPIO_PIN);
     ESP_LOGI(TAG, "  ⚡ GPIO DHT22 Power: %d", DHT22_POWER_GPIO);
     ESP_LOGI(TAG, "  📊 Intervalle lecture: %d ms", SENSOR_READ_INTERVAL_MS);
     ESP_LOGI(TAG, "🎓 Interface capteurs identique à Enterprise!");
     ESP_LOGI(TAG, "========================================");
-}
\ No newline at end of file
+}
+#endif /* CONFIG_APP_BANNERS */
\ No newline at end of file
@@ -0,0 +1,243 @@
+/**
+ * @file windowed_stats.c
+ * @brief Statistiques glissantes en O(1) pour SecureIoT-VIF Community Edition
+ * 
+ * Moyenne et variance: Welford avec retrait de la valeur sortante, en
+ * double pour éviter la dérive des mises à jour incrémentales. Min/max:
+ * deques monotones de positions dans la fenêtre circulaire; chaque valeur
+ * entre et sort au plus une fois de chaque deque, d'où un coût amorti
+ * constant.
+ * 
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#include <string.h>
+#include <math.h>
+#include "windowed_stats.h"
+
+// ================================
+// Deques monotones
+// ================================
+
+static inline uint16_t deque_index(const windowed_stats_t *ws, uint16_t head, uint16_t offset) {
+    uint32_t idx = (uint32_t)head + offset;
+    return (uint16_t)(idx >= ws->capacity ? idx - ws->capacity : idx);
+}
+
+static inline void deque_pop_front(const windowed_stats_t *ws, uint16_t *head, uint16_t *count) {
+    *head = deque_index(ws, *head, 1);
+    (*count)--;
+}
+
+/**
+ * @brief Ajoute une position en retirant par l'arrière celles qu'elle domine
+ * 
+ * @param keep_min true pour le deque du minimum, false pour le maximum
+ */
+static void deque_push_back(windowed_stats_t *ws, uint16_t *deque, uint16_t head,
+                            uint16_t *count, uint16_t pos, bool keep_min) {
+    float value = ws->values[pos];
+    while (*count > 0) {
+        float back = ws->values[deque[deque_index(ws, head, *count - 1)]];
+        if (keep_min ? (back <= value) : (back >= value)) {
+            break;
+        }
+        (*count)--;
+    }
+    deque[deque_index(ws, head, *count)] = pos;
+    (*count)++;
+}
+
+// ================================
+// Fonctions publiques
+// ================================
+
+/**
+ * @brief Initialise une colonne sur un stockage fourni par l'appelant
+ */
+esp_err_t windowed_stats_init(windowed_stats_t *ws, uint16_t window,
+                              uint32_t *storage, size_t storage_words, float ewma_alpha) {
+    if (ws == NULL || storage == NULL || window == 0 || window > WINDOWED_STATS_MAX_WINDOW ||
+        ewma_alpha <= 0.0f || ewma_alpha > 1.0f) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    if (storage_words < WINDOWED_STATS_STORAGE_WORDS(window)) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    
+    memset(ws, 0, sizeof(*ws));
+    ws->values = (float *)storage;
+    ws->min_deque = (uint16_t *)(storage + window);
+    ws->max_deque = ws->min_deque + window;
+    ws->capacity = window;
+    ws->alpha = ewma_alpha;
+    
+    return ESP_OK;
+}
+
+/**
+ * @brief Vide la fenêtre
+ */
+void windowed_stats_reset(windowed_stats_t *ws) {
+    ws->count = 0;
+    ws->write_pos = 0;
+    ws->min_head = 0;
+    ws->min_count = 0;
+    ws->max_head = 0;
+    ws->max_count = 0;
+    ws->mean = 0.0;
+    ws->m2 = 0.0;
+    ws->ewma = 0.0f;
+    ws->ewma_var = 0.0f;
+    ws->last = 0.0f;
+    ws->total_samples = 0;
+}
+
+/**
+ * @brief Ajoute une valeur à la fenêtre
+ */
+void windowed_stats_push(windowed_stats_t *ws, float value) {
+    uint16_t pos = ws->write_pos;
+    
+    // Retirer la valeur sortante (fenêtre pleine)
+    if (ws->count == ws->capacity) {
+        double outgoing = ws->values[pos];
+        ws->count--;
+        if (ws->count == 0) {
+            ws->mean = 0.0;
+            ws->m2 = 0.0;
+        } else {
+            double delta = outgoing - ws->mean;
+            ws->mean -= delta / ws->count;
+            ws->m2 -= delta * (outgoing - ws->mean);
+            if (ws->m2 < 0.0) {
+                ws->m2 = 0.0;
+            }
+        }
+        
+        // La plus ancienne valeur, si elle est encore candidate, est en tête
+        if (ws->min_count > 0 && ws->min_deque[ws->min_head] == pos) {
+            deque_pop_front(ws, &ws->min_head, &ws->min_count);
+        }
+        if (ws->max_count > 0 && ws->max_deque[ws->max_head] == pos) {
+            deque_pop_front(ws, &ws->max_head, &ws->max_count);
+        }
+    }
+    
+    // Ajouter la valeur entrante
+    ws->values[pos] = value;
+    ws->count++;
+    double delta = (double)value - ws->mean;
+    ws->mean += delta / ws->count;
+    ws->m2 += delta * ((double)value - ws->mean);
+    
+    deque_push_back(ws, ws->min_deque, ws->min_head, &ws->min_count, pos, true);
+    deque_push_back(ws, ws->max_deque, ws->max_head, &ws->max_count, pos, false);
+    
+    // EWMA et variance exponentielle
+    if (ws->total_samples == 0) {
+        ws->ewma = value;
+        ws->ewma_var = 0.0f;
+    } else {
+        float diff = value - ws->ewma;
+        float incr = ws->alpha * diff;
+        ws->ewma += incr;
+        ws->ewma_var = (1.0f - ws->alpha) * (ws->ewma_var + diff * incr);
+    }
+    
+    ws->last = value;
+    ws->total_samples++;
+    ws->write_pos = (pos + 1 == ws->capacity) ? 0 : pos + 1;
+}
+
+uint16_t windowed_stats_count(const windowed_stats_t *ws) {
+    return ws->count;
+}
+
+float windowed_stats_mean(const windowed_stats_t *ws) {
+    return (float)ws->mean;
+}
+
+float windowed_stats_variance(const windowed_stats_t *ws) {
+    return (ws->count > 1) ? (float)(ws->m2 / (ws->count - 1)) : 0.0f;
+}
+
+float windowed_stats_stddev(const windowed_stats_t *ws) {
+    return sqrtf(windowed_stats_variance(ws));
+}
+
+float windowed_stats_min(const windowed_stats_t *ws) {
+    return (ws->min_count > 0) ? ws->values[ws->min_deque[ws->min_head]] : 0.0f;
+}
+
+float windowed_stats_max(const windowed_stats_t *ws) {
+    return (ws->max_count > 0) ? ws->values[ws->max_deque[ws->max_head]] : 0.0f;
+}
+
+float windowed_stats_ewma(const windowed_stats_t *ws) {
+    return ws->ewma;
+}
+
+float windowed_stats_last(const windowed_stats_t *ws) {
+    return ws->last;
+}
+
+/**
+ * @brief Sauvegarde la fenêtre (du plus ancien au plus récent) et l'état scalaire
+ */
+void windowed_stats_save(const windowed_stats_t *ws, float *values, uint16_t max_values,
+                         windowed_stats_state_t *state) {
+    uint16_t count = (ws->count < max_values) ? ws->count : max_values;
+    
+    // Dernière valeur écrite juste avant write_pos
+    uint16_t pos = (ws->write_pos + ws->capacity - count) % ws->capacity;
+    for (uint16_t i = 0; i < count; i++) {
+        values[i] = ws->values[pos];
+        pos = (pos + 1 == ws->capacity) ? 0 : pos + 1;
+    }
+    
+    state->count = count;
+    state->ewma = ws->ewma;
+    state->ewma_var = ws->ewma_var;
+    state->total_samples = ws->total_samples;
+}
+
+/**
+ * @brief Reconstruit une colonne initialisée à partir d'une sauvegarde
+ */
+esp_err_t windowed_stats_restore(windowed_stats_t *ws, const float *values,
+                                 const windowed_stats_state_t *state) {
+    if (state->count > ws->capacity || state->count > state->total_samples) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    
+    // Rejouer la fenêtre recalcule Welford, les deques et la dernière valeur
+    windowed_stats_reset(ws);
+    for (uint16_t i = 0; i < state->count; i++) {
+        windowed_stats_push(ws, values[i]);
+    }
+    
+    ws->ewma = state->ewma;
+    ws->ewma_var = state->ewma_var;
+    ws->total_samples = state->total_samples;
+    
+    return ESP_OK;
+}
+
+/**
+ * @brief Remplit un instantané de toutes les statistiques
+ */
+void windowed_stats_get_summary(const windowed_stats_t *ws, windowed_stats_summary_t *summary) {
+    summary->count = ws->count;
+    summary->mean = windowed_stats_mean(ws);
+    summary->variance = windowed_stats_variance(ws);
+    summary->stddev = sqrtf(summary->variance);
+    summary->min = windowed_stats_min(ws);
+    summary->max = windowed_stats_max(ws);
+    summary->ewma = ws->ewma;
+    summary->ewma_stddev = sqrtf(ws->ewma_var);
+    summary->last = ws->last;
+}
\ No newline at end of file
@@ -0,0 +1,104 @@
+/**
+ * @file telemetry.h
+ * @brief Remontée de télémétrie par lots chiffrés (Community Edition)
+ *
+ * Une tâche lit l'anneau d'échantillons à intervalle fixe, encode les
+ * échantillons accumulés en trames compactes (telemetry_frame.h), les
+ * chiffre en un seul appel AES-GCM par trame et les publie en UDP. La
+ * radio ne sert qu'une fois par lot au lieu d'une fois par échantillon.
+ *
+ * Les publications attendent la barrière BOOT_GATE_INTEGRITY_VERIFIED:
+ * tant qu'elle est fermée, les échantillons restent dans l'anneau.
+ *
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "telemetry_frame.h"
+
+// ================================
+// Constantes Community
+// ================================
+
+#define TELEMETRY_TASK_STACK_SIZE_COMMUNITY (4096)
+#define TELEMETRY_TASK_PRIORITY_COMMUNITY   (3)
+#define TELEMETRY_TASK_CORE_COMMUNITY       tskNO_AFFINITY
+
+// ================================
+// Types et structures Community
+// ================================
+
+/**
+ * @brief Configuration de la tâche de télémétrie
+ */
+typedef struct {
+    uint32_t batch_interval_ms;         // Intervalle entre deux lots
+    uint32_t task_priority;             // Priorité de la tâche
+    uint32_t task_stack_size;           // Pile de la tâche
+    BaseType_t task_core;               // Cœur de la tâche (tskNO_AFFINITY: libre)
+} telemetry_config_t;
+
+/**
+ * @brief Statistiques de télémétrie
+ */
+typedef struct {
+    uint32_t frames_sent;               // Trames publiées
+    uint32_t frames_failed;             // Trames perdues (chiffrement ou envoi)
+    uint32_t samples_sent;              // Échantillons publiés
+    uint32_t samples_rejected;          // Échantillons non encodables (sensor_id hors plage)
+    uint32_t batches_deferred;          // Lots reportés (réseau absent, barrière fermée)
+    uint64_t bytes_sent;                // Octets UDP publiés (en-tête, charge, tag)
+    uint64_t json_bytes;                // Octets équivalents en JSON par échantillon
+    uint32_t last_frame_bytes;          // Taille de la dernière trame
+    uint32_t max_send_time_us;          // Pire durée chiffrement + envoi d'une trame
+    bool connected;                     // Réseau disponible
+} telemetry_stats_t;
+
+// ================================
+// Fonctions Community
+// ================================
+
+/**
+ * @brief Démarre la télémétrie (WiFi station, socket UDP, tâche)
+ *
+ * À appeler après sample_ring_init() et crypto_operations_basic_init().
+ *
+ * @param config Configuration (NULL: valeurs Kconfig et *_COMMUNITY)
+ * @return ESP_OK, ESP_ERR_INVALID_STATE si déjà démarrée,
+ *         ESP_ERR_INVALID_ARG si la clé ou la destination Kconfig est invalide
+ */
+esp_err_t telemetry_start(const telemetry_config_t *config);
+
+/**
+ * @brief Demande la publication immédiate des échantillons en attente
+ */
+void telemetry_flush(void);
+
+/**
+ * @brief Obtient les statistiques de télémétrie
+ */
+esp_err_t telemetry_get_stats(telemetry_stats_t *stats);
+
+/**
+ * @brief Affiche les statistiques de télémétrie
+ */
+void telemetry_print_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TELEMETRY_H */
\ No newline at end of file
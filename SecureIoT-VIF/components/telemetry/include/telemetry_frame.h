@@ -0,0 +1,157 @@
+/**
+ * @file telemetry_frame.h
+ * @brief Encodage compact des lots d'échantillons capteurs (Community Edition)
+ *
+ * Une trame regroupe jusqu'à TELEMETRY_FRAME_MAX_SAMPLES échantillons:
+ * horodatages en deltas, température et humidité en dixièmes (résolution
+ * du DHT22) en deltas par capteur, le tout en varints zigzag. Un
+ * échantillon typique tient en 5 à 6 octets contre ~90 en JSON.
+ *
+ * Format (petit-boutiste):
+ *   En-tête (22 octets, en clair, AAD du chiffrement)
+ *     [0]      version
+ *     [1]      nombre d'échantillons
+ *     [2..5]   numéro de trame
+ *     [6..13]  préfixe d'IV (aléatoire par démarrage)
+ *     [14..21] horodatage de base (ms)
+ *   Charge utile (chiffrée), par échantillon
+ *     varint          sensor_id
+ *     varint zigzag   delta horodatage / échantillon précédent (ms)
+ *     varint zigzag   delta température / même capteur (0.1 °C)
+ *     varint zigzag   delta humidité / même capteur (0.1 %)
+ *     octet           quality_score
+ *   Tag GCM (16 octets)
+ *
+ * L'IV d'une trame est préfixe || numéro de trame (big-endian), comme
+ * crypto_basic_gcm_session_encrypt_batch().
+ *
+ * Module pur (ni tâche ni crypto): compilé tel quel dans la build hôte.
+ *
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#ifndef TELEMETRY_FRAME_H
+#define TELEMETRY_FRAME_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "sensor_manager.h"
+
+// ================================
+// Constantes Community
+// ================================
+
+#define TELEMETRY_FRAME_VERSION             (1)
+#define TELEMETRY_FRAME_HEADER_SIZE         (22)
+#define TELEMETRY_FRAME_IV_PREFIX_SIZE      (8)
+#define TELEMETRY_FRAME_TAG_SIZE            (16)
+#define TELEMETRY_FRAME_MAX_SAMPLES         (64)
+#define TELEMETRY_FRAME_SAMPLE_MAX_SIZE     (17)    // varints pire cas (1 + 3 * 5) + qualité
+#define TELEMETRY_FRAME_PAYLOAD_MAX_SIZE    (TELEMETRY_FRAME_MAX_SAMPLES * TELEMETRY_FRAME_SAMPLE_MAX_SIZE)
+#define TELEMETRY_FRAME_MAX_SIZE            (TELEMETRY_FRAME_HEADER_SIZE + TELEMETRY_FRAME_PAYLOAD_MAX_SIZE + \
+                                             TELEMETRY_FRAME_TAG_SIZE)
+
+// ================================
+// Types et structures Community
+// ================================
+
+/**
+ * @brief En-tête de trame décodé
+ */
+typedef struct {
+    uint8_t version;                                    // TELEMETRY_FRAME_VERSION
+    uint8_t sample_count;                               // Échantillons dans la trame
+    uint32_t sequence;                                  // Numéro de trame
+    uint8_t iv_prefix[TELEMETRY_FRAME_IV_PREFIX_SIZE];  // Préfixe d'IV
+    uint64_t base_timestamp_ms;                         // Horodatage du premier échantillon
+} telemetry_frame_header_t;
+
+/**
+ * @brief Trame en cours de construction (stockage fourni par l'appelant)
+ */
+typedef struct {
+    uint8_t header[TELEMETRY_FRAME_HEADER_SIZE];        // En-tête sérialisé
+    uint8_t payload[TELEMETRY_FRAME_PAYLOAD_MAX_SIZE];  // Échantillons encodés
+    size_t payload_len;                                 // Octets de charge utile
+    uint8_t sample_count;                               // Échantillons ajoutés
+    uint64_t base_timestamp_ms;                         // Horodatage de base
+    uint64_t last_timestamp_ms;                         // Horodatage du dernier échantillon
+    int32_t last_temperature[SENSOR_MAX_INSTANCES];     // Dernière température par capteur (0.1 °C)
+    int32_t last_humidity[SENSOR_MAX_INSTANCES];        // Dernière humidité par capteur (0.1 %)
+} telemetry_frame_t;
+
+// ================================
+// Fonctions Community
+// ================================
+
+/**
+ * @brief Démarre une trame vide
+ *
+ * @param frame Trame à initialiser
+ * @param sequence Numéro de trame (partie compteur de l'IV)
+ * @param iv_prefix Préfixe d'IV (TELEMETRY_FRAME_IV_PREFIX_SIZE octets)
+ */
+void telemetry_frame_begin(telemetry_frame_t *frame, uint32_t sequence, const uint8_t *iv_prefix);
+
+/**
+ * @brief Ajoute un échantillon à la trame
+ *
+ * @return ESP_OK, ESP_ERR_NO_MEM si la trame est pleine,
+ *         ESP_ERR_INVALID_ARG si sensor_id >= SENSOR_MAX_INSTANCES
+ */
+esp_err_t telemetry_frame_add(telemetry_frame_t *frame, const sensor_data_t *sample);
+
+/**
+ * @brief Finalise l'en-tête (nombre d'échantillons)
+ *
+ * @return Taille en-tête + charge utile, hors tag
+ */
+size_t telemetry_frame_finish(telemetry_frame_t *frame);
+
+/**
+ * @brief Construit l'IV de la trame (préfixe || numéro big-endian)
+ *
+ * @param header En-tête sérialisé
+ * @param iv Sortie (12 octets)
+ */
+void telemetry_frame_build_iv(const uint8_t *header, uint8_t *iv);
+
+/**
+ * @brief Décode un en-tête de trame
+ *
+ * @return ESP_OK, ESP_ERR_INVALID_SIZE, ESP_ERR_INVALID_VERSION
+ */
+esp_err_t telemetry_frame_parse_header(const uint8_t *buffer, size_t length, telemetry_frame_header_t *header);
+
+/**
+ * @brief Décode la charge utile (en clair) d'une trame
+ *
+ * @param header En-tête décodé
+ * @param payload Charge utile déchiffrée
+ * @param length Taille de la charge utile
+ * @param samples Tableau de sortie (read_duration_ms à 0)
+ * @param max_samples Capacité du tableau
+ * @param count Échantillons décodés (sortie)
+ * @return ESP_OK, ESP_ERR_INVALID_SIZE (trame tronquée ou tableau trop petit)
+ */
+esp_err_t telemetry_frame_decode(const telemetry_frame_header_t *header, const uint8_t *payload, size_t length,
+                                 sensor_data_t *samples, size_t max_samples, size_t *count);
+
+/**
+ * @brief Taille du même échantillon publié en JSON (référence de comparaison)
+ */
+size_t telemetry_frame_json_size(const sensor_data_t *sample);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TELEMETRY_FRAME_H */
\ No newline at end of file
@@ -0,0 +1,410 @@
+/**
+ * @file telemetry.c
+ * @brief Remontée de télémétrie par lots chiffrés (Community Edition)
+ *
+ * WiFi station en modem-sleep: entre deux lots la radio ne se réveille
+ * que pour les balises DTIM. Chaque lot est encodé puis chiffré en un
+ * appel crypto_basic_gcm_session_encrypt() (clé étendue une seule fois
+ * au démarrage) et publié en un datagramme UDP par trame.
+ *
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#include <string.h>
+#include <errno.h>
+#include "esp_log.h"
+#include "esp_err.h"
+#include "esp_timer.h"
+#include "esp_wifi.h"
+#include "esp_netif.h"
+#include "esp_event.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "freertos/event_groups.h"
+#include "lwip/sockets.h"
+#include "sdkconfig.h"
+
+#include "telemetry.h"
+#include "sample_ring.h"
+#include "crypto_operations_basic.h"
+#include "boot_scheduler.h"
+
+static const char *TAG = "TELEMETRY_COMMUNITY";
+
+#define TELEMETRY_CONNECTED_BIT         (1UL << 0)
+
+// ================================
+// Variables globales
+// ================================
+
+static bool telemetry_started = false;
+static uint8_t telemetry_consumer = SAMPLE_RING_CONSUMER_INVALID;
+static telemetry_config_t telemetry_config;
+static TaskHandle_t telemetry_task_handle = NULL;
+
+static crypto_basic_gcm_session_t *telemetry_session = NULL;
+static uint8_t telemetry_iv_prefix[TELEMETRY_FRAME_IV_PREFIX_SIZE];
+static uint32_t telemetry_sequence = 0;
+
+static int telemetry_socket = -1;
+static struct sockaddr_in telemetry_destination;
+
+static EventGroupHandle_t telemetry_events = NULL;
+static StaticEventGroup_t telemetry_events_buffer;
+
+static telemetry_stats_t telemetry_stats;
+static SemaphoreHandle_t telemetry_stats_mutex = NULL;
+static StaticSemaphore_t telemetry_stats_mutex_buffer;
+
+// Buffers de la tâche (hors pile)
+static sensor_data_t telemetry_batch[TELEMETRY_FRAME_MAX_SAMPLES];
+static telemetry_frame_t telemetry_frame;
+static uint8_t telemetry_datagram[TELEMETRY_FRAME_MAX_SIZE];
+
+// ================================
+// Fonctions internes
+// ================================
+
+/**
+ * @brief Décode la clé AES-128 hexadécimale de Kconfig
+ */
+static esp_err_t parse_key_hex(const char *hex, uint8_t *key) {
+    if (strlen(hex) != CRYPTO_BASIC_AES_KEY_SIZE * 2) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    for (int i = 0; i < CRYPTO_BASIC_AES_KEY_SIZE * 2; i++) {
+        char c = hex[i];
+        uint8_t nibble;
+        if (c >= '0' && c <= '9') {
+            nibble = (uint8_t)(c - '0');
+        } else if (c >= 'a' && c <= 'f') {
+            nibble = (uint8_t)(c - 'a' + 10);
+        } else if (c >= 'A' && c <= 'F') {
+            nibble = (uint8_t)(c - 'A' + 10);
+        } else {
+            return ESP_ERR_INVALID_ARG;
+        }
+        key[i / 2] = (i % 2 == 0) ? (uint8_t)(nibble << 4) : (uint8_t)(key[i / 2] | nibble);
+    }
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Événements WiFi / IP de la station
+ */
+static void telemetry_wifi_event_handler(void *arg, esp_event_base_t event_base,
+                                         int32_t event_id, void *event_data) {
+    if (event_base == WIFI_EVENT && event_id == WIFI_EVENT_STA_START) {
+        esp_wifi_connect();
+    } else if (event_base == WIFI_EVENT && event_id == WIFI_EVENT_STA_DISCONNECTED) {
+        // Reconnexion tentée par la tâche au lot suivant, pas en boucle
+        xEventGroupClearBits(telemetry_events, TELEMETRY_CONNECTED_BIT);
+        ESP_LOGW(TAG, "📶 WiFi déconnecté");
+    } else if (event_base == IP_EVENT && event_id == IP_EVENT_STA_GOT_IP) {
+        xEventGroupSetBits(telemetry_events, TELEMETRY_CONNECTED_BIT);
+        ESP_LOGI(TAG, "📶 WiFi connecté");
+    }
+}
+
+/**
+ * @brief Démarre la station WiFi en modem-sleep
+ */
+static esp_err_t telemetry_wifi_start(void) {
+    esp_netif_create_default_wifi_sta();
+
+    wifi_init_config_t init_config = WIFI_INIT_CONFIG_DEFAULT();
+    esp_err_t ret = esp_wifi_init(&init_config);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    ret = esp_event_handler_instance_register(WIFI_EVENT, ESP_EVENT_ANY_ID,
+                                              &telemetry_wifi_event_handler, NULL, NULL);
+    if (ret == ESP_OK) {
+        ret = esp_event_handler_instance_register(IP_EVENT, IP_EVENT_STA_GOT_IP,
+                                                  &telemetry_wifi_event_handler, NULL, NULL);
+    }
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    wifi_config_t wifi_config = {0};
+    strncpy((char *)wifi_config.sta.ssid, CONFIG_TELEMETRY_WIFI_SSID, sizeof(wifi_config.sta.ssid));
+    strncpy((char *)wifi_config.sta.password, CONFIG_TELEMETRY_WIFI_PASSWORD, sizeof(wifi_config.sta.password));
+    wifi_config.sta.listen_interval = CONFIG_TELEMETRY_WIFI_LISTEN_INTERVAL;
+
+    ret = esp_wifi_set_mode(WIFI_MODE_STA);
+    if (ret == ESP_OK) {
+        ret = esp_wifi_set_config(WIFI_IF_STA, &wifi_config);
+    }
+    if (ret == ESP_OK) {
+        ret = esp_wifi_start();
+    }
+    if (ret == ESP_OK) {
+        // Radio éteinte entre les balises, réveillée par l'émission d'un lot
+        ret = esp_wifi_set_ps(WIFI_PS_MAX_MODEM);
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Encode, chiffre et publie une trame
+ */
+static void telemetry_send_batch(const sensor_data_t *samples, size_t count) {
+    uint8_t iv[CRYPTO_BASIC_AES_IV_SIZE];
+    uint32_t rejected = 0;
+    uint64_t json_bytes = 0;
+
+    uint64_t start_us = esp_timer_get_time();
+
+    telemetry_frame_begin(&telemetry_frame, telemetry_sequence, telemetry_iv_prefix);
+    for (size_t i = 0; i < count; i++) {
+        if (telemetry_frame_add(&telemetry_frame, &samples[i]) != ESP_OK) {
+            rejected++;
+            continue;
+        }
+        json_bytes += telemetry_frame_json_size(&samples[i]);
+    }
+
+    size_t clear_len = telemetry_frame_finish(&telemetry_frame);
+    size_t frame_len = clear_len + TELEMETRY_FRAME_TAG_SIZE;
+    bool sent = false;
+
+    if (telemetry_frame.sample_count > 0) {
+        memcpy(telemetry_datagram, telemetry_frame.header, TELEMETRY_FRAME_HEADER_SIZE);
+        telemetry_frame_build_iv(telemetry_frame.header, iv);
+
+        // Un IV par trame: le numéro avance même si l'envoi échoue
+        telemetry_sequence++;
+
+        esp_err_t ret = crypto_basic_gcm_session_encrypt(telemetry_session, iv,
+                                                         telemetry_frame.header, TELEMETRY_FRAME_HEADER_SIZE,
+                                                         telemetry_frame.payload, telemetry_frame.payload_len,
+                                                         &telemetry_datagram[TELEMETRY_FRAME_HEADER_SIZE],
+                                                         &telemetry_datagram[clear_len]);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "❌ Chiffrement trame %lu échoué: %s", telemetry_sequence - 1, esp_err_to_name(ret));
+        } else if (sendto(telemetry_socket, telemetry_datagram, frame_len, 0,
+                          (struct sockaddr *)&telemetry_destination, sizeof(telemetry_destination)) < 0) {
+            ESP_LOGW(TAG, "⚠️ Envoi trame %lu échoué (errno %d)", telemetry_sequence - 1, errno);
+        } else {
+            sent = true;
+        }
+    }
+
+    uint32_t send_time_us = (uint32_t)(esp_timer_get_time() - start_us);
+
+    xSemaphoreTake(telemetry_stats_mutex, portMAX_DELAY);
+    telemetry_stats.samples_rejected += rejected;
+    if (sent) {
+        telemetry_stats.frames_sent++;
+        telemetry_stats.samples_sent += telemetry_frame.sample_count;
+        telemetry_stats.bytes_sent += frame_len;
+        telemetry_stats.json_bytes += json_bytes;
+        telemetry_stats.last_frame_bytes = (uint32_t)frame_len;
+    } else if (telemetry_frame.sample_count > 0) {
+        telemetry_stats.frames_failed++;
+    }
+    if (send_time_us > telemetry_stats.max_send_time_us) {
+        telemetry_stats.max_send_time_us = send_time_us;
+    }
+    xSemaphoreGive(telemetry_stats_mutex);
+
+    ESP_LOGD(TAG, "📤 Trame: %u échantillons, %d octets (JSON: %llu)",
+             telemetry_frame.sample_count, frame_len, json_bytes);
+}
+
+/**
+ * @brief Publie tous les échantillons en attente dans l'anneau
+ */
+static void telemetry_publish_pending(void) {
+    bool connected = (xEventGroupGetBits(telemetry_events) & TELEMETRY_CONNECTED_BIT) != 0;
+    bool ready = connected && boot_gate_require(BOOT_GATE_INTEGRITY_VERIFIED, "Télémétrie") == ESP_OK;
+
+    xSemaphoreTake(telemetry_stats_mutex, portMAX_DELAY);
+    telemetry_stats.connected = connected;
+    if (!ready) {
+        telemetry_stats.batches_deferred++;
+    }
+    xSemaphoreGive(telemetry_stats_mutex);
+
+    if (!ready) {
+        // Échantillons conservés par l'anneau jusqu'au prochain lot
+        if (!connected) {
+            esp_wifi_connect();
+        }
+        return;
+    }
+
+    size_t count;
+    do {
+        count = sample_ring_read(telemetry_consumer, telemetry_batch, TELEMETRY_FRAME_MAX_SAMPLES);
+        if (count > 0) {
+            telemetry_send_batch(telemetry_batch, count);
+        }
+    } while (count == TELEMETRY_FRAME_MAX_SAMPLES);
+}
+
+/**
+ * @brief Tâche de télémétrie: un lot par intervalle (ou sur telemetry_flush)
+ */
+static void telemetry_task(void *pvParameters) {
+    ESP_LOGI(TAG, "📡 Tâche télémétrie démarrée (lot toutes les %lu ms)", telemetry_config.batch_interval_ms);
+
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(telemetry_config.batch_interval_ms));
+        telemetry_publish_pending();
+    }
+}
+
+// ================================
+// Fonctions publiques
+// ================================
+
+/**
+ * @brief Démarre la télémétrie (WiFi station, socket UDP, tâche)
+ */
+esp_err_t telemetry_start(const telemetry_config_t *config) {
+    if (telemetry_started) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    if (config != NULL) {
+        telemetry_config = *config;
+    } else {
+        telemetry_config = (telemetry_config_t){
+            .batch_interval_ms = CONFIG_TELEMETRY_BATCH_INTERVAL_MS,
+            .task_priority = TELEMETRY_TASK_PRIORITY_COMMUNITY,
+            .task_stack_size = TELEMETRY_TASK_STACK_SIZE_COMMUNITY,
+            .task_core = TELEMETRY_TASK_CORE_COMMUNITY
+        };
+    }
+
+    uint8_t key[CRYPTO_BASIC_AES_KEY_SIZE];
+    if (parse_key_hex(CONFIG_TELEMETRY_KEY_HEX, key) != ESP_OK) {
+        ESP_LOGE(TAG, "❌ Clé de télémétrie invalide (32 caractères hexadécimaux attendus)");
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    memset(&telemetry_destination, 0, sizeof(telemetry_destination));
+    telemetry_destination.sin_family = AF_INET;
+    telemetry_destination.sin_port = htons(CONFIG_TELEMETRY_UDP_PORT);
+    if (inet_pton(AF_INET, CONFIG_TELEMETRY_UDP_HOST, &telemetry_destination.sin_addr) != 1) {
+        ESP_LOGE(TAG, "❌ Destination de télémétrie invalide: %s", CONFIG_TELEMETRY_UDP_HOST);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (telemetry_stats_mutex == NULL) {
+        telemetry_stats_mutex = xSemaphoreCreateMutexStatic(&telemetry_stats_mutex_buffer);
+        telemetry_events = xEventGroupCreateStatic(&telemetry_events_buffer);
+    }
+    memset(&telemetry_stats, 0, sizeof(telemetry_stats));
+
+    esp_err_t ret = crypto_basic_gcm_session_create(key, &telemetry_session);
+    memset(key, 0, sizeof(key));
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ Session AES-GCM de télémétrie: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    // Préfixe aléatoire: pas de réutilisation d'IV d'un démarrage à l'autre
+    ret = crypto_basic_generate_random(telemetry_iv_prefix, sizeof(telemetry_iv_prefix));
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    telemetry_sequence = 0;
+
+    // Depuis le plus ancien: les échantillons pris pendant le démarrage partent au premier lot
+    ret = sample_ring_register_consumer("telemetry", true, &telemetry_consumer);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ Échec enregistrement consommateur télémétrie");
+        return ret;
+    }
+
+    telemetry_socket = socket(AF_INET, SOCK_DGRAM, IPPROTO_IP);
+    if (telemetry_socket < 0) {
+        ESP_LOGE(TAG, "❌ Échec création socket UDP (errno %d)", errno);
+        return ESP_FAIL;
+    }
+
+    ret = telemetry_wifi_start();
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ Échec démarrage WiFi station: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    BaseType_t task_ret = xTaskCreatePinnedToCore(
+        telemetry_task,
+        "telemetry_community",
+        telemetry_config.task_stack_size,
+        NULL,
+        telemetry_config.task_priority,
+        &telemetry_task_handle,
+        telemetry_config.task_core
+    );
+    if (task_ret != pdPASS) {
+        ESP_LOGE(TAG, "❌ Échec création tâche télémétrie");
+        return ESP_FAIL;
+    }
+
+    telemetry_started = true;
+    ESP_LOGI(TAG, "📡 Télémétrie vers %s:%d (trames de %d échantillons max)",
+             CONFIG_TELEMETRY_UDP_HOST, CONFIG_TELEMETRY_UDP_PORT, TELEMETRY_FRAME_MAX_SAMPLES);
+    return ESP_OK;
+}
+
+/**
+ * @brief Demande la publication immédiate des échantillons en attente
+ */
+void telemetry_flush(void) {
+    if (telemetry_task_handle != NULL) {
+        xTaskNotifyGive(telemetry_task_handle);
+    }
+}
+
+/**
+ * @brief Obtient les statistiques de télémétrie
+ */
+esp_err_t telemetry_get_stats(telemetry_stats_t *stats) {
+    if (stats == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!telemetry_started) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(telemetry_stats_mutex, portMAX_DELAY);
+    *stats = telemetry_stats;
+    xSemaphoreGive(telemetry_stats_mutex);
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Affiche les statistiques de télémétrie
+ */
+void telemetry_print_stats(void) {
+    telemetry_stats_t stats;
+    if (telemetry_get_stats(&stats) != ESP_OK) {
+        return;
+    }
+
+    ESP_LOGI(TAG, "📡 Télémétrie: %lu trames, %lu échantillons, %lu échecs, %lu lots reportés%s",
+             stats.frames_sent, stats.samples_sent, stats.frames_failed, stats.batches_deferred,
+             stats.connected ? "" : " (hors ligne)");
+
+    if (stats.samples_sent > 0) {
+        // Hors en-têtes IP/UDP (28 octets par trame, un datagramme par échantillon en JSON)
+        uint32_t frame_tenths = (uint32_t)(stats.bytes_sent * 10 / stats.samples_sent);
+        uint32_t json_tenths = (uint32_t)(stats.json_bytes * 10 / stats.samples_sent);
+        ESP_LOGI(TAG, "   Octets/échantillon: %lu.%lu (JSON: %lu.%lu), dernière trame %lu octets, envoi max %lu us",
+                 frame_tenths / 10, frame_tenths % 10, json_tenths / 10, json_tenths % 10,
+                 stats.last_frame_bytes, stats.max_send_time_us);
+    }
+}
\ No newline at end of file
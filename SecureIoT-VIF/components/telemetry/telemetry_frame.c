@@ -0,0 +1,250 @@
+/**
+ * @file telemetry_frame.c
+ * @brief Encodage compact des lots d'échantillons capteurs (Community Edition)
+ *
+ * Varints LEB128 (7 bits par octet) sur des deltas zigzag: les petites
+ * variations, positives comme négatives, tiennent sur un octet.
+ *
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "telemetry_frame.h"
+
+// ================================
+// Fonctions internes
+// ================================
+
+static inline uint32_t zigzag_encode(int32_t value) {
+    return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+static inline int32_t zigzag_decode(uint32_t value) {
+    return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+}
+
+static size_t varint_put(uint8_t *out, uint32_t value) {
+    size_t len = 0;
+    while (value >= 0x80) {
+        out[len++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    out[len++] = (uint8_t)value;
+    return len;
+}
+
+/**
+ * @brief Lit un varint, 0 si tronqué ou plus long que 5 octets
+ */
+static size_t varint_get(const uint8_t *in, size_t available, uint32_t *value) {
+    uint32_t result = 0;
+    for (size_t i = 0; i < available && i < 5; i++) {
+        result |= (uint32_t)(in[i] & 0x7F) << (7 * i);
+        if ((in[i] & 0x80) == 0) {
+            *value = result;
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+static void put_le32(uint8_t *out, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        out[i] = (uint8_t)(value >> (8 * i));
+    }
+}
+
+static void put_le64(uint8_t *out, uint64_t value) {
+    for (int i = 0; i < 8; i++) {
+        out[i] = (uint8_t)(value >> (8 * i));
+    }
+}
+
+static uint32_t get_le32(const uint8_t *in) {
+    uint32_t value = 0;
+    for (int i = 0; i < 4; i++) {
+        value |= (uint32_t)in[i] << (8 * i);
+    }
+    return value;
+}
+
+static uint64_t get_le64(const uint8_t *in) {
+    uint64_t value = 0;
+    for (int i = 0; i < 8; i++) {
+        value |= (uint64_t)in[i] << (8 * i);
+    }
+    return value;
+}
+
+/**
+ * @brief Valeur capteur en dixièmes (résolution DHT22)
+ */
+static inline int32_t to_decis(float value) {
+    return (int32_t)lroundf(value * 10.0f);
+}
+
+// ================================
+// Fonctions publiques
+// ================================
+
+/**
+ * @brief Démarre une trame vide
+ */
+void telemetry_frame_begin(telemetry_frame_t *frame, uint32_t sequence, const uint8_t *iv_prefix) {
+    memset(frame->header, 0, sizeof(frame->header));
+    frame->header[0] = TELEMETRY_FRAME_VERSION;
+    put_le32(&frame->header[2], sequence);
+    memcpy(&frame->header[6], iv_prefix, TELEMETRY_FRAME_IV_PREFIX_SIZE);
+
+    frame->payload_len = 0;
+    frame->sample_count = 0;
+    frame->base_timestamp_ms = 0;
+    frame->last_timestamp_ms = 0;
+    memset(frame->last_temperature, 0, sizeof(frame->last_temperature));
+    memset(frame->last_humidity, 0, sizeof(frame->last_humidity));
+}
+
+/**
+ * @brief Ajoute un échantillon à la trame
+ */
+esp_err_t telemetry_frame_add(telemetry_frame_t *frame, const sensor_data_t *sample) {
+    if (frame->sample_count >= TELEMETRY_FRAME_MAX_SAMPLES) {
+        return ESP_ERR_NO_MEM;
+    }
+    if (sample->sensor_id >= SENSOR_MAX_INSTANCES) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (frame->sample_count == 0) {
+        frame->base_timestamp_ms = sample->timestamp;
+        frame->last_timestamp_ms = sample->timestamp;
+    }
+
+    // Premier échantillon d'un capteur: delta depuis 0, soit la valeur absolue
+    int32_t temperature = to_decis(sample->temperature);
+    int32_t humidity = to_decis(sample->humidity);
+    int32_t delta_ms = (int32_t)(int64_t)(sample->timestamp - frame->last_timestamp_ms);
+
+    uint8_t *out = &frame->payload[frame->payload_len];
+    size_t len = varint_put(out, sample->sensor_id);
+    len += varint_put(out + len, zigzag_encode(delta_ms));
+    len += varint_put(out + len, zigzag_encode(temperature - frame->last_temperature[sample->sensor_id]));
+    len += varint_put(out + len, zigzag_encode(humidity - frame->last_humidity[sample->sensor_id]));
+    out[len++] = sample->quality_score;
+
+    frame->payload_len += len;
+    frame->sample_count++;
+    frame->last_timestamp_ms = sample->timestamp;
+    frame->last_temperature[sample->sensor_id] = temperature;
+    frame->last_humidity[sample->sensor_id] = humidity;
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Finalise l'en-tête (nombre d'échantillons)
+ */
+size_t telemetry_frame_finish(telemetry_frame_t *frame) {
+    frame->header[1] = frame->sample_count;
+    put_le64(&frame->header[14], frame->base_timestamp_ms);
+    return TELEMETRY_FRAME_HEADER_SIZE + frame->payload_len;
+}
+
+/**
+ * @brief Construit l'IV de la trame (préfixe || numéro big-endian)
+ */
+void telemetry_frame_build_iv(const uint8_t *header, uint8_t *iv) {
+    uint32_t sequence = get_le32(&header[2]);
+
+    memcpy(iv, &header[6], TELEMETRY_FRAME_IV_PREFIX_SIZE);
+    iv[8] = (uint8_t)(sequence >> 24);
+    iv[9] = (uint8_t)(sequence >> 16);
+    iv[10] = (uint8_t)(sequence >> 8);
+    iv[11] = (uint8_t)sequence;
+}
+
+/**
+ * @brief Décode un en-tête de trame
+ */
+esp_err_t telemetry_frame_parse_header(const uint8_t *buffer, size_t length, telemetry_frame_header_t *header) {
+    if (buffer == NULL || header == NULL || length < TELEMETRY_FRAME_HEADER_SIZE) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    if (buffer[0] != TELEMETRY_FRAME_VERSION) {
+        return ESP_ERR_INVALID_VERSION;
+    }
+
+    header->version = buffer[0];
+    header->sample_count = buffer[1];
+    header->sequence = get_le32(&buffer[2]);
+    memcpy(header->iv_prefix, &buffer[6], TELEMETRY_FRAME_IV_PREFIX_SIZE);
+    header->base_timestamp_ms = get_le64(&buffer[14]);
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Décode la charge utile (en clair) d'une trame
+ */
+esp_err_t telemetry_frame_decode(const telemetry_frame_header_t *header, const uint8_t *payload, size_t length,
+                                 sensor_data_t *samples, size_t max_samples, size_t *count) {
+    int32_t last_temperature[SENSOR_MAX_INSTANCES] = {0};
+    int32_t last_humidity[SENSOR_MAX_INSTANCES] = {0};
+    uint64_t timestamp = header->base_timestamp_ms;
+    size_t offset = 0;
+
+    *count = 0;
+    if (header->sample_count > max_samples) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    for (size_t i = 0; i < header->sample_count; i++) {
+        uint32_t fields[4];
+        for (int f = 0; f < 4; f++) {
+            size_t used = varint_get(&payload[offset], length - offset, &fields[f]);
+            if (used == 0) {
+                return ESP_ERR_INVALID_SIZE;
+            }
+            offset += used;
+        }
+        if (offset >= length || fields[0] >= SENSOR_MAX_INSTANCES) {
+            return ESP_ERR_INVALID_SIZE;
+        }
+
+        uint8_t id = (uint8_t)fields[0];
+        timestamp += (int64_t)zigzag_decode(fields[1]);
+        last_temperature[id] += zigzag_decode(fields[2]);
+        last_humidity[id] += zigzag_decode(fields[3]);
+
+        sensor_data_t *sample = &samples[i];
+        memset(sample, 0, sizeof(*sample));
+        sample->sensor_id = id;
+        sample->timestamp = timestamp;
+        sample->temperature = (float)last_temperature[id] / 10.0f;
+        sample->humidity = (float)last_humidity[id] / 10.0f;
+        sample->quality_score = payload[offset++];
+    }
+
+    if (offset != length) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    *count = header->sample_count;
+    return ESP_OK;
+}
+
+/**
+ * @brief Taille du même échantillon publié en JSON (référence de comparaison)
+ */
+size_t telemetry_frame_json_size(const sensor_data_t *sample) {
+    int len = snprintf(NULL, 0,
+                       "{\"sensor_id\":%u,\"timestamp\":%llu,\"temperature\":%.1f,"
+                       "\"humidity\":%.1f,\"quality\":%u}",
+                       sample->sensor_id, (unsigned long long)sample->timestamp,
+                       sample->temperature, sample->humidity, sample->quality_score);
+    return len > 0 ? (size_t)len : 0;
+}
\ No newline at end of file
@@ -0,0 +1,475 @@
+/**
+ * @file host_flash.c
+ * @brief Shims hôte: image flash simulée, partitions, mmap, OTA et image
+ *
+ * La table de partitions est relue depuis partitions.csv pour que les
+ * composants trouvent les mêmes labels, sous-types et tailles que sur
+ * cible.
+ *
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "esp_ota_ops.h"
+#include "esp_image_format.h"
+#include "spi_flash_mmap.h"
+#include "freertos/FreeRTOS.h"
+#include "host_hal.h"
+
+#ifndef HOST_DEFAULT_PARTITIONS_CSV
+#define HOST_DEFAULT_PARTITIONS_CSV     "partitions.csv"
+#endif
+
+#define HOST_FLASH_MMAP_PAGES           (64)
+#define HOST_IMAGE_CHECKSUM_ALIGN       (16)
+#define HOST_IMAGE_DIGEST_SIZE          (32)
+
+static const char *TAG = "HOST_FLASH";
+
+static uint8_t *flash_image = NULL;
+static size_t flash_size = 0;
+static esp_partition_t flash_partitions[HOST_FLASH_MAX_PARTITIONS];
+static size_t flash_partition_count = 0;
+static host_flash_stats_t flash_stats;
+static portMUX_TYPE flash_lock = portMUX_INITIALIZER_UNLOCKED;
+static const esp_partition_t *running_partition = NULL;
+
+// ================================
+// Table de partitions
+// ================================
+
+static char *host_trim(char *s) {
+    while (isspace((unsigned char)*s)) {
+        s++;
+    }
+    char *end = s + strlen(s);
+    while (end > s && isspace((unsigned char)end[-1])) {
+        *--end = '\0';
+    }
+    return s;
+}
+
+static uint32_t host_parse_size(const char *s) {
+    char *end = NULL;
+    unsigned long value = strtoul(s, &end, 0);
+    if (end != NULL && (*end == 'K' || *end == 'k')) {
+        value *= 1024;
+    } else if (end != NULL && (*end == 'M' || *end == 'm')) {
+        value *= 1024 * 1024;
+    }
+    return (uint32_t)value;
+}
+
+static int host_parse_type(const char *s) {
+    if (strcmp(s, "app") == 0) {
+        return ESP_PARTITION_TYPE_APP;
+    }
+    if (strcmp(s, "data") == 0) {
+        return ESP_PARTITION_TYPE_DATA;
+    }
+    return (int)strtoul(s, NULL, 0);
+}
+
+static int host_parse_subtype(const char *s) {
+    static const struct {
+        const char *name;
+        int value;
+    } names[] = {
+        { "factory", ESP_PARTITION_SUBTYPE_APP_FACTORY },
+        { "ota_0", ESP_PARTITION_SUBTYPE_APP_OTA_0 },
+        { "ota_1", ESP_PARTITION_SUBTYPE_APP_OTA_1 },
+        { "ota", ESP_PARTITION_SUBTYPE_DATA_OTA },
+        { "phy", ESP_PARTITION_SUBTYPE_DATA_PHY },
+        { "nvs", ESP_PARTITION_SUBTYPE_DATA_NVS },
+        { "coredump", 0x03 },
+        { "nvs_keys", 0x04 },
+    };
+
+    for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+        if (strcmp(s, names[i].name) == 0) {
+            return names[i].value;
+        }
+    }
+    return (int)strtoul(s, NULL, 0);
+}
+
+static esp_err_t host_load_partition_table(const char *path) {
+    FILE *f = fopen(path, "r");
+    if (f == NULL) {
+        ESP_LOGE(TAG, "Table de partitions introuvable: %s", path);
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    char line[256];
+    uint32_t next_offset = 0x9000;
+    flash_partition_count = 0;
+
+    while (fgets(line, sizeof(line), f) != NULL) {
+        char *comment = strchr(line, '#');
+        if (comment != NULL) {
+            *comment = '\0';
+        }
+
+        char *fields[6] = {0};
+        size_t n = 0;
+        for (char *tok = strtok(line, ","); tok != NULL && n < 6; tok = strtok(NULL, ",")) {
+            fields[n++] = host_trim(tok);
+        }
+        if (n < 5 || fields[0][0] == '\0') {
+            continue;
+        }
+        if (flash_partition_count >= HOST_FLASH_MAX_PARTITIONS) {
+            ESP_LOGW(TAG, "Plus de %d partitions - suivantes ignorées", HOST_FLASH_MAX_PARTITIONS);
+            break;
+        }
+
+        esp_partition_t *p = &flash_partitions[flash_partition_count];
+        memset(p, 0, sizeof(esp_partition_t));
+        strncpy(p->label, fields[0], sizeof(p->label) - 1);
+        p->type = (esp_partition_type_t)host_parse_type(fields[1]);
+        p->subtype = (esp_partition_subtype_t)host_parse_subtype(fields[2]);
+        p->size = host_parse_size(fields[4]);
+        p->erase_size = SPI_FLASH_SEC_SIZE;
+
+        uint32_t align = (p->type == ESP_PARTITION_TYPE_APP) ? SPI_FLASH_MMU_PAGE_SIZE : SPI_FLASH_SEC_SIZE;
+        p->address = (fields[3][0] != '\0') ? host_parse_size(fields[3])
+                                             : (next_offset + align - 1) & ~(align - 1);
+        next_offset = p->address + p->size;
+        flash_partition_count++;
+    }
+
+    fclose(f);
+    return (flash_partition_count > 0) ? ESP_OK : ESP_ERR_NOT_FOUND;
+}
+
+// ================================
+// Image flash
+// ================================
+
+esp_err_t host_flash_init(const char *partitions_csv, const char *image_path) {
+    host_flash_deinit();
+
+    esp_err_t ret = host_load_partition_table(partitions_csv != NULL ? partitions_csv
+                                                                     : HOST_DEFAULT_PARTITIONS_CSV);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    flash_size = HOST_FLASH_DEFAULT_SIZE;
+    for (size_t i = 0; i < flash_partition_count; i++) {
+        size_t end = (size_t)flash_partitions[i].address + flash_partitions[i].size;
+        if (end > flash_size) {
+            flash_size = end;
+        }
+    }
+
+    flash_image = malloc(flash_size);
+    if (flash_image == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    memset(flash_image, 0xFF, flash_size);
+    memset(&flash_stats, 0, sizeof(flash_stats));
+
+    if (image_path != NULL) {
+        FILE *f = fopen(image_path, "rb");
+        if (f != NULL) {
+            size_t loaded = fread(flash_image, 1, flash_size, f);
+            fclose(f);
+            ESP_LOGI(TAG, "Image flash rechargée: %s (%zu octets)", image_path, loaded);
+        }
+    }
+
+    ESP_LOGI(TAG, "Flash simulée: %zu KB, %zu partition(s)", flash_size / 1024, flash_partition_count);
+    return ESP_OK;
+}
+
+esp_err_t host_flash_save(const char *image_path) {
+    if (flash_image == NULL || image_path == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    FILE *f = fopen(image_path, "wb");
+    if (f == NULL) {
+        return ESP_FAIL;
+    }
+    size_t written = fwrite(flash_image, 1, flash_size, f);
+    fclose(f);
+
+    return (written == flash_size) ? ESP_OK : ESP_FAIL;
+}
+
+void host_flash_deinit(void) {
+    free(flash_image);
+    flash_image = NULL;
+    flash_size = 0;
+    flash_partition_count = 0;
+    running_partition = NULL;
+}
+
+uint8_t* host_flash_data(size_t *size) {
+    if (size != NULL) {
+        *size = flash_size;
+    }
+    return flash_image;
+}
+
+void host_flash_get_stats(host_flash_stats_t *stats) {
+    if (stats != NULL) {
+        portENTER_CRITICAL(&flash_lock);
+        *stats = flash_stats;
+        portEXIT_CRITICAL(&flash_lock);
+    }
+}
+
+esp_err_t host_flash_write_test_image(const esp_partition_t *partition, size_t payload_size, uint32_t seed) {
+    if (partition == NULL || flash_image == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    const size_t segment_count = 2;
+    size_t segment_size = ((payload_size / segment_count) + 3) & ~(size_t)3;
+    size_t total = sizeof(esp_image_header_t) +
+                   segment_count * (sizeof(esp_image_segment_header_t) + segment_size) + 1;
+    total = (total + HOST_IMAGE_CHECKSUM_ALIGN - 1) & ~(size_t)(HOST_IMAGE_CHECKSUM_ALIGN - 1);
+    if (total > partition->size) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    uint8_t *base = flash_image + partition->address;
+    memset(base, 0xFF, partition->size);
+
+    esp_image_header_t header = {
+        .magic = ESP_IMAGE_HEADER_MAGIC,
+        .segment_count = (uint8_t)segment_count,
+        .entry_addr = 0x40080000,
+        .hash_appended = 0,
+    };
+    memcpy(base, &header, sizeof(header));
+
+    size_t pos = sizeof(header);
+    uint32_t state = seed ? seed : 0x12345678;
+    for (size_t s = 0; s < segment_count; s++) {
+        esp_image_segment_header_t seg = {
+            .load_addr = 0x3F400000 + (uint32_t)(s * 0x100000),
+            .data_len = (uint32_t)segment_size,
+        };
+        memcpy(base + pos, &seg, sizeof(seg));
+        pos += sizeof(seg);
+        for (size_t i = 0; i < segment_size; i++) {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            base[pos++] = (uint8_t)state;
+        }
+    }
+
+    memset(base + pos, 0, total - pos);
+    return ESP_OK;
+}
+
+// ================================
+// esp_partition
+// ================================
+
+static bool host_partition_range_ok(const esp_partition_t *partition, size_t offset, size_t size) {
+    return flash_image != NULL && partition != NULL &&
+           offset <= partition->size && size <= partition->size - offset;
+}
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t type,
+                                                esp_partition_subtype_t subtype,
+                                                const char *label) {
+    for (size_t i = 0; i < flash_partition_count; i++) {
+        const esp_partition_t *p = &flash_partitions[i];
+        if (type != ESP_PARTITION_TYPE_ANY && p->type != type) {
+            continue;
+        }
+        if (subtype != ESP_PARTITION_SUBTYPE_ANY && p->subtype != subtype) {
+            continue;
+        }
+        if (label != NULL && strcmp(p->label, label) != 0) {
+            continue;
+        }
+        return p;
+    }
+    return NULL;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t *partition, size_t src_offset,
+                             void *dst, size_t size) {
+    if (dst == NULL || !host_partition_range_ok(partition, src_offset, size)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    memcpy(dst, flash_image + partition->address + src_offset, size);
+
+    portENTER_CRITICAL(&flash_lock);
+    flash_stats.reads++;
+    portEXIT_CRITICAL(&flash_lock);
+    return ESP_OK;
+}
+
+/**
+ * Sémantique NOR: l'écriture fait un ET bit à bit avec le contenu.
+ * Réécrire un bit à 1 sans effacement est silencieux sur cible; ici
+ * c'est aussi accepté mais compté dans nor_violations.
+ */
+esp_err_t esp_partition_write(const esp_partition_t *partition, size_t dst_offset,
+                              const void *src, size_t size) {
+    if (src == NULL || !host_partition_range_ok(partition, dst_offset, size)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    uint8_t *dst = flash_image + partition->address + dst_offset;
+    const uint8_t *in = src;
+    uint32_t violations = 0;
+    for (size_t i = 0; i < size; i++) {
+        if ((in[i] & ~dst[i]) != 0) {
+            violations++;
+        }
+        dst[i] &= in[i];
+    }
+
+    portENTER_CRITICAL(&flash_lock);
+    flash_stats.writes++;
+    flash_stats.bytes_written += size;
+    flash_stats.nor_violations += violations;
+    portEXIT_CRITICAL(&flash_lock);
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_erase_range(const esp_partition_t *partition, size_t offset, size_t size) {
+    if (!host_partition_range_ok(partition, offset, size) ||
+        (offset % SPI_FLASH_SEC_SIZE) != 0 || (size % SPI_FLASH_SEC_SIZE) != 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    memset(flash_image + partition->address + offset, 0xFF, size);
+
+    portENTER_CRITICAL(&flash_lock);
+    flash_stats.erases += (uint32_t)(size / SPI_FLASH_SEC_SIZE);
+    portEXIT_CRITICAL(&flash_lock);
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_mmap(const esp_partition_t *partition, size_t offset, size_t size,
+                             spi_flash_mmap_memory_t memory, const void **out_ptr,
+                             spi_flash_mmap_handle_t *out_handle) {
+    (void)memory;
+    if (out_ptr == NULL || out_handle == NULL || !host_partition_range_ok(partition, offset, size)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    *out_ptr = flash_image + partition->address + offset;
+    *out_handle = 1;
+    return ESP_OK;
+}
+
+uint32_t spi_flash_mmap_get_free_pages(spi_flash_mmap_memory_t memory) {
+    (void)memory;
+    return HOST_FLASH_MMAP_PAGES;
+}
+
+void spi_flash_munmap(spi_flash_mmap_handle_t handle) {
+    (void)handle;
+}
+
+// ================================
+// OTA et format d'image
+// ================================
+
+void host_ota_set_running_partition(const esp_partition_t *partition) {
+    running_partition = partition;
+}
+
+const esp_partition_t *esp_ota_get_running_partition(void) {
+    if (running_partition != NULL) {
+        return running_partition;
+    }
+    const esp_partition_t *p = esp_partition_find_first(ESP_PARTITION_TYPE_APP,
+                                                        ESP_PARTITION_SUBTYPE_APP_FACTORY, NULL);
+    return (p != NULL) ? p : esp_partition_find_first(ESP_PARTITION_TYPE_APP,
+                                                      ESP_PARTITION_SUBTYPE_ANY, NULL);
+}
+
+const esp_app_desc_t *esp_ota_get_app_description(void) {
+    static const esp_app_desc_t host_desc = {
+        .magic_word = ESP_APP_DESC_MAGIC_WORD,
+        .version = "host",
+        .project_name = "SecureIoT-VIF-Community",
+        .idf_ver = "host-shim",
+    };
+    static esp_app_desc_t image_desc;
+
+    // Image synthétique sans description: identité hôte par défaut
+    if (esp_ota_get_partition_description(esp_ota_get_running_partition(), &image_desc) == ESP_OK) {
+        return &image_desc;
+    }
+    return &host_desc;
+}
+
+esp_err_t esp_ota_get_partition_description(const esp_partition_t *partition, esp_app_desc_t *app_desc) {
+    // Même emplacement que l'IDF: après l'en-tête d'image et celui du premier segment
+    const size_t desc_offset = sizeof(esp_image_header_t) + sizeof(esp_image_segment_header_t);
+    if (partition == NULL || app_desc == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_err_t ret = esp_partition_read(partition, desc_offset, app_desc, sizeof(esp_app_desc_t));
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    return (app_desc->magic_word == ESP_APP_DESC_MAGIC_WORD) ? ESP_OK : ESP_ERR_NOT_FOUND;
+}
+
+esp_err_t esp_image_get_metadata(const esp_partition_pos_t *part, esp_image_metadata_t *metadata) {
+    if (part == NULL || metadata == NULL || flash_image == NULL ||
+        part->offset >= flash_size || part->size > flash_size - part->offset) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    const uint8_t *base = flash_image + part->offset;
+    memset(metadata, 0, sizeof(esp_image_metadata_t));
+    metadata->start_addr = part->offset;
+    memcpy(&metadata->image, base, sizeof(esp_image_header_t));
+
+    if (metadata->image.magic != ESP_IMAGE_HEADER_MAGIC ||
+        metadata->image.segment_count > ESP_IMAGE_MAX_SEGMENTS) {
+        return ESP_ERR_IMAGE_INVALID;
+    }
+
+    size_t pos = sizeof(esp_image_header_t);
+    for (uint8_t s = 0; s < metadata->image.segment_count; s++) {
+        if (pos + sizeof(esp_image_segment_header_t) > part->size) {
+            return ESP_ERR_IMAGE_INVALID;
+        }
+        memcpy(&metadata->segments[s], base + pos, sizeof(esp_image_segment_header_t));
+        pos += sizeof(esp_image_segment_header_t);
+        metadata->segment_data[s] = (uint32_t)(part->offset + pos);
+        pos += metadata->segments[s].data_len;
+    }
+
+    // Octet de checksum, image complétée à un multiple de 16
+    pos = (pos + 1 + HOST_IMAGE_CHECKSUM_ALIGN - 1) & ~(size_t)(HOST_IMAGE_CHECKSUM_ALIGN - 1);
+    if (metadata->image.hash_appended) {
+        if (pos + HOST_IMAGE_DIGEST_SIZE > part->size) {
+            return ESP_ERR_IMAGE_INVALID;
+        }
+        memcpy(metadata->image_digest, base + pos, HOST_IMAGE_DIGEST_SIZE);
+        pos += HOST_IMAGE_DIGEST_SIZE;
+    }
+
+    if (pos > part->size) {
+        return ESP_ERR_IMAGE_INVALID;
+    }
+    metadata->image_len = (uint32_t)pos;
+    return ESP_OK;
+}
\ No newline at end of file
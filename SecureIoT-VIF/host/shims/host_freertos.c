@@ -0,0 +1,304 @@
+/**
+ * @file host_freertos.c
+ * @brief Shims hôte: sections critiques, sémaphores et tâches sur pthread
+ *
+ * Les attentes bornées utilisent le temps réel, même quand
+ * esp_timer_get_time() est sur l'horloge virtuelle: la simulation
+ * n'appelle que des chemins non bloquants.
+ *
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#define _GNU_SOURCE     // PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+
+struct host_semaphore {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    uint32_t count;
+    uint32_t max_count;
+    bool is_static;
+};
+
+_Static_assert(sizeof(struct host_semaphore) <= sizeof(StaticSemaphore_t),
+               "StaticSemaphore_t trop petit pour struct host_semaphore");
+
+struct host_task {
+    pthread_t thread;
+    TaskFunction_t code;
+    void *parameters;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    uint32_t notifications;
+};
+
+static pthread_mutex_t host_critical_lock = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP;
+static __thread struct host_task *host_current_task = NULL;
+
+// ================================
+// Sections critiques
+// ================================
+
+void vPortEnterCritical(portMUX_TYPE *mux) {
+    (void)mux;
+    pthread_mutex_lock(&host_critical_lock);
+}
+
+void vPortExitCritical(portMUX_TYPE *mux) {
+    (void)mux;
+    pthread_mutex_unlock(&host_critical_lock);
+}
+
+// ================================
+// Attentes
+// ================================
+
+/**
+ * @brief Échéance absolue (CLOCK_REALTIME) d'une attente de ticks
+ */
+static struct timespec host_deadline(TickType_t ticks) {
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    uint64_t ns = (uint64_t)ticks * portTICK_PERIOD_MS * 1000000ULL;
+    ts.tv_sec += (time_t)(ns / 1000000000ULL);
+    ts.tv_nsec += (long)(ns % 1000000000ULL);
+    if (ts.tv_nsec >= 1000000000L) {
+        ts.tv_sec++;
+        ts.tv_nsec -= 1000000000L;
+    }
+    return ts;
+}
+
+/**
+ * @brief Attend cond tant que *ready est faux, dans la limite de ticks
+ *
+ * @return true si la condition est satisfaite
+ */
+static bool host_wait(pthread_cond_t *cond, pthread_mutex_t *lock, const uint32_t *ready, TickType_t ticks) {
+    if (ticks == portMAX_DELAY) {
+        while (*ready == 0) {
+            pthread_cond_wait(cond, lock);
+        }
+        return true;
+    }
+
+    struct timespec deadline = host_deadline(ticks);
+    while (*ready == 0) {
+        if (pthread_cond_timedwait(cond, lock, &deadline) == ETIMEDOUT) {
+            return *ready != 0;
+        }
+    }
+    return true;
+}
+
+// ================================
+// Sémaphores
+// ================================
+
+static SemaphoreHandle_t host_semaphore_init(SemaphoreHandle_t sem, UBaseType_t max_count,
+                                             UBaseType_t initial_count) {
+    if (sem == NULL) {
+        return NULL;
+    }
+    pthread_mutex_init(&sem->lock, NULL);
+    pthread_cond_init(&sem->cond, NULL);
+    sem->count = initial_count;
+    sem->max_count = max_count;
+    return sem;
+}
+
+static SemaphoreHandle_t host_semaphore_create(UBaseType_t max_count, UBaseType_t initial_count) {
+    return host_semaphore_init(calloc(1, sizeof(struct host_semaphore)), max_count, initial_count);
+}
+
+static SemaphoreHandle_t host_semaphore_create_static(StaticSemaphore_t *buffer, UBaseType_t max_count,
+                                                      UBaseType_t initial_count) {
+    if (buffer == NULL) {
+        return NULL;
+    }
+    memset(buffer, 0, sizeof(*buffer));
+    SemaphoreHandle_t sem = host_semaphore_init((SemaphoreHandle_t)buffer, max_count, initial_count);
+    sem->is_static = true;
+    return sem;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void) {
+    return host_semaphore_create(1, 1);
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void) {
+    return host_semaphore_create(1, 0);
+}
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max_count, UBaseType_t initial_count) {
+    return host_semaphore_create(max_count, initial_count);
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutexStatic(StaticSemaphore_t *buffer) {
+    return host_semaphore_create_static(buffer, 1, 1);
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinaryStatic(StaticSemaphore_t *buffer) {
+    return host_semaphore_create_static(buffer, 1, 0);
+}
+
+SemaphoreHandle_t xSemaphoreCreateCountingStatic(UBaseType_t max_count, UBaseType_t initial_count,
+                                                 StaticSemaphore_t *buffer) {
+    return host_semaphore_create_static(buffer, max_count, initial_count);
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks_to_wait) {
+    if (sem == NULL) {
+        return pdFALSE;
+    }
+
+    pthread_mutex_lock(&sem->lock);
+    bool taken = host_wait(&sem->cond, &sem->lock, &sem->count, ticks_to_wait);
+    if (taken) {
+        sem->count--;
+    }
+    pthread_mutex_unlock(&sem->lock);
+
+    return taken ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem) {
+    if (sem == NULL) {
+        return pdFALSE;
+    }
+
+    BaseType_t ret = pdFALSE;
+    pthread_mutex_lock(&sem->lock);
+    if (sem->count < sem->max_count) {
+        sem->count++;
+        pthread_cond_signal(&sem->cond);
+        ret = pdTRUE;
+    }
+    pthread_mutex_unlock(&sem->lock);
+
+    return ret;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t sem) {
+    if (sem == NULL) {
+        return;
+    }
+    pthread_mutex_destroy(&sem->lock);
+    pthread_cond_destroy(&sem->cond);
+    if (!sem->is_static) {
+        free(sem);
+    }
+}
+
+// ================================
+// Tâches
+// ================================
+
+static void *host_task_entry(void *arg) {
+    struct host_task *task = arg;
+    host_current_task = task;
+    task->code(task->parameters);
+    return NULL;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t task_code, const char *name, uint32_t stack_depth,
+                       void *parameters, UBaseType_t priority, TaskHandle_t *created_task) {
+    (void)name;
+    (void)stack_depth;
+    (void)priority;
+
+    struct host_task *task = calloc(1, sizeof(struct host_task));
+    if (task == NULL) {
+        return pdFAIL;
+    }
+    task->code = task_code;
+    task->parameters = parameters;
+    pthread_mutex_init(&task->lock, NULL);
+    pthread_cond_init(&task->cond, NULL);
+
+    if (pthread_create(&task->thread, NULL, host_task_entry, task) != 0) {
+        free(task);
+        return pdFAIL;
+    }
+    pthread_detach(task->thread);
+
+    if (created_task != NULL) {
+        *created_task = task;
+    }
+    return pdPASS;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task_code, const char *name, uint32_t stack_depth,
+                                   void *parameters, UBaseType_t priority, TaskHandle_t *created_task,
+                                   BaseType_t core_id) {
+    (void)core_id;
+    return xTaskCreate(task_code, name, stack_depth, parameters, priority, created_task);
+}
+
+/**
+ * Seule l'auto-suppression (NULL ou tâche courante) est prise en charge,
+ * comme dans les composants. Le descripteur est volontairement conservé:
+ * un xTaskNotifyGive tardif sur une tâche terminée reste sans danger.
+ */
+void vTaskDelete(TaskHandle_t task) {
+    if (task == NULL || task == host_current_task) {
+        pthread_exit(NULL);
+    }
+}
+
+void vTaskDelay(TickType_t ticks) {
+    usleep((useconds_t)ticks * portTICK_PERIOD_MS * 1000);
+}
+
+TickType_t xTaskGetTickCount(void) {
+    return (TickType_t)(esp_timer_get_time() / 1000 / portTICK_PERIOD_MS);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void) {
+    return host_current_task;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+    if (task == NULL) {
+        return pdFAIL;
+    }
+    pthread_mutex_lock(&task->lock);
+    task->notifications++;
+    pthread_cond_signal(&task->cond);
+    pthread_mutex_unlock(&task->lock);
+    return pdPASS;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks_to_wait) {
+    struct host_task *task = host_current_task;
+    if (task == NULL) {
+        vTaskDelay(ticks_to_wait == portMAX_DELAY ? 0 : ticks_to_wait);
+        return 0;
+    }
+
+    pthread_mutex_lock(&task->lock);
+    host_wait(&task->cond, &task->lock, &task->notifications, ticks_to_wait);
+    uint32_t value = task->notifications;
+    if (value > 0) {
+        task->notifications = clear_on_exit ? 0 : value - 1;
+    }
+    pthread_mutex_unlock(&task->lock);
+
+    return value;
+}
+
+BaseType_t xPortGetCoreID(void) {
+    return 0;
+}
\ No newline at end of file
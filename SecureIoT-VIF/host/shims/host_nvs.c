@@ -0,0 +1,163 @@
+/**
+ * @file host_nvs.c
+ * @brief Shim hôte: NVS en mémoire (espace de noms + clé -> blob)
+ *
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "esp_err.h"
+#include "nvs.h"
+#include "freertos/FreeRTOS.h"
+
+#define HOST_NVS_MAX_ENTRIES            (32)
+#define HOST_NVS_MAX_NAMESPACES         (8)
+#define HOST_NVS_KEY_MAX                (16)    // 15 caractères + '\0' comme l'IDF
+#define HOST_NVS_BLOB_MAX               (1024)
+
+typedef struct {
+    bool used;
+    nvs_handle_t ns;
+    char key[HOST_NVS_KEY_MAX];
+    size_t length;
+    uint8_t value[HOST_NVS_BLOB_MAX];
+} host_nvs_entry_t;
+
+static host_nvs_entry_t nvs_entries[HOST_NVS_MAX_ENTRIES];
+static char nvs_namespaces[HOST_NVS_MAX_NAMESPACES][HOST_NVS_KEY_MAX];
+static portMUX_TYPE nvs_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// Le handle encode l'espace de noms (bits 0-7) et le mode (bit 8)
+#define HOST_NVS_HANDLE_NS(h)           ((h) & 0xFF)
+#define HOST_NVS_HANDLE_WRITABLE(h)     (((h) >> 8) & 1)
+
+static host_nvs_entry_t *host_nvs_find(nvs_handle_t handle, const char *key) {
+    for (size_t i = 0; i < HOST_NVS_MAX_ENTRIES; i++) {
+        if (nvs_entries[i].used && nvs_entries[i].ns == HOST_NVS_HANDLE_NS(handle) &&
+            strcmp(nvs_entries[i].key, key) == 0) {
+            return &nvs_entries[i];
+        }
+    }
+    return NULL;
+}
+
+esp_err_t nvs_open(const char *name, nvs_open_mode_t open_mode, nvs_handle_t *out_handle) {
+    if (name == NULL || out_handle == NULL || strlen(name) >= HOST_NVS_KEY_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_err_t ret = ESP_ERR_NO_MEM;
+    portENTER_CRITICAL(&nvs_lock);
+    for (size_t i = 0; i < HOST_NVS_MAX_NAMESPACES; i++) {
+        if (nvs_namespaces[i][0] == '\0') {
+            if (open_mode == NVS_READONLY) {
+                ret = ESP_ERR_NVS_NOT_FOUND;
+                break;
+            }
+            strcpy(nvs_namespaces[i], name);
+        }
+        if (strcmp(nvs_namespaces[i], name) == 0) {
+            *out_handle = (nvs_handle_t)(i + 1) | ((open_mode == NVS_READWRITE) ? (1U << 8) : 0);
+            ret = ESP_OK;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&nvs_lock);
+
+    return ret;
+}
+
+void nvs_close(nvs_handle_t handle) {
+    (void)handle;
+}
+
+esp_err_t nvs_get_blob(nvs_handle_t handle, const char *key, void *out_value, size_t *length) {
+    if (key == NULL || length == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_err_t ret = ESP_OK;
+    portENTER_CRITICAL(&nvs_lock);
+    host_nvs_entry_t *entry = host_nvs_find(handle, key);
+    if (entry == NULL) {
+        ret = ESP_ERR_NVS_NOT_FOUND;
+    } else if (out_value == NULL) {
+        *length = entry->length;
+    } else if (*length < entry->length) {
+        ret = ESP_ERR_NVS_INVALID_LENGTH;
+    } else {
+        memcpy(out_value, entry->value, entry->length);
+        *length = entry->length;
+    }
+    portEXIT_CRITICAL(&nvs_lock);
+
+    return ret;
+}
+
+esp_err_t nvs_set_blob(nvs_handle_t handle, const char *key, const void *value, size_t length) {
+    if (key == NULL || value == NULL || strlen(key) >= HOST_NVS_KEY_MAX || length > HOST_NVS_BLOB_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!HOST_NVS_HANDLE_WRITABLE(handle)) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    esp_err_t ret = ESP_OK;
+    portENTER_CRITICAL(&nvs_lock);
+    host_nvs_entry_t *entry = host_nvs_find(handle, key);
+    for (size_t i = 0; entry == NULL && i < HOST_NVS_MAX_ENTRIES; i++) {
+        if (!nvs_entries[i].used) {
+            entry = &nvs_entries[i];
+            entry->used = true;
+            entry->ns = HOST_NVS_HANDLE_NS(handle);
+            strcpy(entry->key, key);
+        }
+    }
+    if (entry == NULL) {
+        ret = ESP_ERR_NO_MEM;
+    } else {
+        memcpy(entry->value, value, length);
+        entry->length = length;
+    }
+    portEXIT_CRITICAL(&nvs_lock);
+
+    return ret;
+}
+
+esp_err_t nvs_get_u32(nvs_handle_t handle, const char *key, uint32_t *out_value) {
+    size_t length = sizeof(uint32_t);
+    return nvs_get_blob(handle, key, out_value, &length);
+}
+
+esp_err_t nvs_set_u32(nvs_handle_t handle, const char *key, uint32_t value) {
+    return nvs_set_blob(handle, key, &value, sizeof(value));
+}
+
+esp_err_t nvs_erase_key(nvs_handle_t handle, const char *key) {
+    if (key == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!HOST_NVS_HANDLE_WRITABLE(handle)) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    esp_err_t ret = ESP_OK;
+    portENTER_CRITICAL(&nvs_lock);
+    host_nvs_entry_t *entry = host_nvs_find(handle, key);
+    if (entry == NULL) {
+        ret = ESP_ERR_NVS_NOT_FOUND;
+    } else {
+        memset(entry, 0, sizeof(host_nvs_entry_t));
+    }
+    portEXIT_CRITICAL(&nvs_lock);
+
+    return ret;
+}
+
+esp_err_t nvs_commit(nvs_handle_t handle) {
+    (void)handle;
+    return ESP_OK;
+}
\ No newline at end of file
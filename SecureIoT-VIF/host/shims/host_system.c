@@ -0,0 +1,203 @@
+/**
+ * @file host_system.c
+ * @brief Shims hôte: erreurs, log, horloge, cycles CPU, CRC, tas
+ *
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <time.h>
+#include <unistd.h>
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_system.h"
+#include "esp_heap_caps.h"
+#include "esp_cpu.h"
+#include "esp_rom_crc.h"
+#include "rom/ets_sys.h"
+#include "host_hal.h"
+
+// Tas nominal d'un ESP32 après démarrage du Wi-Fi, pour les composants qui le rapportent
+#define HOST_NOMINAL_FREE_HEAP          (200 * 1024)
+
+static int host_log_level = ESP_LOG_INFO;
+static atomic_bool host_clock_virtual = false;
+static _Atomic int64_t host_clock_virtual_us = 0;
+
+// ================================
+// Erreurs
+// ================================
+
+const char *esp_err_to_name(esp_err_t code) {
+    switch (code) {
+        case ESP_OK: return "ESP_OK";
+        case ESP_FAIL: return "ESP_FAIL";
+        case ESP_ERR_NO_MEM: return "ESP_ERR_NO_MEM";
+        case ESP_ERR_INVALID_ARG: return "ESP_ERR_INVALID_ARG";
+        case ESP_ERR_INVALID_STATE: return "ESP_ERR_INVALID_STATE";
+        case ESP_ERR_INVALID_SIZE: return "ESP_ERR_INVALID_SIZE";
+        case ESP_ERR_NOT_FOUND: return "ESP_ERR_NOT_FOUND";
+        case ESP_ERR_NOT_SUPPORTED: return "ESP_ERR_NOT_SUPPORTED";
+        case ESP_ERR_TIMEOUT: return "ESP_ERR_TIMEOUT";
+        case ESP_ERR_INVALID_RESPONSE: return "ESP_ERR_INVALID_RESPONSE";
+        case ESP_ERR_INVALID_CRC: return "ESP_ERR_INVALID_CRC";
+        case ESP_ERR_INVALID_VERSION: return "ESP_ERR_INVALID_VERSION";
+        case ESP_ERR_INVALID_MAC: return "ESP_ERR_INVALID_MAC";
+        case ESP_ERR_NOT_FINISHED: return "ESP_ERR_NOT_FINISHED";
+        default: return "ERROR";
+    }
+}
+
+void esp_host_abort_on_error(esp_err_t code, const char *file, int line, const char *expr) {
+    fprintf(stderr, "ESP_ERROR_CHECK échoué: %s (0x%x) à %s:%d\nexpression: %s\n",
+            esp_err_to_name(code), code, file, line, expr);
+    abort();
+}
+
+void esp_restart(void) {
+    fprintf(stderr, "esp_restart() appelé sur l'hôte - arrêt\n");
+    exit(EXIT_FAILURE);
+}
+
+uint32_t esp_get_free_heap_size(void) {
+    return HOST_NOMINAL_FREE_HEAP;
+}
+
+uint32_t esp_get_minimum_free_heap_size(void) {
+    return HOST_NOMINAL_FREE_HEAP;
+}
+
+size_t heap_caps_get_free_size(uint32_t caps) {
+    (void)caps;
+    return HOST_NOMINAL_FREE_HEAP;
+}
+
+size_t heap_caps_get_minimum_free_size(uint32_t caps) {
+    (void)caps;
+    return HOST_NOMINAL_FREE_HEAP;
+}
+
+size_t heap_caps_get_largest_free_block(uint32_t caps) {
+    (void)caps;
+    return HOST_NOMINAL_FREE_HEAP;
+}
+
+// ================================
+// Horloge et cycles
+// ================================
+
+static int64_t host_monotonic_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static int64_t host_clock_origin_us(void) {
+    static int64_t origin = 0;
+    if (origin == 0) {
+        origin = host_monotonic_us();
+    }
+    return origin;
+}
+
+int64_t esp_timer_get_time(void) {
+    if (atomic_load(&host_clock_virtual)) {
+        return atomic_load(&host_clock_virtual_us);
+    }
+    return host_monotonic_us() - host_clock_origin_us();
+}
+
+void host_clock_set_virtual(bool enable) {
+    if (enable) {
+        atomic_store(&host_clock_virtual_us, esp_timer_get_time());
+    } else {
+        (void)host_clock_origin_us();
+    }
+    atomic_store(&host_clock_virtual, enable);
+}
+
+void host_clock_advance_us(int64_t delta_us) {
+    if (atomic_load(&host_clock_virtual) && delta_us > 0) {
+        atomic_fetch_add(&host_clock_virtual_us, delta_us);
+    }
+}
+
+void host_clock_set_us(int64_t now_us) {
+    atomic_store(&host_clock_virtual_us, now_us);
+}
+
+/**
+ * Toujours sur l'horloge réelle: les portées perf_trace mesurent le
+ * coût hôte même quand esp_timer_get_time() est virtuel.
+ */
+uint32_t esp_cpu_get_ccount(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    uint64_t ns = (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+    return (uint32_t)(ns * HOST_CPU_FREQ_MHZ / 1000);
+}
+
+uint32_t ets_get_cpu_frequency(void) {
+    return HOST_CPU_FREQ_MHZ;
+}
+
+void ets_delay_us(uint32_t us) {
+    usleep(us);
+}
+
+// ================================
+// CRC
+// ================================
+
+uint32_t esp_rom_crc32_le(uint32_t crc, uint8_t const *buf, uint32_t len) {
+    static uint32_t table[256];
+    static atomic_bool table_ready = false;
+
+    if (!atomic_load(&table_ready)) {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; k++) {
+                c = (c & 1) ? (0xEDB88320U ^ (c >> 1)) : (c >> 1);
+            }
+            table[i] = c;
+        }
+        atomic_store(&table_ready, true);
+    }
+
+    crc = ~crc;
+    for (uint32_t i = 0; i < len; i++) {
+        crc = table[(crc ^ buf[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+// ================================
+// Log
+// ================================
+
+void host_log_set_level(int level) {
+    host_log_level = level;
+}
+
+void esp_log_write(esp_log_level_t level, const char *tag, const char *format, ...) {
+    static const char letters[] = "NEWIDV";
+
+    if ((int)level > host_log_level) {
+        return;
+    }
+
+    printf("%c (%lld) %s: ", letters[level], (long long)(esp_timer_get_time() / 1000), tag);
+
+    va_list args;
+    va_start(args, format);
+    vprintf(format, args);
+    va_end(args);
+
+    putchar('\n');
+}
\ No newline at end of file
@@ -0,0 +1,11 @@
+/**
+ * @file esp_attr.h
+ * @brief Shim hôte: attributs de placement mémoire sans effet
+ */
+
+#pragma once
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define RTC_DATA_ATTR
+#define RTC_NOINIT_ATTR
\ No newline at end of file
@@ -0,0 +1,10 @@
+/**
+ * @file esp_cpu.h
+ * @brief Shim hôte: compteur de cycles à HOST_CPU_FREQ_MHZ nominal
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+uint32_t esp_cpu_get_ccount(void);
\ No newline at end of file
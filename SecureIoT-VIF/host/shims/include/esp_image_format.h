@@ -0,0 +1,57 @@
+/**
+ * @file esp_image_format.h
+ * @brief Shim hôte: lecture des métadonnées d'une image applicative
+ *
+ * Analyse l'en-tête et les segments écrits dans la flash simulée, au
+ * même format que l'IDF (magic 0xE9, checksum aligné sur 16, SHA-256
+ * optionnel en fin d'image).
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+
+#define ESP_ERR_IMAGE_BASE              0x2000
+#define ESP_ERR_IMAGE_FLASH_FAIL        (ESP_ERR_IMAGE_BASE + 1)
+#define ESP_ERR_IMAGE_INVALID           (ESP_ERR_IMAGE_BASE + 2)
+#define ESP_IMAGE_HEADER_MAGIC          0xE9
+#define ESP_IMAGE_MAX_SEGMENTS          16
+
+typedef struct {
+    uint8_t magic;
+    uint8_t segment_count;
+    uint8_t spi_mode;
+    uint8_t spi_speed: 4;
+    uint8_t spi_size: 4;
+    uint32_t entry_addr;
+    uint8_t wp_pin;
+    uint8_t spi_pin_drv[3];
+    uint16_t chip_id;
+    uint8_t min_chip_rev;
+    uint16_t min_chip_rev_full;
+    uint16_t max_chip_rev_full;
+    uint8_t reserved[4];
+    uint8_t hash_appended;
+} __attribute__((packed)) esp_image_header_t;
+
+typedef struct {
+    uint32_t load_addr;
+    uint32_t data_len;
+} esp_image_segment_header_t;
+
+typedef struct {
+    uint32_t start_addr;
+    esp_image_header_t image;
+    esp_image_segment_header_t segments[ESP_IMAGE_MAX_SEGMENTS];
+    uint32_t segment_data[ESP_IMAGE_MAX_SEGMENTS];
+    uint32_t image_len;
+    uint8_t image_digest[32];
+} esp_image_metadata_t;
+
+typedef struct {
+    uint32_t offset;
+    uint32_t size;
+} esp_partition_pos_t;
+
+esp_err_t esp_image_get_metadata(const esp_partition_pos_t *part, esp_image_metadata_t *metadata);
\ No newline at end of file
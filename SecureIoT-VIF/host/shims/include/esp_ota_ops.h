@@ -0,0 +1,14 @@
+/**
+ * @file esp_ota_ops.h
+ * @brief Shim hôte: partition en cours d'exécution = partition factory simulée
+ */
+
+#pragma once
+
+#include "esp_err.h"
+#include "esp_partition.h"
+#include "esp_app_format.h"
+
+const esp_partition_t *esp_ota_get_running_partition(void);
+const esp_app_desc_t *esp_ota_get_app_description(void);
+esp_err_t esp_ota_get_partition_description(const esp_partition_t *partition, esp_app_desc_t *app_desc);
\ No newline at end of file
@@ -0,0 +1,10 @@
+/**
+ * @file esp_rom_crc.h
+ * @brief Shim hôte: CRC32 little-endian (même convention que la ROM)
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+uint32_t esp_rom_crc32_le(uint32_t crc, uint8_t const *buf, uint32_t len);
\ No newline at end of file
@@ -0,0 +1,8 @@
+/**
+ * @file esp_spi_flash.h
+ * @brief Shim hôte: en-tête historique de la flash SPI
+ */
+
+#pragma once
+
+#include "spi_flash_mmap.h"
\ No newline at end of file
@@ -0,0 +1,11 @@
+/**
+ * @file esp_timer.h
+ * @brief Shim hôte: horloge µs (réelle ou virtuelle, voir host_hal.h)
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+
+int64_t esp_timer_get_time(void);
\ No newline at end of file
@@ -0,0 +1,50 @@
+/**
+ * @file FreeRTOS.h
+ * @brief Shim hôte: types FreeRTOS et sections critiques sur pthread
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "sdkconfig.h"
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint8_t StackType_t;
+
+#define pdPASS                          1
+#define pdFAIL                          0
+#define pdTRUE                          1
+#define pdFALSE                         0
+#define portMAX_DELAY                   ((TickType_t)0xffffffffu)
+#define portTICK_PERIOD_MS              (1000 / CONFIG_FREERTOS_HZ)
+#define pdMS_TO_TICKS(ms)               ((TickType_t)(((uint64_t)(ms) * CONFIG_FREERTOS_HZ) / 1000))
+#define portNUM_PROCESSORS              1
+#define configMAX_PRIORITIES            25
+#define tskNO_AFFINITY                  0x7fffffff
+
+// Stockage des objets statiques: assez grand pour le sémaphore pthread
+typedef struct {
+    uint64_t opaque[16];
+} StaticSemaphore_t;
+
+/**
+ * Un verrou global récursif sérialise toutes les sections critiques:
+ * correct pour les composants, qui n'y font que des accès courts.
+ */
+typedef struct {
+    int unused;
+} portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED    { 0 }
+
+void vPortEnterCritical(portMUX_TYPE *mux);
+void vPortExitCritical(portMUX_TYPE *mux);
+
+#define portENTER_CRITICAL(mux)         vPortEnterCritical(mux)
+#define portEXIT_CRITICAL(mux)          vPortExitCritical(mux)
+#define portENTER_CRITICAL_ISR(mux)     vPortEnterCritical(mux)
+#define portEXIT_CRITICAL_ISR(mux)      vPortExitCritical(mux)
+#define portYIELD_FROM_ISR(x)           ((void)(x))
\ No newline at end of file
@@ -0,0 +1,8 @@
+/**
+ * @file portmacro.h
+ * @brief Shim hôte: voir FreeRTOS.h
+ */
+
+#pragma once
+
+#include "freertos/FreeRTOS.h"
\ No newline at end of file
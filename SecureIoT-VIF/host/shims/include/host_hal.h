@@ -0,0 +1,140 @@
+/**
+ * @file host_hal.h
+ * @brief Contrôle des shims HAL de la build hôte (Linux)
+ *
+ * Les composants sont compilés tels quels contre des en-têtes ESP-IDF
+ * minimaux; ce fichier expose les réglages propres à l'hôte: horloge
+ * virtuelle, image flash simulée et niveau de log.
+ *
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#ifndef HOST_HAL_H
+#define HOST_HAL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "esp_partition.h"
+
+// ================================
+// Constantes hôte
+// ================================
+
+#define HOST_FLASH_DEFAULT_SIZE         (4 * 1024 * 1024)   // Flash 4 MB (ESP32-WROOM)
+#define HOST_CPU_FREQ_MHZ               (240)               // Fréquence nominale rapportée
+#define HOST_FLASH_MAX_PARTITIONS       (16)
+
+// ================================
+// Horloge
+// ================================
+
+/**
+ * @brief Bascule esp_timer_get_time() sur une horloge virtuelle
+ *
+ * En mode virtuel le temps n'avance que par host_clock_advance_us(), ce
+ * qui permet de rejouer des heures de trace en quelques millisecondes
+ * tout en gardant les fenêtres temporelles des composants cohérentes.
+ */
+void host_clock_set_virtual(bool enable);
+
+/**
+ * @brief Avance l'horloge virtuelle (sans effet en mode réel)
+ */
+void host_clock_advance_us(int64_t delta_us);
+
+/**
+ * @brief Positionne l'horloge virtuelle
+ */
+void host_clock_set_us(int64_t now_us);
+
+// ================================
+// Flash simulée
+// ================================
+
+/**
+ * @brief Crée l'image flash simulée et sa table de partitions
+ *
+ * L'image est en RAM et respecte la sémantique NOR: l'effacement
+ * (par secteur de 4 KB) remet les octets à 0xFF, l'écriture ne peut
+ * que faire passer des bits de 1 à 0.
+ *
+ * @param partitions_csv Table au format ESP-IDF (NULL = partitions.csv du dépôt)
+ * @param image_path Fichier image à recharger s'il existe (NULL = image vierge)
+ * @return ESP_OK si succès
+ */
+esp_err_t host_flash_init(const char *partitions_csv, const char *image_path);
+
+/**
+ * @brief Écrit l'image flash dans un fichier (persistance entre exécutions)
+ */
+esp_err_t host_flash_save(const char *image_path);
+
+/**
+ * @brief Libère l'image flash simulée
+ */
+void host_flash_deinit(void);
+
+/**
+ * @brief Accès direct à l'image (injection de fautes, corruption de test)
+ */
+uint8_t* host_flash_data(size_t *size);
+
+/**
+ * @brief Compteurs d'opérations flash depuis host_flash_init()
+ */
+typedef struct {
+    uint32_t reads;
+    uint32_t writes;
+    uint32_t erases;
+    uint64_t bytes_written;
+    uint32_t nor_violations;        // Écritures tentant de passer un bit de 0 à 1
+} host_flash_stats_t;
+
+void host_flash_get_stats(host_flash_stats_t *stats);
+
+/**
+ * @brief Écrit une image applicative synthétique valide dans une partition
+ *
+ * En-tête ESP-IDF, deux segments pseudo-aléatoires (déterministes pour
+ * une graine donnée), checksum aligné, sans SHA-256 ajouté.
+ *
+ * @param partition Partition app cible (typiquement factory)
+ * @param payload_size Taille approximative des segments
+ * @param seed Graine du contenu
+ * @return ESP_OK, ESP_ERR_INVALID_SIZE si l'image dépasse la partition
+ */
+esp_err_t host_flash_write_test_image(const esp_partition_t *partition, size_t payload_size, uint32_t seed);
+
+/**
+ * @brief Simule un redémarrage sur une autre partition applicative
+ *
+ * esp_ota_get_running_partition() renvoie alors cette partition et
+ * esp_ota_get_app_description() la description écrite dans son image
+ * (description hôte par défaut si absente).
+ *
+ * @param partition Partition app (NULL = factory)
+ */
+void host_ota_set_running_partition(const esp_partition_t *partition);
+
+// ================================
+// Log
+// ================================
+
+/**
+ * @brief Niveau maximal affiché (1 = erreurs ... 5 = verbeux, 0 = muet)
+ */
+void host_log_set_level(int level);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_HAL_H */
\ No newline at end of file
@@ -0,0 +1,11 @@
+/**
+ * @file ets_sys.h
+ * @brief Shim hôte: fonctions ROM
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+void ets_delay_us(uint32_t us);
+uint32_t ets_get_cpu_frequency(void);
\ No newline at end of file
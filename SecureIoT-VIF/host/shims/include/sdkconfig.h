@@ -0,0 +1,26 @@
+/**
+ * @file sdkconfig.h
+ * @brief Configuration de la build hôte (équivalent sdkconfig généré)
+ *
+ * Aucune capacité SOC SHA/AES (soc/soc_caps.h hôte): le backend crypto
+ * reste logiciel.
+ */
+
+#pragma once
+
+#define CONFIG_FREERTOS_HZ                      1000
+#define CONFIG_CRYPTO_BASIC_BACKEND_SOFTWARE    1
+#define CONFIG_CRYPTO_RANDOM_POOL_SOURCE_DRBG   1
+#define CONFIG_CRYPTO_RANDOM_RESEED_INTERVAL_MS 600000
+
+// Profil de développement: auto-tests exécutés par les tests hôtes
+#define CONFIG_APP_PROFILE_DEVELOPMENT          1
+#define CONFIG_APP_PROFILE_NAME                 "development"
+#define CONFIG_APP_SELF_TESTS                   1
+#define CONFIG_APP_BANNERS                      1
+#define CONFIG_APP_DIAGNOSTIC_REPORTS           1
+#define CONFIG_APP_RUNTIME_GUARDS               1
+
+#ifndef CONFIG_PERF_TRACE_ENABLE
+#define CONFIG_PERF_TRACE_ENABLE                1
+#endif
\ No newline at end of file
@@ -0,0 +1,8 @@
+/**
+ * @file soc_caps.h
+ * @brief Capacités SOC de la build hôte
+ *
+ * Ni SOC_SHA_SUPPORTED ni SOC_AES_SUPPORTED: pas de backend crypto hardware.
+ */
+
+#pragma once
\ No newline at end of file
@@ -0,0 +1,22 @@
+/**
+ * @file spi_flash_mmap.h
+ * @brief Shim hôte: projection mémoire de la flash simulée
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define SPI_FLASH_SEC_SIZE              4096
+#define SPI_FLASH_MMU_PAGE_SIZE         0x10000
+
+typedef enum {
+    SPI_FLASH_MMAP_DATA,
+    SPI_FLASH_MMAP_INST
+} spi_flash_mmap_memory_t;
+
+typedef uint32_t spi_flash_mmap_handle_t;
+
+uint32_t spi_flash_mmap_get_free_pages(spi_flash_mmap_memory_t memory);
+void spi_flash_munmap(spi_flash_mmap_handle_t handle);
\ No newline at end of file
@@ -0,0 +1,357 @@
+/**
+ * @file host_sim.c
+ * @brief Simulation hôte: trace capteur -> détecteur -> gestionnaire d'incidents
+ *
+ * Reproduit le chemin de sensor_task et du monitoring de main.c sur
+ * horloge virtuelle: chaque échantillon positionne l'horloge sur son
+ * timestamp, la maintenance (incident_manager_tick) tourne toutes les
+ * SECURITY_MONITOR_INTERVAL_MS simulées, le journal écrit dans l'image
+ * flash simulée.
+ *
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include <time.h>
+#include "esp_log.h"
+#include "esp_err.h"
+#include "esp_timer.h"
+#include "app_config.h"
+#include "anomaly_detector.h"
+#include "incident_manager.h"
+#include "incident_journal.h"
+#include "security_event.h"
+#include "perf_trace.h"
+#include "host_hal.h"
+#include "sensor_trace.h"
+
+static const char *TAG = "HOST_SIM";
+
+#define SIM_BATCH_SIZE                  (256)
+
+typedef struct {
+    const char *trace_path;
+    const char *write_trace_path;
+    const char *flash_path;
+    sensor_trace_synth_config_t synth;
+    anomaly_detection_mode_t mode;
+    bool batch;
+    bool check;
+    bool perf;
+    int log_level;
+} sim_options_t;
+
+typedef struct {
+    uint64_t samples;
+    uint64_t anomalies;
+    uint64_t events_new;
+    uint64_t events_coalesced;
+    uint64_t events_rate_limited;
+    uint64_t ticks;
+} sim_counters_t;
+
+static double sim_wall_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void sim_usage(const char *prog) {
+    printf("Usage: %s [options]\n"
+           "  --trace FICHIER        Rejouer une trace CSV (" SENSOR_TRACE_CSV_HEADER ")\n"
+           "  --synthetic N          Trace synthétique de N échantillons (défaut 100000)\n"
+           "  --seed S               Graine de la trace synthétique (défaut 1)\n"
+           "  --interval-ms MS       Période simulée (défaut SENSOR_READ_INTERVAL_MS)\n"
+           "  --anomaly-rate R       Probabilité d'anomalie injectée (défaut 0.001)\n"
+           "  --mode threshold|statistical\n"
+           "  --batch                Scoring par lots (anomaly_detect_batch, débit seul)\n"
+           "  --write-trace FICHIER  Enregistrer la trace produite pour la rejouer\n"
+           "  --flash IMAGE          Image flash persistante (journal entre exécutions)\n"
+           "  --perf                 Afficher les latences perf_trace\n"
+           "  --check                Code retour non nul si le pipeline est incohérent\n"
+           "  --quiet / --verbose    Niveau de log des composants\n", prog);
+}
+
+static int sim_parse_options(int argc, char **argv, sim_options_t *opts) {
+    static const struct option long_options[] = {
+        { "trace", required_argument, NULL, 't' },
+        { "synthetic", required_argument, NULL, 'n' },
+        { "seed", required_argument, NULL, 's' },
+        { "interval-ms", required_argument, NULL, 'i' },
+        { "anomaly-rate", required_argument, NULL, 'r' },
+        { "mode", required_argument, NULL, 'm' },
+        { "batch", no_argument, NULL, 'b' },
+        { "write-trace", required_argument, NULL, 'w' },
+        { "flash", required_argument, NULL, 'f' },
+        { "perf", no_argument, NULL, 'p' },
+        { "check", no_argument, NULL, 'c' },
+        { "quiet", no_argument, NULL, 'q' },
+        { "verbose", no_argument, NULL, 'v' },
+        { "help", no_argument, NULL, 'h' },
+        { NULL, 0, NULL, 0 }
+    };
+
+    memset(opts, 0, sizeof(sim_options_t));
+    opts->synth.samples = 100000;
+    opts->synth.seed = 1;
+    opts->synth.interval_ms = SENSOR_READ_INTERVAL_MS;
+    opts->synth.anomaly_rate = 0.001f;
+    opts->mode = ANOMALY_MODE_THRESHOLD;
+    opts->log_level = ESP_LOG_WARN;
+
+    int c;
+    while ((c = getopt_long(argc, argv, "", long_options, NULL)) != -1) {
+        switch (c) {
+            case 't': opts->trace_path = optarg; break;
+            case 'n': opts->synth.samples = strtoull(optarg, NULL, 0); break;
+            case 's': opts->synth.seed = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'i': opts->synth.interval_ms = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'r': opts->synth.anomaly_rate = strtof(optarg, NULL); break;
+            case 'm':
+                if (strcmp(optarg, "statistical") == 0) {
+                    opts->mode = ANOMALY_MODE_STATISTICAL;
+                } else if (strcmp(optarg, "threshold") != 0) {
+                    fprintf(stderr, "Mode inconnu: %s\n", optarg);
+                    return -1;
+                }
+                break;
+            case 'b': opts->batch = true; break;
+            case 'w': opts->write_trace_path = optarg; break;
+            case 'f': opts->flash_path = optarg; break;
+            case 'p': opts->perf = true; break;
+            case 'c': opts->check = true; break;
+            case 'q': opts->log_level = ESP_LOG_ERROR; break;
+            case 'v': opts->log_level = ESP_LOG_INFO; break;
+            case 'h': sim_usage(argv[0]); exit(EXIT_SUCCESS);
+            default: sim_usage(argv[0]); return -1;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Chemin de sensor_task + dispatch_security_event pour un échantillon
+ */
+static void sim_process_sample(const sensor_data_t *sample, sim_counters_t *counters) {
+    anomaly_result_t result = anomaly_detect(sample);
+    if (!result.is_anomaly) {
+        return;
+    }
+    counters->anomalies++;
+
+    security_event_t event;
+    security_event_from_anomaly(&event, &result, sample->sensor_id, SECURITY_SEVERITY_MEDIUM);
+
+    switch (incident_admit(&event)) {
+        case INCIDENT_DECISION_NEW:
+            counters->events_new++;
+            incident_handle_anomaly(&event);
+            break;
+        case INCIDENT_DECISION_COALESCED:
+            counters->events_coalesced++;
+            break;
+        case INCIDENT_DECISION_RATE_LIMITED:
+            counters->events_rate_limited++;
+            break;
+    }
+}
+
+static void sim_process_batch(const float *temps, const float *hums, size_t n,
+                              uint8_t *flags, float *scores, sim_counters_t *counters) {
+    if (anomaly_detect_batch(temps, hums, n, flags, scores) != ESP_OK) {
+        return;
+    }
+    for (size_t i = 0; i < n; i++) {
+        counters->anomalies += (flags[i] != 0);
+    }
+}
+
+static void sim_print_report(const sim_options_t *opts, const sensor_trace_t *trace,
+                             const sim_counters_t *counters, double wall_s) {
+    incident_stats_t incidents;
+    incident_journal_stats_t journal;
+    host_flash_stats_t flash;
+
+    incident_get_stats(&incidents);
+    incident_journal_get_stats(&journal);
+    host_flash_get_stats(&flash);
+
+    double simulated_h = (double)esp_timer_get_time() / 3600e6;
+
+    printf("=== Simulation hôte SecureIoT-VIF ===\n");
+    printf("source            : %s\n", opts->trace_path ? opts->trace_path : "synthétique");
+    printf("mode              : %s%s\n", anomaly_mode_to_string(opts->mode), opts->batch ? " (lots)" : "");
+    printf("échantillons      : %llu (%.1f h simulées, %llu injectés)\n",
+           (unsigned long long)counters->samples, simulated_h, (unsigned long long)trace->injected);
+    printf("débit             : %.0f échantillons/s (%.3f s)\n",
+           wall_s > 0 ? counters->samples / wall_s : 0.0, wall_s);
+    printf("anomalies         : %llu\n", (unsigned long long)counters->anomalies);
+    printf("événements        : %llu nouveaux, %llu fusionnés, %llu limités\n",
+           (unsigned long long)counters->events_new, (unsigned long long)counters->events_coalesced,
+           (unsigned long long)counters->events_rate_limited);
+    printf("incidents         : %u clôturés, %u escalades\n",
+           incidents.incidents_closed, incidents.escalations);
+    printf("journal           : %u ajoutés, %u perdus, %u écritures, %u rotations (%u effacements à l'ajout)\n",
+           journal.records_appended, journal.records_dropped, journal.flushes, journal.sector_rotations,
+           journal.inline_erases);
+    printf("flash             : %u écritures, %u effacements, %u violations NOR\n",
+           flash.writes, flash.erases, flash.nor_violations);
+}
+
+/**
+ * @brief Invariants du pipeline pour --check
+ */
+static int sim_check(const sim_options_t *opts, const sensor_trace_t *trace, const sim_counters_t *counters) {
+    incident_stats_t incidents;
+    incident_journal_stats_t journal;
+    host_flash_stats_t flash;
+    int failures = 0;
+
+    incident_get_stats(&incidents);
+    incident_journal_get_stats(&journal);
+    host_flash_get_stats(&flash);
+
+    if (trace->injected > 0 && counters->anomalies == 0) {
+        fprintf(stderr, "CHECK: anomalies injectées mais aucune détectée\n");
+        failures++;
+    }
+    if (opts->trace_path == NULL && trace->injected == 0 && counters->anomalies != 0) {
+        fprintf(stderr, "CHECK: %llu faux positif(s) sur une trace synthétique saine\n",
+                (unsigned long long)counters->anomalies);
+        failures++;
+    }
+    if (flash.nor_violations != 0) {
+        fprintf(stderr, "CHECK: %u écriture(s) flash sans effacement préalable\n", flash.nor_violations);
+        failures++;
+    }
+    if (journal.records_dropped != 0 || journal.write_errors != 0) {
+        fprintf(stderr, "CHECK: journal en erreur (%u perdus, %u erreurs)\n",
+                journal.records_dropped, journal.write_errors);
+        failures++;
+    }
+    if (!opts->batch && counters->events_new + counters->events_coalesced + counters->events_rate_limited
+                  != counters->anomalies) {
+        fprintf(stderr, "CHECK: décisions du pipeline incomplètes\n");
+        failures++;
+    }
+    if (!opts->batch && incidents.events_submitted != counters->anomalies) {
+        fprintf(stderr, "CHECK: %u événements soumis pour %llu anomalies\n",
+                incidents.events_submitted, (unsigned long long)counters->anomalies);
+        failures++;
+    }
+
+    return failures;
+}
+
+int main(int argc, char **argv) {
+    sim_options_t opts;
+    if (sim_parse_options(argc, argv, &opts) != 0) {
+        return 2;
+    }
+
+    host_log_set_level(opts.log_level);
+    host_clock_set_virtual(true);
+    host_clock_set_us(0);
+
+    if (host_flash_init(NULL, opts.flash_path) != ESP_OK ||
+        anomaly_detector_basic_init() != ESP_OK ||
+        anomaly_set_detection_mode(opts.mode) != ESP_OK ||
+        incident_manager_init() != ESP_OK) {
+        ESP_LOGE(TAG, "Initialisation de la simulation échouée");
+        return 1;
+    }
+
+    sensor_trace_t trace;
+    esp_err_t ret = opts.trace_path ? sensor_trace_open_file(&trace, opts.trace_path)
+                                    : sensor_trace_open_synthetic(&trace, &opts.synth);
+    if (ret != ESP_OK) {
+        return 1;
+    }
+
+    FILE *trace_out = NULL;
+    if (opts.write_trace_path != NULL) {
+        trace_out = fopen(opts.write_trace_path, "w");
+        if (trace_out == NULL) {
+            ESP_LOGE(TAG, "Impossible d'écrire %s", opts.write_trace_path);
+            return 1;
+        }
+        fprintf(trace_out, SENSOR_TRACE_CSV_HEADER "\n");
+    }
+
+    static float temps[SIM_BATCH_SIZE], hums[SIM_BATCH_SIZE], scores[SIM_BATCH_SIZE];
+    static uint8_t flags[SIM_BATCH_SIZE];
+    size_t pending = 0;
+
+    sim_counters_t counters = {0};
+    int64_t next_tick_us = (int64_t)SECURITY_MONITOR_INTERVAL_MS * 1000;
+    sensor_data_t sample;
+    double start = sim_wall_seconds();
+
+    while (sensor_trace_next(&trace, &sample)) {
+        int64_t now_us = (int64_t)sample.timestamp * 1000;
+        host_clock_set_us(now_us);
+        counters.samples++;
+
+        if (trace_out != NULL) {
+            sensor_trace_write(trace_out, &sample);
+        }
+
+        if (opts.batch) {
+            temps[pending] = sample.temperature;
+            hums[pending] = sample.humidity;
+            if (++pending == SIM_BATCH_SIZE) {
+                sim_process_batch(temps, hums, pending, flags, scores, &counters);
+                pending = 0;
+            }
+        } else {
+            sim_process_sample(&sample, &counters);
+        }
+
+        // Maintenance périodique du monitoring
+        while (now_us >= next_tick_us) {
+            incident_manager_tick();
+            counters.ticks++;
+            next_tick_us += (int64_t)SECURITY_MONITOR_INTERVAL_MS * 1000;
+        }
+    }
+
+    if (pending > 0) {
+        sim_process_batch(temps, hums, pending, flags, scores, &counters);
+    }
+
+    // Clôture des incidents encore ouverts, puis écriture du journal
+    host_clock_advance_us((int64_t)INCIDENT_DEDUP_WINDOW_MS * 1000 + 1);
+    incident_manager_tick();
+
+    double wall_s = sim_wall_seconds() - start;
+
+    sensor_trace_close(&trace);
+    if (trace_out != NULL) {
+        fclose(trace_out);
+    }
+
+    sim_print_report(&opts, &trace, &counters, wall_s);
+    if (opts.perf) {
+        host_log_set_level(ESP_LOG_INFO);
+        perf_trace_dump();
+    }
+
+    int failures = opts.check ? sim_check(&opts, &trace, &counters) : 0;
+
+    incident_manager_deinit();
+    anomaly_detector_basic_deinit();
+
+    if (opts.flash_path != NULL && host_flash_save(opts.flash_path) != ESP_OK) {
+        ESP_LOGE(TAG, "Sauvegarde de l'image flash échouée: %s", opts.flash_path);
+        failures++;
+    }
+    host_flash_deinit();
+
+    return failures == 0 ? 0 : 1;
+}
\ No newline at end of file
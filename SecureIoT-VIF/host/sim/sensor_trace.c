@@ -0,0 +1,177 @@
+/**
+ * @file sensor_trace.c
+ * @brief Source d'échantillons rejouable pour la build hôte
+ *
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "esp_log.h"
+#include "sensor_trace.h"
+
+static const char *TAG = "SENSOR_TRACE";
+
+#define TRACE_DAY_MS                    (24.0f * 3600.0f * 1000.0f)
+#define TRACE_TWO_PI                    (6.28318530718f)
+
+// ================================
+// Générateur
+// ================================
+
+static inline uint32_t trace_rand(sensor_trace_t *trace) {
+    uint32_t x = trace->rng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    trace->rng = x;
+    return x;
+}
+
+static inline float trace_uniform(sensor_trace_t *trace) {
+    return (trace_rand(trace) >> 8) * (1.0f / 16777216.0f);
+}
+
+/**
+ * @brief Bruit approximativement normal (somme de 4 uniformes), écart-type ~1
+ */
+static inline float trace_noise(sensor_trace_t *trace) {
+    float sum = trace_uniform(trace) + trace_uniform(trace) + trace_uniform(trace) + trace_uniform(trace);
+    return (sum - 2.0f) * 1.7320508f;
+}
+
+static void trace_synthesize(sensor_trace_t *trace, sensor_data_t *sample) {
+    uint64_t t_ms = trace->produced * trace->synth.interval_ms;
+    float phase = TRACE_TWO_PI * (float)fmod((double)t_ms, (double)TRACE_DAY_MS) / TRACE_DAY_MS;
+
+    // Cycle journalier intérieur: 21-25°C, humidité en opposition de phase
+    float temperature = 23.0f + 2.0f * sinf(phase) + 0.15f * trace_noise(trace);
+    float humidity = 50.0f - 6.0f * sinf(phase) + 0.5f * trace_noise(trace);
+
+    if (trace->inject == SENSOR_TRACE_INJECT_NONE && trace_uniform(trace) < trace->synth.anomaly_rate) {
+        trace->inject = (sensor_trace_inject_t)(1 + trace_rand(trace) % (SENSOR_TRACE_INJECT_MAX - 1));
+        switch (trace->inject) {
+            case SENSOR_TRACE_INJECT_SPIKE:
+                trace->inject_left = 1;
+                trace->inject_value = 15.0f + 10.0f * trace_uniform(trace);
+                break;
+            case SENSOR_TRACE_INJECT_DRIFT:
+                trace->inject_left = 60 + trace_rand(trace) % 120;
+                trace->inject_value = 0.0f;
+                break;
+            case SENSOR_TRACE_INJECT_STUCK:
+                trace->inject_left = 30 + trace_rand(trace) % 60;
+                trace->inject_value = temperature;
+                break;
+            default:
+                break;
+        }
+    }
+
+    if (trace->inject != SENSOR_TRACE_INJECT_NONE) {
+        switch (trace->inject) {
+            case SENSOR_TRACE_INJECT_SPIKE:
+                temperature += trace->inject_value;
+                break;
+            case SENSOR_TRACE_INJECT_DRIFT:
+                trace->inject_value += 0.6f;
+                humidity += trace->inject_value;
+                break;
+            case SENSOR_TRACE_INJECT_STUCK:
+                temperature = trace->inject_value;
+                break;
+            default:
+                break;
+        }
+        trace->injected++;
+        if (--trace->inject_left == 0) {
+            trace->inject = SENSOR_TRACE_INJECT_NONE;
+        }
+    }
+
+    sample->temperature = temperature;
+    sample->humidity = fminf(fmaxf(humidity, 0.0f), 100.0f);
+    sample->timestamp = t_ms;
+}
+
+// ================================
+// Fonctions publiques
+// ================================
+
+esp_err_t sensor_trace_open_file(sensor_trace_t *trace, const char *path) {
+    if (trace == NULL || path == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    memset(trace, 0, sizeof(sensor_trace_t));
+    trace->file = fopen(path, "r");
+    if (trace->file == NULL) {
+        ESP_LOGE(TAG, "Trace introuvable: %s", path);
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    return ESP_OK;
+}
+
+esp_err_t sensor_trace_open_synthetic(sensor_trace_t *trace, const sensor_trace_synth_config_t *config) {
+    if (trace == NULL || config == NULL || config->interval_ms == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    memset(trace, 0, sizeof(sensor_trace_t));
+    trace->synth = *config;
+    trace->rng = config->seed ? config->seed : 0x9E3779B9;
+
+    return ESP_OK;
+}
+
+bool sensor_trace_next(sensor_trace_t *trace, sensor_data_t *sample) {
+    if (trace == NULL || sample == NULL) {
+        return false;
+    }
+
+    memset(sample, 0, sizeof(sensor_data_t));
+    sample->quality_score = 100;
+    sample->sensor_id = 0;
+
+    if (trace->file == NULL) {
+        if (trace->produced >= trace->synth.samples) {
+            return false;
+        }
+        trace_synthesize(trace, sample);
+        trace->produced++;
+        return true;
+    }
+
+    char line[128];
+    while (fgets(line, sizeof(line), trace->file) != NULL) {
+        unsigned long long t_ms;
+        float temperature, humidity;
+        if (sscanf(line, "%llu,%f,%f", &t_ms, &temperature, &humidity) != 3) {
+            continue;   // En-tête ou ligne vide
+        }
+        sample->timestamp = t_ms;
+        sample->temperature = temperature;
+        sample->humidity = humidity;
+        trace->produced++;
+        return true;
+    }
+
+    return false;
+}
+
+void sensor_trace_write(FILE *out, const sensor_data_t *sample) {
+    fprintf(out, "%llu,%.2f,%.2f\n", (unsigned long long)sample->timestamp,
+            sample->temperature, sample->humidity);
+}
+
+void sensor_trace_close(sensor_trace_t *trace) {
+    if (trace != NULL && trace->file != NULL) {
+        fclose(trace->file);
+        trace->file = NULL;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,111 @@
+/**
+ * @file sensor_trace.h
+ * @brief Source d'échantillons rejouable pour la build hôte
+ *
+ * Remplace le pilote DHT22: rejoue une trace CSV enregistrée
+ * (timestamp_ms,temperature,humidity) ou génère une trace synthétique
+ * déterministe avec anomalies injectées.
+ *
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#ifndef SENSOR_TRACE_H
+#define SENSOR_TRACE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "sensor_manager.h"
+
+// ================================
+// Constantes
+// ================================
+
+#define SENSOR_TRACE_CSV_HEADER         "timestamp_ms,temperature,humidity"
+
+// ================================
+// Types
+// ================================
+
+/**
+ * @brief Paramètres de la trace synthétique
+ */
+typedef struct {
+    uint64_t samples;               // Nombre d'échantillons à produire
+    uint32_t seed;                  // Graine (même graine = même trace)
+    uint32_t interval_ms;           // Période d'échantillonnage simulée
+    float anomaly_rate;             // Probabilité de début d'anomalie par échantillon
+} sensor_trace_synth_config_t;
+
+/**
+ * @brief Type d'anomalie injectée
+ */
+typedef enum {
+    SENSOR_TRACE_INJECT_NONE = 0,
+    SENSOR_TRACE_INJECT_SPIKE,      // Saut de température isolé
+    SENSOR_TRACE_INJECT_DRIFT,      // Dérive lente de l'humidité
+    SENSOR_TRACE_INJECT_STUCK,      // Capteur figé sur une valeur
+    SENSOR_TRACE_INJECT_MAX
+} sensor_trace_inject_t;
+
+/**
+ * @brief Source de trace ouverte
+ */
+typedef struct {
+    FILE *file;                     // Trace CSV (NULL = synthétique)
+    uint64_t produced;              // Échantillons déjà produits
+    uint64_t injected;              // Échantillons portant une anomalie injectée
+    sensor_trace_synth_config_t synth;
+
+    // État du générateur synthétique
+    uint32_t rng;
+    sensor_trace_inject_t inject;
+    uint32_t inject_left;
+    float inject_value;
+} sensor_trace_t;
+
+// ================================
+// Fonctions
+// ================================
+
+/**
+ * @brief Ouvre une trace CSV enregistrée
+ */
+esp_err_t sensor_trace_open_file(sensor_trace_t *trace, const char *path);
+
+/**
+ * @brief Ouvre une trace synthétique
+ */
+esp_err_t sensor_trace_open_synthetic(sensor_trace_t *trace, const sensor_trace_synth_config_t *config);
+
+/**
+ * @brief Produit l'échantillon suivant
+ *
+ * @param trace Source ouverte
+ * @param sample Échantillon au format sensor_manager (sortie)
+ * @return true si un échantillon a été produit, false en fin de trace
+ */
+bool sensor_trace_next(sensor_trace_t *trace, sensor_data_t *sample);
+
+/**
+ * @brief Écrit un échantillon au format CSV de la trace
+ */
+void sensor_trace_write(FILE *out, const sensor_data_t *sample);
+
+/**
+ * @brief Ferme la source
+ */
+void sensor_trace_close(sensor_trace_t *trace);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SENSOR_TRACE_H */
\ No newline at end of file
@@ -0,0 +1,80 @@
+/**
+ * @file fuzz_anomaly_detector.c
+ * @brief Cible libFuzzer: détecteur, pipeline d'incidents et formatage
+ *
+ * Chaque entrée est une suite d'échantillons (température, humidité,
+ * delta de temps) passée aux deux modes de détection, au scoring par
+ * lots et au pipeline d'incidents.
+ *
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "anomaly_detector.h"
+#include "incident_manager.h"
+#include "security_event.h"
+#include "host_hal.h"
+
+#define FUZZ_MAX_SAMPLES                (256)
+
+typedef struct {
+    float temperature;
+    float humidity;
+    uint16_t delta_ms;
+} __attribute__((packed)) fuzz_sample_t;
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+    static bool initialized = false;
+    static float temps[FUZZ_MAX_SAMPLES], hums[FUZZ_MAX_SAMPLES], scores[FUZZ_MAX_SAMPLES];
+    static uint8_t flags[FUZZ_MAX_SAMPLES];
+
+    if (!initialized) {
+        host_log_set_level(ESP_LOG_NONE);
+        host_clock_set_virtual(true);
+        host_flash_init(NULL, NULL);
+        anomaly_detector_basic_init();
+        incident_manager_init();
+        initialized = true;
+    }
+
+    size_t n = size / sizeof(fuzz_sample_t);
+    if (n > FUZZ_MAX_SAMPLES) {
+        n = FUZZ_MAX_SAMPLES;
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        fuzz_sample_t in;
+        memcpy(&in, data + i * sizeof(fuzz_sample_t), sizeof(in));
+        host_clock_advance_us((int64_t)in.delta_ms * 1000);
+
+        sensor_data_t sample = {
+            .temperature = in.temperature,
+            .humidity = in.humidity,
+            .timestamp = (uint64_t)(esp_timer_get_time() / 1000),
+            .quality_score = 100,
+        };
+        temps[i] = in.temperature;
+        hums[i] = in.humidity;
+
+        anomaly_set_detection_mode((i & 1) ? ANOMALY_MODE_STATISTICAL : ANOMALY_MODE_THRESHOLD);
+        anomaly_result_t result = anomaly_detect(&sample);
+
+        security_event_t event;
+        char description[SECURITY_EVENT_DESC_MAX_LEN];
+        security_event_from_anomaly(&event, &result, 0, SECURITY_SEVERITY_MEDIUM);
+        security_event_format(&event, description, sizeof(description));
+        if (result.is_anomaly) {
+            incident_admit(&event);
+        }
+    }
+
+    anomaly_detect_batch(temps, hums, n, flags, scores);
+    incident_manager_tick();
+    return 0;
+}
\ No newline at end of file
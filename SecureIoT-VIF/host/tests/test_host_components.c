@@ -0,0 +1,658 @@
+/**
+ * @file test_host_components.c
+ * @brief Auto-tests des composants exécutés sur l'hôte
+ *
+ * Rejoue les auto-tests intégrés des composants contre les shims HAL,
+ * plus une vérification de persistance du journal d'incidents à travers
+ * un redémarrage simulé. Avec mbedTLS disponible (HOST_WITH_CRYPTO),
+ * couvre aussi la crypto et le vérificateur d'intégrité sur une image
+ * applicative synthétique.
+ *
+ * @author Framework SecureIoT-VIF Community
+ * @version 1.0.0 - Community Edition
+ * @date 2025
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "esp_log.h"
+#include "esp_err.h"
+#include "anomaly_detector.h"
+#include "incident_manager.h"
+#include "incident_journal.h"
+#include "security_event.h"
+#include "crypto_arena.h"
+#include "telemetry_frame.h"
+#include "host_hal.h"
+
+#if HOST_WITH_CRYPTO
+#include "esp_ota_ops.h"
+#include "esp_image_format.h"
+#include "crypto_operations_basic.h"
+#include "integrity_checker.h"
+#include "integrity_manifest.h"
+#include "integrity_ota.h"
+#endif
+
+#define TEST_JOURNAL_RECORDS            (40)
+#define TEST_JOURNAL_MAINTAIN_EVERY     (16)
+#define TEST_ARENA_SIZE                 (4096)
+#define TEST_ARENA_BLOCKS               (48)
+#define TEST_TELEMETRY_SENSORS          (2)
+#define TEST_SNAPSHOT_SAMPLES           (70)
+#define TEST_STORM_DURATION_MS          (60000)
+#define TEST_OTA_IMAGE_SIZE             (96 * 1024)
+#define TEST_OTA_CHANGED_CHUNK          (3)
+#define TEST_OTA_UNCHANGED_CHUNK        (5)
+
+typedef esp_err_t (*host_test_fn_t)(void);
+
+/**
+ * @brief Journal: les incidents survivent à un démontage/remontage
+ */
+static esp_err_t test_journal_persistence(void) {
+    incident_journal_record_t records[TEST_JOURNAL_RECORDS];
+    incident_journal_stats_t stats;
+    size_t count = 0;
+
+    // Le gestionnaire d'incidents a monté le journal pendant son auto-test
+    incident_manager_deinit();
+
+    if (incident_journal_init() != ESP_OK || incident_journal_erase() != ESP_OK) {
+        return ESP_FAIL;
+    }
+    incident_journal_get_stats(&stats);
+    uint16_t first_boot = stats.boot_id;
+    uint32_t first_seq = stats.next_seq;
+
+    for (int i = 0; i < TEST_JOURNAL_RECORDS; i++) {
+        security_event_t event;
+        security_event_from_integrity(&event, i, (uint32_t)i, SECURITY_SEVERITY_HIGH);
+        if (incident_journal_append(&event, (uint16_t)(i + 1)) != ESP_OK) {
+            return ESP_FAIL;
+        }
+    }
+    incident_journal_deinit();
+
+    // Redémarrage simulé: même image flash, nouvel identifiant de boot
+    if (incident_journal_init() != ESP_OK ||
+        incident_journal_get_last(records, TEST_JOURNAL_RECORDS, &count) != ESP_OK) {
+        return ESP_FAIL;
+    }
+    incident_journal_get_stats(&stats);
+    incident_journal_deinit();
+
+    if (count != TEST_JOURNAL_RECORDS || stats.boot_id != first_boot + 1) {
+        printf("  %zu enregistrement(s) relus, boot %u -> %u\n", count, first_boot, stats.boot_id);
+        return ESP_FAIL;
+    }
+    for (size_t i = 0; i < count; i++) {
+        // Du plus récent au plus ancien
+        uint32_t expected = TEST_JOURNAL_RECORDS - 1 - (uint32_t)i;
+        if (records[i].seq != first_seq + expected ||
+            records[i].event.payload.integrity.chunk_id != expected ||
+            records[i].repeat_count != expected + 1) {
+            printf("  enregistrement %zu incohérent (seq %u)\n", i, records[i].seq);
+            return ESP_FAIL;
+        }
+    }
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Journal: rotations sans effacement à l'ajout, démarrage distinct sur journal vide
+ *
+ * La maintenance passe toutes les TEST_JOURNAL_MAINTAIN_EVERY ajouts, comme
+ * incident_manager_tick() pendant une rafale.
+ */
+static esp_err_t test_journal_rotation(void) {
+    incident_journal_record_t records[TEST_JOURNAL_RECORDS];
+    incident_journal_stats_t stats;
+    size_t count = 0;
+
+    if (incident_journal_init() != ESP_OK || incident_journal_erase() != ESP_OK) {
+        return ESP_FAIL;
+    }
+    incident_journal_get_stats(&stats);
+    uint32_t total = stats.records_per_sector * (stats.sector_count + 1);
+    uint32_t first_seq = stats.next_seq;
+
+    for (uint32_t i = 0; i < total; i++) {
+        security_event_t event;
+        security_event_from_integrity(&event, 0, i, SECURITY_SEVERITY_HIGH);
+        if (incident_journal_append(&event, 1) != ESP_OK) {
+            return ESP_FAIL;
+        }
+        if (i % TEST_JOURNAL_MAINTAIN_EVERY == 0 && incident_journal_maintain() != ESP_OK) {
+            return ESP_FAIL;
+        }
+    }
+    incident_journal_get_stats(&stats);
+    esp_err_t ret = incident_journal_get_last(records, TEST_JOURNAL_RECORDS, &count);
+    if (ret != ESP_OK || stats.inline_erases != 0 || stats.records_dropped != 0 ||
+        stats.sector_rotations < stats.sector_count || count != TEST_JOURNAL_RECORDS ||
+        records[0].seq != first_seq + total - 1 || records[0].event.payload.integrity.chunk_id != total - 1) {
+        printf("  %u rotation(s), %u effacement(s) à l'ajout, %u perdu(s), %zu relu(s)\n",
+               stats.sector_rotations, stats.inline_erases, stats.records_dropped, count);
+        return ESP_FAIL;
+    }
+
+    // Journal vidé: les démarrages suivants restent distincts (en-tête de secteur)
+    uint16_t boot_id = stats.boot_id;
+    if (incident_journal_erase() != ESP_OK) {
+        return ESP_FAIL;
+    }
+    for (int reboot = 1; reboot <= 2; reboot++) {
+        incident_journal_deinit();
+        if (incident_journal_init() != ESP_OK) {
+            return ESP_FAIL;
+        }
+        incident_journal_get_stats(&stats);
+        if (stats.boot_id != (uint16_t)(boot_id + reboot)) {
+            printf("  journal vide: démarrage %u après %u\n", stats.boot_id, boot_id);
+            incident_journal_deinit();
+            return ESP_FAIL;
+        }
+
+        security_event_t event;
+        security_event_from_integrity(&event, 0, 0, SECURITY_SEVERITY_HIGH);
+        incident_journal_append(&event, 1);
+    }
+    ret = incident_journal_get_last(records, 2, &count);
+    incident_journal_deinit();
+    if (ret != ESP_OK || count != 2 || records[0].boot_id != records[1].boot_id + 1) {
+        printf("  %zu enregistrement(s) après effacement\n", count);
+        return ESP_FAIL;
+    }
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Arène crypto: blocs nuls, réutilisation après fragmentation, refus propre, repli tas
+ */
+static esp_err_t test_crypto_arena(void) {
+    static uint64_t arena[TEST_ARENA_SIZE / sizeof(uint64_t)];
+    uint8_t *blocks[TEST_ARENA_BLOCKS];
+    crypto_arena_stats_t stats;
+
+    memset(arena, 0xA5, sizeof(arena));
+    if (crypto_arena_init(arena, sizeof(arena)) != ESP_OK) {
+        return ESP_FAIL;
+    }
+
+    // Tailles variées, comme les limbs de bignums mbedTLS
+    for (int i = 0; i < TEST_ARENA_BLOCKS; i++) {
+        size_t size = 8 + (size_t)(i * 13) % 56;
+        blocks[i] = crypto_arena_calloc(1, size);
+        if (blocks[i] == NULL || ((uintptr_t)blocks[i] % CRYPTO_ARENA_ALIGNMENT) != 0) {
+            return ESP_FAIL;
+        }
+        for (size_t b = 0; b < size; b++) {
+            if (blocks[i][b] != 0) {
+                return ESP_FAIL;
+            }
+        }
+        memset(blocks[i], 0xFF, size);
+    }
+
+    // Libérer un bloc sur deux, puis le reste: fusion des voisins libres
+    for (int i = 0; i < TEST_ARENA_BLOCKS; i += 2) {
+        crypto_arena_free(blocks[i]);
+    }
+    for (int i = 1; i < TEST_ARENA_BLOCKS; i += 2) {
+        crypto_arena_free(blocks[i]);
+    }
+
+    crypto_arena_get_stats(&stats);
+    if (stats.used != 0 || stats.live_blocks != 0 || stats.peak == 0) {
+        printf("  arène non vide après libération: %zu octets, %u blocs\n", stats.used, stats.live_blocks);
+        return ESP_FAIL;
+    }
+
+    // Toute l'arène à nouveau disponible d'un seul tenant
+    void *large = crypto_arena_calloc(1, TEST_ARENA_SIZE - 64);
+    void *refused = crypto_arena_calloc(1, 128);
+
+    // Allocateur mbedTLS: le refus est servi par le tas et lui est rendu
+    uint8_t *fallback = crypto_arena_calloc_or_heap(1, 128);
+    bool fallback_ok = (fallback != NULL && (fallback < (uint8_t *)arena ||
+                                             fallback >= (uint8_t *)arena + sizeof(arena)) &&
+                        fallback[0] == 0 && fallback[127] == 0);
+    crypto_arena_free(fallback);
+    crypto_arena_free(large);
+    crypto_arena_get_stats(&stats);
+    crypto_arena_deinit();
+
+    return (large != NULL && refused == NULL && fallback_ok && stats.failures == 2 &&
+            stats.heap_fallbacks == 1 && stats.foreign_frees == 1) ? ESP_OK : ESP_FAIL;
+}
+
+/**
+ * @brief Détecteur: une sauvegarde restaurée score comme l'historique d'origine
+ */
+static esp_err_t test_anomaly_snapshot(void) {
+    static anomaly_snapshot_t snapshot;
+    sensor_data_t sample = {0};
+
+    if (anomaly_detector_basic_init() != ESP_OK || anomaly_reset_stats_community() != ESP_OK ||
+        anomaly_set_detection_mode(ANOMALY_MODE_STATISTICAL) != ESP_OK) {
+        return ESP_FAIL;
+    }
+
+    // Deux capteurs, fenêtre pleine et CUSUM non nuls
+    for (int i = 0; i < TEST_SNAPSHOT_SAMPLES; i++) {
+        sample.sensor_id = (uint8_t)(i % 2);
+        sample.temperature = 22.0f + 0.2f * (float)((i * 7) % 5) + 0.01f * (float)i;
+        sample.humidity = 50.0f + 0.5f * (float)((i * 3) % 4);
+        sample.timestamp = (uint64_t)i * 5000;
+        anomaly_detect(&sample);
+    }
+
+    if (anomaly_detector_save_state(&snapshot) != ESP_OK || snapshot.sensor_count != 2) {
+        return ESP_FAIL;
+    }
+
+    sample.sensor_id = 1;
+    sample.temperature = 23.4f;
+    sample.humidity = 51.0f;
+    anomaly_result_t expected = anomaly_detect(&sample);
+
+    // Sommeil profond simulé: historique perdu, puis restauré
+    anomaly_reset_stats_community();
+    anomaly_set_detection_mode(ANOMALY_MODE_THRESHOLD);
+    if (anomaly_detector_restore_state(&snapshot) != ESP_OK ||
+        anomaly_get_detection_mode() != ANOMALY_MODE_STATISTICAL) {
+        return ESP_FAIL;
+    }
+    anomaly_result_t restored = anomaly_detect(&sample);
+
+    snapshot.magic = 0;
+    esp_err_t invalid = anomaly_detector_restore_state(&snapshot);
+    anomaly_set_detection_mode(ANOMALY_DETECTION_MODE_DEFAULT);
+
+    if (restored.is_anomaly != expected.is_anomaly ||
+        fabsf(restored.anomaly_score - expected.anomaly_score) > 1e-4f ||
+        fabsf(restored.z_score - expected.z_score) > 1e-3f ||
+        fabsf(restored.cusum_score - expected.cusum_score) > 1e-3f) {
+        printf("  score %.4f/%.4f, z %.3f/%.3f, cusum %.3f/%.3f\n",
+               restored.anomaly_score, expected.anomaly_score, restored.z_score, expected.z_score,
+               restored.cusum_score, expected.cusum_score);
+        return ESP_FAIL;
+    }
+
+    return (invalid == ESP_ERR_INVALID_CRC) ? ESP_OK : ESP_FAIL;
+}
+
+/**
+ * @brief Événements d'anomalie: le drapeau de saut désigne la grandeur en cause
+ */
+static esp_err_t test_anomaly_change_flags(void) {
+    const sensor_data_t samples[] = {
+        { .temperature = 22.0f, .humidity = 40.0f },
+        { .temperature = 22.5f, .humidity = 70.0f },    // Saut d'humidité seul
+        { .temperature = 33.0f, .humidity = 70.5f },    // Saut de température seul
+    };
+    const uint8_t expected[] = { 0, ANOMALY_FLAG_HUMIDITY_CHANGE, ANOMALY_FLAG_TEMP_CHANGE };
+    esp_err_t ret = ESP_OK;
+
+    if (anomaly_reset_stats_community() != ESP_OK ||
+        anomaly_set_detection_mode(ANOMALY_MODE_THRESHOLD) != ESP_OK) {
+        return ESP_FAIL;
+    }
+
+    for (size_t i = 0; i < ARRAY_SIZE(samples); i++) {
+        anomaly_result_t result = anomaly_detect(&samples[i]);
+        security_event_t event;
+        security_event_from_anomaly(&event, &result, 0, SECURITY_SEVERITY_MEDIUM);
+        uint8_t flags = SECURITY_EVENT_ANOMALY_FLAGS(&event);
+        if (flags != expected[i]) {
+            printf("  échantillon %zu: drapeaux 0x%x, attendu 0x%x\n", i, flags, expected[i]);
+            ret = ESP_FAIL;
+        }
+    }
+
+    anomaly_set_detection_mode(ANOMALY_DETECTION_MODE_DEFAULT);
+    return ret;
+}
+
+/**
+ * @brief Trames de télémétrie: aller-retour, compacité vs JSON, trames invalides
+ */
+static esp_err_t test_telemetry_frame(void) {
+    static telemetry_frame_t frame;
+    sensor_data_t samples[TELEMETRY_FRAME_MAX_SAMPLES];
+    sensor_data_t decoded[TELEMETRY_FRAME_MAX_SAMPLES];
+    const uint8_t iv_prefix[TELEMETRY_FRAME_IV_PREFIX_SIZE] = {1, 2, 3, 4, 5, 6, 7, 8};
+    telemetry_frame_header_t header;
+    size_t json_bytes = 0;
+    size_t count = 0;
+
+    // Deux capteurs entrelacés, dérive lente et quelques lectures négatives
+    telemetry_frame_begin(&frame, 0x01020304, iv_prefix);
+    for (int i = 0; i < TELEMETRY_FRAME_MAX_SAMPLES; i++) {
+        sensor_data_t *sample = &samples[i];
+        memset(sample, 0, sizeof(*sample));
+        sample->sensor_id = (uint8_t)(i % TEST_TELEMETRY_SENSORS);
+        sample->timestamp = 1700000000000ULL + (uint64_t)i * 2500 + (uint64_t)(i % 3);
+        sample->temperature = (sample->sensor_id == 0 ? 21.4f : -3.2f) + 0.1f * (float)(i % 7);
+        sample->humidity = 45.0f + 0.3f * (float)(i % 5);
+        sample->quality_score = (uint8_t)(90 + i % 10);
+        if (telemetry_frame_add(&frame, sample) != ESP_OK) {
+            return ESP_FAIL;
+        }
+        json_bytes += telemetry_frame_json_size(sample);
+    }
+    if (telemetry_frame_add(&frame, &samples[0]) != ESP_ERR_NO_MEM) {
+        return ESP_FAIL;
+    }
+
+    size_t clear_len = telemetry_frame_finish(&frame);
+    size_t frame_len = clear_len + TELEMETRY_FRAME_TAG_SIZE;
+    if (frame_len * 8 > json_bytes) {
+        printf("  trame de %zu octets pour %zu octets JSON\n", frame_len, json_bytes);
+        return ESP_FAIL;
+    }
+
+    if (telemetry_frame_parse_header(frame.header, TELEMETRY_FRAME_HEADER_SIZE, &header) != ESP_OK ||
+        header.sequence != 0x01020304 || header.sample_count != TELEMETRY_FRAME_MAX_SAMPLES ||
+        header.base_timestamp_ms != samples[0].timestamp ||
+        telemetry_frame_decode(&header, frame.payload, frame.payload_len, decoded,
+                               TELEMETRY_FRAME_MAX_SAMPLES, &count) != ESP_OK ||
+        count != TELEMETRY_FRAME_MAX_SAMPLES) {
+        return ESP_FAIL;
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (decoded[i].sensor_id != samples[i].sensor_id || decoded[i].timestamp != samples[i].timestamp ||
+            fabsf(decoded[i].temperature - samples[i].temperature) > 0.051f ||
+            fabsf(decoded[i].humidity - samples[i].humidity) > 0.051f ||
+            decoded[i].quality_score != samples[i].quality_score) {
+            printf("  échantillon %zu mal décodé\n", i);
+            return ESP_FAIL;
+        }
+    }
+
+    // IV: préfixe || numéro de trame big-endian
+    uint8_t iv[12];
+    telemetry_frame_build_iv(frame.header, iv);
+    if (memcmp(iv, iv_prefix, sizeof(iv_prefix)) != 0 || iv[8] != 0x01 || iv[11] != 0x04) {
+        return ESP_FAIL;
+    }
+
+    // Charge utile tronquée, version inconnue, capteur hors plage
+    frame.header[0] = TELEMETRY_FRAME_VERSION + 1;
+    if (telemetry_frame_decode(&header, frame.payload, frame.payload_len - 1, decoded,
+                               TELEMETRY_FRAME_MAX_SAMPLES, &count) != ESP_ERR_INVALID_SIZE ||
+        telemetry_frame_parse_header(frame.header, TELEMETRY_FRAME_HEADER_SIZE, &header) != ESP_ERR_INVALID_VERSION) {
+        return ESP_FAIL;
+    }
+
+    sensor_data_t invalid = samples[0];
+    invalid.sensor_id = SENSOR_MAX_INSTANCES;
+    telemetry_frame_begin(&frame, 0, iv_prefix);
+    if (telemetry_frame_add(&frame, &invalid) != ESP_ERR_INVALID_ARG || frame.sample_count != 0) {
+        return ESP_FAIL;
+    }
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Incidents: le seau se recharge pendant une tempête d'événements limités
+ *
+ * Un nouvel incident par milliseconde pendant une minute: après la rafale,
+ * INCIDENT_RATE_PER_MINUTE incidents (à un près) doivent encore passer.
+ */
+static esp_err_t test_incident_rate_refill(void) {
+    incident_manager_deinit();
+    host_clock_set_virtual(true);
+    host_clock_set_us(1000000);
+    esp_err_t ret = incident_manager_init();
+
+    uint32_t admitted = 0;
+    for (uint32_t i = 0; ret == ESP_OK && i < TEST_STORM_DURATION_MS; i++) {
+        security_event_t event;
+        security_event_init(&event, SECURITY_EVENT_SENSOR_MALFUNCTION, SECURITY_SEVERITY_LOW,
+                            (uint8_t)(i % 250));
+        if (incident_admit(&event) == INCIDENT_DECISION_NEW) {
+            admitted++;
+        }
+        host_clock_advance_us(1000);
+    }
+
+    incident_manager_deinit();
+    host_clock_set_virtual(false);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    uint32_t refilled = admitted - INCIDENT_RATE_BURST;
+    uint32_t expected = (uint32_t)((uint64_t)TEST_STORM_DURATION_MS * INCIDENT_RATE_PER_MINUTE / 60000);
+    return (admitted >= INCIDENT_RATE_BURST && refilled + 1 >= expected && refilled <= expected + 1) ?
+           ESP_OK : ESP_FAIL;
+}
+
+#if HOST_WITH_CRYPTO
+/**
+ * @brief Intégrité: image saine validée, chunk corrompu détecté
+ */
+static esp_err_t test_integrity_corruption(void) {
+    const esp_partition_t *app = esp_ota_get_running_partition();
+    if (app == NULL || host_flash_write_test_image(app, 96 * 1024, 42) != ESP_OK) {
+        return ESP_FAIL;
+    }
+
+    if (integrity_checker_init() != ESP_OK || integrity_check_firmware_basic() != INTEGRITY_OK) {
+        return ESP_FAIL;
+    }
+
+    // Inverser un octet au milieu du premier chunk couvert
+    size_t flash_size = 0;
+    uint8_t *flash = host_flash_data(&flash_size);
+    flash[app->address + 1024] ^= 0x5A;
+
+    integrity_status_t status = integrity_check_chunk_basic(0);
+    flash[app->address + 1024] ^= 0x5A;
+
+    return (status != INTEGRITY_OK) ? ESP_OK : ESP_FAIL;
+}
+
+/**
+ * @brief Manifeste OTA d'une image écrite dans une partition (comme tools/ota_manifest.py)
+ */
+static esp_err_t test_ota_build_manifest(const esp_partition_t *partition, uint32_t image_size,
+                                         integrity_manifest_blob_t *blob) {
+    size_t flash_size = 0;
+    const uint8_t *image = host_flash_data(&flash_size) + partition->address;
+
+    memset(blob, 0, sizeof(*blob));
+    blob->header.magic = INTEGRITY_MANIFEST_MAGIC;
+    blob->header.version = INTEGRITY_MANIFEST_VERSION;
+    blob->header.chunk_size = INTEGRITY_CHUNK_SIZE_COMMUNITY;
+    blob->header.image_size = image_size;
+    blob->header.chunk_count = (uint16_t)INTEGRITY_CALC_CHUNKS_COMMUNITY(image_size);
+
+    esp_app_desc_t desc;
+    esp_err_t ret = esp_ota_get_partition_description(partition, &desc);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    memcpy(blob->header.app_elf_sha256, desc.app_elf_sha256, sizeof(blob->header.app_elf_sha256));
+
+    for (size_t i = 0; i < blob->header.chunk_count && ret == ESP_OK; i++) {
+        size_t offset = INTEGRITY_CHUNK_OFFSET_COMMUNITY(i);
+        size_t len = (offset + INTEGRITY_CHUNK_SIZE_COMMUNITY > image_size) ?
+                     (image_size - offset) : INTEGRITY_CHUNK_SIZE_COMMUNITY;
+        ret = crypto_basic_sha256(image + offset, len, blob->digests[i]);
+    }
+    if (ret == ESP_OK) {
+        ret = integrity_manifest_merkle_root((const uint8_t (*)[INTEGRITY_MANIFEST_DIGEST_SIZE])blob->digests,
+                                             blob->header.chunk_count, blob->header.root_hash);
+    }
+    return ret;
+}
+
+/**
+ * @brief Déroule une vérification OTA (begin + verify) et garde le bilan
+ */
+static esp_err_t test_ota_run(const esp_partition_t *partition, const integrity_manifest_blob_t *blob,
+                              integrity_ota_stats_t *stats) {
+    esp_err_t ret = integrity_ota_begin(partition, blob, INTEGRITY_MANIFEST_BLOB_SIZE(blob->header.chunk_count));
+    if (ret == ESP_OK) {
+        ret = integrity_ota_verify();
+    }
+    integrity_ota_get_stats(stats);
+    return ret;
+}
+
+/**
+ * @brief OTA différentielle: seuls les chunks modifiés sont relus, puis le
+ *        manifeste en attente est adopté au redémarrage sur la nouvelle image
+ */
+static esp_err_t test_integrity_ota_delta(void) {
+    static integrity_manifest_blob_t blob;
+    const esp_partition_t *factory = esp_ota_get_running_partition();
+    const esp_partition_t *target = esp_partition_find_first(ESP_PARTITION_TYPE_APP,
+                                                             ESP_PARTITION_SUBTYPE_APP_OTA_0, NULL);
+    if (factory == NULL || target == NULL) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    // Manifeste courant appris sur l'image factory
+    integrity_checker_deinit();
+    integrity_manifest_erase();
+    if (host_flash_write_test_image(factory, TEST_OTA_IMAGE_SIZE, 11) != ESP_OK ||
+        integrity_checker_init() != ESP_OK) {
+        return ESP_FAIL;
+    }
+    bool sweep_done = false;
+    while (!sweep_done) {
+        if (integrity_sweep_step(UINT32_MAX, 0, &sweep_done, NULL) != INTEGRITY_OK) {
+            return ESP_FAIL;
+        }
+    }
+    integrity_stats_community_t checker_stats;
+    integrity_get_stats_community(&checker_stats);
+    if (integrity_manifest_get_state() != INTEGRITY_MANIFEST_READY) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    // Nouvelle image: copie de factory, description propre et un chunk de charge utile modifié
+    size_t flash_size = 0;
+    uint8_t *flash = host_flash_data(&flash_size);
+    memcpy(flash + target->address, flash + factory->address, target->size);
+
+    esp_app_desc_t desc = {
+        .magic_word = ESP_APP_DESC_MAGIC_WORD,
+        .version = "ota",
+        .project_name = "SecureIoT-VIF-Community",
+    };
+    memset(desc.app_elf_sha256, 0xA5, sizeof(desc.app_elf_sha256));
+    memcpy(flash + target->address + sizeof(esp_image_header_t) + sizeof(esp_image_segment_header_t),
+           &desc, sizeof(desc));
+
+    uint8_t *changed = flash + target->address + INTEGRITY_CHUNK_OFFSET_COMMUNITY(TEST_OTA_CHANGED_CHUNK) + 100;
+    *changed ^= 0xFF;
+
+    esp_err_t ret = test_ota_build_manifest(target, checker_stats.image_size, &blob);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    // Chunk modifié corrompu après coup: relu, donc rejeté
+    integrity_ota_stats_t stats;
+    *changed ^= 0x01;
+    ret = test_ota_run(target, &blob, &stats);
+    *changed ^= 0x01;
+    integrity_ota_abort();
+    if (ret != ESP_ERR_INVALID_CRC || stats.chunks_failed != 1) {
+        return ESP_FAIL;
+    }
+
+    // Chunk inchangé: hérité par son condensat, jamais relu
+    uint8_t *unchanged = flash + target->address + INTEGRITY_CHUNK_OFFSET_COMMUNITY(TEST_OTA_UNCHANGED_CHUNK) + 100;
+    *unchanged ^= 0x01;
+    ret = test_ota_run(target, &blob, &stats);
+    *unchanged ^= 0x01;
+    integrity_ota_abort();
+    if (ret != ESP_OK) {
+        return ESP_FAIL;
+    }
+
+    // Image conforme: delta relu, manifeste mis en attente
+    ret = test_ota_run(target, &blob, &stats);
+    if (ret == ESP_OK) {
+        ret = integrity_ota_finish();
+    }
+    if (ret != ESP_OK || stats.full_verify || stats.chunks_changed < 2 ||
+        stats.chunks_verified != stats.chunks_changed ||
+        stats.chunks_reused + stats.chunks_changed != stats.chunks_total ||
+        stats.bytes_hashed >= checker_stats.image_size) {
+        integrity_ota_abort();
+        return ESP_FAIL;
+    }
+
+    // Redémarrage sur la nouvelle image: manifest_next adopté sans apprentissage
+    integrity_checker_deinit();
+    host_ota_set_running_partition(target);
+    ret = integrity_checker_init();
+    bool adopted = (ret == ESP_OK && integrity_manifest_get_state() == INTEGRITY_MANIFEST_READY &&
+                    integrity_manifest_root_matches(blob.header.root_hash));
+
+    integrity_checker_deinit();
+    host_ota_set_running_partition(NULL);
+    integrity_manifest_erase();
+    return adopted ? ESP_OK : ESP_FAIL;
+}
+#endif
+
+int main(void) {
+    static const struct {
+        const char *name;
+        host_test_fn_t fn;
+    } tests[] = {
+        { "anomaly_detector_self_test", anomaly_detector_self_test },
+        { "incident_manager_self_test", incident_manager_self_test },
+        { "journal_persistence", test_journal_persistence },
+        { "journal_rotation", test_journal_rotation },
+        { "crypto_arena", test_crypto_arena },
+        { "anomaly_snapshot", test_anomaly_snapshot },
+        { "anomaly_change_flags", test_anomaly_change_flags },
+        { "telemetry_frame", test_telemetry_frame },
+        { "incident_rate_refill", test_incident_rate_refill },
+#if HOST_WITH_CRYPTO
+        { "crypto_basic_self_test", crypto_basic_self_test },
+        { "integrity_checker_self_test", integrity_checker_self_test },
+        { "integrity_corruption", test_integrity_corruption },
+        { "integrity_ota_delta", test_integrity_ota_delta },
+#endif
+    };
+    int failures = 0;
+
+    host_log_set_level(ESP_LOG_WARN);
+    host_clock_set_virtual(false);
+
+    if (host_flash_init(NULL, NULL) != ESP_OK) {
+        fprintf(stderr, "Flash simulée indisponible\n");
+        return 1;
+    }
+
+#if HOST_WITH_CRYPTO
+    if (crypto_operations_basic_init() != ESP_OK ||
+        host_flash_write_test_image(esp_ota_get_running_partition(), 64 * 1024, 7) != ESP_OK) {
+        fprintf(stderr, "Initialisation crypto / image de test échouée\n");
+        return 1;
+    }
+#endif
+
+    for (size_t i = 0; i < sizeof(tests) / sizeof(tests[0]); i++) {
+        esp_err_t ret = tests[i].fn();
+        printf("%-32s %s\n", tests[i].name, ret == ESP_OK ? "OK" : esp_err_to_name(ret));
+        failures += (ret != ESP_OK);
+    }
+
+    host_flash_deinit();
+    return failures == 0 ? 0 : 1;
+}
\ No newline at end of file
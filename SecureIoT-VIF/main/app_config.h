@@ -18,6 +18,7 @@ extern "C" {
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "sdkconfig.h"
 
 // ================================
 // Configuration générale Community
@@ -27,6 +28,30 @@ extern "C" {
 #define SECURE_IOT_VIF_NAME "SecureIoT-VIF-Community"
 #define SECURE_IOT_VIF_EDITION "Community Edition"
 
+// ================================
+// Topologie des cœurs (ESP32 bi-cœur)
+// ================================
+
+// Cœur de la pile WiFi/lwIP (PRO_CPU par défaut dans ESP-IDF)
+#if CONFIG_ESP_WIFI_TASK_PINNED_TO_CORE_1 || CONFIG_ESP32_WIFI_TASK_PINNED_TO_CORE_1
+#define APP_RADIO_CORE                   (1)
+#else
+#define APP_RADIO_CORE                   (0)
+#endif
+
+// Cœur sans radio: capture capteur à faible gigue
+#if CONFIG_FREERTOS_UNICORE
+#define APP_ISOLATED_CORE                (0)
+#else
+#define APP_ISOLATED_CORE                (1 - APP_RADIO_CORE)
+#endif
+
+#define SECURITY_MONITOR_CORE            APP_RADIO_CORE     // Préempté par le WiFi, tolère la latence
+#define SENSOR_TASK_CORE                 APP_ISOLATED_CORE  // Section critique DHT22 loin des IRQ radio
+#define INTEGRITY_SWEEP_CORE             APP_ISOLATED_CORE  // Temps libre du cœur capteur, sous sa priorité
+#define TELEMETRY_TASK_CORE              APP_RADIO_CORE     // Chiffrement et envoi à côté de la pile WiFi
+#define ATTESTATION_RESPONDER_CORE       APP_RADIO_CORE     // Signatures loin du cœur capteur
+
 // ================================
 // Configuration des tâches FreeRTOS
 // ================================
@@ -34,28 +59,55 @@ extern "C" {
 // Tâche de monitoring de sécurité (priorité réduite)
 #define SECURITY_MONITOR_STACK_SIZE      (6144)    // Réduit vs Enterprise
 #define SECURITY_MONITOR_PRIORITY        (8)       // Réduit vs Enterprise 
-#define SECURITY_MONITOR_INTERVAL_MS     (10000)   // 10 secondes vs 5s
+#define SECURITY_MONITOR_INTERVAL_MS     (10000)   // 10 secondes vs 5s (maintenance périodique)
 
 // Tâche de gestion des capteurs
 #define SENSOR_TASK_STACK_SIZE           (4096)
 #define SENSOR_TASK_PRIORITY             (7)       // Réduit vs Enterprise
 #define SENSOR_READ_INTERVAL_MS          (5000)    // 5 secondes vs 2s
 
-// Pas de tâche d'attestation en Community Edition
+// Tâche de balayage d'intégrité incrémental (basse priorité)
+// Valeurs définies une seule fois dans integrity_checker.h
+#define INTEGRITY_SWEEP_STACK_SIZE       INTEGRITY_SWEEP_TASK_STACK_COMMUNITY
+#define INTEGRITY_SWEEP_PRIORITY         INTEGRITY_SWEEP_TASK_PRIORITY_COMMUNITY
+#define INTEGRITY_SWEEP_CHUNKS_PER_SLICE INTEGRITY_SWEEP_CHUNKS_PER_SLICE_COMMUNITY
+#define INTEGRITY_SWEEP_SLICE_BUDGET_US  INTEGRITY_SWEEP_SLICE_BUDGET_US_COMMUNITY
+#define INTEGRITY_SWEEP_SLICE_PERIOD_MS  INTEGRITY_SWEEP_SLICE_PERIOD_MS_COMMUNITY
+
+// Tâche de télémétrie (lots chiffrés, CONFIG_TELEMETRY_ENABLE)
+#define TELEMETRY_TASK_STACK_SIZE        (4096)
+#define TELEMETRY_TASK_PRIORITY          (3)       // Sous capteurs et monitoring, au-dessus du balayage
+
+// Démarrage parallèle (boot_scheduler)
+#define BOOT_CORE_PRIMARY                APP_RADIO_CORE     // Crypto, détection, incidents
+#define BOOT_CORE_VERIFY                 APP_ISOLATED_CORE  // Vérificateur d'intégrité
+#define BOOT_CORE_SENSORS                SENSOR_TASK_CORE   // ISR GPIO DHT22 allouée sur le cœur qui l'installe
+#define BOOT_REQUIRED_TIMEOUT_MS         (15000)   // Étapes requises avant mise en service
+#define BOOT_DEFERRED_TIMEOUT_MS         (60000)   // Vérification d'intégrité différée
+
+// Répondeur d'attestation (CONFIG_ATTESTATION_UDP_RESPONDER): pile et priorité dans attestation.h
 
 // ================================
 // Configuration des timers Community
 // ================================
 
-#define INTEGRITY_CHECK_INTERVAL_US_COMMUNITY    (300000000) // 5 minutes vs 60s Enterprise
+#define INTEGRITY_CHECK_INTERVAL_US_COMMUNITY    (300000000) // 5 minutes vs 60s Enterprise (début de passe)
 #define HEARTBEAT_INTERVAL_US                    (30000000)  // 30 secondes vs 10s
 
 // ================================
 // Configuration des queues
 // ================================
 
-#define SECURITY_EVENT_QUEUE_SIZE        (10)      // Réduit vs Enterprise
-#define SENSOR_DATA_QUEUE_SIZE           (5)       // Réduit vs Enterprise
+#define SECURITY_EVENT_QUEUE_SIZE        (10)      // Réduit vs Enterprise (enregistrements de 16 octets)
+
+// Échantillons capteurs: anneau sans verrou (sample_ring.h), lus par lots
+#define MONITOR_SAMPLE_BATCH_SIZE        (16)      // Lot lu par la maintenance du monitoring
+
+// Dispatcher événementiel du monitoring
+#define SECURITY_EVENT_POST_TIMEOUT_MS   (0)       // Jamais bloquant côté producteur
+#define SECURITY_MONITOR_LATENCY_WARN_US (1000)    // Latence d'incident visée < 1 ms
+#define PERF_TRACE_DUMP_INTERVAL_MS      (300000)  // Rapport de latences (perf_trace.h)
+#define TASK_STATS_DUMP_INTERVAL_MS      (300000)  // Rapport d'occupation CPU par tâche
 
 // ================================
 // Configuration GPIO et hardware
@@ -64,6 +116,7 @@ extern "C" {
 // Configuration DHT22 (identique)
 #define DHT22_GPIO_PIN                  (4)
 #define DHT22_POWER_GPIO                (5)
+#define DHT22_READ_MODE_DEFAULT         DHT22_MODE_EDGE_CAPTURE  // ISR de fronts, pas de section critique
 
 // LED de statut
 #define STATUS_LED_GPIO                 (2)
@@ -102,8 +155,7 @@ extern "C" {
 #define INTEGRITY_CHECK_BOOT_DELAY_MS   (5000)     // Plus long délai
 #define INTEGRITY_CHECK_MAX_FAILURES    (5)        // Plus tolérant
 
-// Pas d'attestation continue en Community Edition
-#define COMMUNITY_NO_ATTESTATION        (true)
+// Attestation: rapport signé une fois par fenêtre, demandes servies depuis le cache
 
 // ================================
 // Configuration des capteurs (identique)
@@ -138,7 +190,7 @@ extern "C" {
 
 #define MAX_LOG_MESSAGE_SIZE            (256)
 #define SECURITY_LOG_BUFFER_SIZE        (2048)     // Réduit vs Enterprise
-#define LOG_ROTATION_SIZE_KB            (32)       // Réduit vs Enterprise
+#define LOG_ROTATION_SIZE_KB            (32)       // Réduit vs Enterprise (taille du journal d'incidents)
 
 // ================================
 // Configuration détection d'anomalies Community
@@ -148,6 +200,7 @@ extern "C" {
 #define ANOMALY_DETECTION_WINDOW        (5)        // Réduit vs Enterprise
 #define ANOMALY_SCORE_THRESHOLD         (0.9f)     // Plus strict (moins sensible)
 #define ANOMALY_LEARNING_PERIOD_MS      (600000)   // 10 minutes vs 5
+#define ANOMALY_DETECTION_MODE_DEFAULT  ANOMALY_MODE_STATISTICAL  // 0 faux positif sur trace saine (host_sim_clean_statistical)
 
 // Pas de ML adaptatif en Community
 #define COMMUNITY_THRESHOLD_ONLY        (true)
@@ -164,6 +217,7 @@ typedef enum {
     SECURITY_EVENT_SENSOR_MALFUNCTION,
     SECURITY_EVENT_COMMUNICATION_FAILURE,
     SECURITY_EVENT_POWER_ANOMALY,
+    SECURITY_EVENT_ATTESTATION_FAILURE,     // Rapport d'attestation non signé
     // Pas d'événements avancés en Community
     SECURITY_EVENT_MAX
 } security_event_type_t;
@@ -197,11 +251,19 @@ typedef enum {
 // Configuration gestion d'énergie Community
 // ================================
 
+#if CONFIG_POWER_DUTY_CYCLE
+// Cycle de sommeil profond (composant power_manager)
+#define POWER_SAVE_MODE_ENABLED         (1)
+#define SLEEP_MODE_DURATION_MS          CONFIG_POWER_DUTY_CYCLE_PERIOD_MS
+#define POWER_FULL_WAKE_WINDOW_MS       CONFIG_POWER_DUTY_FULL_WAKE_WINDOW_MS
+#define POWER_FAST_WAKE_MAX_POLLS       (3)        // Passes du planificateur par réveil rapide
+#else
 #define POWER_SAVE_MODE_ENABLED         (0)        // Désactivé par défaut
 #define SLEEP_MODE_DURATION_MS          (300000)   // 5 minutes vs 1 minute
 
 // Pas de gestion énergétique avancée
 #define COMMUNITY_NO_POWER_MGMT         (true)
+#endif
 
 // ================================
 // Macros utilitaires (identiques)
@@ -286,7 +348,11 @@ extern global_config_community_t g_config_community;
 #define FEATURE_EFUSE_PROTECTION        (false)    // Pas de protection eFuse
 #define FEATURE_SECURE_BOOT_V2          (false)    // Secure Boot basique seulement
 #define FEATURE_FLASH_ENCRYPTION        (false)    // Pas de chiffrement flash
-#define FEATURE_REMOTE_ATTESTATION      (false)    // Pas d'attestation distante
+#if CONFIG_ATTESTATION_ENABLE
+#define FEATURE_REMOTE_ATTESTATION      (true)     // Rapports signés en cache (components/attestation)
+#else
+#define FEATURE_REMOTE_ATTESTATION      (false)
+#endif
 #define FEATURE_ADVANCED_MONITORING     (false)    // Monitoring basique
 #define FEATURE_ENTERPRISE_TOOLS        (false)    // Pas d'outils avancés
 
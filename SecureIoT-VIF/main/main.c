@@ -26,16 +26,27 @@
 #include "esp_log.h"
 #include "esp_err.h"
 #include "esp_sleep.h"
+#include "esp_attr.h"
 #include "esp_timer.h"
 #include "nvs_flash.h"
 #include "driver/gpio.h"
 
 #include "app_config.h"
 #include "crypto_operations_basic.h"  // Version simplifiée
+#include "crypto_random.h"
 #include "integrity_checker.h"
 #include "sensor_manager.h"
+#include "sample_ring.h"
 #include "anomaly_detector.h"
 #include "incident_manager.h"
+#include "security_event.h"
+#include "perf_trace.h"
+#include "bench.h"
+#include "boot_scheduler.h"
+#include "telemetry.h"
+#include "duty_cycle.h"
+#include "dht22_driver.h"
+#include "attestation.h"
 
 static const char *TAG = "SECURE_IOT_VIF_COMMUNITY";
 
@@ -49,49 +60,109 @@ static esp_timer_handle_t heartbeat_timer = NULL;
 
 // Queues pour la communication inter-tâches
 static QueueHandle_t security_event_queue = NULL;
-static QueueHandle_t sensor_data_queue = NULL;
+static StaticQueue_t security_event_queue_buffer;
+static uint8_t security_event_queue_storage[SECURITY_EVENT_QUEUE_SIZE * sizeof(security_event_t)];
+static uint8_t monitor_sample_consumer = SAMPLE_RING_CONSUMER_INVALID;
 
 // Sémaphores pour la synchronisation
 static SemaphoreHandle_t system_mutex = NULL;
+static StaticSemaphore_t system_mutex_buffer;
+
+#if CONFIG_APP_STATIC_MEMORY
+// Piles et TCB des tâches applicatives en .bss: aucune dépendance au tas
+static StackType_t security_monitor_stack[SECURITY_MONITOR_STACK_SIZE];
+static StaticTask_t security_monitor_tcb;
+static StackType_t sensor_task_stack[SENSOR_TASK_STACK_SIZE];
+static StaticTask_t sensor_task_tcb;
+#endif
+
+#if CONFIG_POWER_DUTY_CYCLE
+// Historique du détecteur conservé en mémoire RTC entre deux sommeils profonds
+static RTC_DATA_ATTR anomaly_snapshot_t rtc_detector_state;
+#endif
 
 /**
- * @brief Structure pour les événements de sécurité
+ * @brief Statistiques du dispatcher de monitoring
  */
 typedef struct {
-    security_event_type_t type;
-    uint32_t timestamp;
-    uint8_t severity;
-    char description[128];
-    uint8_t data[64];
-    size_t data_len;
-} security_event_t;
+    uint32_t events_posted;         // Événements acceptés dans la queue
+    uint32_t events_dropped;        // Événements rejetés (queue pleine)
+    uint32_t events_dispatched;     // Événements traités
+    uint32_t queue_high_water;      // Profondeur maximale observée
+    uint32_t batches;               // Réveils ayant traité au moins un événement
+    uint32_t max_batch_size;        // Plus gros lot traité en un réveil
+    uint32_t last_latency_us;       // Latence émission → traitement (dernier)
+    uint32_t max_latency_us;        // Latence émission → traitement (max)
+    uint32_t housekeeping_runs;     // Passages de maintenance périodique
+    uint32_t samples_consumed;      // Échantillons capteurs lus dans l'anneau
+} security_monitor_stats_t;
+
+// Bits de notification de la tâche de monitoring
+#define MONITOR_NOTIFY_EVENT            (1UL << 0)
+#define MONITOR_NOTIFY_HOUSEKEEPING     (1UL << 1)
+
+static esp_timer_handle_t monitor_housekeeping_timer = NULL;
+static security_monitor_stats_t monitor_stats = {0};
+static portMUX_TYPE monitor_stats_lock = portMUX_INITIALIZER_UNLOCKED;
+
+/**
+ * @brief Publie un événement de sécurité vers le dispatcher (non bloquant)
+ * 
+ * Ne bloque jamais le producteur: si la queue est pleine, l'événement est
+ * compté comme perdu et ESP_ERR_TIMEOUT est retourné.
+ */
+static esp_err_t post_security_event(security_event_t *event) {
+    event->timestamp_us = (uint32_t)esp_timer_get_time();
+    
+    if (xQueueSend(security_event_queue, event, pdMS_TO_TICKS(SECURITY_EVENT_POST_TIMEOUT_MS)) != pdPASS) {
+        portENTER_CRITICAL(&monitor_stats_lock);
+        monitor_stats.events_dropped++;
+        portEXIT_CRITICAL(&monitor_stats_lock);
+        return ESP_ERR_TIMEOUT;
+    }
+    
+    uint32_t depth = uxQueueMessagesWaiting(security_event_queue);
+    portENTER_CRITICAL(&monitor_stats_lock);
+    monitor_stats.events_posted++;
+    if (depth > monitor_stats.queue_high_water) {
+        monitor_stats.queue_high_water = depth;
+    }
+    portEXIT_CRITICAL(&monitor_stats_lock);
+    
+    if (security_monitor_task_handle != NULL) {
+        xTaskNotify(security_monitor_task_handle, MONITOR_NOTIFY_EVENT, eSetBits);
+    }
+    
+    return ESP_OK;
+}
 
 /**
- * @brief Fonction de callback pour le timer de vérification d'intégrité (au démarrage)
+ * @brief Callback d'échec du balayage d'intégrité (tâche de balayage)
+ */
+static void integrity_sweep_failure_callback(integrity_status_t status, size_t chunk_id, void *arg) {
+    ESP_LOGE(TAG, "❌ Échec vérification intégrité: %d (chunk %d)", status, chunk_id);
+    
+    // Signaler l'événement de sécurité
+    security_event_t event;
+    security_event_from_integrity(&event, (int32_t)status, (uint32_t)chunk_id,
+                                  SECURITY_SEVERITY_HIGH);
+    
+    if (post_security_event(&event) != ESP_OK) {
+        ESP_LOGE(TAG, "❌ Impossible d'envoyer événement de sécurité");
+    }
+}
+
+/**
+ * @brief Fonction de callback pour le timer de vérification d'intégrité
+ * 
+ * Ne vérifie rien elle-même: demande une nouvelle passe à la tâche de
+ * balayage pour ne pas bloquer la tâche de dispatch esp_timer.
  */
 static void integrity_check_timer_callback(void* arg) {
-    ESP_LOGI(TAG, "🔍 Vérification d'intégrité de base (Community Edition)");
+    ESP_LOGD(TAG, "🔍 Demande de passe de vérification d'intégrité");
     
-    // Vérification simplifiée au démarrage uniquement
-    integrity_status_t status = integrity_check_firmware_basic();
-    if (status != INTEGRITY_OK) {
-        ESP_LOGE(TAG, "❌ Échec vérification intégrité: %d", status);
-        
-        // Signaler l'événement de sécurité
-        security_event_t event = {
-            .type = SECURITY_EVENT_INTEGRITY_FAILURE,
-            .timestamp = (uint32_t)(esp_timer_get_time() / 1000),
-            .severity = SECURITY_SEVERITY_HIGH,
-            .data_len = sizeof(integrity_status_t)
-        };
-        strncpy(event.description, "Échec vérification intégrité basique", sizeof(event.description)-1);
-        memcpy(event.data, &status, sizeof(integrity_status_t));
-        
-        if (xQueueSend(security_event_queue, &event, 0) != pdPASS) {
-            ESP_LOGE(TAG, "❌ Impossible d'envoyer événement de sécurité");
-        }
-    } else {
-        ESP_LOGI(TAG, "✅ Vérification d'intégrité de base réussie");
+    if (integrity_sweep_request() != ESP_OK) {
+        ESP_LOGW(TAG, "⚠️ Tâche de balayage d'intégrité indisponible");
     }
 }
 
@@ -113,41 +184,208 @@ static void heartbeat_timer_callback(void* arg) {
 }
 
 /**
- * @brief Tâche de monitoring de sécurité (version simplifiée)
+ * @brief Fonction de callback pour la maintenance périodique du monitoring
+ * 
+ * Ne fait que réveiller la tâche de monitoring: le travail est fait hors
+ * de la tâche esp_timer.
  */
-static void security_monitor_task(void *pvParameters) {
-    ESP_LOGI(TAG, "🛡️ Démarrage monitoring sécurité Community Edition");
+static void monitor_housekeeping_timer_callback(void* arg) {
+    if (security_monitor_task_handle != NULL) {
+        xTaskNotify(security_monitor_task_handle, MONITOR_NOTIFY_HOUSEKEEPING, eSetBits);
+    }
+}
+
+/**
+ * @brief Traite un événement de sécurité
+ */
+static void dispatch_security_event(security_event_t *event) {
+    PERF_TRACE_SCOPE(PERF_SPAN_MONITOR_DISPATCH);
     
-    security_event_t event;
-    TickType_t xLastWakeTime = xTaskGetTickCount();
+    // Répétitions et rafales: une mise à jour de compteur, ni log ni écriture flash
+    if (incident_admit(event) != INCIDENT_DECISION_NEW) {
+        return;
+    }
     
-    while (1) {
-        // Traitement des événements de sécurité
-        if (xQueueReceive(security_event_queue, &event, pdMS_TO_TICKS(100)) == pdPASS) {
-            ESP_LOGW(TAG, "⚠️ Événement sécurité reçu: type=%d, sévérité=%d, desc=%s", 
-                     event.type, event.severity, event.description);
+    // Description construite seulement ici, hors du chemin des producteurs
+    char description[SECURITY_EVENT_DESC_MAX_LEN];
+    security_event_format(event, description, sizeof(description));
+    ESP_LOGW(TAG, "⚠️ Événement sécurité reçu: type=%d, sévérité=%s, desc=%s", 
+             event->type, security_event_severity_to_string(event->severity), description);
+    
+    // Traitement basique selon le type d'événement
+    switch (event->type) {
+        case SECURITY_EVENT_INTEGRITY_FAILURE:
+            incident_handle_integrity_failure(event);
+            break;
             
-            // Traitement basique selon le type d'événement
-            switch (event.type) {
-                case SECURITY_EVENT_INTEGRITY_FAILURE:
-                    incident_handle_integrity_failure(&event);
-                    break;
-                    
-                case SECURITY_EVENT_ANOMALY_DETECTED:
-                    incident_handle_anomaly(&event);
-                    break;
-                    
-                case SECURITY_EVENT_SENSOR_MALFUNCTION:
-                    ESP_LOGW(TAG, "🌡️ Dysfonctionnement capteur détecté");
-                    break;
-                    
-                default:
-                    ESP_LOGW(TAG, "❓ Événement de sécurité non reconnu: %d", event.type);
-                    break;
-            }
+        case SECURITY_EVENT_ANOMALY_DETECTED:
+            incident_handle_anomaly(event);
+            break;
+            
+        case SECURITY_EVENT_SENSOR_MALFUNCTION:
+            ESP_LOGW(TAG, "🌡️ Dysfonctionnement capteur détecté");
+            break;
+            
+        case SECURITY_EVENT_ATTESTATION_FAILURE:
+            incident_handle_attestation_failure(event);
+            break;
+            
+        default:
+            ESP_LOGW(TAG, "❓ Événement de sécurité non reconnu: %d", event->type);
+            break;
+    }
+}
+
+/**
+ * @brief Vide la queue d'événements en un seul lot
+ */
+static void monitor_drain_events(void) {
+    security_event_t event;
+    uint32_t batch_size = 0;
+    
+    while (xQueueReceive(security_event_queue, &event, 0) == pdPASS) {
+        uint32_t latency_us = SECURITY_EVENT_AGE_US(&event, esp_timer_get_time());
+        monitor_stats.last_latency_us = latency_us;
+        if (latency_us > monitor_stats.max_latency_us) {
+            monitor_stats.max_latency_us = latency_us;
+        }
+        
+        dispatch_security_event(&event);
+        batch_size++;
+    }
+    
+    if (batch_size > 0) {
+        monitor_stats.events_dispatched += batch_size;
+        monitor_stats.batches++;
+        if (batch_size > monitor_stats.max_batch_size) {
+            monitor_stats.max_batch_size = batch_size;
+        }
+        ESP_LOGD(TAG, "📦 Lot de %lu événements traité", batch_size);
+    }
+}
+
+/**
+ * @brief Maintenance périodique: rapport des compteurs du dispatcher
+ */
+static void monitor_housekeeping(void) {
+    static uint32_t last_dropped = 0;
+    static uint32_t last_samples_dropped = 0;
+#if CONFIG_APP_DIAGNOSTIC_REPORTS
+    static int64_t last_perf_dump_us = 0;
+    static int64_t last_task_dump_us = 0;
+#endif
+    security_monitor_stats_t snapshot;
+    
+    monitor_stats.housekeeping_runs++;
+    
+    // Consommer les échantillons capteurs par lots (curseur propre au monitoring)
+    sensor_data_t samples[MONITOR_SAMPLE_BATCH_SIZE];
+    size_t read_count;
+    while ((read_count = sample_ring_read(monitor_sample_consumer, samples,
+                                          MONITOR_SAMPLE_BATCH_SIZE)) > 0) {
+        monitor_stats.samples_consumed += read_count;
+    }
+    
+    sample_ring_consumer_stats_t ring_stats;
+    if (sample_ring_get_consumer_stats(monitor_sample_consumer, &ring_stats) == ESP_OK &&
+        ring_stats.samples_dropped != last_samples_dropped) {
+        ESP_LOGW(TAG, "📦 Anneau capteurs: %lu échantillons écrasés avant lecture (+%lu)",
+                 ring_stats.samples_dropped, ring_stats.samples_dropped - last_samples_dropped);
+        last_samples_dropped = ring_stats.samples_dropped;
+    }
+    
+    // Clôture des incidents fusionnés, résumé des limitations, vidage du journal
+    incident_manager_tick();
+    
+#if CONFIG_ATTESTATION_ENABLE
+    // Re-signature du rapport en cache à l'échéance ou sur changement d'état
+    // Échec de signature: événement soumis à la fusion et à la limitation comme les autres
+    esp_err_t attest_ret = attestation_tick();
+    if (attest_ret != ESP_OK && attest_ret != ESP_ERR_INVALID_STATE) {
+        security_event_t attest_event;
+        security_event_init(&attest_event, SECURITY_EVENT_ATTESTATION_FAILURE,
+                            SECURITY_SEVERITY_MEDIUM, SECURITY_EVENT_SOURCE_NONE);
+        if (post_security_event(&attest_event) != ESP_OK) {
+            ESP_LOGW(TAG, "⚠️ Échec attestation non signalé (queue pleine)");
         }
+    }
+#endif
+    
+#if CONFIG_APP_DIAGNOSTIC_REPORTS
+    // Latences p50/p99/max des chemins instrumentés
+    int64_t now_us = esp_timer_get_time();
+    if (now_us - last_perf_dump_us >= (int64_t)PERF_TRACE_DUMP_INTERVAL_MS * 1000) {
+        perf_trace_dump();
+        last_perf_dump_us = now_us;
+    }
+    
+    // Occupation CPU par tâche: vérifie le placement cœur capteur / cœur radio
+    // Niveau du tas: doit rester plat après le repère de fin d'initialisation
+    if (now_us - last_task_dump_us >= (int64_t)TASK_STATS_DUMP_INTERVAL_MS * 1000) {
+        perf_trace_dump_tasks();
+        perf_trace_dump_heap();
         
-        vTaskDelayUntil(&xLastWakeTime, pdMS_TO_TICKS(SECURITY_MONITOR_INTERVAL_MS));
+        crypto_arena_stats_t arena_stats;
+        if (crypto_basic_get_arena_stats(&arena_stats) == ESP_OK) {
+            ESP_LOGI(TAG, "🧱 Arène mbedTLS: %d/%d octets (pic %d), %lu échec(s), %lu repli(s) tas",
+                     arena_stats.used, arena_stats.capacity, arena_stats.peak, arena_stats.failures,
+                     arena_stats.heap_fallbacks);
+        }
+        
+        // Recharges dans l'appelant ou attentes du verrou: réserves sous-dimensionnées
+        crypto_random_print_stats();
+        
+        // Octets par échantillon publiés vs JSON (no-op sans télémétrie)
+        telemetry_print_stats();
+        
+        // Part des demandes servies sans signature (no-op sans attestation)
+        attestation_print_stats();
+        last_task_dump_us = now_us;
+    }
+#endif
+    
+    portENTER_CRITICAL(&monitor_stats_lock);
+    snapshot = monitor_stats;
+    portEXIT_CRITICAL(&monitor_stats_lock);
+    
+    if (snapshot.events_dropped != last_dropped) {
+        ESP_LOGW(TAG, "📉 Backpressure monitoring: %lu événements perdus (+%lu), pic queue=%lu/%d",
+                 snapshot.events_dropped, snapshot.events_dropped - last_dropped,
+                 snapshot.queue_high_water, SECURITY_EVENT_QUEUE_SIZE);
+        last_dropped = snapshot.events_dropped;
+    }
+    
+    if (snapshot.max_latency_us > SECURITY_MONITOR_LATENCY_WARN_US) {
+        ESP_LOGW(TAG, "⏱️ Latence incident max %lu µs (> %d µs)",
+                 snapshot.max_latency_us, SECURITY_MONITOR_LATENCY_WARN_US);
+    }
+    
+    ESP_LOGD(TAG, "📊 Monitoring: émis=%lu, traités=%lu, perdus=%lu, pic queue=%lu, "
+             "lots=%lu (max %lu), latence=%lu µs (max %lu µs), échantillons=%lu",
+             snapshot.events_posted, snapshot.events_dispatched, snapshot.events_dropped,
+             snapshot.queue_high_water, snapshot.batches, snapshot.max_batch_size,
+             snapshot.last_latency_us, snapshot.max_latency_us, snapshot.samples_consumed);
+}
+
+/**
+ * @brief Tâche de monitoring de sécurité (dispatcher événementiel)
+ * 
+ * Bloque sur une notification: chaque réveil vide toute la queue
+ * d'événements, la maintenance périodique arrive par un timer séparé.
+ */
+static void security_monitor_task(void *pvParameters) {
+    ESP_LOGI(TAG, "🛡️ Démarrage monitoring sécurité Community Edition");
+    
+    while (1) {
+        uint32_t notified = 0;
+        xTaskNotifyWait(0, UINT32_MAX, &notified, portMAX_DELAY);
+        
+        // Toujours vider la queue: un événement peut précéder la notification
+        monitor_drain_events();
+        
+        if (notified & MONITOR_NOTIFY_HOUSEKEEPING) {
+            monitor_housekeeping();
+        }
     }
 }
 
@@ -157,104 +395,271 @@ static void security_monitor_task(void *pvParameters) {
 static void sensor_task(void *pvParameters) {
     ESP_LOGI(TAG, "🌡️ Démarrage tâche gestion capteurs");
     
-    sensor_data_t sensor_data;
-    TickType_t xLastWakeTime = xTaskGetTickCount();
+    sensor_data_t batch[SENSOR_MAX_INSTANCES];
+    bool first_sample_logged = false;
+    int64_t expected_wake_us = 0;
     
     while (1) {
-        // Lecture des données capteurs
-        esp_err_t ret = sensor_read_dht22(&sensor_data);
-        if (ret == ESP_OK) {
+        // Gigue: retard du réveil effectif sur l'échéance demandée
+        if (expected_wake_us != 0) {
+            int64_t late_us = esp_timer_get_time() - expected_wake_us;
+            perf_trace_record_us(PERF_SPAN_SENSOR_WAKE_LATE, late_us > 0 ? (uint32_t)late_us : 0);
+        }
+        
+        // Passe du planificateur: lectures échues groupées, périodes par capteur
+        size_t count = 0;
+        uint32_t next_wake_ms = SENSOR_READ_INTERVAL_MS;
+        esp_err_t ret = sensor_scheduler_poll(batch, SENSOR_MAX_INSTANCES, &count, &next_wake_ms);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "❌ Erreur lecture capteur: %s", esp_err_to_name(ret));
+        }
+        
+        if (count > 0 && !first_sample_logged) {
+            ESP_LOGI(TAG, "⏱️ Premier échantillon à %lld ms du boot", esp_timer_get_time() / 1000);
+            first_sample_logged = true;
+        }
+        
+        for (size_t i = 0; i < count; i++) {
+            sensor_data_t *sensor_data = &batch[i];
+#if CONFIG_POWER_DUTY_CYCLE
+            // Même base de temps que les échantillons des réveils rapides
+            sensor_data->timestamp = duty_cycle_now_ms();
+#endif
             ESP_LOGD(TAG, "📊 Données capteur: T=%.1f°C, H=%.1f%%", 
-                     sensor_data.temperature, sensor_data.humidity);
+                     sensor_data->temperature, sensor_data->humidity);
             
-            // Détection d'anomalies par seuils fixes (Community Edition)
-            anomaly_result_t anomaly = anomaly_detect_threshold_based(&sensor_data);
+            // Détection d'anomalies selon le mode actif (seuils fixes ou statistique)
+            anomaly_result_t anomaly = anomaly_detect(sensor_data);
             if (anomaly.is_anomaly) {
-                ESP_LOGW(TAG, "🚨 Anomalie détectée (seuils fixes): score=%.3f", anomaly.anomaly_score);
+                ESP_LOGW(TAG, "🚨 Anomalie détectée (%s): score=%.3f",
+                         anomaly_mode_to_string(anomaly.mode), anomaly.anomaly_score);
                 
                 // Signaler l'événement
-                security_event_t event = {
-                    .type = SECURITY_EVENT_ANOMALY_DETECTED,
-                    .timestamp = (uint32_t)(esp_timer_get_time() / 1000),
-                    .severity = SECURITY_SEVERITY_MEDIUM,
-                    .data_len = sizeof(anomaly_result_t)
-                };
-                snprintf(event.description, sizeof(event.description), 
-                         "Anomalie seuils fixes: score=%.3f", anomaly.anomaly_score);
-                memcpy(event.data, &anomaly, sizeof(anomaly_result_t));
+                // Enregistrement compact: pas de formatage sur le chemin capteur
+                security_event_t event;
+                security_event_from_anomaly(&event, &anomaly, sensor_data->sensor_id,
+                                            SECURITY_SEVERITY_MEDIUM);
                 
-                xQueueSend(security_event_queue, &event, portMAX_DELAY);
+                // Jamais bloquant: une rafale d'anomalies ne doit pas figer l'échantillonnage
+                post_security_event(&event);
             }
             
-            // Envoyer les données à la queue pour traitement
-            if (xQueueSend(sensor_data_queue, &sensor_data, 0) != pdPASS) {
-                ESP_LOGW(TAG, "📦 Queue des données capteur pleine");
-            }
-        } else {
-            ESP_LOGE(TAG, "❌ Erreur lecture capteur: %s", esp_err_to_name(ret));
+            // Publier dans l'anneau: jamais bloquant, les plus anciens sont écrasés
+            sample_ring_push(sensor_data);
         }
         
-        vTaskDelayUntil(&xLastWakeTime, pdMS_TO_TICKS(SENSOR_READ_INTERVAL_MS));
+        TickType_t delay = pdMS_TO_TICKS(next_wake_ms);
+        if (delay == 0) {
+            delay = 1;
+        }
+        expected_wake_us = esp_timer_get_time() + (int64_t)delay * portTICK_PERIOD_MS * 1000;
+        vTaskDelay(delay);
     }
 }
 
+// ================================
+// Étapes de démarrage (boot_scheduler)
+// ================================
+
 /**
- * @brief Initialisation du système de sécurité (version Community)
+ * @brief Étape: crypto de base (graine DRBG)
  */
-static esp_err_t init_security_system(void) {
-    esp_err_t ret = ESP_OK;
-    
-    ESP_LOGI(TAG, "🔐 === Initialisation Système Community Edition ===");
-    
+static esp_err_t boot_stage_crypto(void) {
     // Initialisation crypto de base (pas d'HSM avancé)
     ESP_LOGI(TAG, "🔑 Initialisation crypto de base...");
-    ret = crypto_operations_basic_init();
+    esp_err_t ret = crypto_operations_basic_init();
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "❌ Échec initialisation crypto de base: %s", esp_err_to_name(ret));
         return ret;
     }
     ESP_LOGI(TAG, "✅ Crypto de base initialisé");
-    
-    // Vérification initiale d'intégrité (au démarrage seulement)
+    return ESP_OK;
+}
+
+/**
+ * @brief Étape: vérificateur d'intégrité (partition, manifeste)
+ */
+static esp_err_t boot_stage_integrity_init(void) {
     ESP_LOGI(TAG, "🔍 Vérification intégrité initiale...");
+    esp_err_t ret = integrity_checker_init();
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ Échec initialisation vérificateur d'intégrité: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief Étape différée: vérification initiale d'intégrité
+ * 
+ * Tourne pendant que l'échantillonnage démarre; ouvre la barrière des
+ * actions sensibles une fois l'image validée.
+ */
+static esp_err_t boot_stage_integrity_verify(void) {
     integrity_status_t integrity_status = integrity_check_firmware_basic();
     if (integrity_status != INTEGRITY_OK) {
         ESP_LOGE(TAG, "❌ Échec vérification intégrité initiale: %d", integrity_status);
         return ESP_FAIL;
     }
     ESP_LOGI(TAG, "✅ Vérification intégrité initiale réussie");
-    
-    // Initialisation des capteurs
+    boot_gate_open(BOOT_GATE_INTEGRITY_VERIFIED);
+    return ESP_OK;
+}
+
+/**
+ * @brief Étape: capteurs (attente de mise sous tension DHT22 incluse)
+ */
+static esp_err_t boot_stage_sensors(void) {
     ESP_LOGI(TAG, "🌡️ Initialisation gestionnaire de capteurs...");
-    ret = sensor_manager_init();
+    esp_err_t ret = sensor_manager_init();
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "❌ Échec initialisation gestionnaire de capteurs: %s", esp_err_to_name(ret));
         return ret;
     }
     ESP_LOGI(TAG, "✅ Gestionnaire de capteurs initialisé");
-    
-    // Initialisation du détecteur d'anomalies (seuils fixes)
+    return ESP_OK;
+}
+
+/**
+ * @brief Étape: détecteur d'anomalies (seuils fixes)
+ */
+static esp_err_t boot_stage_anomaly(void) {
     ESP_LOGI(TAG, "🤖 Initialisation détecteur d'anomalies de base...");
-    ret = anomaly_detector_basic_init();
+    esp_err_t ret = anomaly_detector_basic_init();
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "❌ Échec initialisation détecteur d'anomalies: %s", esp_err_to_name(ret));
         return ret;
     }
     ESP_LOGI(TAG, "✅ Détecteur d'anomalies de base initialisé");
-    
-    // Initialisation du gestionnaire d'incidents
+    return ESP_OK;
+}
+
+/**
+ * @brief Étape: gestionnaire d'incidents (journal flash)
+ */
+static esp_err_t boot_stage_incidents(void) {
     ESP_LOGI(TAG, "🚨 Initialisation gestionnaire d'incidents...");
-    ret = incident_manager_init();
+    esp_err_t ret = incident_manager_init();
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "❌ Échec initialisation gestionnaire d'incidents: %s", esp_err_to_name(ret));
         return ret;
     }
     ESP_LOGI(TAG, "✅ Gestionnaire d'incidents initialisé");
+    return ESP_OK;
+}
+
+#if CONFIG_ATTESTATION_ENABLE
+/**
+ * @brief Étape: clé et compteur de démarrages d'attestation
+ * 
+ * Non bloquante: sans attestation, le nœud reste en service et la
+ * maintenance ne tente aucune signature.
+ */
+static esp_err_t boot_stage_attestation(void) {
+    esp_err_t ret = attestation_init();
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "⚠️ Attestation indisponible: %s", esp_err_to_name(ret));
+    }
+    return ESP_OK;
+}
+#endif
+
+// Index des étapes (bits de dépendance)
+enum {
+    BOOT_STAGE_CRYPTO = 0,
+    BOOT_STAGE_INTEGRITY_INIT,
+    BOOT_STAGE_INTEGRITY_VERIFY,
+    BOOT_STAGE_SENSORS,
+    BOOT_STAGE_ANOMALY,
+    BOOT_STAGE_INCIDENTS,
+#if CONFIG_ATTESTATION_ENABLE
+    BOOT_STAGE_ATTESTATION,
+#endif
+    BOOT_STAGE_COUNT
+};
+
+// Intégrité et capteurs (ISR de capture DHT22) sur le cœur isolé pendant que le cœur radio sème le DRBG
+static const boot_stage_t boot_stages[BOOT_STAGE_COUNT] = {
+    [BOOT_STAGE_CRYPTO] = {
+        .name = "crypto", .fn = boot_stage_crypto,
+        .core = BOOT_CORE_PRIMARY
+    },
+    [BOOT_STAGE_INTEGRITY_INIT] = {
+        .name = "integrity_init", .fn = boot_stage_integrity_init,
+        .depends_on = BOOT_STAGE_BIT(BOOT_STAGE_CRYPTO),
+        .core = BOOT_CORE_VERIFY
+    },
+    [BOOT_STAGE_INTEGRITY_VERIFY] = {
+        .name = "integrity_verify", .fn = boot_stage_integrity_verify,
+        .depends_on = BOOT_STAGE_BIT(BOOT_STAGE_INTEGRITY_INIT),
+        .core = BOOT_CORE_VERIFY, .deferred = true
+    },
+    [BOOT_STAGE_SENSORS] = {
+        .name = "sensors", .fn = boot_stage_sensors,
+        .core = BOOT_CORE_SENSORS
+    },
+    [BOOT_STAGE_ANOMALY] = {
+        .name = "anomaly", .fn = boot_stage_anomaly,
+        .core = BOOT_CORE_PRIMARY
+    },
+    [BOOT_STAGE_INCIDENTS] = {
+        .name = "incidents", .fn = boot_stage_incidents,
+        .core = BOOT_CORE_PRIMARY
+    },
+#if CONFIG_ATTESTATION_ENABLE
+    [BOOT_STAGE_ATTESTATION] = {
+        .name = "attestation", .fn = boot_stage_attestation,
+        .depends_on = BOOT_STAGE_BIT(BOOT_STAGE_CRYPTO) | BOOT_STAGE_BIT(BOOT_STAGE_INCIDENTS),
+        .core = BOOT_CORE_PRIMARY
+    },
+#endif
+};
+
+/**
+ * @brief Initialisation du système de sécurité (version Community)
+ * 
+ * Les étapes indépendantes tournent en parallèle sur les deux cœurs. La
+ * vérification d'intégrité est différée: l'échantillonnage démarre sans
+ * l'attendre, les actions sensibles sont bloquées par
+ * BOOT_GATE_INTEGRITY_VERIFIED jusqu'à son succès.
+ */
+static esp_err_t init_security_system(void) {
+    ESP_LOGI(TAG, "🔐 === Initialisation Système Community Edition ===");
+    
+    esp_err_t ret = boot_scheduler_run(boot_stages, BOOT_STAGE_COUNT, BOOT_REQUIRED_TIMEOUT_MS);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ Échec étapes de démarrage: %s", esp_err_to_name(ret));
+        boot_scheduler_print_timings();
+        return ret;
+    }
     
     ESP_LOGI(TAG, "🎉 === Système Community Edition Initialisé ===");
     return ESP_OK;
 }
 
+/**
+ * @brief Démarre le balayage d'intégrité incrémental (couverture complète)
+ * 
+ * Lancé après la vérification de démarrage pour ne pas concurrencer
+ * la passe initiale sur les statistiques et le mapping de la partition.
+ */
+static esp_err_t start_integrity_sweep(void) {
+    integrity_sweep_config_t sweep_config = {
+        .chunks_per_slice = INTEGRITY_SWEEP_CHUNKS_PER_SLICE,
+        .slice_budget_us = INTEGRITY_SWEEP_SLICE_BUDGET_US,
+        .slice_period_ms = INTEGRITY_SWEEP_SLICE_PERIOD_MS,
+        .task_priority = INTEGRITY_SWEEP_PRIORITY,
+        .task_stack_size = INTEGRITY_SWEEP_STACK_SIZE,
+        .task_core = INTEGRITY_SWEEP_CORE
+    };
+    esp_err_t ret = integrity_sweep_start(&sweep_config, integrity_sweep_failure_callback, NULL);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ Échec démarrage balayage d'intégrité: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    return ESP_OK;
+}
+
 /**
  * @brief Initialisation des tâches et timers
  */
@@ -264,52 +669,112 @@ static esp_err_t init_tasks_and_timers(void) {
     ESP_LOGI(TAG, "⚙️ Initialisation tâches et timers Community...");
     
     // Création des queues
-    security_event_queue = xQueueCreate(SECURITY_EVENT_QUEUE_SIZE, sizeof(security_event_t));
+    security_event_queue = xQueueCreateStatic(SECURITY_EVENT_QUEUE_SIZE, sizeof(security_event_t),
+                                              security_event_queue_storage, &security_event_queue_buffer);
     if (security_event_queue == NULL) {
         ESP_LOGE(TAG, "❌ Échec création queue événements de sécurité");
         return ESP_FAIL;
     }
     
-    sensor_data_queue = xQueueCreate(SENSOR_DATA_QUEUE_SIZE, sizeof(sensor_data_t));
-    if (sensor_data_queue == NULL) {
-        ESP_LOGE(TAG, "❌ Échec création queue données capteur");
-        return ESP_FAIL;
+    ret = sample_ring_init();
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ Échec initialisation anneau d'échantillons");
+        return ret;
+    }
+    
+    ret = sample_ring_register_consumer("monitor", false, &monitor_sample_consumer);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ Échec enregistrement consommateur monitoring");
+        return ret;
     }
     
     // Création des sémaphores
-    system_mutex = xSemaphoreCreateMutex();
+    system_mutex = xSemaphoreCreateMutexStatic(&system_mutex_buffer);
     if (system_mutex == NULL) {
         ESP_LOGE(TAG, "❌ Échec création mutex système");
         return ESP_FAIL;
     }
     
     // Création des tâches
-    BaseType_t task_ret = xTaskCreate(
+    // Placement fixe: capture capteur sur le cœur sans radio (app_config.h)
+#if CONFIG_APP_STATIC_MEMORY
+    security_monitor_task_handle = xTaskCreateStaticPinnedToCore(
         security_monitor_task,
         "security_monitor_community",
         SECURITY_MONITOR_STACK_SIZE,
         NULL,
         SECURITY_MONITOR_PRIORITY,
-        &security_monitor_task_handle
+        security_monitor_stack,
+        &security_monitor_tcb,
+        SECURITY_MONITOR_CORE
     );
+    BaseType_t task_ret = (security_monitor_task_handle != NULL) ? pdPASS : pdFAIL;
+#else
+    BaseType_t task_ret = xTaskCreatePinnedToCore(
+        security_monitor_task,
+        "security_monitor_community",
+        SECURITY_MONITOR_STACK_SIZE,
+        NULL,
+        SECURITY_MONITOR_PRIORITY,
+        &security_monitor_task_handle,
+        SECURITY_MONITOR_CORE
+    );
+#endif
     if (task_ret != pdPASS) {
         ESP_LOGE(TAG, "❌ Échec création tâche monitoring Community");
         return ESP_FAIL;
     }
     
-    task_ret = xTaskCreate(
+#if CONFIG_APP_STATIC_MEMORY
+    sensor_task_handle = xTaskCreateStaticPinnedToCore(
         sensor_task,
         "sensor_task_community",
         SENSOR_TASK_STACK_SIZE,
         NULL,
         SENSOR_TASK_PRIORITY,
-        &sensor_task_handle
+        sensor_task_stack,
+        &sensor_task_tcb,
+        SENSOR_TASK_CORE
     );
+    task_ret = (sensor_task_handle != NULL) ? pdPASS : pdFAIL;
+#else
+    task_ret = xTaskCreatePinnedToCore(
+        sensor_task,
+        "sensor_task_community",
+        SENSOR_TASK_STACK_SIZE,
+        NULL,
+        SENSOR_TASK_PRIORITY,
+        &sensor_task_handle,
+        SENSOR_TASK_CORE
+    );
+#endif
     if (task_ret != pdPASS) {
         ESP_LOGE(TAG, "❌ Échec création tâche capteur");
         return ESP_FAIL;
     }
     
+#if CONFIG_TELEMETRY_ENABLE
+    // Remontée par lots chiffrés: non bloquante pour la sécurité locale
+    telemetry_config_t telemetry_config = {
+        .batch_interval_ms = CONFIG_TELEMETRY_BATCH_INTERVAL_MS,
+        .task_priority = TELEMETRY_TASK_PRIORITY,
+        .task_stack_size = TELEMETRY_TASK_STACK_SIZE,
+        .task_core = TELEMETRY_TASK_CORE
+    };
+    ret = telemetry_start(&telemetry_config);
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "⚠️ Télémétrie indisponible: %s", esp_err_to_name(ret));
+    }
+    
+#if CONFIG_ATTESTATION_UDP_RESPONDER
+    // Demandes des vérificateurs servies depuis le rapport en cache
+    ret = attestation_responder_start(ATTESTATION_RESPONDER_CORE);
+    if (ret != ESP_OK && ret != ESP_ERR_INVALID_STATE) {
+        ESP_LOGW(TAG, "⚠️ Répondeur d'attestation indisponible: %s", esp_err_to_name(ret));
+    }
+#endif
+#endif
+    
     // Configuration des timers (vérification moins fréquente en Community)
     esp_timer_create_args_t integrity_timer_args = {
         .callback = &integrity_check_timer_callback,
@@ -348,14 +813,174 @@ static esp_err_t init_tasks_and_timers(void) {
         return ret;
     }
     
+    esp_timer_create_args_t housekeeping_timer_args = {
+        .callback = &monitor_housekeeping_timer_callback,
+        .arg = NULL,
+        .name = "monitor_housekeeping_community"
+    };
+    
+    ret = esp_timer_create(&housekeeping_timer_args, &monitor_housekeeping_timer);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ Échec création timer maintenance monitoring: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    
+    ret = esp_timer_start_periodic(monitor_housekeeping_timer, (uint64_t)SECURITY_MONITOR_INTERVAL_MS * 1000);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "❌ Échec démarrage timer maintenance monitoring: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    
     ESP_LOGI(TAG, "✅ Tâches et timers Community initialisés");
     return ESP_OK;
 }
 
+#if CONFIG_POWER_DUTY_CYCLE
+// ================================
+// Cycle de sommeil profond (power_manager)
+// ================================
+
+/**
+ * @brief Réveil rapide: capteur, détection, anneau RTC
+ * 
+ * Ni NVS, ni réseau, ni crypto, ni vérification d'intégrité: le coût du
+ * cycle se limite au boot, à une lecture DHT22 et au scoring.
+ * 
+ * @return ESP_OK pour se rendormir, ESP_ERR_INVALID_STATE si une anomalie
+ *         impose un réveil complet immédiat, autre code si l'initialisation
+ *         minimale a échoué (réveil complet également)
+ */
+static esp_err_t duty_fast_cycle(void) {
+    esp_err_t ret = sensor_manager_init();
+    if (ret == ESP_OK) {
+        ret = anomaly_detector_basic_init();
+    }
+    if (ret == ESP_OK) {
+        ret = anomaly_detector_restore_state(&rtc_detector_state);
+    }
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    
+    sensor_data_t batch[SENSOR_MAX_INSTANCES];
+    size_t count = 0;
+    bool anomaly_seen = false;
+    
+    // Capteurs décalés à l'enregistrement: quelques passes courtes suffisent
+    for (int pass = 0; pass < POWER_FAST_WAKE_MAX_POLLS && count == 0; pass++) {
+        uint32_t next_wake_ms = 0;
+        ret = sensor_scheduler_poll(batch, SENSOR_MAX_INSTANCES, &count, &next_wake_ms);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "❌ Erreur lecture capteur: %s", esp_err_to_name(ret));
+            break;
+        }
+        if (count == 0) {
+            vTaskDelay(pdMS_TO_TICKS(next_wake_ms > 0 ? next_wake_ms : 1));
+        }
+    }
+    
+    for (size_t i = 0; i < count; i++) {
+        batch[i].timestamp = duty_cycle_now_ms();
+        anomaly_result_t anomaly = anomaly_detect(&batch[i]);
+        duty_cycle_append(&batch[i], anomaly.anomaly_score, anomaly.is_anomaly);
+        anomaly_seen |= anomaly.is_anomaly;
+    }
+    
+    anomaly_detector_save_state(&rtc_detector_state);
+    
+    if (anomaly_seen) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    dht22_retain_power_in_sleep();
+    return ESP_OK;
+}
+
+/**
+ * @brief Réveil complet: reprend l'historique du détecteur avant les tâches
+ */
+static void duty_restore_detector(void) {
+    if (anomaly_detector_restore_state(&rtc_detector_state) == ESP_OK) {
+        ESP_LOGI(TAG, "🔋 Historique du détecteur repris de la mémoire RTC");
+    }
+}
+
+/**
+ * @brief Réveil complet: rejoue les échantillons des réveils rapides
+ * 
+ * Déjà scorés: ils alimentent l'anneau (monitoring, télémétrie) et les
+ * anomalies signalées deviennent des événements de sécurité.
+ */
+static void duty_replay_rtc_samples(void) {
+    duty_cycle_sample_t samples[8];
+    uint32_t replayed = 0;
+    uint32_t anomalies = 0;
+    size_t count;
+    
+    while ((count = duty_cycle_drain(samples, ARRAY_SIZE(samples))) > 0) {
+        for (size_t i = 0; i < count; i++) {
+            const sensor_data_t *data = &samples[i].data;
+            sample_ring_push(data);
+            replayed++;
+            
+            if (samples[i].is_anomaly) {
+                anomaly_result_t result = {
+                    .is_anomaly = true,
+                    .anomaly_score = samples[i].anomaly_score,
+                    .timestamp = data->timestamp,
+                    .temperature = data->temperature,
+                    .humidity = data->humidity,
+                    .mode = anomaly_get_detection_mode()
+                };
+                security_event_t event;
+                security_event_from_anomaly(&event, &result, data->sensor_id, SECURITY_SEVERITY_MEDIUM);
+                post_security_event(&event);
+                anomalies++;
+            }
+        }
+    }
+    
+    if (replayed > 0) {
+        ESP_LOGI(TAG, "🔋 %lu échantillon(s) des réveils rapides rejoués, %lu anomalie(s)", replayed, anomalies);
+    }
+}
+
+/**
+ * @brief Réveil complet: fenêtre de traitement puis retour en sommeil
+ */
+static void duty_full_cycle_finish(void) {
+    // Première moitié: connexion WiFi; seconde: publication et vidage du journal
+    vTaskDelay(pdMS_TO_TICKS(POWER_FULL_WAKE_WINDOW_MS / 2));
+#if CONFIG_TELEMETRY_ENABLE
+    telemetry_flush();
+#endif
+    vTaskDelay(pdMS_TO_TICKS(POWER_FULL_WAKE_WINDOW_MS / 2));
+    
+    duty_cycle_print_energy();
+    
+    // Plus de scoring pendant la sauvegarde
+    vTaskSuspend(sensor_task_handle);
+    anomaly_detector_save_state(&rtc_detector_state);
+    dht22_retain_power_in_sleep();
+    
+    duty_cycle_sleep();
+}
+#endif
+
 /**
  * @brief Point d'entrée principal de l'application Community
  */
 void app_main(void) {
+#if CONFIG_POWER_DUTY_CYCLE
+    // Réveil rapide avant toute initialisation; une anomalie ou un échec bascule en réveil complet
+    if (duty_cycle_begin() == DUTY_WAKE_FAST) {
+        if (duty_fast_cycle() == ESP_OK) {
+            duty_cycle_sleep();         // Ne retourne pas
+        }
+        duty_cycle_escalate();
+    }
+#endif
+    
     ESP_LOGI(TAG, "🚀 === Démarrage SecureIoT-VIF Community Edition ===");
     
     // Initialisation de la mémoire NVS
@@ -398,6 +1023,19 @@ void app_main(void) {
         esp_restart();
     }
     
+#if CONFIG_BENCH_RUN_AT_BOOT
+    // Profil microbenchmarks: mesures sans tâches applicatives concurrentes
+    boot_scheduler_wait_deferred(BOOT_DEFERRED_TIMEOUT_MS);
+    boot_scheduler_print_timings();
+    bench_run_all();
+    ESP_LOGI(TAG, "🏁 Profil microbenchmarks - tâches applicatives non démarrées");
+    return;
+#endif
+    
+#if CONFIG_POWER_DUTY_CYCLE
+    duty_restore_detector();
+#endif
+    
     // Initialisation des tâches et timers
     ret = init_tasks_and_timers();
     if (ret != ESP_OK) {
@@ -405,10 +1043,40 @@ void app_main(void) {
         esp_restart();
     }
     
+#if CONFIG_POWER_DUTY_CYCLE
+    duty_replay_rtc_samples();
+#endif
+    
     ESP_LOGI(TAG, "🎉 === SecureIoT-VIF Community Edition Opérationnel ===");
     ESP_LOGI(TAG, "🎓 Framework éducatif et de recherche actif");
     ESP_LOGI(TAG, "💡 Idéal pour apprendre la sécurité IoT!");
     
+    // Vérification d'intégrité différée: l'échantillonnage tourne déjà
+    ret = boot_scheduler_wait_deferred(BOOT_DEFERRED_TIMEOUT_MS);
+    if (ret == ESP_OK) {
+#if CONFIG_POWER_DUTY_CYCLE
+        // Image revérifiée à chaque réveil complet: pas de balayage continu
+#else
+        start_integrity_sweep();
+#endif
+    } else {
+        // Barrière fermée: actions sensibles refusées, surveillance maintenue
+        ESP_LOGE(TAG, "❌ Vérification intégrité de démarrage non validée: %s", esp_err_to_name(ret));
+        
+        security_event_t event;
+        security_event_from_integrity(&event, (ret == ESP_ERR_TIMEOUT) ? INTEGRITY_ERROR : INTEGRITY_CORRUPTED,
+                                      0, SECURITY_SEVERITY_HIGH);
+        post_security_event(&event);
+    }
+    boot_scheduler_print_timings();
+    
+    // Tout est alloué: les rapports suivants comparent le tas à ce repère
+    perf_trace_heap_mark();
+    
+#if CONFIG_POWER_DUTY_CYCLE
+    duty_full_cycle_finish();
+#endif
+    
     // La boucle principale est gérée par les tâches FreeRTOS
 }
 
@@ -0,0 +1,175 @@
+#!/usr/bin/env python3
+"""
+Vérificateur d'attestation pour SecureIoT-VIF Community Edition
+Interroge le répondeur UDP du composant attestation et vérifie la signature
+ECDSA P-256 du rapport avec la clé publique enrôlée (affichée au démarrage
+du nœud). La fraîcheur repose sur la partie signée: le rapport doit contenir
+le défi de l'époque courante, tiré par le vérificateur et renouvelé toutes
+les --epoch secondes (au plus ce délai d'ancienneté). Le dernier numéro de
+séquence accepté est conservé par nœud (--state) et ne peut pas reculer.
+
+Format: components/attestation/include/attestation.h
+"""
+
+import os
+import sys
+import json
+import time
+import socket
+import struct
+import argparse
+from pathlib import Path
+
+REPORT_MAGIC = 0x52414953       # "SIAR"
+REPORT_VERSION = 1
+REQUEST_MAGIC = 0x51414953      # "SIAQ"
+NONCE_SIZE = 16
+MAX_CHALLENGES = 4
+REPORT_FORMAT = f"<IHHQII32s32sHHIIII{MAX_CHALLENGES * NONCE_SIZE}s"
+REPORT_SIZE = struct.calcsize(REPORT_FORMAT)
+FLAG_INTEGRITY_VERIFIED = 1 << 0
+FLAG_MANIFEST_READY = 1 << 1
+DEFAULT_PORT = 5685
+DEFAULT_EPOCH_S = 30
+DEFAULT_STATE = Path("attestation_state.json")
+
+
+def parse_response(data):
+    """Découpe une réponse: rapport (signé), signature DER, âge (ms, non signé)"""
+    if len(data) < REPORT_SIZE + 1:
+        raise ValueError(f"réponse trop courte ({len(data)} octets)")
+    report = data[:REPORT_SIZE]
+    sig_len = data[REPORT_SIZE]
+    offset = REPORT_SIZE + 1
+    if len(data) != offset + sig_len + 4:
+        raise ValueError("longueur de signature incohérente")
+    signature = data[offset:offset + sig_len]
+    (age_ms,) = struct.unpack_from("<I", data, offset + sig_len)
+    return report, signature, age_ms
+
+
+def decode_report(report):
+    (magic, version, flags, sequence, boot_count, uptime_s, app_sha, root, chunks, challenge_count,
+     incidents, integrity_failures, anomalies, violations, challenges) = struct.unpack(REPORT_FORMAT, report)
+    if magic != REPORT_MAGIC or version != REPORT_VERSION:
+        raise ValueError(f"rapport {magic:#x} v{version} non supporté")
+    if challenge_count > MAX_CHALLENGES:
+        raise ValueError(f"{challenge_count} défis annoncés")
+    return {
+        "challenges": [challenges[i * NONCE_SIZE:(i + 1) * NONCE_SIZE] for i in range(challenge_count)],
+        "flags": flags, "sequence": sequence, "boot_count": boot_count, "uptime_s": uptime_s,
+        "app_elf_sha256": app_sha.hex(), "manifest_root": root.hex(), "manifest_chunks": chunks,
+        "incidents_total": incidents, "integrity_failures": integrity_failures,
+        "anomalies_handled": anomalies, "security_violations": violations,
+    }
+
+
+def load_public_key(value):
+    from cryptography.hazmat.primitives.asymmetric import ec
+    path = Path(value)
+    text = path.read_text().strip() if path.exists() else value
+    return ec.EllipticCurvePublicKey.from_encoded_point(ec.SECP256R1(), bytes.fromhex(text))
+
+
+def load_state(path):
+    try:
+        return json.loads(path.read_text())
+    except (OSError, ValueError):
+        return {}
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Vérificateur d'attestation SecureIoT-VIF Community")
+    parser.add_argument("host", help="Adresse IPv4 du nœud")
+    parser.add_argument("--port", type=int, default=DEFAULT_PORT, help="Port UDP (CONFIG_ATTESTATION_UDP_PORT)")
+    parser.add_argument("--pubkey", required=True, help="Clé publique P-256 non compressée (hex ou fichier)")
+    parser.add_argument("--epoch", type=float, default=DEFAULT_EPOCH_S,
+                        help="Durée de vie d'un défi (s): ancienneté maximale d'un rapport accepté")
+    parser.add_argument("--state", type=Path, default=DEFAULT_STATE,
+                        help="Dernière séquence acceptée par nœud (JSON)")
+    parser.add_argument("--count", type=int, default=1, help="Nombre de demandes")
+    parser.add_argument("--interval", type=float, default=1.0, help="Secondes entre deux demandes")
+    parser.add_argument("--timeout", type=float, default=2.0, help="Attente d'une réponse (s)")
+    args = parser.parse_args()
+
+    try:
+        from cryptography.exceptions import InvalidSignature
+        from cryptography.hazmat.primitives import hashes
+        from cryptography.hazmat.primitives.asymmetric import ec
+    except ImportError:
+        print("❌ Module 'cryptography' requis: pip install cryptography")
+        return 1
+
+    try:
+        public_key = load_public_key(args.pubkey)
+    except (OSError, ValueError) as exc:
+        print(f"❌ Clé publique invalide: {exc}")
+        return 1
+
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.settimeout(args.timeout)
+
+    state = load_state(args.state)
+    device = f"{args.host}:{args.port}"
+    last_sequence = state.get(device, {}).get("sequence")
+
+    # Un défi par époque: les demandes de la même époque sont servies depuis le cache du nœud
+    nonce, epoch_start = None, 0.0
+    failures = 0
+    for i in range(args.count):
+        if i > 0:
+            time.sleep(args.interval)
+
+        if nonce is None or time.monotonic() - epoch_start >= args.epoch:
+            nonce, epoch_start = os.urandom(NONCE_SIZE), time.monotonic()
+        start = time.monotonic()
+        sock.sendto(struct.pack("<I", REQUEST_MAGIC) + nonce, (args.host, args.port))
+        try:
+            data, _ = sock.recvfrom(2048)
+            rtt_ms = (time.monotonic() - start) * 1000.0
+            report, signature, age_ms = parse_response(data)
+            public_key.verify(signature, report, ec.ECDSA(hashes.SHA256()))
+            fields = decode_report(report)
+            if nonce not in fields["challenges"]:
+                raise ValueError("défi de l'époque absent du rapport signé (rejeu ou réponse d'un autre vérificateur)")
+        except socket.timeout:
+            print(f"⚠️ Pas de réponse de {args.host}:{args.port}")
+            failures += 1
+            continue
+        except InvalidSignature:
+            print("❌ Signature du rapport invalide")
+            failures += 1
+            continue
+        except ValueError as exc:
+            print(f"❌ Réponse rejetée: {exc}")
+            failures += 1
+            continue
+
+        verdicts = []
+        if last_sequence is not None and fields["sequence"] < last_sequence:
+            verdicts.append("séquence en recul (état du nœud restauré)")
+        if not fields["flags"] & FLAG_INTEGRITY_VERIFIED:
+            verdicts.append("intégrité de démarrage non vérifiée")
+        if last_sequence is None or fields["sequence"] > last_sequence:
+            last_sequence = fields["sequence"]
+            state[device] = {"sequence": last_sequence}
+            args.state.write_text(json.dumps(state, indent=2))
+
+        boot, report_index = fields["sequence"] >> 32, fields["sequence"] & 0xFFFFFFFF
+        status = "❌ " + ", ".join(verdicts) if verdicts else "✅ rapport valide"
+        print(f"{status}: séquence {boot}.{report_index}, signé après le défi émis il y a "
+              f"{time.monotonic() - epoch_start:.1f} s, RTT {rtt_ms:.1f} ms, "
+              f"démarrage #{fields['boot_count']}, uptime {fields['uptime_s']} s (âge annoncé {age_ms} ms, non signé)")
+        root = fields["manifest_root"][:16] + "..." if fields["flags"] & FLAG_MANIFEST_READY else "non prête"
+        print(f"   firmware {fields['app_elf_sha256'][:16]}..., racine manifeste {root} "
+              f"({fields['manifest_chunks']} chunks)")
+        print(f"   incidents {fields['incidents_total']} (intégrité {fields['integrity_failures']}, "
+              f"anomalies {fields['anomalies_handled']}, violations {fields['security_violations']})")
+        if verdicts:
+            failures += 1
+
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
\ No newline at end of file
@@ -0,0 +1,174 @@
+#!/usr/bin/env python3
+"""
+Collecteur de microbenchmarks pour SecureIoT-VIF Community Edition
+Lit les lignes BENCH_JSON émises par le firmware (profil configs/bench.config),
+enregistre les résultats et signale les régressions par rapport à une baseline.
+
+La baseline (tests/bench_baseline.json par défaut) dépend de la carte et de
+sa configuration: elle n'est pas livrée. La générer une fois sur la carte de
+référence, puis la versionner:
+
+    python tools/bench_collect.py --port /dev/ttyUSB0 --update-baseline
+"""
+
+import sys
+import json
+import time
+import argparse
+from pathlib import Path
+
+BENCH_PREFIX = "BENCH_JSON "
+DEFAULT_BASELINE = Path(__file__).resolve().parent.parent / "tests" / "bench_baseline.json"
+DEFAULT_TOLERANCE = 10.0  # Pourcentage de dégradation toléré
+
+
+def parse_line(line):
+    """Extrait l'objet JSON d'une ligne BENCH_JSON (None sinon)"""
+    index = line.find(BENCH_PREFIX)
+    if index < 0:
+        return None
+    try:
+        return json.loads(line[index + len(BENCH_PREFIX):])
+    except json.JSONDecodeError:
+        print(f"⚠️ Ligne BENCH_JSON illisible: {line.strip()}")
+        return None
+
+
+def collect_from_lines(lines):
+    """Agrège les mesures jusqu'à la ligne de fin"""
+    results = {"meta": {}, "metrics": {}, "errors": {}, "failures": None}
+
+    for line in lines:
+        record = parse_line(line)
+        if record is None:
+            continue
+
+        suite = record.get("suite")
+        if suite == "meta":
+            results["meta"] = {k: v for k, v in record.items() if k != "suite"}
+        elif suite == "done":
+            results["failures"] = record.get("failures", 0)
+            break
+        elif "error" in record:
+            results["errors"][f"{suite}.{record['name']}"] = record["error"]
+            print(f"❌ {suite}.{record['name']}: {record['error']}")
+        else:
+            key = f"{suite}.{record['name']}"
+            results["metrics"][key] = {
+                "value": record["value"],
+                "unit": record["unit"],
+                "better": record["better"],
+            }
+            print(f"📊 {key:40s} {record['value']:12.3f} {record['unit']}")
+
+    return results
+
+
+def serial_lines(port, baudrate, timeout):
+    """Générateur de lignes depuis le port série"""
+    try:
+        import serial
+    except ImportError:
+        print("❌ pyserial requis: pip install -r requirements.txt")
+        sys.exit(2)
+
+    deadline = time.time() + timeout
+    with serial.Serial(port, baudrate, timeout=1) as ser:
+        # Redémarrage de la carte pour lancer les suites depuis le boot
+        ser.setDTR(False)
+        ser.setRTS(True)
+        time.sleep(0.1)
+        ser.setRTS(False)
+
+        while time.time() < deadline:
+            raw = ser.readline()
+            if raw:
+                yield raw.decode("utf-8", errors="ignore")
+
+    print(f"⏰ Timeout après {timeout}s sans ligne de fin")
+
+
+def compare(results, baseline, tolerance):
+    """Compare aux valeurs de référence, retourne la liste des régressions"""
+    regressions = []
+
+    for key, ref in baseline.get("metrics", {}).items():
+        current = results["metrics"].get(key)
+        if current is None:
+            print(f"⚠️ {key}: absent des résultats")
+            regressions.append(key)
+            continue
+
+        ref_value = ref["value"]
+        value = current["value"]
+        if ref_value == 0:
+            continue
+
+        if ref["better"] == "higher":
+            delta = (ref_value - value) / ref_value * 100.0
+        else:
+            delta = (value - ref_value) / ref_value * 100.0
+
+        if delta > tolerance:
+            print(f"🔻 {key}: {value:.3f} vs {ref_value:.3f} {ref['unit']} ({delta:.1f}% moins bien)")
+            regressions.append(key)
+        elif delta < -tolerance:
+            print(f"🔺 {key}: {value:.3f} vs {ref_value:.3f} {ref['unit']} ({-delta:.1f}% mieux)")
+
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Collecteur de microbenchmarks SecureIoT-VIF Community")
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument("--port", help="Port série de la carte (ex: /dev/ttyUSB0)")
+    source.add_argument("--log", type=Path, help="Lire un log série déjà capturé")
+    parser.add_argument("--baudrate", type=int, default=115200, help="Vitesse du port série")
+    parser.add_argument("--timeout", type=int, default=300, help="Durée maximale de collecte (s)")
+    parser.add_argument("--output", type=Path, help="Fichier JSON de résultats")
+    parser.add_argument("--baseline", type=Path, default=DEFAULT_BASELINE, help="Baseline de référence")
+    parser.add_argument("--tolerance", type=float, default=DEFAULT_TOLERANCE,
+                        help="Dégradation tolérée en pourcentage")
+    parser.add_argument("--update-baseline", action="store_true",
+                        help="Remplacer la baseline par les résultats collectés")
+    args = parser.parse_args()
+
+    print("🏁 Collecte des microbenchmarks SecureIoT-VIF Community...")
+    if args.log:
+        with open(args.log, "r", encoding="utf-8", errors="ignore") as f:
+            results = collect_from_lines(f)
+    else:
+        results = collect_from_lines(serial_lines(args.port, args.baudrate, args.timeout))
+
+    if results["failures"] is None:
+        print("❌ Ligne de fin BENCH_JSON non reçue - collecte incomplète")
+        return 2
+
+    if args.output:
+        args.output.write_text(json.dumps(results, indent=2, ensure_ascii=False))
+        print(f"💾 Résultats enregistrés: {args.output}")
+
+    if args.update_baseline:
+        args.baseline.write_text(json.dumps(results, indent=2, ensure_ascii=False))
+        print(f"📌 Baseline mise à jour: {args.baseline}")
+        return 0
+
+    if not args.baseline.exists():
+        print(f"⚠️ Baseline absente ({args.baseline}) - générez-la avec --update-baseline")
+        return 0
+
+    baseline = json.loads(args.baseline.read_text())
+    if baseline.get("meta") and baseline["meta"] != results["meta"]:
+        print(f"⚠️ Contexte différent de la baseline: {baseline['meta']} vs {results['meta']}")
+
+    regressions = compare(results, baseline, args.tolerance)
+    if regressions or results["failures"]:
+        print(f"❌ {len(regressions)} régression(s), {results['failures']} suite(s) en échec")
+        return 1
+
+    print(f"✅ Aucune régression au-delà de {args.tolerance:.0f}%")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
\ No newline at end of file
@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+"""
+Générateur de manifeste OTA pour SecureIoT-VIF Community Edition
+Produit, pour une image applicative (.bin esptool), le manifeste de
+chunks livré avec la mise à jour: en-tête + condensats SHA-256 des chunks
+de 8 Ko + racine de Merkle (RFC 6962). Le module integrity_ota n'en relit
+que les chunks dont le condensat change par rapport à l'image courante.
+
+Format: components/firmware_verification/include/integrity_manifest.h
+"""
+
+import sys
+import struct
+import hashlib
+import argparse
+from pathlib import Path
+
+MANIFEST_MAGIC = 0x4D464953     # "SIFM"
+MANIFEST_VERSION = 1
+CHUNK_SIZE = 8192
+MAX_CHUNKS = 256
+HEADER_FORMAT = "<IHHII32s32s"
+APP_DESC_OFFSET = 32            # En-tête d'image (24) + en-tête du premier segment (8)
+APP_DESC_MAGIC = 0xABCD5432
+APP_ELF_SHA256_OFFSET = APP_DESC_OFFSET + 144
+
+
+def chunk_digests(image):
+    """Condensats des chunks couverts par le manifeste"""
+    count = min((len(image) + CHUNK_SIZE - 1) // CHUNK_SIZE, MAX_CHUNKS)
+    return [hashlib.sha256(image[i * CHUNK_SIZE:(i + 1) * CHUNK_SIZE]).digest() for i in range(count)]
+
+
+def merkle_root(leaves):
+    """Racine RFC 6962: nœud = SHA256(0x01 || gauche || droite), feuilles = condensats des chunks"""
+    if len(leaves) == 1:
+        return leaves[0]
+    split = 1
+    while split * 2 < len(leaves):
+        split *= 2
+    return hashlib.sha256(b"\x01" + merkle_root(leaves[:split]) + merkle_root(leaves[split:])).digest()
+
+
+def app_elf_sha256(image):
+    """SHA-256 de l'ELF lu dans esp_app_desc_t (identité de l'image)"""
+    if len(image) < APP_ELF_SHA256_OFFSET + 32:
+        raise ValueError("image trop courte")
+    (magic,) = struct.unpack_from("<I", image, APP_DESC_OFFSET)
+    if magic != APP_DESC_MAGIC:
+        raise ValueError("esp_app_desc_t introuvable")
+    return image[APP_ELF_SHA256_OFFSET:APP_ELF_SHA256_OFFSET + 32]
+
+
+def build_manifest(image):
+    digests = chunk_digests(image)
+    header = struct.pack(HEADER_FORMAT, MANIFEST_MAGIC, MANIFEST_VERSION, len(digests), CHUNK_SIZE,
+                         len(image), app_elf_sha256(image), merkle_root(digests))
+    return header + b"".join(digests), digests
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Manifeste de chunks d'une image OTA SecureIoT-VIF")
+    parser.add_argument("image", type=Path, help="Image applicative (.bin)")
+    parser.add_argument("-o", "--output", type=Path, help="Fichier manifeste (défaut: <image>.manifest)")
+    parser.add_argument("--previous", type=Path, help="Image actuellement déployée, pour estimer le delta")
+    args = parser.parse_args()
+
+    try:
+        blob, digests = build_manifest(args.image.read_bytes())
+    except (OSError, ValueError) as exc:
+        print(f"❌ {args.image}: {exc}")
+        return 1
+
+    output = args.output or args.image.with_suffix(".manifest")
+    output.write_bytes(blob)
+    print(f"📦 {output}: {len(digests)} chunks, {len(blob)} octets, racine {merkle_root(digests).hex()[:16]}...")
+
+    if args.previous:
+        previous = chunk_digests(args.previous.read_bytes())
+        changed = sum(1 for i, d in enumerate(digests) if i >= len(previous) or previous[i] != d)
+        print(f"🔄 Delta: {changed}/{len(digests)} chunks à vérifier ({changed * CHUNK_SIZE // 1024} Ko max)")
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
\ No newline at end of file
@@ -0,0 +1,126 @@
+#!/usr/bin/env python3
+"""
+Comparaison des profils de build pour SecureIoT-VIF Community Edition
+Construit chaque profil (main/Kconfig.projbuild) dans son propre répertoire,
+relève l'occupation flash/RAM (idf.py size) et l'écart au profil de
+développement. Avec des résultats de bench_collect.py par profil, ajoute le
+coût en cycles des chemins chauds (scoring d'anomalies, IV, crypto).
+
+Usage:
+  python tools/profile_report.py
+  python tools/profile_report.py --bench development=dev.json --bench production-minimal=prod.json
+"""
+
+import sys
+import json
+import argparse
+import subprocess
+from pathlib import Path
+
+PROJECT_DIR = Path(__file__).resolve().parent.parent
+REFERENCE = "development"
+PROFILES = {
+    "development": ["sdkconfig.defaults"],
+    "production-minimal": ["sdkconfig.defaults", "configs/production-minimal.config"],
+}
+HOT_PATH_SUITES = ("anomaly", "random", "sha256", "aes_gcm")
+
+# Clés de idf.py size --format json (noms ESP-IDF v4.4 et v5)
+FLASH_KEYS = ("total_size",)
+RAM_KEYS = ("used_dram", "used_iram")
+
+
+def build_dir(profile):
+    return PROJECT_DIR / "build" / f"profile-{profile}"
+
+
+def run_idf(profile, *args):
+    directory = build_dir(profile)
+    defaults = ";".join(str(PROJECT_DIR / f) for f in PROFILES[profile])
+    command = ["idf.py", "-C", str(PROJECT_DIR), "-B", str(directory),
+               "-D", f"SDKCONFIG={directory / 'sdkconfig'}",
+               "-D", f"SDKCONFIG_DEFAULTS={defaults}", *args]
+    return subprocess.run(command, check=True, capture_output=True, text=True).stdout
+
+
+def measure_size(profile, skip_build):
+    """Occupation flash/RAM d'un profil (octets)"""
+    if not skip_build:
+        print(f"🔨 Build du profil {profile}...")
+        run_idf(profile, "build")
+    output = run_idf(profile, "size", "--format", "json")
+    sizes = json.loads(output[output.index("{"):])
+    return {
+        "flash": sum(sizes.get(k, 0) for k in FLASH_KEYS),
+        "ram": sum(sizes.get(k, 0) for k in RAM_KEYS),
+    }
+
+
+def load_cycles(path):
+    """Coût en cycles des métriques en ns des suites chaudes (bench_collect.py --output)"""
+    results = json.loads(Path(path).read_text())
+    cpu_mhz = results.get("meta", {}).get("cpu_mhz", 240)
+    cycles = {}
+    for key, metric in results.get("metrics", {}).items():
+        if key.split(".")[0] in HOT_PATH_SUITES and metric["unit"].startswith("ns"):
+            cycles[key] = metric["value"] * cpu_mhz / 1000.0
+    return cycles
+
+
+def saving(reference, value):
+    if reference == 0:
+        return "-"
+    return f"{(reference - value) / reference * 100.0:+.1f}%"
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Gains flash/RAM et cycles des profils de build SecureIoT-VIF")
+    parser.add_argument("--skip-build", action="store_true", help="Réutiliser les builds existants")
+    parser.add_argument("--bench", action="append", default=[], metavar="PROFIL=FICHIER",
+                        help="Résultats bench_collect.py d'un profil (répétable)")
+    parser.add_argument("--output", type=Path, help="Rapport JSON")
+    args = parser.parse_args()
+
+    report = {"sizes": {}, "cycles": {}}
+    try:
+        for profile in PROFILES:
+            report["sizes"][profile] = measure_size(profile, args.skip_build)
+    except (OSError, subprocess.CalledProcessError, ValueError) as exc:
+        print(f"❌ Mesure de taille impossible (environnement ESP-IDF requis): {exc}")
+        return 1
+
+    ref = report["sizes"][REFERENCE]
+    print(f"\n📦 {'Profil':22s} {'Flash':>10s} {'Gain':>8s} {'RAM':>10s} {'Gain':>8s}")
+    for profile, size in report["sizes"].items():
+        print(f"   {profile:22s} {size['flash']:10d} {saving(ref['flash'], size['flash']):>8s} "
+              f"{size['ram']:10d} {saving(ref['ram'], size['ram']):>8s}")
+
+    for entry in args.bench:
+        profile, _, path = entry.partition("=")
+        if profile not in PROFILES or not path:
+            print(f"⚠️ --bench {entry}: attendu PROFIL=FICHIER avec PROFIL parmi {', '.join(PROFILES)}")
+            continue
+        report["cycles"][profile] = load_cycles(path)
+
+    ref_cycles = report["cycles"].get(REFERENCE)
+    if ref_cycles:
+        print(f"\n⏱️ {'Chemin chaud':32s} " + " ".join(f"{p:>22s}" for p in report["cycles"]))
+        for key, ref_value in sorted(ref_cycles.items()):
+            cells = []
+            for profile, cycles in report["cycles"].items():
+                value = cycles.get(key)
+                cells.append(f"{'-':>22s}" if value is None else
+                             f"{value:10.0f} cyc {saving(ref_value, value):>8s}")
+            print(f"   {key:32s} " + " ".join(cells))
+    elif args.bench:
+        print(f"⚠️ Résultats du profil de référence '{REFERENCE}' requis pour les gains en cycles")
+
+    if args.output:
+        args.output.write_text(json.dumps(report, indent=2, ensure_ascii=False))
+        print(f"💾 Rapport enregistré: {args.output}")
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
\ No newline at end of file
@@ -0,0 +1,168 @@
+#!/usr/bin/env python3
+"""
+Collecteur de télémétrie pour SecureIoT-VIF Community Edition
+Reçoit les trames UDP du composant telemetry (profil configs/telemetry.config),
+les authentifie et déchiffre (AES-128-GCM), décode les échantillons et les
+affiche ou les ajoute à un fichier CSV.
+
+Format: components/telemetry/include/telemetry_frame.h
+"""
+
+import sys
+import socket
+import struct
+import argparse
+from pathlib import Path
+
+HEADER_SIZE = 22
+TAG_SIZE = 16
+FRAME_VERSION = 1
+SENSOR_MAX_INSTANCES = 8
+DEFAULT_PORT = 5684
+DEFAULT_KEY = "2b7e151628aed2a6abf7158809cf4f3c"
+
+
+def read_varint(data, offset):
+    """Lit un varint LEB128, retourne (valeur, nouvel offset)"""
+    value = 0
+    for i in range(5):
+        if offset >= len(data):
+            break
+        byte = data[offset]
+        offset += 1
+        value |= (byte & 0x7F) << (7 * i)
+        if not byte & 0x80:
+            return value, offset
+    raise ValueError("varint tronqué")
+
+
+def zigzag(value):
+    return (value >> 1) ^ -(value & 1)
+
+
+def parse_header(frame):
+    """Décode l'en-tête en clair (aussi AAD du chiffrement)"""
+    if len(frame) < HEADER_SIZE + TAG_SIZE:
+        raise ValueError(f"trame trop courte ({len(frame)} octets)")
+    version, count, sequence = struct.unpack_from("<BBI", frame, 0)
+    if version != FRAME_VERSION:
+        raise ValueError(f"version {version} non supportée")
+    iv_prefix = frame[6:14]
+    base_ts = struct.unpack_from("<Q", frame, 14)[0]
+    return count, sequence, iv_prefix, base_ts
+
+
+def decode_payload(payload, count, base_ts):
+    """Reconstruit les échantillons (deltas par capteur, dixièmes)"""
+    last_temp = [0] * SENSOR_MAX_INSTANCES
+    last_hum = [0] * SENSOR_MAX_INSTANCES
+    timestamp = base_ts
+    offset = 0
+    samples = []
+
+    for _ in range(count):
+        sensor_id, offset = read_varint(payload, offset)
+        delta_ts, offset = read_varint(payload, offset)
+        delta_temp, offset = read_varint(payload, offset)
+        delta_hum, offset = read_varint(payload, offset)
+        if sensor_id >= SENSOR_MAX_INSTANCES or offset >= len(payload):
+            raise ValueError("échantillon invalide")
+        quality = payload[offset]
+        offset += 1
+
+        timestamp += zigzag(delta_ts)
+        last_temp[sensor_id] += zigzag(delta_temp)
+        last_hum[sensor_id] += zigzag(delta_hum)
+        samples.append({
+            "sensor_id": sensor_id,
+            "timestamp_ms": timestamp,
+            "temperature": last_temp[sensor_id] / 10.0,
+            "humidity": last_hum[sensor_id] / 10.0,
+            "quality": quality,
+        })
+
+    if offset != len(payload):
+        raise ValueError("octets résiduels en fin de trame")
+    return samples
+
+
+def decrypt_frame(aesgcm, frame):
+    """Authentifie et décode une trame complète"""
+    count, sequence, iv_prefix, base_ts = parse_header(frame)
+    iv = iv_prefix + struct.pack(">I", sequence)
+    header = frame[:HEADER_SIZE]
+    # cryptography attend le tag à la suite du texte chiffré, comme sur le fil
+    payload = aesgcm.decrypt(iv, frame[HEADER_SIZE:], header)
+    return sequence, decode_payload(payload, count, base_ts)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Collecteur de télémétrie SecureIoT-VIF Community")
+    parser.add_argument("--bind", default="0.0.0.0", help="Adresse d'écoute")
+    parser.add_argument("--port", type=int, default=DEFAULT_PORT, help="Port UDP")
+    parser.add_argument("--key", default=DEFAULT_KEY, help="Clé AES-128 (CONFIG_TELEMETRY_KEY_HEX)")
+    parser.add_argument("--csv", type=Path, help="Fichier CSV de sortie (ajout)")
+    args = parser.parse_args()
+
+    try:
+        from cryptography.hazmat.primitives.ciphers.aead import AESGCM
+    except ImportError:
+        print("❌ Module 'cryptography' requis: pip install cryptography")
+        return 1
+
+    key = bytes.fromhex(args.key)
+    if len(key) != 16:
+        print("❌ Clé AES-128 attendue (32 caractères hexadécimaux)")
+        return 1
+    aesgcm = AESGCM(key)
+
+    csv_file = None
+    if args.csv:
+        new_file = not args.csv.exists()
+        csv_file = args.csv.open("a")
+        if new_file:
+            csv_file.write("source,sequence,sensor_id,timestamp_ms,temperature,humidity,quality\n")
+
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.bind((args.bind, args.port))
+    print(f"📡 Écoute UDP {args.bind}:{args.port}")
+
+    frames = 0
+    samples_total = 0
+    bytes_total = 0
+    try:
+        while True:
+            frame, source = sock.recvfrom(2048)
+            try:
+                sequence, samples = decrypt_frame(aesgcm, frame)
+            except Exception as exc:
+                print(f"⚠️ Trame rejetée de {source[0]}: {exc or 'authentification échouée'}")
+                continue
+
+            frames += 1
+            samples_total += len(samples)
+            bytes_total += len(frame)
+            print(f"📥 {source[0]} trame {sequence}: {len(samples)} échantillons, {len(frame)} octets "
+                  f"({bytes_total / samples_total:.1f} octets/échantillon en moyenne)")
+
+            for sample in samples:
+                if csv_file:
+                    csv_file.write(f"{source[0]},{sequence},{sample['sensor_id']},{sample['timestamp_ms']},"
+                                   f"{sample['temperature']:.1f},{sample['humidity']:.1f},{sample['quality']}\n")
+                else:
+                    print(f"   capteur {sample['sensor_id']} t={sample['timestamp_ms']} ms "
+                          f"T={sample['temperature']:.1f}°C H={sample['humidity']:.1f}% Q={sample['quality']}")
+            if csv_file:
+                csv_file.flush()
+    except KeyboardInterrupt:
+        print(f"\n📊 {frames} trames, {samples_total} échantillons reçus")
+    finally:
+        sock.close()
+        if csv_file:
+            csv_file.close()
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
\ No newline at end of file